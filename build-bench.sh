@@ -0,0 +1,2 @@
+#!/bin/sh
+gcc ssfbench.c ssfjson.c ssfcbor.c ssfbase64.c ssfhex.c ssfaes.c ssfaesgcm.c ssfbfifo.c ssfport.c -Wall -Wextra -pedantic -Wcast-align -Wno-parentheses -Wno-unused -Wdisabled-optimization -fdiagnostics-show-option -Wstrict-overflow=5 -Wformat=2 -lm -lpthread -O2 -o ssfbench
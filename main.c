@@ -49,6 +49,7 @@
 #include "ssfaesgcm.h"
 #include "ssfcfg.h"
 #include "ssfprng.h"
+#include "ssfcbor.h"
 
 /* --------------------------------------------------------------------------------------------- */
 /* SSF unit test entry point.                                                                    */
@@ -123,5 +124,9 @@ int main(void)
     SSFPRNGUnitTest();
 #endif /* SSF_CONFIG_TLV_UNIT_TEST */
 
+#if SSF_CONFIG_CBOR_UNIT_TEST == 1
+    SSFCborUnitTest();
+#endif /* SSF_CONFIG_CBOR_UNIT_TEST */
+
     return 0;
 }
@@ -80,6 +80,26 @@
 #include "ssfport.h"
 #include "ssfassert.h"
 #include "ssfaes.h"
+#if SSF_AES_NI == 1
+#include <emmintrin.h>
+#include <wmmintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif /* _MSC_VER */
+#endif /* SSF_AES_NI */
+
+#define SSF_AES_MAGIC (0x41455343u)
+
+#if SSF_AES_DEC_SCHEDULE == 1
+#define CONTEXT_DW(c) ((c)->dw)
+#else
+#define CONTEXT_DW(c) NULL
+#endif /* SSF_AES_DEC_SCHEDULE */
+
+#define SSF_AES_BSWAP32(x) (((x) >> 24) | (((x) >> 8) & 0xff00ul) | (((x) & 0xff00ul) << 8) | \
+    ((x) << 24))
 
 #define FGFM2(x) ((x<<1) ^ (0x1b & -(x>>7)))
 
@@ -92,8 +112,8 @@
 #define SBOX_STATE(s) BOX_STATE(s, sbox)
 #define INV_SBOX_STATE(s) BOX_STATE(s, inv_sbox)
 
-#define SBOX_WORD(x) (sbox[(x & 0xff)] ^ (sbox[((x >> 8) & 0xff)] << 8) \
-    ^ (sbox[((x >> 16) & 0xff)] << 16) ^ (sbox[((x >> 24) & 0xff)] << 24))
+#define SBOX_WORD(x) ((uint32_t)sbox[(x & 0xff)] ^ ((uint32_t)sbox[((x >> 8) & 0xff)] << 8) \
+    ^ ((uint32_t)sbox[((x >> 16) & 0xff)] << 16) ^ ((uint32_t)sbox[((x >> 24) & 0xff)] << 24))
 
 #define SHIFT_ROWS(s, t) \
     t = s[1][0]; s[1][0] = s[1][1]; s[1][1] = s[1][2]; s[1][2] = s[1][3]; s[1][3] = t; \
@@ -169,6 +189,27 @@
     a[2] = s[2][0]; a[6] = s[2][1]; a[10] = s[2][2]; a[14] = s[2][3]; \
     a[3] = s[3][0]; a[7] = s[3][1]; a[11] = s[3][2]; a[15] = s[3][3]
 
+#define GET_COL(a, c) ((uint32_t)a[(c) << 2] ^ ((uint32_t)a[((c) << 2) + 1] << 8) ^ \
+    ((uint32_t)a[((c) << 2) + 2] << 16) ^ ((uint32_t)a[((c) << 2) + 3] << 24))
+
+#define PUT_COL(a, c, x) \
+    a[(c) << 2] = (uint8_t)(x); a[((c) << 2) + 1] = (uint8_t)((x) >> 8); \
+    a[((c) << 2) + 2] = (uint8_t)((x) >> 16); a[((c) << 2) + 3] = (uint8_t)((x) >> 24)
+
+#if SSF_AES_CONFIG_CIPHER == 1
+#define ROTL32(x, n) (((x) << (n)) | ((x) >> (32 - (n))))
+
+/* Combined SubBytes, ShiftRows and MixColumns of the column taking row r from word r */
+#define TE_COL(a, b, c, d) (te0[(a) & 0xff] ^ ROTL32(te0[((b) >> 8) & 0xff], 8) ^ \
+    ROTL32(te0[((c) >> 16) & 0xff], 16) ^ ROTL32(te0[(d) >> 24], 24))
+
+#define TD_COL(a, b, c, d) (td0[(a) & 0xff] ^ ROTL32(td0[((b) >> 8) & 0xff], 8) ^ \
+    ROTL32(td0[((c) >> 16) & 0xff], 16) ^ ROTL32(td0[(d) >> 24], 24))
+
+#define BOX_COL(x, a, b, c, d) ((uint32_t)x[(a) & 0xff] ^ ((uint32_t)x[((b) >> 8) & 0xff] << 8) ^ \
+    ((uint32_t)x[((c) >> 16) & 0xff] << 16) ^ ((uint32_t)x[(d) >> 24] << 24))
+#endif /* SSF_AES_CONFIG_CIPHER */
+
 
 static const uint8_t sbox[256] =
 {
@@ -210,11 +251,543 @@ static const uint8_t inv_sbox[256] =
     0x17, 0x2b, 0x04, 0x7e, 0xba, 0x77, 0xd6, 0x26, 0xe1, 0x69, 0x14, 0x63, 0x55, 0x21, 0x0c, 0x7d
 };
 
+#if SSF_AES_CONFIG_CIPHER == 1
+/* sbox[x] times MixColumns column {2, 1, 1, 3}, row 0 in the least significant byte */
+static const uint32_t te0[256] =
+{
+    0xa56363c6, 0x847c7cf8, 0x997777ee, 0x8d7b7bf6, 0x0df2f2ff, 0xbd6b6bd6, 0xb16f6fde, 0x54c5c591,
+    0x50303060, 0x03010102, 0xa96767ce, 0x7d2b2b56, 0x19fefee7, 0x62d7d7b5, 0xe6abab4d, 0x9a7676ec,
+    0x45caca8f, 0x9d82821f, 0x40c9c989, 0x877d7dfa, 0x15fafaef, 0xeb5959b2, 0xc947478e, 0x0bf0f0fb,
+    0xecadad41, 0x67d4d4b3, 0xfda2a25f, 0xeaafaf45, 0xbf9c9c23, 0xf7a4a453, 0x967272e4, 0x5bc0c09b,
+    0xc2b7b775, 0x1cfdfde1, 0xae93933d, 0x6a26264c, 0x5a36366c, 0x413f3f7e, 0x02f7f7f5, 0x4fcccc83,
+    0x5c343468, 0xf4a5a551, 0x34e5e5d1, 0x08f1f1f9, 0x937171e2, 0x73d8d8ab, 0x53313162, 0x3f15152a,
+    0x0c040408, 0x52c7c795, 0x65232346, 0x5ec3c39d, 0x28181830, 0xa1969637, 0x0f05050a, 0xb59a9a2f,
+    0x0907070e, 0x36121224, 0x9b80801b, 0x3de2e2df, 0x26ebebcd, 0x6927274e, 0xcdb2b27f, 0x9f7575ea,
+    0x1b090912, 0x9e83831d, 0x742c2c58, 0x2e1a1a34, 0x2d1b1b36, 0xb26e6edc, 0xee5a5ab4, 0xfba0a05b,
+    0xf65252a4, 0x4d3b3b76, 0x61d6d6b7, 0xceb3b37d, 0x7b292952, 0x3ee3e3dd, 0x712f2f5e, 0x97848413,
+    0xf55353a6, 0x68d1d1b9, 0x00000000, 0x2cededc1, 0x60202040, 0x1ffcfce3, 0xc8b1b179, 0xed5b5bb6,
+    0xbe6a6ad4, 0x46cbcb8d, 0xd9bebe67, 0x4b393972, 0xde4a4a94, 0xd44c4c98, 0xe85858b0, 0x4acfcf85,
+    0x6bd0d0bb, 0x2aefefc5, 0xe5aaaa4f, 0x16fbfbed, 0xc5434386, 0xd74d4d9a, 0x55333366, 0x94858511,
+    0xcf45458a, 0x10f9f9e9, 0x06020204, 0x817f7ffe, 0xf05050a0, 0x443c3c78, 0xba9f9f25, 0xe3a8a84b,
+    0xf35151a2, 0xfea3a35d, 0xc0404080, 0x8a8f8f05, 0xad92923f, 0xbc9d9d21, 0x48383870, 0x04f5f5f1,
+    0xdfbcbc63, 0xc1b6b677, 0x75dadaaf, 0x63212142, 0x30101020, 0x1affffe5, 0x0ef3f3fd, 0x6dd2d2bf,
+    0x4ccdcd81, 0x140c0c18, 0x35131326, 0x2fececc3, 0xe15f5fbe, 0xa2979735, 0xcc444488, 0x3917172e,
+    0x57c4c493, 0xf2a7a755, 0x827e7efc, 0x473d3d7a, 0xac6464c8, 0xe75d5dba, 0x2b191932, 0x957373e6,
+    0xa06060c0, 0x98818119, 0xd14f4f9e, 0x7fdcdca3, 0x66222244, 0x7e2a2a54, 0xab90903b, 0x8388880b,
+    0xca46468c, 0x29eeeec7, 0xd3b8b86b, 0x3c141428, 0x79dedea7, 0xe25e5ebc, 0x1d0b0b16, 0x76dbdbad,
+    0x3be0e0db, 0x56323264, 0x4e3a3a74, 0x1e0a0a14, 0xdb494992, 0x0a06060c, 0x6c242448, 0xe45c5cb8,
+    0x5dc2c29f, 0x6ed3d3bd, 0xefacac43, 0xa66262c4, 0xa8919139, 0xa4959531, 0x37e4e4d3, 0x8b7979f2,
+    0x32e7e7d5, 0x43c8c88b, 0x5937376e, 0xb76d6dda, 0x8c8d8d01, 0x64d5d5b1, 0xd24e4e9c, 0xe0a9a949,
+    0xb46c6cd8, 0xfa5656ac, 0x07f4f4f3, 0x25eaeacf, 0xaf6565ca, 0x8e7a7af4, 0xe9aeae47, 0x18080810,
+    0xd5baba6f, 0x887878f0, 0x6f25254a, 0x722e2e5c, 0x241c1c38, 0xf1a6a657, 0xc7b4b473, 0x51c6c697,
+    0x23e8e8cb, 0x7cdddda1, 0x9c7474e8, 0x211f1f3e, 0xdd4b4b96, 0xdcbdbd61, 0x868b8b0d, 0x858a8a0f,
+    0x907070e0, 0x423e3e7c, 0xc4b5b571, 0xaa6666cc, 0xd8484890, 0x05030306, 0x01f6f6f7, 0x120e0e1c,
+    0xa36161c2, 0x5f35356a, 0xf95757ae, 0xd0b9b969, 0x91868617, 0x58c1c199, 0x271d1d3a, 0xb99e9e27,
+    0x38e1e1d9, 0x13f8f8eb, 0xb398982b, 0x33111122, 0xbb6969d2, 0x70d9d9a9, 0x898e8e07, 0xa7949433,
+    0xb69b9b2d, 0x221e1e3c, 0x92878715, 0x20e9e9c9, 0x49cece87, 0xff5555aa, 0x78282850, 0x7adfdfa5,
+    0x8f8c8c03, 0xf8a1a159, 0x80898909, 0x170d0d1a, 0xdabfbf65, 0x31e6e6d7, 0xc6424284, 0xb86868d0,
+    0xc3414182, 0xb0999929, 0x772d2d5a, 0x110f0f1e, 0xcbb0b07b, 0xfc5454a8, 0xd6bbbb6d, 0x3a16162c
+};
+
+/* inv_sbox[x] times InvMixColumns column {e, 9, d, b}, row 0 in the least significant byte */
+static const uint32_t td0[256] =
+{
+    0x50a7f451, 0x5365417e, 0xc3a4171a, 0x965e273a, 0xcb6bab3b, 0xf1459d1f, 0xab58faac, 0x9303e34b,
+    0x55fa3020, 0xf66d76ad, 0x9176cc88, 0x254c02f5, 0xfcd7e54f, 0xd7cb2ac5, 0x80443526, 0x8fa362b5,
+    0x495ab1de, 0x671bba25, 0x980eea45, 0xe1c0fe5d, 0x02752fc3, 0x12f04c81, 0xa397468d, 0xc6f9d36b,
+    0xe75f8f03, 0x959c9215, 0xeb7a6dbf, 0xda595295, 0x2d83bed4, 0xd3217458, 0x2969e049, 0x44c8c98e,
+    0x6a89c275, 0x78798ef4, 0x6b3e5899, 0xdd71b927, 0xb64fe1be, 0x17ad88f0, 0x66ac20c9, 0xb43ace7d,
+    0x184adf63, 0x82311ae5, 0x60335197, 0x457f5362, 0xe07764b1, 0x84ae6bbb, 0x1ca081fe, 0x942b08f9,
+    0x58684870, 0x19fd458f, 0x876cde94, 0xb7f87b52, 0x23d373ab, 0xe2024b72, 0x578f1fe3, 0x2aab5566,
+    0x0728ebb2, 0x03c2b52f, 0x9a7bc586, 0xa50837d3, 0xf2872830, 0xb2a5bf23, 0xba6a0302, 0x5c8216ed,
+    0x2b1ccf8a, 0x92b479a7, 0xf0f207f3, 0xa1e2694e, 0xcdf4da65, 0xd5be0506, 0x1f6234d1, 0x8afea6c4,
+    0x9d532e34, 0xa055f3a2, 0x32e18a05, 0x75ebf6a4, 0x39ec830b, 0xaaef6040, 0x069f715e, 0x51106ebd,
+    0xf98a213e, 0x3d06dd96, 0xae053edd, 0x46bde64d, 0xb58d5491, 0x055dc471, 0x6fd40604, 0xff155060,
+    0x24fb9819, 0x97e9bdd6, 0xcc434089, 0x779ed967, 0xbd42e8b0, 0x888b8907, 0x385b19e7, 0xdbeec879,
+    0x470a7ca1, 0xe90f427c, 0xc91e84f8, 0x00000000, 0x83868009, 0x48ed2b32, 0xac70111e, 0x4e725a6c,
+    0xfbff0efd, 0x5638850f, 0x1ed5ae3d, 0x27392d36, 0x64d90f0a, 0x21a65c68, 0xd1545b9b, 0x3a2e3624,
+    0xb1670a0c, 0x0fe75793, 0xd296eeb4, 0x9e919b1b, 0x4fc5c080, 0xa220dc61, 0x694b775a, 0x161a121c,
+    0x0aba93e2, 0xe52aa0c0, 0x43e0223c, 0x1d171b12, 0x0b0d090e, 0xadc78bf2, 0xb9a8b62d, 0xc8a91e14,
+    0x8519f157, 0x4c0775af, 0xbbdd99ee, 0xfd607fa3, 0x9f2601f7, 0xbcf5725c, 0xc53b6644, 0x347efb5b,
+    0x7629438b, 0xdcc623cb, 0x68fcedb6, 0x63f1e4b8, 0xcadc31d7, 0x10856342, 0x40229713, 0x2011c684,
+    0x7d244a85, 0xf83dbbd2, 0x1132f9ae, 0x6da129c7, 0x4b2f9e1d, 0xf330b2dc, 0xec52860d, 0xd0e3c177,
+    0x6c16b32b, 0x99b970a9, 0xfa489411, 0x2264e947, 0xc48cfca8, 0x1a3ff0a0, 0xd82c7d56, 0xef903322,
+    0xc74e4987, 0xc1d138d9, 0xfea2ca8c, 0x360bd498, 0xcf81f5a6, 0x28de7aa5, 0x268eb7da, 0xa4bfad3f,
+    0xe49d3a2c, 0x0d927850, 0x9bcc5f6a, 0x62467e54, 0xc2138df6, 0xe8b8d890, 0x5ef7392e, 0xf5afc382,
+    0xbe805d9f, 0x7c93d069, 0xa92dd56f, 0xb31225cf, 0x3b99acc8, 0xa77d1810, 0x6e639ce8, 0x7bbb3bdb,
+    0x097826cd, 0xf418596e, 0x01b79aec, 0xa89a4f83, 0x656e95e6, 0x7ee6ffaa, 0x08cfbc21, 0xe6e815ef,
+    0xd99be7ba, 0xce366f4a, 0xd4099fea, 0xd67cb029, 0xafb2a431, 0x31233f2a, 0x3094a5c6, 0xc066a235,
+    0x37bc4e74, 0xa6ca82fc, 0xb0d090e0, 0x15d8a733, 0x4a9804f1, 0xf7daec41, 0x0e50cd7f, 0x2ff69117,
+    0x8dd64d76, 0x4db0ef43, 0x544daacc, 0xdf0496e4, 0xe3b5d19e, 0x1b886a4c, 0xb81f2cc1, 0x7f516546,
+    0x04ea5e9d, 0x5d358c01, 0x737487fa, 0x2e410bfb, 0x5a1d67b3, 0x52d2db92, 0x335610e9, 0x1347d66d,
+    0x8c61d79a, 0x7a0ca137, 0x8e14f859, 0x893c13eb, 0xee27a9ce, 0x35c961b7, 0xede51ce1, 0x3cb1477a,
+    0x59dfd29c, 0x3f73f255, 0x79ce1418, 0xbf37c773, 0xeacdf753, 0x5baafd5f, 0x146f3ddf, 0x86db4478,
+    0x81f3afca, 0x3ec468b9, 0x2c342438, 0x5f40a3c2, 0x72c31d16, 0x0c25e2bc, 0x8b493c28, 0x41950dff,
+    0x7101a839, 0xdeb30c08, 0x9ce4b4d8, 0x90c15664, 0x6184cb7b, 0x70b632d5, 0x745c6c48, 0x4257b8d0
+};
+#endif /* SSF_AES_CONFIG_CIPHER */
+
+#if SSF_CONFIG_AES_UNIT_TEST == 1
+/* Cipher forced by unit test, SSF_AES_CIPHER_AUTO selects it as other builds do */
+static uint8_t _ssfAESCipher = SSF_AES_CIPHER_AUTO;
+#define SSF_AES_CIPHER ((_ssfAESCipher == SSF_AES_CIPHER_AUTO) ? SSF_AES_CONFIG_CIPHER : \
+                        _ssfAESCipher)
+#else
+#define SSF_AES_CIPHER SSF_AES_CONFIG_CIPHER
+#endif /* SSF_CONFIG_AES_UNIT_TEST */
+
+#if SSF_AES_NI == 1
+#if defined(_MSC_VER)
+#define SSF_AES_NI_TARGET
+#else
+#define SSF_AES_NI_TARGET __attribute__((target("aes,sse2")))
+#endif /* _MSC_VER */
+
+/* -1 until CPUID is read, then 1 if AES-NI is supported, else 0 */
+static int8_t _ssfAESNI = -1;
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if CPUID reports the AES-NI and SSE2 instructions, else false.                   */
+/* --------------------------------------------------------------------------------------------- */
+static bool _SSFAESNIIsSupported(void)
+{
+    if (_ssfAESNI < 0)
+    {
+#if defined(_MSC_VER)
+        int r[4];
+
+        __cpuid(r, 1);
+        _ssfAESNI = ((((uint32_t)r[2] >> 25) & 1) && (((uint32_t)r[3] >> 26) & 1)) ? 1 : 0;
+#else
+        unsigned int a, b, c, d;
+
+        _ssfAESNI = (__get_cpuid(1, &a, &b, &c, &d) && (c & bit_AES) && (d & bit_SSE2)) ? 1 : 0;
+#endif /* _MSC_VER */
+    }
+    return _ssfAESNI == 1;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if blocks are processed with AES-NI instructions, else false.                    */
+/* --------------------------------------------------------------------------------------------- */
+static bool _SSFAESNIIsUsed(void)
+{
+#if SSF_CONFIG_AES_UNIT_TEST == 1
+    if ((_ssfAESCipher != SSF_AES_CIPHER_AUTO) && (_ssfAESCipher != SSF_AES_CIPHER_AESNI))
+    { return false; }
+#endif /* SSF_CONFIG_AES_UNIT_TEST */
+    return _SSFAESNIIsSupported();
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns SubWord() of x computed by the AES-NI key generation assist instruction.              */
+/* --------------------------------------------------------------------------------------------- */
+SSF_AES_NI_TARGET static uint32_t _SSFAESNISubWord(uint32_t x)
+{
+    /* Dword 0 of the result is SubWord() of dword 1 of the source */
+    return (uint32_t)_mm_cvtsi128_si32(_mm_aeskeygenassist_si128(_mm_set1_epi32((int)x), 0));
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Derives the middle round keys of the equivalent inverse cipher with AESIMC.                   */
+/* --------------------------------------------------------------------------------------------- */
+SSF_AES_NI_TARGET static void _SSFAESNIInvMixKeys(const uint32_t *w, uint32_t *dw, uint8_t nr)
+{
+    uint8_t i;
+
+    for (i = 1; i < nr; i++)
+    {
+        _mm_storeu_si128((__m128i *)&dw[i << 2],
+                         _mm_aesimc_si128(_mm_loadu_si128((const __m128i *)&w[(nr - i) << 2])));
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Encrypts a block with AES-NI instructions.                                                    */
+/* --------------------------------------------------------------------------------------------- */
+SSF_AES_NI_TARGET static void _SSFAESNIEncrypt(const uint32_t *w, uint8_t nr, const uint8_t *pt,
+                                               uint8_t *ct)
+{
+    const __m128i *k = (const __m128i *)w;
+    __m128i s;
+    uint8_t i;
+
+    s = _mm_xor_si128(_mm_loadu_si128((const __m128i *)pt), _mm_loadu_si128(&k[0]));
+    for (i = 1; i < nr; i++) s = _mm_aesenc_si128(s, _mm_loadu_si128(&k[i]));
+    s = _mm_aesenclast_si128(s, _mm_loadu_si128(&k[nr]));
+    _mm_storeu_si128((__m128i *)ct, s);
+}
+
 /* --------------------------------------------------------------------------------------------- */
-/* Performs AES key expansion.                                                                   */
+/* Decrypts a block with AES-NI instructions and the equivalent inverse cipher's key schedule.   */
+/* --------------------------------------------------------------------------------------------- */
+SSF_AES_NI_TARGET static void _SSFAESNIDecrypt(const uint32_t *dw, uint8_t nr, const uint8_t *ct,
+                                               uint8_t *pt)
+{
+    const __m128i *k = (const __m128i *)dw;
+    __m128i s;
+    uint8_t i;
+
+    s = _mm_xor_si128(_mm_loadu_si128((const __m128i *)ct), _mm_loadu_si128(&k[0]));
+    for (i = 1; i < nr; i++) s = _mm_aesdec_si128(s, _mm_loadu_si128(&k[i]));
+    s = _mm_aesdeclast_si128(s, _mm_loadu_si128(&k[nr]));
+    _mm_storeu_si128((__m128i *)pt, s);
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* XORs len bytes of in with the CTR keystream of whole blocks into out, 4 blocks in parallel.   */
+/* --------------------------------------------------------------------------------------------- */
+SSF_AES_NI_TARGET static void _SSFAESNICTR32(const uint32_t *w, uint8_t nr, const uint8_t *cb,
+                                             uint32_t *ctr, const uint8_t *in, uint8_t *out,
+                                             size_t len)
+{
+    __m128i k[SSF_AES_MAX_ROUNDS + 1];
+    __m128i b[4];
+    int32_t c[3];
+    uint8_t i;
+    uint8_t j;
+
+    for (i = 0; i <= nr; i++) k[i] = _mm_loadu_si128((const __m128i *)&w[i << 2]);
+    memcpy(c, cb, sizeof(c));
+
+    for (; len >= (SSF_AES_BLOCK_SIZE << 2); len -= (SSF_AES_BLOCK_SIZE << 2))
+    {
+        /* Interleave the rounds of 4 counter blocks to hide the AESENC latency */
+        for (j = 0; j < 4; j++)
+        {
+            b[j] = _mm_xor_si128(_mm_set_epi32((int32_t)SSF_AES_BSWAP32(*ctr), c[2], c[1], c[0]),
+                                 k[0]);
+            (*ctr)++;
+        }
+        for (i = 1; i < nr; i++)
+        {
+            b[0] = _mm_aesenc_si128(b[0], k[i]);
+            b[1] = _mm_aesenc_si128(b[1], k[i]);
+            b[2] = _mm_aesenc_si128(b[2], k[i]);
+            b[3] = _mm_aesenc_si128(b[3], k[i]);
+        }
+        for (j = 0; j < 4; j++)
+        {
+            b[j] = _mm_aesenclast_si128(b[j], k[nr]);
+            _mm_storeu_si128((__m128i *)out,
+                             _mm_xor_si128(b[j], _mm_loadu_si128((const __m128i *)in)));
+            in += SSF_AES_BLOCK_SIZE;
+            out += SSF_AES_BLOCK_SIZE;
+        }
+    }
+
+    for (; len != 0; len -= SSF_AES_BLOCK_SIZE)
+    {
+        b[0] = _mm_xor_si128(_mm_set_epi32((int32_t)SSF_AES_BSWAP32(*ctr), c[2], c[1], c[0]),
+                             k[0]);
+        (*ctr)++;
+        for (i = 1; i < nr; i++) b[0] = _mm_aesenc_si128(b[0], k[i]);
+        b[0] = _mm_aesenclast_si128(b[0], k[nr]);
+        _mm_storeu_si128((__m128i *)out,
+                         _mm_xor_si128(b[0], _mm_loadu_si128((const __m128i *)in)));
+        in += SSF_AES_BLOCK_SIZE;
+        out += SSF_AES_BLOCK_SIZE;
+    }
+}
+
+#endif /* SSF_AES_NI */
+
+#if SSF_AES_CONFIG_ENABLE_BITSLICE == 1
+/* Exchanges the s bit groups of x selected by ch with those of y selected by cl */
+#define BS_SWAP(cl, ch, s, x, y) do { \
+    uint64_t bsA = (x), bsB = (y); \
+    (x) = (bsA & (uint64_t)(cl)) | ((bsB & (uint64_t)(cl)) << (s)); \
+    (y) = ((bsA & (uint64_t)(ch)) >> (s)) | (bsB & (uint64_t)(ch)); } while (0)
+#define BS_SWAP2(x, y) BS_SWAP(0x5555555555555555ull, 0xaaaaaaaaaaaaaaaaull, 1, x, y)
+#define BS_SWAP4(x, y) BS_SWAP(0x3333333333333333ull, 0xccccccccccccccccull, 2, x, y)
+#define BS_SWAP8(x, y) BS_SWAP(0x0f0f0f0f0f0f0f0full, 0xf0f0f0f0f0f0f0f0ull, 4, x, y)
+#define BS_ROTR32(x) (((x) << 32) | ((x) >> 32))
+#define BS_ROTR16(x) (((x) >> 16) | ((x) << 48))
+#define BS_BLOCKS (4u)
+#define BS_ADD_KEY(q, k) \
+    q[0] ^= (k)[0]; q[1] ^= (k)[1]; q[2] ^= (k)[2]; q[3] ^= (k)[3]; \
+    q[4] ^= (k)[4]; q[5] ^= (k)[5]; q[6] ^= (k)[6]; q[7] ^= (k)[7]
+
+/* --------------------------------------------------------------------------------------------- */
+/* Applies SubBytes to all bytes of the bitsliced state q with Boyar and Peralta's circuit.      */
+/* --------------------------------------------------------------------------------------------- */
+static void _SSFAESBSSbox(uint64_t *q)
+{
+    uint64_t x0, x1, x2, x3, x4, x5, x6, x7;
+    uint64_t y1, y2, y3, y4, y5, y6, y7, y8, y9, y10, y11, y12, y13, y14, y15, y16, y17, y18, y19;
+    uint64_t y20, y21;
+    uint64_t z0, z1, z2, z3, z4, z5, z6, z7, z8, z9, z10, z11, z12, z13, z14, z15, z16, z17;
+    uint64_t t0, t1, t2, t3, t4, t5, t6, t7, t8, t9, t10, t11, t12, t13, t14, t15, t16, t17, t18;
+    uint64_t t19, t20, t21, t22, t23, t24, t25, t26, t27, t28, t29, t30, t31, t32, t33, t34, t35;
+    uint64_t t36, t37, t38, t39, t40, t41, t42, t43, t44, t45, t46, t47, t48, t49, t50, t51, t52;
+    uint64_t t53, t54, t55, t56, t57, t58, t59, t60, t61, t62, t63, t64, t65, t66, t67;
+
+    /* q[0] holds the least significant bit of every byte */
+    x0 = q[7]; x1 = q[6]; x2 = q[5]; x3 = q[4]; x4 = q[3]; x5 = q[2]; x6 = q[1]; x7 = q[0];
+
+    /* Top linear transformation */
+    y14 = x3 ^ x5; y13 = x0 ^ x6; y9 = x0 ^ x3; y8 = x0 ^ x5;
+    t0 = x1 ^ x2; y1 = t0 ^ x7; y4 = y1 ^ x3; y12 = y13 ^ y14;
+    y2 = y1 ^ x0; y5 = y1 ^ x6; y3 = y5 ^ y8; t1 = x4 ^ y12;
+    y15 = t1 ^ x5; y20 = t1 ^ x1; y6 = y15 ^ x7; y10 = y15 ^ t0;
+    y11 = y20 ^ y9; y7 = x7 ^ y11; y17 = y10 ^ y11; y19 = y10 ^ y8;
+    y16 = t0 ^ y11; y21 = y13 ^ y16; y18 = x0 ^ y16;
+
+    /* Non-linear section, inversion in GF(2^8) */
+    t2 = y12 & y15; t3 = y3 & y6; t4 = t3 ^ t2; t5 = y4 & x7;
+    t6 = t5 ^ t2; t7 = y13 & y16; t8 = y5 & y1; t9 = t8 ^ t7;
+    t10 = y2 & y7; t11 = t10 ^ t7; t12 = y9 & y11; t13 = y14 & y17;
+    t14 = t13 ^ t12; t15 = y8 & y10; t16 = t15 ^ t12; t17 = t4 ^ t14;
+    t18 = t6 ^ t16; t19 = t9 ^ t14; t20 = t11 ^ t16; t21 = t17 ^ y20;
+    t22 = t18 ^ y19; t23 = t19 ^ y21; t24 = t20 ^ y18;
+
+    t25 = t21 ^ t22; t26 = t21 & t23; t27 = t24 ^ t26; t28 = t25 & t27;
+    t29 = t28 ^ t22; t30 = t23 ^ t24; t31 = t22 ^ t26; t32 = t31 & t30;
+    t33 = t32 ^ t24; t34 = t23 ^ t33; t35 = t27 ^ t33; t36 = t24 & t35;
+    t37 = t36 ^ t34; t38 = t27 ^ t36; t39 = t29 & t38; t40 = t25 ^ t39;
+
+    t41 = t40 ^ t37; t42 = t29 ^ t33; t43 = t29 ^ t40; t44 = t33 ^ t37;
+    t45 = t42 ^ t41;
+    z0 = t44 & y15; z1 = t37 & y6; z2 = t33 & x7; z3 = t43 & y16;
+    z4 = t40 & y1; z5 = t29 & y7; z6 = t42 & y11; z7 = t45 & y17;
+    z8 = t41 & y10; z9 = t44 & y12; z10 = t37 & y3; z11 = t33 & y4;
+    z12 = t43 & y13; z13 = t40 & y5; z14 = t29 & y2; z15 = t42 & y9;
+    z16 = t45 & y14; z17 = t41 & y8;
+
+    /* Bottom linear transformation, including the affine constant */
+    t46 = z15 ^ z16; t47 = z10 ^ z11; t48 = z5 ^ z13; t49 = z9 ^ z10;
+    t50 = z2 ^ z12; t51 = z2 ^ z5; t52 = z7 ^ z8; t53 = z0 ^ z3;
+    t54 = z6 ^ z7; t55 = z16 ^ z17; t56 = z12 ^ t48; t57 = t50 ^ t53;
+    t58 = z4 ^ t46; t59 = z3 ^ t54; t60 = t46 ^ t57; t61 = z14 ^ t57;
+    t62 = t52 ^ t58; t63 = t49 ^ t58; t64 = z4 ^ t59; t65 = t61 ^ t62;
+    t66 = z1 ^ t63; t67 = t64 ^ t65;
+
+    q[7] = t59 ^ t63;
+    q[1] = t56 ^ ~t62;
+    q[0] = t48 ^ ~t60;
+    q[4] = t53 ^ t66;
+    q[3] = t51 ^ t66;
+    q[2] = t47 ^ t65;
+    q[6] = t64 ^ ~q[4];
+    q[5] = t55 ^ ~t67;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Transposes q between interleaved words and bit planes, where q[i] holds bit i of every byte.  */
+/* --------------------------------------------------------------------------------------------- */
+static void _SSFAESBSOrtho(uint64_t *q)
+{
+    BS_SWAP2(q[0], q[1]); BS_SWAP2(q[2], q[3]); BS_SWAP2(q[4], q[5]); BS_SWAP2(q[6], q[7]);
+    BS_SWAP4(q[0], q[2]); BS_SWAP4(q[1], q[3]); BS_SWAP4(q[4], q[6]); BS_SWAP4(q[5], q[7]);
+    BS_SWAP8(q[0], q[4]); BS_SWAP8(q[1], q[5]); BS_SWAP8(q[2], q[6]); BS_SWAP8(q[3], q[7]);
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Spreads the 4 little endian columns w of a block over the 16-bit lanes of q0 and q1.          */
+/* --------------------------------------------------------------------------------------------- */
+static void _SSFAESBSInterleaveIn(uint64_t *q0, uint64_t *q1, const uint32_t *w)
+{
+    uint64_t x[4];
+    uint8_t i;
+
+    for (i = 0; i < 4; i++)
+    {
+        x[i] = w[i];
+        x[i] = (x[i] | (x[i] << 16)) & 0x0000ffff0000ffffull;
+        x[i] = (x[i] | (x[i] << 8)) & 0x00ff00ff00ff00ffull;
+    }
+    *q0 = x[0] | (x[2] << 8);
+    *q1 = x[1] | (x[3] << 8);
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Gathers the 4 little endian columns w of a block from the 16-bit lanes of q0 and q1.          */
+/* --------------------------------------------------------------------------------------------- */
+static void _SSFAESBSInterleaveOut(uint32_t *w, uint64_t q0, uint64_t q1)
+{
+    uint64_t x[4];
+    uint8_t i;
+
+    x[0] = q0 & 0x00ff00ff00ff00ffull;
+    x[1] = q1 & 0x00ff00ff00ff00ffull;
+    x[2] = (q0 >> 8) & 0x00ff00ff00ff00ffull;
+    x[3] = (q1 >> 8) & 0x00ff00ff00ff00ffull;
+    for (i = 0; i < 4; i++)
+    {
+        x[i] = (x[i] | (x[i] >> 8)) & 0x0000ffff0000ffffull;
+        w[i] = (uint32_t)x[i] | (uint32_t)(x[i] >> 16);
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns SubWord() of x computed without table lookups.                                        */
+/* --------------------------------------------------------------------------------------------- */
+static uint32_t _SSFAESBSSubWord(uint32_t x)
+{
+    uint64_t q[8];
+
+    memset(q, 0, sizeof(q));
+    q[0] = x;
+    _SSFAESBSOrtho(q);
+    _SSFAESBSSbox(q);
+    _SSFAESBSOrtho(q);
+    return (uint32_t)q[0];
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Applies ShiftRows to the bitsliced state q.                                                   */
+/* --------------------------------------------------------------------------------------------- */
+static void _SSFAESBSShiftRows(uint64_t *q)
+{
+    uint64_t x;
+    uint8_t i;
+
+    for (i = 0; i < 8; i++)
+    {
+        x = q[i];
+        q[i] = (x & 0x000000000000ffffull) |
+               ((x & 0x00000000fff00000ull) >> 4) | ((x & 0x00000000000f0000ull) << 12) |
+               ((x & 0x0000ff0000000000ull) >> 8) | ((x & 0x000000ff00000000ull) << 8) |
+               ((x & 0xf000000000000000ull) >> 12) | ((x & 0x0fff000000000000ull) << 4);
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Applies MixColumns to the bitsliced state q.                                                  */
+/* --------------------------------------------------------------------------------------------- */
+static void _SSFAESBSMixColumns(uint64_t *q)
+{
+    uint64_t q0, q1, q2, q3, q4, q5, q6, q7;
+    uint64_t r0, r1, r2, r3, r4, r5, r6, r7;
+
+    /* r is each column rotated by one row, multiplying by x is a shift across the bit planes */
+    q0 = q[0]; q1 = q[1]; q2 = q[2]; q3 = q[3]; q4 = q[4]; q5 = q[5]; q6 = q[6]; q7 = q[7];
+    r0 = BS_ROTR16(q0); r1 = BS_ROTR16(q1); r2 = BS_ROTR16(q2); r3 = BS_ROTR16(q3);
+    r4 = BS_ROTR16(q4); r5 = BS_ROTR16(q5); r6 = BS_ROTR16(q6); r7 = BS_ROTR16(q7);
+
+    q[0] = q7 ^ r7 ^ r0 ^ BS_ROTR32(q0 ^ r0);
+    q[1] = q0 ^ r0 ^ q7 ^ r7 ^ r1 ^ BS_ROTR32(q1 ^ r1);
+    q[2] = q1 ^ r1 ^ r2 ^ BS_ROTR32(q2 ^ r2);
+    q[3] = q2 ^ r2 ^ q7 ^ r7 ^ r3 ^ BS_ROTR32(q3 ^ r3);
+    q[4] = q3 ^ r3 ^ q7 ^ r7 ^ r4 ^ BS_ROTR32(q4 ^ r4);
+    q[5] = q4 ^ r4 ^ r5 ^ BS_ROTR32(q5 ^ r5);
+    q[6] = q5 ^ r5 ^ r6 ^ BS_ROTR32(q6 ^ r6);
+    q[7] = q6 ^ r6 ^ r7 ^ BS_ROTR32(q7 ^ r7);
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Bitslices each round key of the schedule w, replicated for 4 blocks, into sk.                 */
+/* --------------------------------------------------------------------------------------------- */
+static void _SSFAESBSKeys(const uint32_t *w, uint8_t nr, uint64_t *sk)
+{
+    uint8_t i;
+    uint8_t j;
+
+    for (i = 0; i <= nr; i++)
+    {
+        for (j = 0; j < BS_BLOCKS; j++)
+        {
+            _SSFAESBSInterleaveIn(&sk[(i << 3) + j], &sk[(i << 3) + j + 4], &w[i << 2]);
+        }
+        _SSFAESBSOrtho(&sk[i << 3]);
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Encrypts the 4 blocks of little endian columns b in place with bitsliced round keys sk.       */
+/* --------------------------------------------------------------------------------------------- */
+static void _SSFAESBSEncrypt(const uint64_t *sk, uint8_t nr, uint32_t *b)
+{
+    uint64_t q[8];
+    uint8_t i;
+    uint8_t j;
+
+    for (j = 0; j < BS_BLOCKS; j++) _SSFAESBSInterleaveIn(&q[j], &q[j + 4], &b[j << 2]);
+    _SSFAESBSOrtho(q);
+
+    BS_ADD_KEY(q, sk);
+    for (i = 1; i < nr; i++)
+    {
+        _SSFAESBSSbox(q);
+        _SSFAESBSShiftRows(q);
+        _SSFAESBSMixColumns(q);
+        BS_ADD_KEY(q, &sk[i << 3]);
+    }
+    _SSFAESBSSbox(q);
+    _SSFAESBSShiftRows(q);
+    BS_ADD_KEY(q, &sk[nr << 3]);
+
+    _SSFAESBSOrtho(q);
+    for (j = 0; j < BS_BLOCKS; j++) _SSFAESBSInterleaveOut(&b[j << 2], q[j], q[j + 4]);
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* XORs len bytes of in with the CTR keystream into out, 4 blocks per bitsliced pass.            */
+/* --------------------------------------------------------------------------------------------- */
+static void _SSFAESBSCTR32(const uint64_t *sk, uint8_t nr, const uint8_t *cb, uint32_t *ctr,
+                           const uint8_t *in, uint8_t *out, size_t len)
+{
+    uint32_t b[BS_BLOCKS << 2];
+    uint32_t c[3];
+    size_t n;
+    size_t i;
+    uint8_t j;
+
+    for (j = 0; j < 3; j++) c[j] = GET_COL(cb, j);
+
+    while (len != 0)
+    {
+        /* A pass always encrypts 4 counter blocks, unused keystream of the last pass is dropped */
+        for (j = 0; j < BS_BLOCKS; j++)
+        {
+            b[j << 2] = c[0];
+            b[(j << 2) + 1] = c[1];
+            b[(j << 2) + 2] = c[2];
+            b[(j << 2) + 3] = SSF_AES_BSWAP32(*ctr);
+            if (len > ((size_t)j << 4)) (*ctr)++;
+        }
+        _SSFAESBSEncrypt(sk, nr, b);
+
+        n = (len < (BS_BLOCKS << 4)) ? len : (BS_BLOCKS << 4);
+        for (i = 0; i < n; i++) out[i] = in[i] ^ (uint8_t)(b[i >> 2] >> ((i & 3) << 3));
+        in += n;
+        out += n;
+        len -= n;
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Encrypts n blocks of in, 1 to 4, into out in one bitsliced pass with unused lanes zeroed.     */
+/* --------------------------------------------------------------------------------------------- */
+static void _SSFAESBSBlocks(const uint64_t *sk, uint8_t nr, const uint8_t *in, uint8_t *out,
+                            size_t n)
+{
+    uint32_t b[BS_BLOCKS << 2];
+    size_t j;
+
+    memset(b, 0, sizeof(b));
+    for (j = 0; j < (n << 2); j++) b[j] = GET_COL(in, j);
+    _SSFAESBSEncrypt(sk, nr, b);
+    for (j = 0; j < (n << 2); j++) { PUT_COL(out, j, b[j]); }
+}
+#define SBOX_KEY_WORD(x, isCT) ((isCT) ? _SSFAESBSSubWord(x) : SBOX_WORD(x))
+#else
+#define SBOX_KEY_WORD(x, isCT) SBOX_WORD(x)
+#endif /* SSF_AES_CONFIG_ENABLE_BITSLICE */
+
+#if SSF_AES_NI == 1
+#define SUB_WORD(x, isCT) (_SSFAESNIIsUsed() ? _SSFAESNISubWord(x) : SBOX_KEY_WORD(x, isCT))
+#define BS_IS_USED() (!_SSFAESNIIsUsed())
+#else
+#define SUB_WORD(x, isCT) SBOX_KEY_WORD(x, isCT)
+#define BS_IS_USED() (true)
+#endif /* SSF_AES_NI */
+
+/* --------------------------------------------------------------------------------------------- */
+/* Performs AES key expansion; If isCT and bitslicing is enabled SubWord() avoids table lookups. */
 /* --------------------------------------------------------------------------------------------- */
 static void _SSFAESKeyExpansion(uint32_t *w, size_t wSize, const uint8_t *key, size_t keyLen,
-                                uint8_t nr, uint8_t nk)
+                                uint8_t nr, uint8_t nk, bool isCT)
 {
     uint32_t i, t;
     uint8_t rcon = 1;
@@ -228,11 +801,15 @@ static void _SSFAESKeyExpansion(uint32_t *w, size_t wSize, const uint8_t *key, s
     SSF_ASSERT(((nr == 10) && (nk == 4)) ||
                ((nr == 12) && (nk == 6)) ||
                ((nr == 14) && (nk == 8)));
+#if SSF_AES_CONFIG_ENABLE_BITSLICE == 0
+    (void)isCT;
+#endif /* SSF_AES_CONFIG_ENABLE_BITSLICE */
 
     for (i = 0; i < nk; i++)
     {
         t = i << 2;
-        w[i] = (key[t]) ^ (key[t + 1] << 8) ^ (key[t + 2] << 16) ^ (key[t + 3] << 24);
+        w[i] = ((uint32_t)key[t]) ^ ((uint32_t)key[t + 1] << 8) ^ ((uint32_t)key[t + 2] << 16) ^
+               ((uint32_t)key[t + 3] << 24);
     }
 
     for (i = nk; i < wSize; i++)
@@ -241,44 +818,27 @@ static void _SSFAESKeyExpansion(uint32_t *w, size_t wSize, const uint8_t *key, s
         if ((i % nk) == 0)
         {
             t = ((t >> 8) | ((t << (32 - 8)) & 0xffffffff));
-            t = SBOX_WORD(t);
+            t = SUB_WORD(t, isCT);
             t ^= rcon;
             rcon = FGFM2(rcon);
         } else if ((nk > 6) && ((i % nk) == 4))
         {
-            t = SBOX_WORD(t);
+            t = SUB_WORD(t, isCT);
         }
         w[i] = w[i - nk] ^ t;
     }
 }
 
 /* --------------------------------------------------------------------------------------------- */
-/* Performs AES block encryption.                                                                */
+/* Encrypts a block with an expanded key schedule of nr rounds.                                  */
 /* --------------------------------------------------------------------------------------------- */
-void SSFAESBlockEncrypt(const uint8_t *pt, size_t ptLen, uint8_t *ct, size_t ctSize,
-                        const uint8_t *key, size_t keyLen, uint8_t nr, uint8_t nk)
+static void _SSFAESEncrypt(const uint32_t *w, uint8_t nr, const uint8_t *pt, uint8_t *ct)
 {
-    uint32_t w[60];
     uint8_t t[5];
     uint8_t s[4][4];
     uint8_t i;
 
-    size_t wSize = (((size_t) nr) + 1) << 2;
-
-    SSF_ASSERT(pt != NULL);
-    SSF_ASSERT(ct != NULL);
-    SSF_ASSERT(key != NULL);
-
-    SSF_ASSERT(ptLen == SSF_AES_BLOCK_SIZE);
-    SSF_ASSERT(ctSize == SSF_AES_BLOCK_SIZE);
-    SSF_ASSERT(keyLen == (((size_t) nk) << 2));
-
-    SSF_ASSERT(((nr == 10) && (nk == 4)) ||
-               ((nr == 12) && (nk == 6)) ||
-               ((nr == 14) && (nk == 8)));
-
     ARRAY_TO_STATE(s, pt);
-    _SSFAESKeyExpansion(w, wSize, key, keyLen, nr, nk);
     ADD_KEY(s, w, 0);
 
     for (i = 1; i < nr; i++)
@@ -297,16 +857,232 @@ void SSFAESBlockEncrypt(const uint8_t *pt, size_t ptLen, uint8_t *ct, size_t ctS
 }
 
 /* --------------------------------------------------------------------------------------------- */
-/* Performs AES block decryption.                                                                */
+/* Decrypts a block with an expanded key schedule of nr rounds.                                  */
 /* --------------------------------------------------------------------------------------------- */
-void SSFAESBlockDecrypt(const uint8_t *ct, size_t ctLen, uint8_t *pt, size_t ptSize,
-                        const uint8_t *key, size_t keyLen, uint8_t nr, uint8_t nk)
+static void _SSFAESDecrypt(const uint32_t *w, uint8_t nr, const uint8_t *ct, uint8_t *pt)
 {
-    uint32_t w[60];
     uint8_t t[5];
     uint8_t s[4][4];
     uint8_t i;
 
+    ARRAY_TO_STATE(s, ct);
+    ADD_KEY(s, w, (nr << 2));
+
+    for (i = nr - 1; i > 0; i--)
+    {
+        INV_SHIFT_ROWS(s, t[0]);
+        INV_SBOX_STATE(s);
+        ADD_KEY(s, w, (i << 2));
+        INV_MIX_COLUMNS(s, t);
+    }
+
+    INV_SHIFT_ROWS(s, t[0]);
+    INV_SBOX_STATE(s);
+    ADD_KEY(s, w, 0);
+
+    STATE_TO_ARRAY(s, pt);
+}
+
+#if SSF_AES_CONFIG_CIPHER == 1
+/* --------------------------------------------------------------------------------------------- */
+/* Encrypts a block with T-table lookups on 32-bit columns.                                      */
+/* --------------------------------------------------------------------------------------------- */
+static void _SSFAESTTableEncrypt(const uint32_t *w, uint8_t nr, const uint8_t *pt, uint8_t *ct)
+{
+    uint32_t s0, s1, s2, s3;
+    uint32_t t0, t1, t2, t3;
+    uint8_t i;
+
+    s0 = GET_COL(pt, 0) ^ w[0];
+    s1 = GET_COL(pt, 1) ^ w[1];
+    s2 = GET_COL(pt, 2) ^ w[2];
+    s3 = GET_COL(pt, 3) ^ w[3];
+
+    for (i = 1; i < nr; i++)
+    {
+        w += 4;
+        t0 = TE_COL(s0, s1, s2, s3) ^ w[0];
+        t1 = TE_COL(s1, s2, s3, s0) ^ w[1];
+        t2 = TE_COL(s2, s3, s0, s1) ^ w[2];
+        t3 = TE_COL(s3, s0, s1, s2) ^ w[3];
+        s0 = t0; s1 = t1; s2 = t2; s3 = t3;
+    }
+
+    w += 4;
+    t0 = BOX_COL(sbox, s0, s1, s2, s3) ^ w[0];
+    t1 = BOX_COL(sbox, s1, s2, s3, s0) ^ w[1];
+    t2 = BOX_COL(sbox, s2, s3, s0, s1) ^ w[2];
+    t3 = BOX_COL(sbox, s3, s0, s1, s2) ^ w[3];
+
+    PUT_COL(ct, 0, t0);
+    PUT_COL(ct, 1, t1);
+    PUT_COL(ct, 2, t2);
+    PUT_COL(ct, 3, t3);
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Decrypts a block with T-table lookups and the equivalent inverse cipher's key schedule dw.    */
+/* --------------------------------------------------------------------------------------------- */
+static void _SSFAESTTableDecrypt(const uint32_t *dw, uint8_t nr, const uint8_t *ct, uint8_t *pt)
+{
+    uint32_t s0, s1, s2, s3;
+    uint32_t t0, t1, t2, t3;
+    uint8_t i;
+
+    s0 = GET_COL(ct, 0) ^ dw[0];
+    s1 = GET_COL(ct, 1) ^ dw[1];
+    s2 = GET_COL(ct, 2) ^ dw[2];
+    s3 = GET_COL(ct, 3) ^ dw[3];
+
+    for (i = 1; i < nr; i++)
+    {
+        dw += 4;
+        t0 = TD_COL(s0, s3, s2, s1) ^ dw[0];
+        t1 = TD_COL(s1, s0, s3, s2) ^ dw[1];
+        t2 = TD_COL(s2, s1, s0, s3) ^ dw[2];
+        t3 = TD_COL(s3, s2, s1, s0) ^ dw[3];
+        s0 = t0; s1 = t1; s2 = t2; s3 = t3;
+    }
+
+    dw += 4;
+    t0 = BOX_COL(inv_sbox, s0, s3, s2, s1) ^ dw[0];
+    t1 = BOX_COL(inv_sbox, s1, s0, s3, s2) ^ dw[1];
+    t2 = BOX_COL(inv_sbox, s2, s1, s0, s3) ^ dw[2];
+    t3 = BOX_COL(inv_sbox, s3, s2, s1, s0) ^ dw[3];
+
+    PUT_COL(pt, 0, t0);
+    PUT_COL(pt, 1, t1);
+    PUT_COL(pt, 2, t2);
+    PUT_COL(pt, 3, t3);
+}
+#endif /* SSF_AES_CONFIG_CIPHER */
+
+#if SSF_AES_DEC_SCHEDULE == 1
+/* --------------------------------------------------------------------------------------------- */
+/* Derives the equivalent inverse cipher's key schedule dw from the encryption schedule w.       */
+/* --------------------------------------------------------------------------------------------- */
+static void _SSFAESDecKeyExpansion(const uint32_t *w, uint32_t *dw, uint8_t nr)
+{
+    uint32_t i;
+    uint32_t n = ((uint32_t)nr) << 2;
+
+    /* Round keys in reverse order, all but the first and last through InvMixColumns */
+    for (i = 0; i < 4; i++)
+    {
+        dw[i] = w[n + i];
+        dw[n + i] = w[i];
+    }
+#if SSF_AES_NI == 1
+    if (_SSFAESNIIsSupported()) { _SSFAESNIInvMixKeys(w, dw, nr); return; }
+#endif /* SSF_AES_NI */
+#if SSF_AES_CONFIG_CIPHER == 1
+    for (i = 4; i < n; i++)
+    {
+        uint32_t x;
+
+        /* td0 applies inv_sbox first, so undo it with sbox */
+        x = w[n - (i & ~3ul) + (i & 3)];
+        x = SBOX_WORD(x);
+        dw[i] = TD_COL(x, x, x, x);
+    }
+#endif /* SSF_AES_CONFIG_CIPHER */
+}
+#endif /* SSF_AES_DEC_SCHEDULE */
+
+/* --------------------------------------------------------------------------------------------- */
+/* Encrypts a block with the selected cipher implementation.                                     */
+/* --------------------------------------------------------------------------------------------- */
+static void _SSFAESCipherEncrypt(const uint32_t *w, uint8_t nr, const uint8_t *pt, uint8_t *ct)
+{
+#if SSF_AES_NI == 1
+    if (_SSFAESNIIsUsed()) { _SSFAESNIEncrypt(w, nr, pt, ct); return; }
+#endif /* SSF_AES_NI */
+#if SSF_AES_CONFIG_CIPHER == 1
+    if (SSF_AES_CIPHER != 0) { _SSFAESTTableEncrypt(w, nr, pt, ct); return; }
+#endif /* SSF_AES_CONFIG_CIPHER */
+    _SSFAESEncrypt(w, nr, pt, ct);
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Decrypts a block with the selected cipher implementation.                                     */
+/* --------------------------------------------------------------------------------------------- */
+static void _SSFAESCipherDecrypt(const uint32_t *w, const uint32_t *dw, uint8_t nr,
+                                 const uint8_t *ct, uint8_t *pt)
+{
+#if SSF_AES_NI == 1
+    if (_SSFAESNIIsUsed()) { _SSFAESNIDecrypt(dw, nr, ct, pt); return; }
+#endif /* SSF_AES_NI */
+#if SSF_AES_CONFIG_CIPHER == 1
+    if (SSF_AES_CIPHER != 0) { _SSFAESTTableDecrypt(dw, nr, ct, pt); return; }
+#endif /* SSF_AES_CONFIG_CIPHER */
+    (void)dw;
+    _SSFAESDecrypt(w, nr, ct, pt);
+}
+
+#if SSF_CONFIG_AES_UNIT_TEST == 1
+/* --------------------------------------------------------------------------------------------- */
+/* Selects the cipher, up to SSF_AES_CONFIG_CIPHER, AES-NI or auto, used by unit test.           */
+/* --------------------------------------------------------------------------------------------- */
+void SSFAESUTSetCipher(uint8_t cipher)
+{
+    SSF_REQUIRE((cipher <= SSF_AES_CONFIG_CIPHER) || (cipher == SSF_AES_CIPHER_AUTO) ||
+                ((SSF_AES_NI == 1) && (cipher == SSF_AES_CIPHER_AESNI)));
+
+    _ssfAESCipher = cipher;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if blocks are processed with AES-NI instructions, else false.                    */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFAESUTIsNIUsed(void)
+{
+#if SSF_AES_NI == 1
+    return _SSFAESNIIsUsed();
+#else
+    return false;
+#endif /* SSF_AES_NI */
+}
+#endif /* SSF_CONFIG_AES_UNIT_TEST */
+
+/* --------------------------------------------------------------------------------------------- */
+/* Performs AES block encryption.                                                                */
+/* --------------------------------------------------------------------------------------------- */
+void SSFAESBlockEncrypt(const uint8_t *pt, size_t ptLen, uint8_t *ct, size_t ctSize,
+                        const uint8_t *key, size_t keyLen, uint8_t nr, uint8_t nk)
+{
+    uint32_t w[(SSF_AES_MAX_ROUNDS + 1) << 2];
+
+    size_t wSize = (((size_t) nr) + 1) << 2;
+
+    SSF_ASSERT(pt != NULL);
+    SSF_ASSERT(ct != NULL);
+    SSF_ASSERT(key != NULL);
+
+    SSF_ASSERT(ptLen == SSF_AES_BLOCK_SIZE);
+    SSF_ASSERT(ctSize == SSF_AES_BLOCK_SIZE);
+    SSF_ASSERT(keyLen == (((size_t) nk) << 2));
+
+    SSF_ASSERT(((nr == 10) && (nk == 4)) ||
+               ((nr == 12) && (nk == 6)) ||
+               ((nr == 14) && (nk == 8)));
+
+    _SSFAESKeyExpansion(w, wSize, key, keyLen, nr, nk, false);
+    _SSFAESCipherEncrypt(w, nr, pt, ct);
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Performs AES block decryption.                                                                */
+/* --------------------------------------------------------------------------------------------- */
+void SSFAESBlockDecrypt(const uint8_t *ct, size_t ctLen, uint8_t *pt, size_t ptSize,
+                        const uint8_t *key, size_t keyLen, uint8_t nr, uint8_t nk)
+{
+    uint32_t w[(SSF_AES_MAX_ROUNDS + 1) << 2];
+#if SSF_AES_DEC_SCHEDULE == 1
+    uint32_t dw[(SSF_AES_MAX_ROUNDS + 1) << 2];
+#else
+    uint32_t *dw = NULL;
+#endif /* SSF_AES_DEC_SCHEDULE */
+
     size_t wSize = (((size_t) nr) + 1) << 2;
 
     SSF_ASSERT(ct != NULL);
@@ -321,22 +1097,290 @@ void SSFAESBlockDecrypt(const uint8_t *ct, size_t ctLen, uint8_t *pt, size_t ptS
                ((nr == 12) && (nk == 6)) ||
                ((nr == 14) && (nk == 8)));
 
-    ARRAY_TO_STATE(s, ct);
-    _SSFAESKeyExpansion(w, wSize, key, keyLen, nr, nk);
-    ADD_KEY(s, w, (nr << 2));
+    _SSFAESKeyExpansion(w, wSize, key, keyLen, nr, nk, false);
+#if SSF_AES_DEC_SCHEDULE == 1
+    _SSFAESDecKeyExpansion(w, dw, nr);
+#endif /* SSF_AES_DEC_SCHEDULE */
+    _SSFAESCipherDecrypt(w, dw, nr, ct, pt);
+}
 
-    for (i = nr - 1; i > 0; i--)
+/* --------------------------------------------------------------------------------------------- */
+/* Inits an AES context with the key schedule of a 16, 24 or 32 byte key.                        */
+/* --------------------------------------------------------------------------------------------- */
+void SSFAESInitContext(SSFAESContext_t *context, const uint8_t *key, size_t keyLen)
+{
+    uint8_t nk;
+
+    SSF_REQUIRE(context != NULL);
+    SSF_REQUIRE(key != NULL);
+    SSF_REQUIRE((keyLen == 16) || (keyLen == 24) || (keyLen == 32));
+
+    nk = (uint8_t)(keyLen >> 2);
+    context->nr = 6 + nk;
+    _SSFAESKeyExpansion(context->w, (((size_t)context->nr) + 1) << 2, key, keyLen,
+                        context->nr, nk, true);
+#if SSF_AES_DEC_SCHEDULE == 1
+    _SSFAESDecKeyExpansion(context->w, context->dw, context->nr);
+#endif /* SSF_AES_DEC_SCHEDULE */
+#if SSF_AES_CONFIG_ENABLE_BITSLICE == 1
+    _SSFAESBSKeys(context->w, context->nr, context->bsk);
+#endif /* SSF_AES_CONFIG_ENABLE_BITSLICE */
+    context->magic = SSF_AES_MAGIC;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Deinits an AES context, clearing its key schedule.                                            */
+/* --------------------------------------------------------------------------------------------- */
+void SSFAESDeInitContext(SSFAESContext_t *context)
+{
+    SSF_REQUIRE(context != NULL);
+    SSF_REQUIRE(context->magic == SSF_AES_MAGIC);
+
+    memset(context, 0, sizeof(SSFAESContext_t));
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Encrypts n blocks, 1 to 4, with context, bitsliced if enabled and AES-NI is not used.         */
+/* --------------------------------------------------------------------------------------------- */
+static void _SSFAESContextEncrypt(const SSFAESContext_t *context, const uint8_t *pt,
+                                  uint8_t *ct, size_t n)
+{
+    size_t i;
+
+#if SSF_AES_CONFIG_ENABLE_BITSLICE == 1
+    if (BS_IS_USED()) { _SSFAESBSBlocks(context->bsk, context->nr, pt, ct, n); return; }
+#endif /* SSF_AES_CONFIG_ENABLE_BITSLICE */
+    for (i = 0; i < (n << 4); i += SSF_AES_BLOCK_SIZE)
     {
-        INV_SHIFT_ROWS(s, t[0]);
-        INV_SBOX_STATE(s);
-        ADD_KEY(s, w, (i << 2));
-        INV_MIX_COLUMNS(s, t);
+        _SSFAESCipherEncrypt(context->w, context->nr, &pt[i], &ct[i]);
     }
+}
 
-    INV_SHIFT_ROWS(s, t[0]);
-    INV_SBOX_STATE(s);
-    ADD_KEY(s, w, 0);
+/* --------------------------------------------------------------------------------------------- */
+/* Performs AES block encryption with the key schedule of an inited context.                     */
+/* --------------------------------------------------------------------------------------------- */
+void SSFAESContextBlockEncrypt(const SSFAESContext_t *context, const uint8_t *pt, size_t ptLen,
+                               uint8_t *ct, size_t ctSize)
+{
+    SSF_REQUIRE(context != NULL);
+    SSF_REQUIRE(context->magic == SSF_AES_MAGIC);
+    SSF_REQUIRE(pt != NULL);
+    SSF_REQUIRE(ct != NULL);
+    SSF_REQUIRE(ptLen == SSF_AES_BLOCK_SIZE);
+    SSF_REQUIRE(ctSize == SSF_AES_BLOCK_SIZE);
 
-    STATE_TO_ARRAY(s, pt);
+    _SSFAESContextEncrypt(context, pt, ct, 1);
 }
 
+/* --------------------------------------------------------------------------------------------- */
+/* Performs AES block decryption with the key schedule of an inited context.                     */
+/* --------------------------------------------------------------------------------------------- */
+void SSFAESContextBlockDecrypt(const SSFAESContext_t *context, const uint8_t *ct, size_t ctLen,
+                               uint8_t *pt, size_t ptSize)
+{
+    SSF_REQUIRE(context != NULL);
+    SSF_REQUIRE(context->magic == SSF_AES_MAGIC);
+    SSF_REQUIRE(ct != NULL);
+    SSF_REQUIRE(pt != NULL);
+    SSF_REQUIRE(ctLen == SSF_AES_BLOCK_SIZE);
+    SSF_REQUIRE(ptSize == SSF_AES_BLOCK_SIZE);
+
+    _SSFAESCipherDecrypt(context->w, CONTEXT_DW(context), context->nr, ct, pt);
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Encrypts whole blocks in ECB mode, pt and ct may be the same buffer.                          */
+/* --------------------------------------------------------------------------------------------- */
+void SSFAESContextECBEncrypt(const SSFAESContext_t *context, const uint8_t *pt, size_t ptLen,
+                             uint8_t *ct, size_t ctSize)
+{
+    size_t i;
+    size_t n;
+
+    SSF_REQUIRE(context != NULL);
+    SSF_REQUIRE(context->magic == SSF_AES_MAGIC);
+    SSF_REQUIRE(pt != NULL);
+    SSF_REQUIRE(ct != NULL);
+    SSF_REQUIRE((ptLen & (SSF_AES_BLOCK_SIZE - 1)) == 0);
+    SSF_REQUIRE(ptLen <= ctSize);
+
+    for (i = 0; i < ptLen; i += n << 4)
+    {
+        n = (ptLen - i) >> 4;
+        if (n > 4) n = 4;
+        _SSFAESContextEncrypt(context, &pt[i], &ct[i], n);
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Decrypts whole blocks in ECB mode, ct and pt may be the same buffer.                          */
+/* --------------------------------------------------------------------------------------------- */
+void SSFAESContextECBDecrypt(const SSFAESContext_t *context, const uint8_t *ct, size_t ctLen,
+                             uint8_t *pt, size_t ptSize)
+{
+    size_t i;
+
+    SSF_REQUIRE(context != NULL);
+    SSF_REQUIRE(context->magic == SSF_AES_MAGIC);
+    SSF_REQUIRE(ct != NULL);
+    SSF_REQUIRE(pt != NULL);
+    SSF_REQUIRE((ctLen & (SSF_AES_BLOCK_SIZE - 1)) == 0);
+    SSF_REQUIRE(ctLen <= ptSize);
+
+    for (i = 0; i < ctLen; i += SSF_AES_BLOCK_SIZE)
+    {
+        _SSFAESCipherDecrypt(context->w, CONTEXT_DW(context), context->nr, &ct[i], &pt[i]);
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Encrypts whole blocks in CBC mode, iv is updated to chain the next call, pt may be ct.        */
+/* --------------------------------------------------------------------------------------------- */
+void SSFAESContextCBCEncrypt(const SSFAESContext_t *context, uint8_t *iv, size_t ivSize,
+                             const uint8_t *pt, size_t ptLen, uint8_t *ct, size_t ctSize)
+{
+    uint8_t x[SSF_AES_BLOCK_SIZE];
+    size_t i;
+    uint8_t j;
+
+    SSF_REQUIRE(context != NULL);
+    SSF_REQUIRE(context->magic == SSF_AES_MAGIC);
+    SSF_REQUIRE(iv != NULL);
+    SSF_REQUIRE(ivSize == SSF_AES_BLOCK_SIZE);
+    SSF_REQUIRE(pt != NULL);
+    SSF_REQUIRE(ct != NULL);
+    SSF_REQUIRE((ptLen & (SSF_AES_BLOCK_SIZE - 1)) == 0);
+    SSF_REQUIRE(ptLen <= ctSize);
+
+    for (i = 0; i < ptLen; i += SSF_AES_BLOCK_SIZE)
+    {
+        for (j = 0; j < SSF_AES_BLOCK_SIZE; j++) x[j] = pt[i + j] ^ iv[j];
+        _SSFAESContextEncrypt(context, x, iv, 1);
+        memcpy(&ct[i], iv, SSF_AES_BLOCK_SIZE);
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Decrypts whole blocks in CBC mode, iv is updated to chain the next call, ct may be pt.        */
+/* --------------------------------------------------------------------------------------------- */
+void SSFAESContextCBCDecrypt(const SSFAESContext_t *context, uint8_t *iv, size_t ivSize,
+                             const uint8_t *ct, size_t ctLen, uint8_t *pt, size_t ptSize)
+{
+    uint8_t c[SSF_AES_BLOCK_SIZE];
+    uint8_t x[SSF_AES_BLOCK_SIZE];
+    size_t i;
+    uint8_t j;
+
+    SSF_REQUIRE(context != NULL);
+    SSF_REQUIRE(context->magic == SSF_AES_MAGIC);
+    SSF_REQUIRE(iv != NULL);
+    SSF_REQUIRE(ivSize == SSF_AES_BLOCK_SIZE);
+    SSF_REQUIRE(ct != NULL);
+    SSF_REQUIRE(pt != NULL);
+    SSF_REQUIRE((ctLen & (SSF_AES_BLOCK_SIZE - 1)) == 0);
+    SSF_REQUIRE(ctLen <= ptSize);
+
+    for (i = 0; i < ctLen; i += SSF_AES_BLOCK_SIZE)
+    {
+        /* Keep the ciphertext block, in place decryption overwrites it */
+        memcpy(c, &ct[i], SSF_AES_BLOCK_SIZE);
+        _SSFAESCipherDecrypt(context->w, CONTEXT_DW(context), context->nr, c, x);
+        for (j = 0; j < SSF_AES_BLOCK_SIZE; j++) pt[i + j] = x[j] ^ iv[j];
+        memcpy(iv, c, SSF_AES_BLOCK_SIZE);
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* XORs len bytes of in with the CTR keystream into out, wrapping the last 32 bits of cb.        */
+/* --------------------------------------------------------------------------------------------- */
+static void _SSFAESCTR32(const SSFAESContext_t *context, const uint8_t *cb, uint32_t *ctr,
+                         const uint8_t *in, uint8_t *out, size_t len)
+{
+    uint8_t ks[SSF_AES_BLOCK_SIZE << 2];
+    uint8_t b[SSF_AES_BLOCK_SIZE];
+    size_t n;
+    size_t i;
+
+#if SSF_AES_NI == 1
+    if (_SSFAESNIIsUsed())
+    {
+        n = len & ~((size_t)SSF_AES_BLOCK_SIZE - 1);
+        _SSFAESNICTR32(context->w, context->nr, cb, ctr, in, out, n);
+        in += n;
+        out += n;
+        len -= n;
+    }
+#endif /* SSF_AES_NI */
+#if SSF_AES_CONFIG_ENABLE_BITSLICE == 1
+    if (BS_IS_USED()) { _SSFAESBSCTR32(context->bsk, context->nr, cb, ctr, in, out, len); return; }
+#endif /* SSF_AES_CONFIG_ENABLE_BITSLICE */
+    memcpy(b, cb, SSF_AES_BLOCK_SIZE);
+    while (len != 0)
+    {
+        /* Make up to 4 keystream blocks, then XOR them in one loop the compiler can unroll */
+        n = (len < sizeof(ks)) ? len : sizeof(ks);
+        for (i = 0; i < n; i += SSF_AES_BLOCK_SIZE)
+        {
+            b[12] = (uint8_t)(*ctr >> 24);
+            b[13] = (uint8_t)(*ctr >> 16);
+            b[14] = (uint8_t)(*ctr >> 8);
+            b[15] = (uint8_t)*ctr;
+            _SSFAESCipherEncrypt(context->w, context->nr, b, &ks[i]);
+            (*ctr)++;
+        }
+        for (i = 0; i < n; i++) out[i] = in[i] ^ ks[i];
+        in += n;
+        out += n;
+        len -= n;
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Encrypts or decrypts in to out in CTR mode, incrementing the last ctrSize bytes of cb big     */
+/* endian, in and out may be the same buffer.                                                    */
+/* --------------------------------------------------------------------------------------------- */
+void SSFAESContextCTR(const SSFAESContext_t *context, uint8_t *cb, size_t cbSize, size_t ctrSize,
+                      const uint8_t *in, size_t inLen, uint8_t *out, size_t outSize)
+{
+    uint64_t room;
+    uint32_t ctr;
+    size_t n;
+    size_t i;
+
+    SSF_REQUIRE(context != NULL);
+    SSF_REQUIRE(context->magic == SSF_AES_MAGIC);
+    SSF_REQUIRE(cb != NULL);
+    SSF_REQUIRE(cbSize == SSF_AES_BLOCK_SIZE);
+    SSF_REQUIRE((ctrSize == 4) || (ctrSize == 8) || (ctrSize == 16));
+    SSF_REQUIRE(in != NULL);
+    SSF_REQUIRE(out != NULL);
+    SSF_REQUIRE(inLen <= outSize);
+
+    while (inLen != 0)
+    {
+        /* Run the 32-bit counter up to its wrap, then carry into the rest of a wider counter */
+        ctr = ((uint32_t)cb[12] << 24) | ((uint32_t)cb[13] << 16) | ((uint32_t)cb[14] << 8) |
+              cb[15];
+        room = 0x100000000ull - ctr;
+        n = inLen;
+        if (ctrSize > 4)
+        {
+            if ((((uint64_t)inLen + SSF_AES_BLOCK_SIZE - 1) >> 4) > room) n = (size_t)(room << 4);
+        }
+        _SSFAESCTR32(context, cb, &ctr, in, out, n);
+        cb[12] = (uint8_t)(ctr >> 24);
+        cb[13] = (uint8_t)(ctr >> 16);
+        cb[14] = (uint8_t)(ctr >> 8);
+        cb[15] = (uint8_t)ctr;
+        if ((ctr == 0) && (ctrSize > 4))
+        {
+            for (i = SSF_AES_BLOCK_SIZE - 4; i > (SSF_AES_BLOCK_SIZE - ctrSize); i--)
+            {
+                if (++cb[i - 1] != 0) break;
+            }
+        }
+        in += n;
+        out += n;
+        inLen -= n;
+    }
+}
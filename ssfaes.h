@@ -90,6 +90,36 @@ extern "C" {
 /* Defines                                                                                       */
 /* --------------------------------------------------------------------------------------------- */
 #define SSF_AES_BLOCK_SIZE (16u)
+#define SSF_AES_MAX_ROUNDS (14u)
+
+/* AES-NI is only compiled for x86 targets, elsewhere the portable cipher is always used */
+#if (SSF_AES_CONFIG_ENABLE_AESNI == 1) && (defined(__x86_64__) || defined(__i386__) || \
+                                           defined(_M_X64) || defined(_M_IX86))
+#define SSF_AES_NI (1u)
+#else
+#define SSF_AES_NI (0u)
+#endif
+#define SSF_AES_CIPHER_AESNI (2u)
+
+/* The T-table and AES-NI ciphers decrypt with the equivalent inverse cipher's key schedule */
+#if (SSF_AES_CONFIG_CIPHER == 1) || (SSF_AES_NI == 1)
+#define SSF_AES_DEC_SCHEDULE (1u)
+#else
+#define SSF_AES_DEC_SCHEDULE (0u)
+#endif
+
+typedef struct SSFAESContext
+{
+    uint32_t w[(SSF_AES_MAX_ROUNDS + 1) << 2];
+#if SSF_AES_DEC_SCHEDULE == 1
+    uint32_t dw[(SSF_AES_MAX_ROUNDS + 1) << 2];
+#endif /* SSF_AES_DEC_SCHEDULE */
+#if SSF_AES_CONFIG_ENABLE_BITSLICE == 1
+    uint64_t bsk[(SSF_AES_MAX_ROUNDS + 1) << 3];
+#endif /* SSF_AES_CONFIG_ENABLE_BITSLICE */
+    uint8_t nr;
+    uint32_t magic;
+} SSFAESContext_t;
 
 /* --------------------------------------------------------------------------------------------- */
 /* External interface                                                                            */
@@ -121,8 +151,35 @@ void SSFAESBlockDecrypt(const uint8_t *ct, size_t ctLen, uint8_t *pt, size_t ptS
 #define SSFAESXXXBlockDecrypt(ct, ctLen, pt, ptSize, key, keyLen) \
     SSFAESBlockDecrypt(ct, ctLen, pt, ptSize, key, keyLen, \
                        (6 + (((keyLen) & 0xff) >> 2)), (((keyLen) & 0xff) >> 2))
-                       
+
+void SSFAESInitContext(SSFAESContext_t *context, const uint8_t *key, size_t keyLen);
+void SSFAESDeInitContext(SSFAESContext_t *context);
+void SSFAESContextBlockEncrypt(const SSFAESContext_t *context, const uint8_t *pt, size_t ptLen,
+                               uint8_t *ct, size_t ctSize);
+void SSFAESContextBlockDecrypt(const SSFAESContext_t *context, const uint8_t *ct, size_t ctLen,
+                               uint8_t *pt, size_t ptSize);
+void SSFAESContextECBEncrypt(const SSFAESContext_t *context, const uint8_t *pt, size_t ptLen,
+                             uint8_t *ct, size_t ctSize);
+void SSFAESContextECBDecrypt(const SSFAESContext_t *context, const uint8_t *ct, size_t ctLen,
+                             uint8_t *pt, size_t ptSize);
+void SSFAESContextCBCEncrypt(const SSFAESContext_t *context, uint8_t *iv, size_t ivSize,
+                             const uint8_t *pt, size_t ptLen, uint8_t *ct, size_t ctSize);
+void SSFAESContextCBCDecrypt(const SSFAESContext_t *context, uint8_t *iv, size_t ivSize,
+                             const uint8_t *ct, size_t ctLen, uint8_t *pt, size_t ptSize);
+void SSFAESContextCTR(const SSFAESContext_t *context, uint8_t *cb, size_t cbSize, size_t ctrSize,
+                      const uint8_t *in, size_t inLen, uint8_t *out, size_t outSize);
+
+#define SSFAESContextCTR32(context, cb, cbSize, in, inLen, out, outSize) \
+    SSFAESContextCTR(context, cb, cbSize, 4, in, inLen, out, outSize)
+#define SSFAESContextCTR64(context, cb, cbSize, in, inLen, out, outSize) \
+    SSFAESContextCTR(context, cb, cbSize, 8, in, inLen, out, outSize)
+#define SSFAESContextCTR128(context, cb, cbSize, in, inLen, out, outSize) \
+    SSFAESContextCTR(context, cb, cbSize, 16, in, inLen, out, outSize)
+
 #if SSF_CONFIG_AES_UNIT_TEST == 1
+#define SSF_AES_CIPHER_AUTO (0xffu)
+void SSFAESUTSetCipher(uint8_t cipher);
+bool SSFAESUTIsNIUsed(void);
 void SSFAESUnitTest(void);
 #endif /* SSF_CONFIG_AES_UNIT_TEST */
 
@@ -428,15 +428,48 @@ SSFAESUT_t _SSFAES256BlockDecryptMonteUT[] =
     }
 };
 
+/* NIST SP 800-38A F.1.1, F.2.1 and F.5.1 AES-128 ECB, CBC and CTR mode vectors */
+static const uint8_t _ssfAESModesKeyUT[] =
+    "\x2b\x7e\x15\x16\x28\xae\xd2\xa6\xab\xf7\x15\x88\x09\xcf\x4f\x3c";
+static const uint8_t _ssfAESModesPtUT[] =
+    "\x6b\xc1\xbe\xe2\x2e\x40\x9f\x96\xe9\x3d\x7e\x11\x73\x93\x17\x2a"
+    "\xae\x2d\x8a\x57\x1e\x03\xac\x9c\x9e\xb7\x6f\xac\x45\xaf\x8e\x51"
+    "\x30\xc8\x1c\x46\xa3\x5c\xe4\x11\xe5\xfb\xc1\x19\x1a\x0a\x52\xef"
+    "\xf6\x9f\x24\x45\xdf\x4f\x9b\x17\xad\x2b\x41\x7b\xe6\x6c\x37\x10";
+static const uint8_t _ssfAESModesECBUT[] =
+    "\x3a\xd7\x7b\xb4\x0d\x7a\x36\x60\xa8\x9e\xca\xf3\x24\x66\xef\x97"
+    "\xf5\xd3\xd5\x85\x03\xb9\x69\x9d\xe7\x85\x89\x5a\x96\xfd\xba\xaf"
+    "\x43\xb1\xcd\x7f\x59\x8e\xce\x23\x88\x1b\x00\xe3\xed\x03\x06\x88"
+    "\x7b\x0c\x78\x5e\x27\xe8\xad\x3f\x82\x23\x20\x71\x04\x72\x5d\xd4";
+static const uint8_t _ssfAESModesCBCIVUT[] =
+    "\x00\x01\x02\x03\x04\x05\x06\x07\x08\x09\x0a\x0b\x0c\x0d\x0e\x0f";
+static const uint8_t _ssfAESModesCBCUT[] =
+    "\x76\x49\xab\xac\x81\x19\xb2\x46\xce\xe9\x8e\x9b\x12\xe9\x19\x7d"
+    "\x50\x86\xcb\x9b\x50\x72\x19\xee\x95\xdb\x11\x3a\x91\x76\x78\xb2"
+    "\x73\xbe\xd6\xb8\xe3\xc1\x74\x3b\x71\x16\xe6\x9e\x22\x22\x95\x16"
+    "\x3f\xf1\xca\xa1\x68\x1f\xac\x09\x12\x0e\xca\x30\x75\x86\xe1\xa7";
+static const uint8_t _ssfAESModesCTRCBUT[] =
+    "\xf0\xf1\xf2\xf3\xf4\xf5\xf6\xf7\xf8\xf9\xfa\xfb\xfc\xfd\xfe\xff";
+static const uint8_t _ssfAESModesCTRUT[] =
+    "\x87\x4d\x61\x91\xb6\x20\xe3\x26\x1b\xef\x68\x64\x99\x0d\xb6\xce"
+    "\x98\x06\xf6\x6b\x79\x70\xfd\xff\x86\x17\x18\x7b\xb9\xff\xfd\xff"
+    "\x5a\xe4\xdf\x3e\xdb\xd5\xd3\x5e\x5b\x4f\x09\x02\x0d\xb0\x3e\xab"
+    "\x1e\x03\x1d\xda\x2f\xbe\x03\xd1\x79\x21\x70\xa0\xf3\x00\x9c\xee";
+
 /* --------------------------------------------------------------------------------------------- */
-/* Unit tests the AES external interface.                                                        */
+/* Unit tests the AES external interface with the selected cipher implementation.                */
 /* --------------------------------------------------------------------------------------------- */
-void SSFAESUnitTest(void)
+static void _SSFAESUnitTestCipher(void)
 {
     uint32_t i, j, k;
     uint8_t out[32];
     uint8_t key[32];
     uint8_t in[16];
+    uint8_t cb[16];
+    uint8_t ctrIn[160];
+    uint8_t ctrOut[160];
+    uint8_t ctrRef[160];
+    SSFAESContext_t context;
 
     SSF_ASSERT_TEST(SSFAES128BlockEncrypt(NULL, 16, out, 16, _SSFAES128BlockEncryptMonteUT[0].key,
                                           16));
@@ -689,6 +722,337 @@ void SSFAESUnitTest(void)
             }
         }
     }
+
+    SSF_ASSERT_TEST(SSFAESInitContext(NULL, key, 16));
+    SSF_ASSERT_TEST(SSFAESInitContext(&context, NULL, 16));
+    SSF_ASSERT_TEST(SSFAESInitContext(&context, key, 15));
+    SSF_ASSERT_TEST(SSFAESInitContext(&context, key, 0));
+    SSF_ASSERT_TEST(SSFAESDeInitContext(NULL));
+    memset(&context, 0, sizeof(context));
+    SSF_ASSERT_TEST(SSFAESContextBlockEncrypt(&context, in, 16, out, 16));
+    SSF_ASSERT_TEST(SSFAESContextBlockDecrypt(&context, in, 16, out, 16));
+    SSF_ASSERT_TEST(SSFAESDeInitContext(&context));
+    SSFAESInitContext(&context, key, 16);
+    SSF_ASSERT_TEST(SSFAESContextBlockEncrypt(NULL, in, 16, out, 16));
+    SSF_ASSERT_TEST(SSFAESContextBlockEncrypt(&context, NULL, 16, out, 16));
+    SSF_ASSERT_TEST(SSFAESContextBlockEncrypt(&context, in, 15, out, 16));
+    SSF_ASSERT_TEST(SSFAESContextBlockEncrypt(&context, in, 16, NULL, 16));
+    SSF_ASSERT_TEST(SSFAESContextBlockEncrypt(&context, in, 16, out, 17));
+    SSF_ASSERT_TEST(SSFAESContextBlockDecrypt(NULL, in, 16, out, 16));
+    SSF_ASSERT_TEST(SSFAESContextBlockDecrypt(&context, NULL, 16, out, 16));
+    SSF_ASSERT_TEST(SSFAESContextBlockDecrypt(&context, in, 15, out, 16));
+    SSF_ASSERT_TEST(SSFAESContextBlockDecrypt(&context, in, 16, NULL, 16));
+    SSF_ASSERT_TEST(SSFAESContextBlockDecrypt(&context, in, 16, out, 17));
+    SSFAESDeInitContext(&context);
+    SSF_ASSERT_TEST(SSFAESContextBlockEncrypt(&context, in, 16, out, 16));
+
+    /* Context Monte Carlo test expands each key once for its 1000 blocks */
+    memcpy(in, _SSFAES128BlockEncryptMonteUT[0].in, 16);
+    memcpy(key, _SSFAES128BlockEncryptMonteUT[0].key, 16);
+
+    for (i = 0; i < (sizeof(_SSFAES128BlockEncryptMonteUT) / sizeof(SSFAESUT_t)); i++)
+    {
+        for (j = 0; j < 9; j++)
+        {
+            SSFAESInitContext(&context, key, 16);
+            for (k = 0; k < 1000; k++)
+            {
+                SSFAESContextBlockEncrypt(&context, in, 16, out, 16);
+                memcpy(in, out, 16);
+            }
+            SSFAESDeInitContext(&context);
+
+            if (j == 0)
+            {
+                SSF_ASSERT(memcmp(in, _SSFAES128BlockEncryptMonteUT[i].out, 16) == 0);
+            }
+
+            for (k = 0; k < 16; k++)
+            {
+                key[k] ^= in[k];
+            }
+        }
+    }
+
+    /* Context results match the per block interface for every key size, also in place */
+    for (i = 16; i <= 32; i += 8)
+    {
+        for (j = 0; j < 50; j++)
+        {
+            for (k = 0; k < 32; k++) key[k] = (uint8_t)((i * 31) + (j * 7) + (k * 13));
+            for (k = 0; k < 16; k++) in[k] = (uint8_t)((j * 11) + (k * 29));
+
+            SSFAESInitContext(&context, key, i);
+            SSFAESXXXBlockEncrypt(in, 16, out, 16, key, i);
+            SSFAESContextBlockEncrypt(&context, in, 16, &out[16], 16);
+            SSF_ASSERT(memcmp(out, &out[16], 16) == 0);
+            SSFAESXXXBlockDecrypt(in, 16, out, 16, key, i);
+            SSFAESContextBlockDecrypt(&context, in, 16, &out[16], 16);
+            SSF_ASSERT(memcmp(out, &out[16], 16) == 0);
+            memcpy(out, in, 16);
+            SSFAESContextBlockEncrypt(&context, out, 16, out, 16);
+            SSFAESContextBlockDecrypt(&context, out, 16, out, 16);
+            SSF_ASSERT(memcmp(out, in, 16) == 0);
+            SSFAESDeInitContext(&context);
+        }
+    }
+
+    SSFAESInitContext(&context, key, 16);
+    SSF_ASSERT_TEST(SSFAESContextCTR32(NULL, cb, 16, ctrIn, 16, ctrOut, 16));
+    SSF_ASSERT_TEST(SSFAESContextCTR32(&context, NULL, 16, ctrIn, 16, ctrOut, 16));
+    SSF_ASSERT_TEST(SSFAESContextCTR32(&context, cb, 15, ctrIn, 16, ctrOut, 16));
+    SSF_ASSERT_TEST(SSFAESContextCTR32(&context, cb, 16, NULL, 16, ctrOut, 16));
+    SSF_ASSERT_TEST(SSFAESContextCTR32(&context, cb, 16, ctrIn, 16, NULL, 16));
+    SSF_ASSERT_TEST(SSFAESContextCTR32(&context, cb, 16, ctrIn, 16, ctrOut, 15));
+    SSFAESDeInitContext(&context);
+
+    /* CTR matches encrypting each counter block, across the 32-bit counter wrap */
+    for (i = 0; i < sizeof(ctrIn); i++) ctrIn[i] = (uint8_t)((i * 37) + 3);
+    for (i = 16; i <= 32; i += 8)
+    {
+        for (k = 0; k < 32; k++) key[k] = (uint8_t)((i * 5) + (k * 17));
+        SSFAESInitContext(&context, key, i);
+        for (j = 0; j <= sizeof(ctrIn); j += (j < 80) ? 1 : 23)
+        {
+            uint8_t icb[16];
+
+            for (k = 0; k < 16; k++) icb[k] = (uint8_t)(k + j);
+            icb[12] = 0xff; icb[13] = 0xff; icb[14] = 0xff; icb[15] = (uint8_t)(0xfd + (j & 1));
+
+            /* Reference keystream block by block */
+            memcpy(cb, icb, 16);
+            for (k = 0; k < j; k++)
+            {
+                if ((k & 15) == 0)
+                {
+                    SSFAESXXXBlockEncrypt(cb, 16, out, 16, key, i);
+                    if (++cb[15] == 0) { if (++cb[14] == 0) { if (++cb[13] == 0) ++cb[12]; } }
+                }
+                ctrRef[k] = ctrIn[k] ^ out[k & 15];
+            }
+            memcpy(out, cb, 16);
+
+            memcpy(cb, icb, 16);
+            SSFAESContextCTR32(&context, cb, 16, ctrIn, j, ctrOut, sizeof(ctrOut));
+            SSF_ASSERT(memcmp(ctrOut, ctrRef, j) == 0);
+            SSF_ASSERT(memcmp(cb, out, 16) == 0);
+            SSF_ASSERT(memcmp(cb, icb, 12) == 0);
+
+            /* In place, and in whole block pieces continuing the counter */
+            memcpy(ctrOut, ctrIn, j);
+            memcpy(cb, icb, 16);
+            for (k = 0; k < j; k += 48)
+            {
+                uint32_t n = ((j - k) < 48) ? (j - k) : 48;
+
+                SSFAESContextCTR32(&context, cb, 16, &ctrOut[k], n, &ctrOut[k], n);
+            }
+            SSF_ASSERT(memcmp(ctrOut, ctrRef, j) == 0);
+            SSF_ASSERT(memcmp(cb, out, 16) == 0);
+        }
+        SSFAESDeInitContext(&context);
+    }
+
+    SSFAESInitContext(&context, _ssfAESModesKeyUT, 16);
+    SSF_ASSERT_TEST(SSFAESContextECBEncrypt(NULL, ctrIn, 16, ctrOut, 16));
+    SSF_ASSERT_TEST(SSFAESContextECBEncrypt(&context, NULL, 16, ctrOut, 16));
+    SSF_ASSERT_TEST(SSFAESContextECBEncrypt(&context, ctrIn, 16, NULL, 16));
+    SSF_ASSERT_TEST(SSFAESContextECBEncrypt(&context, ctrIn, 17, ctrOut, 32));
+    SSF_ASSERT_TEST(SSFAESContextECBEncrypt(&context, ctrIn, 32, ctrOut, 31));
+    SSF_ASSERT_TEST(SSFAESContextECBDecrypt(NULL, ctrIn, 16, ctrOut, 16));
+    SSF_ASSERT_TEST(SSFAESContextECBDecrypt(&context, NULL, 16, ctrOut, 16));
+    SSF_ASSERT_TEST(SSFAESContextECBDecrypt(&context, ctrIn, 16, NULL, 16));
+    SSF_ASSERT_TEST(SSFAESContextECBDecrypt(&context, ctrIn, 15, ctrOut, 16));
+    SSF_ASSERT_TEST(SSFAESContextECBDecrypt(&context, ctrIn, 32, ctrOut, 16));
+    SSF_ASSERT_TEST(SSFAESContextCBCEncrypt(NULL, cb, 16, ctrIn, 16, ctrOut, 16));
+    SSF_ASSERT_TEST(SSFAESContextCBCEncrypt(&context, NULL, 16, ctrIn, 16, ctrOut, 16));
+    SSF_ASSERT_TEST(SSFAESContextCBCEncrypt(&context, cb, 15, ctrIn, 16, ctrOut, 16));
+    SSF_ASSERT_TEST(SSFAESContextCBCEncrypt(&context, cb, 16, NULL, 16, ctrOut, 16));
+    SSF_ASSERT_TEST(SSFAESContextCBCEncrypt(&context, cb, 16, ctrIn, 16, NULL, 16));
+    SSF_ASSERT_TEST(SSFAESContextCBCEncrypt(&context, cb, 16, ctrIn, 8, ctrOut, 16));
+    SSF_ASSERT_TEST(SSFAESContextCBCEncrypt(&context, cb, 16, ctrIn, 32, ctrOut, 16));
+    SSF_ASSERT_TEST(SSFAESContextCBCDecrypt(NULL, cb, 16, ctrIn, 16, ctrOut, 16));
+    SSF_ASSERT_TEST(SSFAESContextCBCDecrypt(&context, NULL, 16, ctrIn, 16, ctrOut, 16));
+    SSF_ASSERT_TEST(SSFAESContextCBCDecrypt(&context, cb, 17, ctrIn, 16, ctrOut, 16));
+    SSF_ASSERT_TEST(SSFAESContextCBCDecrypt(&context, cb, 16, NULL, 16, ctrOut, 16));
+    SSF_ASSERT_TEST(SSFAESContextCBCDecrypt(&context, cb, 16, ctrIn, 16, NULL, 16));
+    SSF_ASSERT_TEST(SSFAESContextCBCDecrypt(&context, cb, 16, ctrIn, 1, ctrOut, 16));
+    SSF_ASSERT_TEST(SSFAESContextCBCDecrypt(&context, cb, 16, ctrIn, 32, ctrOut, 16));
+    SSF_ASSERT_TEST(SSFAESContextCTR(&context, cb, 16, 0, ctrIn, 16, ctrOut, 16));
+    SSF_ASSERT_TEST(SSFAESContextCTR(&context, cb, 16, 12, ctrIn, 16, ctrOut, 16));
+    SSF_ASSERT_TEST(SSFAESContextCTR(&context, cb, 16, 17, ctrIn, 16, ctrOut, 16));
+
+    /* Known answers, out of place, in place and chained over several calls */
+    for (j = 0; j <= 64; j += 16)
+    {
+        memset(ctrOut, 0, sizeof(ctrOut));
+        SSFAESContextECBEncrypt(&context, _ssfAESModesPtUT, j, ctrOut, sizeof(ctrOut));
+        SSF_ASSERT(memcmp(ctrOut, _ssfAESModesECBUT, j) == 0);
+        SSF_ASSERT(ctrOut[j] == 0);
+        SSFAESContextECBDecrypt(&context, ctrOut, j, ctrOut, j);
+        SSF_ASSERT(memcmp(ctrOut, _ssfAESModesPtUT, j) == 0);
+
+        memcpy(cb, _ssfAESModesCBCIVUT, 16);
+        memset(ctrOut, 0, sizeof(ctrOut));
+        SSFAESContextCBCEncrypt(&context, cb, 16, _ssfAESModesPtUT, j, ctrOut, sizeof(ctrOut));
+        SSF_ASSERT(memcmp(ctrOut, _ssfAESModesCBCUT, j) == 0);
+        SSF_ASSERT(ctrOut[j] == 0);
+        SSF_ASSERT(memcmp(cb, (j == 0) ? _ssfAESModesCBCIVUT : &_ssfAESModesCBCUT[j - 16],
+                          16) == 0);
+        memcpy(cb, _ssfAESModesCBCIVUT, 16);
+        SSFAESContextCBCDecrypt(&context, cb, 16, ctrOut, j, ctrOut, j);
+        SSF_ASSERT(memcmp(ctrOut, _ssfAESModesPtUT, j) == 0);
+
+        for (k = 4; k <= 16; k <<= 1)
+        {
+            memcpy(cb, _ssfAESModesCTRCBUT, 16);
+            memcpy(ctrOut, _ssfAESModesPtUT, 64);
+            SSFAESContextCTR(&context, cb, 16, k, ctrOut, j, ctrOut, j);
+            SSFAESContextCTR(&context, cb, 16, k, &ctrOut[j], 64 - j, &ctrOut[j], 64 - j);
+            SSF_ASSERT(memcmp(ctrOut, _ssfAESModesCTRUT, 64) == 0);
+            SSF_ASSERT(memcmp(cb, _ssfAESModesCTRCBUT, 14) == 0);
+            SSF_ASSERT((cb[14] == 0xff) && (cb[15] == 0x03));
+        }
+    }
+    memcpy(cb, _ssfAESModesCBCIVUT, 16);
+    SSFAESContextCBCEncrypt(&context, cb, 16, _ssfAESModesPtUT, 32, ctrOut, sizeof(ctrOut));
+    SSFAESContextCBCEncrypt(&context, cb, 16, &_ssfAESModesPtUT[32], 32, &ctrOut[32], 32);
+    SSF_ASSERT(memcmp(ctrOut, _ssfAESModesCBCUT, 64) == 0);
+    memcpy(cb, _ssfAESModesCBCIVUT, 16);
+    SSFAESContextCBCDecrypt(&context, cb, 16, ctrOut, 48, ctrOut, 48);
+    SSFAESContextCBCDecrypt(&context, cb, 16, &ctrOut[48], 16, &ctrOut[48], 16);
+    SSF_ASSERT(memcmp(ctrOut, _ssfAESModesPtUT, 64) == 0);
+
+    /* 64 and 128-bit counters carry out of the low 32 bits, a 32-bit counter wraps */
+    for (k = 4; k <= 16; k <<= 1)
+    {
+        uint8_t icb[16];
+
+        for (i = 0; i < 16; i++) icb[i] = (uint8_t)((i < 5) ? 0xfe : 0xff);
+        icb[15] = 0xfe;
+        memcpy(cb, icb, 16);
+        for (i = 0; i < 80; i++)
+        {
+            if ((i & 15) == 0)
+            {
+                SSFAESContextBlockEncrypt(&context, cb, 16, out, 16);
+                for (j = 15; j >= (16 - k); j--) { if ((++cb[j] != 0) || (j == 0)) break; }
+            }
+            ctrRef[i] = ctrIn[i] ^ out[i & 15];
+        }
+        memcpy(out, cb, 16);
+
+        memcpy(cb, icb, 16);
+        SSFAESContextCTR(&context, cb, 16, k, ctrIn, 80, ctrOut, sizeof(ctrOut));
+        SSF_ASSERT(memcmp(ctrOut, ctrRef, 80) == 0);
+        SSF_ASSERT(memcmp(cb, out, 16) == 0);
+        SSF_ASSERT(cb[11] == ((k == 4) ? 0xff : 0x00));
+        SSF_ASSERT(cb[7] == ((k == 16) ? 0x00 : 0xff));
+        SSF_ASSERT(cb[4] == ((k == 16) ? 0xff : 0xfe));
+    }
+    SSFAESDeInitContext(&context);
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Unit tests CTR and ECB of 0 to 9 blocks and CTR tails with every cipher against table cipher. */
+/* --------------------------------------------------------------------------------------------- */
+static void _SSFAESUnitTestCTRBlocks(void)
+{
+    static const uint8_t blocks[] = { 0, 1, 2, 3, 4, 5, 9 };
+    static const uint8_t tails[] = { 0, 1, 8, 15 };
+    uint8_t key[32];
+    uint8_t icb[16];
+    uint8_t cb[16];
+    uint8_t refCb[16];
+    uint8_t ks[16];
+    uint8_t in[(9 << 4) + 15];
+    uint8_t ref[sizeof(in)];
+    uint8_t ecb[sizeof(in)];
+    uint8_t out[sizeof(in)];
+    uint32_t keyLen, b, t, len, i;
+    uint8_t cipher;
+    SSFAESContext_t context;
+
+    for (i = 0; i < sizeof(in); i++) in[i] = (uint8_t)((i * 29) + 7);
+    for (i = 0; i < 16; i++) icb[i] = (uint8_t)((i * 13) + 1);
+    for (keyLen = 16; keyLen <= 32; keyLen += 8)
+    {
+        for (i = 0; i < keyLen; i++) key[i] = (uint8_t)((i * 11) + keyLen);
+        for (b = 0; b < sizeof(blocks); b++)
+        {
+            for (t = 0; t < sizeof(tails); t++)
+            {
+                /* Reference keystream one counter block at a time with the table cipher */
+                len = ((uint32_t)blocks[b] << 4) + tails[t];
+                SSFAESUTSetCipher(SSF_AES_CONFIG_CIPHER);
+                memcpy(refCb, icb, 16);
+                for (i = 0; i < len; i++)
+                {
+                    if ((i & 15) == 0)
+                    {
+                        SSFAESXXXBlockEncrypt(refCb, 16, ks, 16, key, keyLen);
+                        if (++refCb[15] == 0) { if (++refCb[14] == 0) ++refCb[13]; }
+                    }
+                    ref[i] = in[i] ^ ks[i & 15];
+                }
+                for (i = 0; i < ((uint32_t)blocks[b] << 4); i += 16)
+                {
+                    SSFAESXXXBlockEncrypt(&in[i], 16, &ecb[i], 16, key, keyLen);
+                }
+
+                for (cipher = 0; cipher <= (SSF_AES_CIPHER_AESNI + 1); cipher++)
+                {
+                    if ((cipher > SSF_AES_CONFIG_CIPHER) && (cipher <= SSF_AES_CIPHER_AESNI) &&
+                        ((SSF_AES_NI == 0) || (cipher != SSF_AES_CIPHER_AESNI))) continue;
+                    SSFAESUTSetCipher((cipher > SSF_AES_CIPHER_AESNI) ? SSF_AES_CIPHER_AUTO :
+                                                                        cipher);
+                    SSFAESInitContext(&context, key, keyLen);
+                    memcpy(cb, icb, 16);
+                    memset(out, 0, sizeof(out));
+                    SSFAESContextCTR32(&context, cb, 16, in, len, out, sizeof(out));
+                    SSF_ASSERT(memcmp(out, ref, len) == 0);
+                    SSF_ASSERT(memcmp(cb, refCb, 16) == 0);
+
+                    /* ECB runs up to 4 blocks per bitsliced pass with the unused lanes zeroed */
+                    memcpy(out, in, sizeof(out));
+                    SSFAESContextECBEncrypt(&context, out, (size_t)blocks[b] << 4, out,
+                                            sizeof(out));
+                    SSF_ASSERT(memcmp(out, ecb, (size_t)blocks[b] << 4) == 0);
+                    SSFAESDeInitContext(&context);
+                }
+            }
+        }
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Unit tests the AES external interface with every configured cipher implementation.            */
+/* --------------------------------------------------------------------------------------------- */
+void SSFAESUnitTest(void)
+{
+    uint8_t cipher;
+    bool isNI = false;
+
+    SSF_ASSERT_TEST(SSFAESUTSetCipher(SSF_AES_CIPHER_AESNI + 1));
+    for (cipher = 0; cipher <= SSF_AES_CONFIG_CIPHER; cipher++)
+    {
+        SSFAESUTSetCipher(cipher);
+        SSF_ASSERT(!SSFAESUTIsNIUsed());
+        _SSFAESUnitTestCipher();
+    }
+#if SSF_AES_NI == 1
+    /* Falls back to SSF_AES_CONFIG_CIPHER if the CPU does not support AES-NI */
+    SSFAESUTSetCipher(SSF_AES_CIPHER_AESNI);
+    isNI = SSFAESUTIsNIUsed();
+    _SSFAESUnitTestCipher();
+#endif /* SSF_AES_NI */
+
+    /* Auto selects as a build without the unit test does, AES-NI whenever the CPU supports it */
+    SSFAESUTSetCipher(SSF_AES_CIPHER_AUTO);
+    SSF_ASSERT(SSFAESUTIsNIUsed() == isNI);
+    _SSFAESUnitTestCipher();
+    _SSFAESUnitTestCTRBlocks();
+    SSFAESUTSetCipher(SSF_AES_CIPHER_AUTO);
 }
 #endif /* SSF_CONFIG_AES_UNIT_TEST */
 
@@ -384,44 +384,24 @@ static void _SSFAESGCMGHASH(const uint8_t *in, size_t inLen, const uint8_t *h, s
 
 /* --------------------------------------------------------------------------------------------- */
 /* --------------------------------------------------------------------------------------------- */
-static void _SSFAESGCMGCTR(const uint8_t *in, size_t inLen, const uint8_t *key, size_t keyLen,
+static void _SSFAESGCMGCTR(const uint8_t *in, size_t inLen, const SSFAESContext_t *aes,
                            const uint8_t *icb, size_t icbLen, uint8_t *out, size_t outSize)
 {
     uint8_t cb[16];
-    uint8_t buf[16];
-    uint32_t i, n;
 
     if ((in == NULL) || (out == NULL)) { return; }
 
     SSF_ASSERT(in != NULL);
-    SSF_ASSERT(key != NULL);
+    SSF_ASSERT(aes != NULL);
     SSF_ASSERT(icb != NULL);
     SSF_ASSERT(out != NULL);
 
-    SSF_ASSERT((keyLen == 16) || (keyLen == 24) || (keyLen == 32));
     SSF_ASSERT(icbLen == 16);
     SSF_ASSERT(inLen <= outSize);
 
+    /* Counter blocks are encrypted several at a time when the cipher supports it */
     memcpy(cb, icb, sizeof(cb));
-    memcpy(out, in, outSize);
-
-    n = outSize & 0xfffffff0;
-    for (i = 0; i < n; i += 16)
-    {
-        SSFAESXXXBlockEncrypt(cb, sizeof(cb), buf, sizeof(buf), key, keyLen);
-        BLOCK_XOR(&out[i], buf);
-        _SSFAESGCMBlockInc32(cb);
-    }
-
-    if (i < outSize)
-    {
-        SSFAESXXXBlockEncrypt(cb, sizeof(cb), buf, sizeof(buf), key, keyLen);
-
-        for (i = 0; i < (outSize & 0xf); i++)
-        {
-            out[n + i] ^= buf[i];
-        }
-    }
+    SSFAESContextCTR32(aes, cb, sizeof(cb), in, inLen, out, outSize);
 }
 
 /* --------------------------------------------------------------------------------------------- */
@@ -436,6 +416,7 @@ void SSFAESGCMEncrypt(const uint8_t *pt, size_t ptLen, const uint8_t *iv, size_t
     uint8_t j0[16] = {0};
     uint8_t j1[16] = {0};
     uint8_t buf[16] = {0};
+    SSFAESContext_t aes;
 
     uint32_t t;
 
@@ -448,7 +429,9 @@ void SSFAESGCMEncrypt(const uint8_t *pt, size_t ptLen, const uint8_t *iv, size_t
     SSF_ASSERT((keyLen == 16) || (keyLen == 24) || (keyLen == 32));
     SSF_ASSERT(((tagSize >= 12) && (tagSize <= 16)) || (tagSize == 8) || (tagSize == 4));
 
-    SSFAESXXXBlockEncrypt(h, sizeof(h), h, sizeof(h), key, keyLen);
+    /* Expand the key once for the hash subkey and every counter block */
+    SSFAESInitContext(&aes, key, keyLen);
+    SSFAESContextBlockEncrypt(&aes, h, sizeof(h), h, sizeof(h));
 
     if (ivLen == 12)
     {
@@ -466,7 +449,7 @@ void SSFAESGCMEncrypt(const uint8_t *pt, size_t ptLen, const uint8_t *iv, size_t
     memcpy(j1, j0, sizeof(j1));
     _SSFAESGCMBlockInc32(j1);
 
-    _SSFAESGCMGCTR(pt, ptLen, key, keyLen, j1, sizeof(j1), ct, ptLen);
+    _SSFAESGCMGCTR(pt, ptLen, &aes, j1, sizeof(j1), ct, ptLen);
 
     t = ((uint32_t)authLen << 3);
     PUT_64_LE(buf, t);
@@ -477,7 +460,8 @@ void SSFAESGCMEncrypt(const uint8_t *pt, size_t ptLen, const uint8_t *iv, size_t
     _SSFAESGCMGHASH(ct, ptLen, h, sizeof(h), s, sizeof(s));
     _SSFAESGCMGHASH(buf, sizeof(buf), h, sizeof(h), s, sizeof(s));
 
-    _SSFAESGCMGCTR(s, sizeof(s), key, keyLen, j0, sizeof(j0), s, sizeof(s));
+    _SSFAESGCMGCTR(s, sizeof(s), &aes, j0, sizeof(j0), s, sizeof(s));
+    SSFAESDeInitContext(&aes);
 
     memcpy(tag, s, sizeof(s));
 }
@@ -494,6 +478,7 @@ bool SSFAESGCMDecrypt(const uint8_t* ct, size_t ctLen, const uint8_t* iv, size_t
     uint8_t j0[16] = { 0 };
     uint8_t j1[16] = { 0 };
     uint8_t buf[16] = { 0 };
+    SSFAESContext_t aes;
 
     uint32_t t;
 
@@ -506,7 +491,9 @@ bool SSFAESGCMDecrypt(const uint8_t* ct, size_t ctLen, const uint8_t* iv, size_t
     SSF_ASSERT((keyLen == 16) || (keyLen == 24) || (keyLen == 32));
     SSF_ASSERT(((tagLen >= 12) && (tagLen <= 16)) || (tagLen == 8) || (tagLen == 4));
 
-    SSFAESXXXBlockEncrypt(h, sizeof(h), h, sizeof(h), key, keyLen);
+    /* Expand the key once for the hash subkey and every counter block */
+    SSFAESInitContext(&aes, key, keyLen);
+    SSFAESContextBlockEncrypt(&aes, h, sizeof(h), h, sizeof(h));
 
     if (ivLen == 12)
     {
@@ -524,7 +511,7 @@ bool SSFAESGCMDecrypt(const uint8_t* ct, size_t ctLen, const uint8_t* iv, size_t
     memcpy(j1, j0, sizeof(j1));
     _SSFAESGCMBlockInc32(j1);
 
-    _SSFAESGCMGCTR(ct, ctLen, key, keyLen, j1, sizeof(j1), pt, ptSize);
+    _SSFAESGCMGCTR(ct, ctLen, &aes, j1, sizeof(j1), pt, ptSize);
 
     t = ((uint32_t)authLen << 3);
     PUT_64_LE(buf, t);
@@ -535,7 +522,8 @@ bool SSFAESGCMDecrypt(const uint8_t* ct, size_t ctLen, const uint8_t* iv, size_t
     _SSFAESGCMGHASH(ct, ctLen, h, sizeof(h), s, sizeof(s));
     _SSFAESGCMGHASH(buf, sizeof(buf), h, sizeof(h), s, sizeof(s));
 
-    _SSFAESGCMGCTR(s, sizeof(s), key, keyLen, j0, sizeof(j0), s, sizeof(s));
+    _SSFAESGCMGCTR(s, sizeof(s), &aes, j0, sizeof(j0), s, sizeof(s));
+    SSFAESDeInitContext(&aes);
 
     return memcmp(s, tag, tagLen) == 0;
 }
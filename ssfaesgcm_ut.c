@@ -33,6 +33,7 @@
 #include <stdbool.h>
 #include <stdio.h>
 #include "ssfaesgcm.h"
+#include "ssfaes.h"
 #include "ssfassert.h"
 
 #if SSF_CONFIG_AESGCM_UNIT_TEST == 1
@@ -3273,6 +3274,29 @@ void SSFAESGCMUnitTest(void)
                        || (memcmp(pt, _AESGCMUT[i].pt, _AESGCMUT[i].ptLen) == 0));
         }
     }
+
+#if (SSF_AES_CONFIG_ENABLE_BITSLICE == 1) && (SSF_CONFIG_AES_UNIT_TEST == 1)
+    /* Bitsliced hash key, tag mask and CTR of any length give the known answers per cipher */
+    for (j = 0; j <= SSF_AES_CIPHER_AESNI; j++)
+    {
+        if ((j > SSF_AES_CONFIG_CIPHER) &&
+            ((SSF_AES_NI == 0) || (j != SSF_AES_CIPHER_AESNI))) continue;
+        SSFAESUTSetCipher((uint8_t)j);
+        for (i = 7; i < sizeof(_AESGCMUT) / sizeof(SSFAESGCMUT_t); i++)
+        {
+            if (_AESGCMUT[i].pf != 0) continue;
+            memset(ct, 0, sizeof(ct));
+            memset(tag, 0, sizeof(tag));
+            SSFAESGCMEncrypt(_AESGCMUT[i].pt, _AESGCMUT[i].ptLen, _AESGCMUT[i].iv,
+                             _AESGCMUT[i].ivLen, _AESGCMUT[i].auth, _AESGCMUT[i].authLen,
+                             _AESGCMUT[i].key, _AESGCMUT[i].keyLen, tag, _AESGCMUT[i].tagLen,
+                             ct, _AESGCMUT[i].ctLen);
+            SSF_ASSERT(memcmp(tag, _AESGCMUT[i].tag, _AESGCMUT[i].tagLen) == 0);
+            SSF_ASSERT(memcmp(ct, _AESGCMUT[i].ct, _AESGCMUT[i].ctLen) == 0);
+        }
+    }
+    SSFAESUTSetCipher(SSF_AES_CIPHER_AUTO);
+#endif /* SSF_AES_CONFIG_ENABLE_BITSLICE, SSF_CONFIG_AES_UNIT_TEST */
 }
 
 #endif /* SSF_CONFIG_AESGCM_UNIT_TEST */
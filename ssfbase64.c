@@ -31,131 +31,697 @@
 /* --------------------------------------------------------------------------------------------- */
 #include <stdint.h>
 #include <stdbool.h>
+#include <string.h>
 #include "ssfport.h"
 #include "ssfassert.h"
 #include "ssfbase64.h"
 
+#if (SSF_BASE64_CONFIG_DECODE == 1) || (SSF_BASE64_CONFIG_ENCODE == 1)
+    #include <tmmintrin.h>
+#elif (SSF_BASE64_CONFIG_DECODE == 2) || (SSF_BASE64_CONFIG_ENCODE == 2)
+    #include <arm_neon.h>
+#endif /* SSF_BASE64_CONFIG_DECODE || SSF_BASE64_CONFIG_ENCODE */
+
+/* --------------------------------------------------------------------------------------------- */
+/* Defines                                                                                       */
+/* --------------------------------------------------------------------------------------------- */
+#define SSF_BASE64_DEC_PAD (64u)
+#define SSF_BASE64_STREAM_MAGIC (0x42363453u)
+#if SSF_BASE64_CONFIG_DECODE == 1
+#define SSF_BASE64_DEC_IN_WIDTH (16u)
+#define SSF_BASE64_DEC_OUT_WIDTH (12u)
+#define SSF_BASE64_DEC_STORE_WIDTH (16u)
+#elif SSF_BASE64_CONFIG_DECODE == 2
+#define SSF_BASE64_DEC_IN_WIDTH (64u)
+#define SSF_BASE64_DEC_OUT_WIDTH (48u)
+#define SSF_BASE64_DEC_STORE_WIDTH (48u)
+#endif /* SSF_BASE64_CONFIG_DECODE */
+#if SSF_BASE64_CONFIG_ENCODE == 1
+#define SSF_BASE64_ENC_IN_WIDTH (12u)
+#define SSF_BASE64_ENC_LOAD_WIDTH (16u)
+#define SSF_BASE64_ENC_OUT_WIDTH (16u)
+#elif SSF_BASE64_CONFIG_ENCODE == 2
+#define SSF_BASE64_ENC_IN_WIDTH (48u)
+#define SSF_BASE64_ENC_LOAD_WIDTH (48u)
+#define SSF_BASE64_ENC_OUT_WIDTH (64u)
+#endif /* SSF_BASE64_CONFIG_ENCODE */
+#define SSF_BASE64_FMT_IS_URL(fmt) (((fmt) == SSF_BASE64_FMT_URL) || \
+                                    ((fmt) == SSF_BASE64_FMT_URL_NOPAD))
+#define SSF_BASE64_FMT_IS_PAD(fmt) (((fmt) == SSF_BASE64_FMT_STD) || \
+                                    ((fmt) == SSF_BASE64_FMT_URL))
+
 /* --------------------------------------------------------------------------------------------- */
 /* Local vars                                                                                    */
 /* --------------------------------------------------------------------------------------------- */
 static const uint8_t _b64[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/=";
+static const uint8_t _b64Url[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_=";
+
+/* Maps a char to its encoding of 0-63, 64 for '=' pad, else 65 for invalid */
+static const uint8_t _b64Dec[256] =
+{
+    65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+    65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+    65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 62, 65, 65, 65, 63,
+    52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 65, 65, 65, 64, 65, 65,
+    65,  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14,
+    15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 65, 65, 65, 65, 65,
+    65, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40,
+    41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 65, 65, 65, 65, 65,
+    65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+    65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+    65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+    65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+    65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+    65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+    65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+    65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65
+};
+
+/* Maps a char of the URL and filename safe alphabet to its encoding, same as _b64Dec otherwise */
+static const uint8_t _b64UrlDec[256] =
+{
+    65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+    65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+    65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 62, 65, 65,
+    52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 65, 65, 65, 64, 65, 65,
+    65,  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14,
+    15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 65, 65, 65, 65, 63,
+    65, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40,
+    41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 65, 65, 65, 65, 65,
+    65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+    65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+    65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+    65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+    65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+    65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+    65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+    65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65
+};
+
+#if SSF_BASE64_CONFIG_DECODE != 0
+/* Classes of a char's low and high nibbles, a char is invalid when both share a bit */
+static const uint8_t _b64DecLutLo[16] =
+{
+    0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1a, 0x1b, 0x1b, 0x1b, 0x1a
+};
+static const uint8_t _b64DecLutHi[16] =
+{
+    0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10
+};
+/* Offset added to a valid char to get its encoding, selected by its high nibble, 1 for '/' */
+static const uint8_t _b64DecLutRoll[16] =
+{
+    0, 16, 19, 4, (uint8_t)-65, (uint8_t)-65, (uint8_t)-71, (uint8_t)-71, 0, 0, 0, 0, 0, 0, 0, 0
+};
+#endif /* SSF_BASE64_CONFIG_DECODE */
+
+#if SSF_BASE64_CONFIG_ENCODE == 1
+/* Offset added to an encoding to get its char, selected by its range of the alphabet */
+static const uint8_t _b64EncLut[16] =
+{
+    65, 71, (uint8_t)-4, (uint8_t)-4, (uint8_t)-4, (uint8_t)-4, (uint8_t)-4, (uint8_t)-4,
+    (uint8_t)-4, (uint8_t)-4, (uint8_t)-4, (uint8_t)-4, (uint8_t)-19, (uint8_t)-16, 0, 0
+};
+static const uint8_t _b64UrlEncLut[16] =
+{
+    65, 71, (uint8_t)-4, (uint8_t)-4, (uint8_t)-4, (uint8_t)-4, (uint8_t)-4, (uint8_t)-4,
+    (uint8_t)-4, (uint8_t)-4, (uint8_t)-4, (uint8_t)-4, (uint8_t)-17, 32, 0, 0
+};
+#endif /* SSF_BASE64_CONFIG_ENCODE */
 
 /* --------------------------------------------------------------------------------------------- */
-/* Returns encoding of 0-63 for valid encoded char, 64 for '=' pad, else 65 for invalid.         */
+/* Returns true if quad has no pad or invalid char and is decoded into 3 bytes, else false.      */
 /* --------------------------------------------------------------------------------------------- */
-static uint8_t _SSFBase64GetEncoding(uint8_t e)
+static bool _SSFBase64DecQuad(const uint8_t *dec, const uint8_t *in, uint8_t *out)
 {
-    const uint8_t *p = _b64;
+    uint32_t a = dec[in[0]];
+    uint32_t b = dec[in[1]];
+    uint32_t c = dec[in[2]];
+    uint32_t d = dec[in[3]];
 
-    while ((*p != e) && (*p != 0)) p++;
-    return (uint8_t)(p - _b64);
+    /* Only pad and invalid encodings have bits above the low 6 bits */
+    if ((a | b | c | d) >= SSF_BASE64_DEC_PAD) return false;
+    a = (a << 18) | (b << 12) | (c << 6) | d;
+    out[0] = (uint8_t)(a >> 16);
+    out[1] = (uint8_t)(a >> 8);
+    out[2] = (uint8_t)a;
+    return true;
 }
 
+#if SSF_BASE64_CONFIG_DECODE == 1
 /* --------------------------------------------------------------------------------------------- */
-/* Returns 1-3 on successful 32-bit block decode into 24-bit output, else 0 on decode error.     */
+/* Returns true if 16 chars have no pad or invalid char and are decoded to 12 bytes, else false. */
 /* --------------------------------------------------------------------------------------------- */
-uint8_t SSFBase64Dec32To24(const char *b32, uint8_t *b24out, size_t b24outSize)
+static bool _SSFBase64DecBlock(const uint8_t *in, uint8_t *out)
 {
-    uint8_t a;
-    uint8_t b;
-    uint8_t c;
-    uint8_t d;
+    __m128i v = _mm_loadu_si128((const __m128i *)in);
+    __m128i nib = _mm_set1_epi8(0x0f);
+    __m128i hi = _mm_and_si128(_mm_srli_epi32(v, 4), nib);
+    __m128i m;
 
-    SSF_REQUIRE(b32 != NULL);
-    SSF_REQUIRE(b24out != NULL);
-    SSF_REQUIRE(b24outSize >= 3);
+    m = _mm_and_si128(_mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)_b64DecLutLo),
+                                       _mm_and_si128(v, nib)),
+                      _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)_b64DecLutHi), hi));
+    if (_mm_movemask_epi8(_mm_cmpeq_epi8(m, _mm_setzero_si128())) != 0xffff) return false;
+    hi = _mm_add_epi8(hi, _mm_cmpeq_epi8(v, _mm_set1_epi8(0x2f)));
+    v = _mm_add_epi8(v, _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)_b64DecLutRoll), hi));
 
-    a = _SSFBase64GetEncoding(*b32);
-    b = _SSFBase64GetEncoding(*(b32 + 1));
-    c = _SSFBase64GetEncoding(*(b32 + 2));
-    d = _SSFBase64GetEncoding(*(b32 + 3));
+    /* Pack each four 6-bit encodings into 24 bits, then into 12 big endian bytes */
+    v = _mm_maddubs_epi16(v, _mm_set1_epi32(0x01400140));
+    v = _mm_madd_epi16(v, _mm_set1_epi32(0x00011000));
+    v = _mm_shuffle_epi8(v, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+    _mm_storeu_si128((__m128i *)out, v);
+    return true;
+}
+#elif SSF_BASE64_CONFIG_DECODE == 2
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if 64 chars have no pad or invalid char and are decoded to 48 bytes, else false. */
+/* --------------------------------------------------------------------------------------------- */
+static bool _SSFBase64DecBlock(const uint8_t *in, uint8_t *out)
+{
+    uint8x16x4_t v = vld4q_u8(in);
+    uint8x16x3_t o;
+    uint8x16_t lutLo = vld1q_u8(_b64DecLutLo);
+    uint8x16_t lutHi = vld1q_u8(_b64DecLutHi);
+    uint8x16_t lutRoll = vld1q_u8(_b64DecLutRoll);
+    uint8x16_t m = vdupq_n_u8(0);
+    uint8x16_t hi;
+    uint8_t i;
+
+    /* Each of the 4 vectors holds one char position of 16 quads */
+    for (i = 0; i < 4; i++)
+    {
+        hi = vshrq_n_u8(v.val[i], 4);
+        m = vorrq_u8(m, vandq_u8(vqtbl1q_u8(lutLo, vandq_u8(v.val[i], vdupq_n_u8(0x0f))),
+                                 vqtbl1q_u8(lutHi, hi)));
+        hi = vaddq_u8(hi, vceqq_u8(v.val[i], vdupq_n_u8(0x2f)));
+        v.val[i] = vaddq_u8(v.val[i], vqtbl1q_u8(lutRoll, hi));
+    }
+    if (vmaxvq_u8(m) != 0) return false;
+
+    o.val[0] = vorrq_u8(vshlq_n_u8(v.val[0], 2), vshrq_n_u8(v.val[1], 4));
+    o.val[1] = vorrq_u8(vshlq_n_u8(v.val[1], 4), vshrq_n_u8(v.val[2], 2));
+    o.val[2] = vorrq_u8(vshlq_n_u8(v.val[2], 6), v.val[3]);
+    vst3q_u8(out, o);
+    return true;
+}
+#endif /* SSF_BASE64_CONFIG_DECODE */
+
+#if SSF_BASE64_CONFIG_ENCODE == 1
+/* --------------------------------------------------------------------------------------------- */
+/* Encodes 12 bytes of in as 16 chars of the alphabet at out, reads 16 bytes of in.              */
+/* --------------------------------------------------------------------------------------------- */
+static void _SSFBase64EncBlock(const uint8_t *alpha, const uint8_t *in, char *out)
+{
+    __m128i v = _mm_loadu_si128((const __m128i *)in);
+    __m128i lut = _mm_loadu_si128((const __m128i *)((alpha == _b64) ? _b64EncLut :
+                                                                     _b64UrlEncLut));
+    __m128i t;
+
+    /* Spread each 3 bytes over 4 bytes, then move each 6-bit encoding into its own byte */
+    v = _mm_shuffle_epi8(v, _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10));
+    t = _mm_mulhi_epu16(_mm_and_si128(v, _mm_set1_epi32(0x0fc0fc00)),
+                        _mm_set1_epi32(0x04000040));
+    v = _mm_mullo_epi16(_mm_and_si128(v, _mm_set1_epi32(0x003f03f0)),
+                        _mm_set1_epi32(0x01000010));
+    v = _mm_or_si128(v, t);
+
+    /* Select the offset to each char by the range its encoding is in */
+    t = _mm_subs_epu8(v, _mm_set1_epi8(51));
+    t = _mm_sub_epi8(t, _mm_cmpgt_epi8(v, _mm_set1_epi8(25)));
+    v = _mm_add_epi8(v, _mm_shuffle_epi8(lut, t));
+    _mm_storeu_si128((__m128i *)out, v);
+}
+#elif SSF_BASE64_CONFIG_ENCODE == 2
+/* --------------------------------------------------------------------------------------------- */
+/* Encodes 48 bytes of in as 64 chars of the alphabet at out.                                    */
+/* --------------------------------------------------------------------------------------------- */
+static void _SSFBase64EncBlock(const uint8_t *alpha, const uint8_t *in, char *out)
+{
+    uint8x16x3_t v = vld3q_u8(in);
+    uint8x16x4_t lut;
+    uint8x16x4_t o;
+    uint8x16_t m = vdupq_n_u8(0x3f);
+    uint8_t i;
+
+    for (i = 0; i < 4; i++) lut.val[i] = vld1q_u8(&alpha[i << 4]);
+    o.val[0] = vshrq_n_u8(v.val[0], 2);
+    o.val[1] = vandq_u8(vorrq_u8(vshlq_n_u8(v.val[0], 4), vshrq_n_u8(v.val[1], 4)), m);
+    o.val[2] = vandq_u8(vorrq_u8(vshlq_n_u8(v.val[1], 2), vshrq_n_u8(v.val[2], 6)), m);
+    o.val[3] = vandq_u8(v.val[2], m);
+    for (i = 0; i < 4; i++) o.val[i] = vqtbl4q_u8(lut, o.val[i]);
+    vst4q_u8((uint8_t *)out, o);
+}
+#endif /* SSF_BASE64_CONFIG_ENCODE */
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns 1-3 on successful quad decode using dec table into 3 bytes, else 0 on decode error.   */
+/* --------------------------------------------------------------------------------------------- */
+static uint8_t _SSFBase64Dec32To24(const uint8_t *dec, const uint8_t *b32, uint8_t *b24out)
+{
+    uint8_t a = dec[b32[0]];
+    uint8_t b = dec[b32[1]];
+    uint8_t c = dec[b32[2]];
+    uint8_t d = dec[b32[3]];
 
-    if (b24outSize == 0) return 0;
     if (a >= 64 || b >= 64 || c >= 65 || d >= 65) return 0;
     if (c == 64 && d != 64) return 0;
     *b24out = (uint8_t)((a << 2) | (b >> 4));
     if (c == 64) return 1;
-    if (b24outSize == 1) return 0;
     *(b24out + 1) = (uint8_t)((b << 4) | (c >> 2));
     if (d == 64) return 2;
-    if (b24outSize == 2) return 0;
     *(b24out + 2) = (uint8_t)((c << 6) | d);
     return 3;
 }
 
 /* --------------------------------------------------------------------------------------------- */
-/* Encodes 24-bit input block as 32-bit output.                                                  */
+/* Returns 1-3 on successful 32-bit block decode into 24-bit output, else 0 on decode error.     */
 /* --------------------------------------------------------------------------------------------- */
-void SSFBase64Enc24To32(const uint8_t *b24in, size_t b24len, char *b32out, size_t b32outSize)
+uint8_t SSFBase64Dec32To24(const char *b32, uint8_t *b24out, size_t b24outSize)
 {
-    uint8_t b24[3];
+    SSF_REQUIRE(b32 != NULL);
+    SSF_REQUIRE(b24out != NULL);
+    SSF_REQUIRE(b24outSize >= 3);
 
-    SSF_REQUIRE(b24in != NULL);
-    SSF_REQUIRE(b24len > 0);
-    SSF_REQUIRE(b32out != NULL);
-    SSF_REQUIRE(b32outSize >= 4);
+    return _SSFBase64Dec32To24(_b64Dec, (const uint8_t *)b32, b24out);
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Encodes 1-3 bytes of b24in as 4 chars of the alphabet, padded with '=' if less than 3.        */
+/* --------------------------------------------------------------------------------------------- */
+static void _SSFBase64Enc24To32(const uint8_t *alpha, const uint8_t *b24in, size_t b24len,
+                                char *b32out)
+{
+    uint8_t b24[3];
 
     b24[0] = b24in[0];
     if (b24len >= 2)  b24[1] = b24in[1];
     else b24[1] = 0;
     if (b24len >= 3) b24[2] = b24in[2];
     else b24[2] = 0;
-    *b32out = _b64[*b24 >> 2];
-    *(b32out + 1) = _b64[((*b24 << 4) & 0x3f) | (*(b24 + 1) >> 4)];
-    if (b24len >= 2) *(b32out + 2) = _b64[((*(b24 + 1) << 2) & 0x3f) | (*(b24 + 2) >> 6)];
+    *b32out = alpha[*b24 >> 2];
+    *(b32out + 1) = alpha[((*b24 << 4) & 0x3f) | (*(b24 + 1) >> 4)];
+    if (b24len >= 2) *(b32out + 2) = alpha[((*(b24 + 1) << 2) & 0x3f) | (*(b24 + 2) >> 6)];
     else b32out[2] = '=';
-    if (b24len >= 3) *(b32out + 3) = _b64[*(b24 + 2) & 0x3f];
+    if (b24len >= 3) *(b32out + 3) = alpha[*(b24 + 2) & 0x3f];
     else b32out[3] = '=';
 }
 
 /* --------------------------------------------------------------------------------------------- */
-/* Returns true if input successfully encoded as C string output, else false.                    */
+/* Encodes 24-bit input block as 32-bit output.                                                  */
 /* --------------------------------------------------------------------------------------------- */
-bool SSFBase64Encode(const uint8_t *in, size_t inLen, SSFCStrOut_t out, size_t outSize,
-                     size_t *outLen)
+void SSFBase64Enc24To32(const uint8_t *b24in, size_t b24len, char *b32out, size_t b32outSize)
+{
+    SSF_REQUIRE(b24in != NULL);
+    SSF_REQUIRE(b24len > 0);
+    SSF_REQUIRE(b32out != NULL);
+    SSF_REQUIRE(b32outSize >= 4);
+
+    _SSFBase64Enc24To32(_b64, b24in, b24len, b32out);
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if input successfully encoded as C string output in fmt, else false.             */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFBase64EncodeFmt(const uint8_t *in, size_t inLen, SSFCStrOut_t out, size_t outSize,
+                        size_t *outLen, SSFBase64Fmt_t fmt)
 {
+    const uint8_t *alpha;
+    char b32[4];
+    size_t len;
+
     SSF_REQUIRE(in != NULL);
     SSF_REQUIRE(out != NULL);
+    SSF_REQUIRE(fmt < SSF_BASE64_FMT_MAX);
 
+    alpha = SSF_BASE64_FMT_IS_URL(fmt) ? _b64Url : _b64;
     if (outLen != NULL) *outLen = 0;
-    while ((inLen > 0) && (outSize >= 5))
+#if SSF_BASE64_CONFIG_ENCODE != 0
+    /* Encode wide blocks while their loads and stores stay within in and out */
+    while ((inLen >= SSF_BASE64_ENC_LOAD_WIDTH) && (outSize >= SSF_BASE64_ENC_OUT_WIDTH))
     {
-        SSFBase64Enc24To32(in, inLen, out, outSize);
+        _SSFBase64EncBlock(alpha, in, out);
+        in += SSF_BASE64_ENC_IN_WIDTH;
+        inLen -= SSF_BASE64_ENC_IN_WIDTH;
+        out += SSF_BASE64_ENC_OUT_WIDTH;
+        outSize -= SSF_BASE64_ENC_OUT_WIDTH;
+        if (outLen != NULL) *outLen += SSF_BASE64_ENC_OUT_WIDTH;
+    }
+#endif /* SSF_BASE64_CONFIG_ENCODE */
+    while ((inLen >= 3) && (outSize >= 5))
+    {
+        _SSFBase64Enc24To32(alpha, in, 3, out);
         in += 3;
-        if (inLen >= 3) inLen -= 3;
-        else inLen = 0;
+        inLen -= 3;
         out += 4;
         outSize -= 4;
         if (outLen != NULL) *outLen += 4;
     }
+    if ((inLen > 0) && (inLen < 3))
+    {
+        /* Unpadded output drops the pads of the last block */
+        len = SSF_BASE64_FMT_IS_PAD(fmt) ? 4 : (inLen + 1);
+        if (outSize > len)
+        {
+            _SSFBase64Enc24To32(alpha, in, inLen, b32);
+            memcpy(out, b32, len);
+            inLen = 0;
+            out += len;
+            outSize -= len;
+            if (outLen != NULL) *outLen += len;
+        }
+    }
     if (outSize > 0) *out = 0;
     return inLen == 0;
 }
 
 /* --------------------------------------------------------------------------------------------- */
-/* Returns true if C string input successfully decoded as output, else false.                    */
+/* Returns true if input successfully encoded as C string output, else false.                    */
 /* --------------------------------------------------------------------------------------------- */
-bool SSFBase64Decode(SSFCStrIn_t in, size_t inLenLim, uint8_t *out, size_t outSize,
+bool SSFBase64Encode(const uint8_t *in, size_t inLen, SSFCStrOut_t out, size_t outSize,
                      size_t *outLen)
 {
+    return SSFBase64EncodeFmt(in, inLen, out, outSize, outLen, SSF_BASE64_FMT_STD);
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if input in fmt successfully decoded as output, else false.                      */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFBase64DecodeFmt(SSFCStrIn_t in, size_t inLenLim, uint8_t *out, size_t outSize,
+                        size_t *outLen, SSFBase64Fmt_t fmt)
+{
+    const uint8_t *b = (const uint8_t *)in;
+    const uint8_t *dec;
+    uint8_t b32[4];
+    uint8_t b24[3];
     uint8_t len;
+    bool isPad;
 
     SSF_REQUIRE(in != NULL);
     SSF_REQUIRE(out != NULL);
     SSF_REQUIRE(outLen != NULL);
+    SSF_REQUIRE(fmt < SSF_BASE64_FMT_MAX);
 
-    if ((inLenLim & 0x03) != 0) return false;
+    dec = SSF_BASE64_FMT_IS_URL(fmt) ? _b64UrlDec : _b64Dec;
+    isPad = SSF_BASE64_FMT_IS_PAD(fmt);
+    /* Unpadded input may end with a partial quad of 2 or 3 chars */
+    if (isPad ? ((inLenLim & 0x03) != 0) : ((inLenLim & 0x03) == 1)) return false;
     *outLen = 0;
-    while (inLenLim >= 4)
+#if SSF_BASE64_CONFIG_DECODE != 0
+    /* Decode wide blocks of the standard alphabet until one holds a pad or invalid char */
+    while ((dec == _b64Dec) && (inLenLim >= SSF_BASE64_DEC_IN_WIDTH) &&
+           (outSize >= SSF_BASE64_DEC_STORE_WIDTH) && _SSFBase64DecBlock(b, out))
+    {
+        b += SSF_BASE64_DEC_IN_WIDTH;
+        inLenLim -= SSF_BASE64_DEC_IN_WIDTH;
+        out += SSF_BASE64_DEC_OUT_WIDTH;
+        outSize -= SSF_BASE64_DEC_OUT_WIDTH;
+        *outLen += SSF_BASE64_DEC_OUT_WIDTH;
+    }
+#endif /* SSF_BASE64_CONFIG_DECODE */
+    /* Decode full quads until one holds a pad or invalid char */
+    while ((inLenLim >= 4) && (outSize >= 3) && _SSFBase64DecQuad(dec, b, out))
     {
-        if ((len = SSFBase64Dec32To24(in, out, outSize)) == 0) return false;
+        b += 4;
         inLenLim -= 4;
-        in += 4;
+        out += 3;
+        outSize -= 3;
+        *outLen += 3;
+    }
+    /* Decode the rest a quad at a time, bounded by the space left in out */
+    while (inLenLim != 0)
+    {
+        if (inLenLim >= 4) memcpy(b32, b, 4);
+        else
+        {
+            /* Pad the partial quad of unpadded input, which itself may not hold a pad */
+            if (dec[b[inLenLim - 1]] == SSF_BASE64_DEC_PAD) return false;
+            memcpy(b32, b, inLenLim);
+            memset(&b32[inLenLim], '=', 4 - inLenLim);
+        }
+        if ((len = _SSFBase64Dec32To24(dec, b32, b24)) == 0) return false;
+        if ((!isPad) && (inLenLim >= 4) && (len < 3)) return false;
+        if (len > outSize) return false;
+        memcpy(out, b24, len);
+        inLenLim -= (inLenLim >= 4) ? 4 : inLenLim;
+        b += 4;
         out += len;
+        outSize -= len;
         *outLen += len;
-        if (outSize >= len) outSize -= len;
-        else outSize = 0;
     }
-    return inLenLim == 0;
+    return true;
 }
 
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if C string input successfully decoded as output, else false.                    */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFBase64Decode(SSFCStrIn_t in, size_t inLenLim, uint8_t *out, size_t outSize,
+                     size_t *outLen)
+{
+    return SSFBase64DecodeFmt(in, inLenLim, out, outSize, outLen, SSF_BASE64_FMT_STD);
+}
+
+#if SSF_BASE64_CONFIG_ENABLE_STREAM == 1
+/* --------------------------------------------------------------------------------------------- */
+/* Inits a streaming encoder context that outputs fmt.                                          */
+/* --------------------------------------------------------------------------------------------- */
+void SSFBase64EncInit(SSFBase64Stream_t *ctx, SSFBase64Fmt_t fmt)
+{
+    SSF_REQUIRE(ctx != NULL);
+    SSF_REQUIRE(fmt < SSF_BASE64_FMT_MAX);
+
+    memset(ctx, 0, sizeof(SSFBase64Stream_t));
+    ctx->fmt = fmt;
+    ctx->magic = SSF_BASE64_STREAM_MAGIC;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if all of in is encoded or kept for the next call, else false if out too small.  */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFBase64EncUpdate(SSFBase64Stream_t *ctx, const uint8_t *in, size_t inLen,
+                        SSFCStrOut_t out, size_t outSize, size_t *outLen)
+{
+    const uint8_t *alpha;
+
+    SSF_REQUIRE(ctx != NULL);
+    SSF_REQUIRE(ctx->magic == SSF_BASE64_STREAM_MAGIC);
+    SSF_REQUIRE(!ctx->isDec);
+    SSF_REQUIRE(in != NULL);
+    SSF_REQUIRE(out != NULL);
+    SSF_REQUIRE(outLen != NULL);
+
+    *outLen = 0;
+    if ((((inLen / 3) + ((ctx->bufLen + (inLen % 3)) / 3)) * 4) > outSize) return false;
+    alpha = SSF_BASE64_FMT_IS_URL(ctx->fmt) ? _b64Url : _b64;
+
+    /* Complete the bytes left over from the last call into a block first */
+    if (ctx->bufLen != 0)
+    {
+        while ((ctx->bufLen < 3) && (inLen != 0))
+        { ctx->buf[ctx->bufLen] = *in; ctx->bufLen++; in++; inLen--; }
+        if (ctx->bufLen < 3) return true;
+        _SSFBase64Enc24To32(alpha, ctx->buf, 3, out);
+        ctx->bufLen = 0;
+        *outLen = 4;
+    }
+    while (inLen >= 3)
+    {
+        _SSFBase64Enc24To32(alpha, in, 3, &out[*outLen]);
+        in += 3;
+        inLen -= 3;
+        *outLen += 4;
+    }
+    memcpy(ctx->buf, in, inLen);
+    ctx->bufLen = (uint8_t)inLen;
+    return true;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if left over bytes are encoded, with pads if fmt has them, else false.           */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFBase64EncFinal(SSFBase64Stream_t *ctx, SSFCStrOut_t out, size_t outSize,
+                       size_t *outLen)
+{
+    char b32[4];
+    size_t len;
+
+    SSF_REQUIRE(ctx != NULL);
+    SSF_REQUIRE(ctx->magic == SSF_BASE64_STREAM_MAGIC);
+    SSF_REQUIRE(!ctx->isDec);
+    SSF_REQUIRE(out != NULL);
+    SSF_REQUIRE(outLen != NULL);
+
+    *outLen = 0;
+    if (ctx->bufLen == 0) return true;
+    len = SSF_BASE64_FMT_IS_PAD(ctx->fmt) ? 4 : ((size_t)ctx->bufLen + 1);
+    if (outSize < len) return false;
+    _SSFBase64Enc24To32(SSF_BASE64_FMT_IS_URL(ctx->fmt) ? _b64Url : _b64, ctx->buf, ctx->bufLen,
+                        b32);
+    memcpy(out, b32, len);
+    ctx->bufLen = 0;
+    *outLen = len;
+    return true;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Inits a streaming decoder context that accepts fmt.                                          */
+/* --------------------------------------------------------------------------------------------- */
+void SSFBase64DecInit(SSFBase64Stream_t *ctx, SSFBase64Fmt_t fmt)
+{
+    SSF_REQUIRE(ctx != NULL);
+    SSF_REQUIRE(fmt < SSF_BASE64_FMT_MAX);
+
+    memset(ctx, 0, sizeof(SSFBase64Stream_t));
+    ctx->fmt = fmt;
+    ctx->isDec = true;
+    ctx->magic = SSF_BASE64_STREAM_MAGIC;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if quad decoded and appended to out, else false and ctx is in error.             */
+/* --------------------------------------------------------------------------------------------- */
+static bool _SSFBase64StreamDecQuad(SSFBase64Stream_t *ctx, const char *quad, uint8_t *out,
+                                    size_t *outLen)
+{
+    uint8_t b24[3];
+    uint8_t len;
+
+    /* Nothing may follow the quad holding a pad, and unpadded formats may not hold one */
+    if (ctx->isEnd ||
+        ((len = _SSFBase64Dec32To24(SSF_BASE64_FMT_IS_URL(ctx->fmt) ? _b64UrlDec : _b64Dec,
+                                    (const uint8_t *)quad, b24)) == 0) ||
+        ((len < 3) && !SSF_BASE64_FMT_IS_PAD(ctx->fmt)))
+    { ctx->isErr = true; return false; }
+    memcpy(&out[*outLen], b24, len);
+    *outLen += len;
+    ctx->isEnd = len < 3;
+    return true;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if all of in is decoded or kept for the next call, else false.                   */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFBase64DecUpdate(SSFBase64Stream_t *ctx, SSFCStrIn_t in, size_t inLen, uint8_t *out,
+                        size_t outSize, size_t *outLen)
+{
+    size_t quads;
+    size_t len;
+
+    SSF_REQUIRE(ctx != NULL);
+    SSF_REQUIRE(ctx->magic == SSF_BASE64_STREAM_MAGIC);
+    SSF_REQUIRE(ctx->isDec);
+    SSF_REQUIRE(in != NULL);
+    SSF_REQUIRE(out != NULL);
+    SSF_REQUIRE(outLen != NULL);
+
+    *outLen = 0;
+    if (ctx->isErr) return false;
+    /* Out too small is not an error, the call may be repeated with more space */
+    if ((((inLen / 4) + ((ctx->bufLen + (inLen % 4)) / 4)) * 3) > outSize) return false;
+
+    /* Complete the chars left over from the last call into a quad first */
+    if (ctx->bufLen != 0)
+    {
+        while ((ctx->bufLen < 4) && (inLen != 0))
+        { ctx->buf[ctx->bufLen] = (uint8_t)*in; ctx->bufLen++; in++; inLen--; }
+        if (ctx->bufLen < 4) return true;
+        ctx->bufLen = 0;
+        if (!_SSFBase64StreamDecQuad(ctx, (const char *)ctx->buf, out, outLen)) return false;
+    }
+
+    /* Bulk decode all but the last quad, which alone may hold a pad */
+    quads = inLen / 4;
+    if (quads > 1)
+    {
+        if (ctx->isEnd ||
+            !SSFBase64DecodeFmt(in, (quads - 1) * 4, &out[*outLen], outSize - *outLen, &len,
+                                ctx->fmt) ||
+            (len != ((quads - 1) * 3)))
+        { ctx->isErr = true; return false; }
+        *outLen += len;
+        in += (quads - 1) * 4;
+        inLen -= (quads - 1) * 4;
+    }
+    if ((quads != 0) && !_SSFBase64StreamDecQuad(ctx, in, out, outLen)) return false;
+    if (quads != 0) { in += 4; inLen -= 4; }
+
+    if ((inLen != 0) && ctx->isEnd) { ctx->isErr = true; return false; }
+    memcpy(ctx->buf, in, inLen);
+    ctx->bufLen = (uint8_t)inLen;
+    return true;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if chars taken from fifo, while their quads fit in out, decoded, else false.     */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFBase64DecUpdateBFifo(SSFBase64Stream_t *ctx, SSFBFifo_t *fifo, uint8_t *out,
+                             size_t outSize, size_t *outLen)
+{
+    char chunk[64];
+    size_t room;
+    size_t len;
+    size_t n;
+
+    SSF_REQUIRE(ctx != NULL);
+    SSF_REQUIRE(ctx->magic == SSF_BASE64_STREAM_MAGIC);
+    SSF_REQUIRE(ctx->isDec);
+    SSF_REQUIRE(fifo != NULL);
+    SSF_REQUIRE(out != NULL);
+    SSF_REQUIRE(outLen != NULL);
+
+    *outLen = 0;
+    while (!ctx->isErr)
+    {
+        /* Chars beyond those that complete quads fitting in out are left in the fifo */
+        room = ((outSize - *outLen) / 3) * 4;
+        if (room <= ctx->bufLen) break;
+        room -= ctx->bufLen;
+        for (n = 0; (n < room) && (n < sizeof(chunk)) &&
+                    SSFBFifoGetByte(fifo, (uint8_t *)&chunk[n]); n++);
+        if (n == 0) break;
+        if (!SSFBase64DecUpdate(ctx, chunk, n, &out[*outLen], outSize - *outLen, &len))
+        { return false; }
+        *outLen += len;
+    }
+    return !ctx->isErr;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if all chars decoded, any unpadded partial quad output, ctx reset, else false.   */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFBase64DecFinal(SSFBase64Stream_t *ctx, uint8_t *out, size_t outSize, size_t *outLen)
+{
+    bool rv;
+
+    SSF_REQUIRE(ctx != NULL);
+    SSF_REQUIRE(ctx->magic == SSF_BASE64_STREAM_MAGIC);
+    SSF_REQUIRE(ctx->isDec);
+    SSF_REQUIRE(out != NULL);
+    SSF_REQUIRE(outLen != NULL);
+
+    *outLen = 0;
+    rv = (!ctx->isErr) && (ctx->bufLen == 0);
+    if ((!ctx->isErr) && (ctx->bufLen != 0) && !SSF_BASE64_FMT_IS_PAD(ctx->fmt))
+    {
+        /* Out too small is not an error, the call may be repeated with more space */
+        if ((size_t)(ctx->bufLen - 1) > outSize) return false;
+        rv = SSFBase64DecodeFmt((const char *)ctx->buf, ctx->bufLen, out, outSize, outLen,
+                                ctx->fmt);
+        if (!rv) *outLen = 0;
+    }
+    SSFBase64DecInit(ctx, ctx->fmt);
+    return rv;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Deinits a streaming encoder or decoder context.                                               */
+/* --------------------------------------------------------------------------------------------- */
+void SSFBase64StreamDeInit(SSFBase64Stream_t *ctx)
+{
+    SSF_REQUIRE(ctx != NULL);
+    SSF_REQUIRE(ctx->magic == SSF_BASE64_STREAM_MAGIC);
+
+    memset(ctx, 0, sizeof(SSFBase64Stream_t));
+}
+#endif /* SSF_BASE64_CONFIG_ENABLE_STREAM */
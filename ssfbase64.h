@@ -39,6 +39,34 @@ extern "C" {
 #include <stdint.h>
 #include <stdbool.h>
 #include "ssfport.h"
+#if SSF_BASE64_CONFIG_ENABLE_STREAM == 1
+#include "ssfbfifo.h"
+#endif /* SSF_BASE64_CONFIG_ENABLE_STREAM */
+
+/* --------------------------------------------------------------------------------------------- */
+/* Defines                                                                                       */
+/* --------------------------------------------------------------------------------------------- */
+typedef enum SSFBase64Fmt
+{
+    SSF_BASE64_FMT_STD,         /* RFC 4648 section 4 alphabet, padded with '=' */
+    SSF_BASE64_FMT_STD_NOPAD,   /* RFC 4648 section 4 alphabet, without padding */
+    SSF_BASE64_FMT_URL,         /* RFC 4648 section 5 URL and filename safe alphabet, padded */
+    SSF_BASE64_FMT_URL_NOPAD,   /* RFC 4648 section 5 URL and filename safe alphabet, unpadded */
+    SSF_BASE64_FMT_MAX,
+} SSFBase64Fmt_t;
+
+#if SSF_BASE64_CONFIG_ENABLE_STREAM == 1
+typedef struct SSFBase64Stream
+{
+    uint8_t buf[4];     /* Leftover 0-2 bytes when encoding, or 0-3 chars when decoding */
+    uint8_t bufLen;
+    SSFBase64Fmt_t fmt;
+    bool isDec;
+    bool isEnd;         /* Decoder has seen a pad */
+    bool isErr;
+    uint32_t magic;
+} SSFBase64Stream_t;
+#endif /* SSF_BASE64_CONFIG_ENABLE_STREAM */
 
 /* --------------------------------------------------------------------------------------------- */
 /* External Interface                                                                            */
@@ -47,6 +75,26 @@ bool SSFBase64Encode(const uint8_t *in, size_t inLen, SSFCStrOut_t out, size_t o
                      size_t *outLen);
 bool SSFBase64Decode(SSFCStrIn_t in, size_t inLenLim, uint8_t *out, size_t outSize,
                      size_t *outLen);
+bool SSFBase64EncodeFmt(const uint8_t *in, size_t inLen, SSFCStrOut_t out, size_t outSize,
+                        size_t *outLen, SSFBase64Fmt_t fmt);
+bool SSFBase64DecodeFmt(SSFCStrIn_t in, size_t inLenLim, uint8_t *out, size_t outSize,
+                        size_t *outLen, SSFBase64Fmt_t fmt);
+
+#if SSF_BASE64_CONFIG_ENABLE_STREAM == 1
+/* Streaming encoder and decoder, out is not NULL terminated and outLen is set per call */
+void SSFBase64EncInit(SSFBase64Stream_t *ctx, SSFBase64Fmt_t fmt);
+bool SSFBase64EncUpdate(SSFBase64Stream_t *ctx, const uint8_t *in, size_t inLen,
+                        SSFCStrOut_t out, size_t outSize, size_t *outLen);
+bool SSFBase64EncFinal(SSFBase64Stream_t *ctx, SSFCStrOut_t out, size_t outSize,
+                       size_t *outLen);
+void SSFBase64DecInit(SSFBase64Stream_t *ctx, SSFBase64Fmt_t fmt);
+bool SSFBase64DecUpdate(SSFBase64Stream_t *ctx, SSFCStrIn_t in, size_t inLen, uint8_t *out,
+                        size_t outSize, size_t *outLen);
+bool SSFBase64DecUpdateBFifo(SSFBase64Stream_t *ctx, SSFBFifo_t *fifo, uint8_t *out,
+                             size_t outSize, size_t *outLen);
+bool SSFBase64DecFinal(SSFBase64Stream_t *ctx, uint8_t *out, size_t outSize, size_t *outLen);
+void SSFBase64StreamDeInit(SSFBase64Stream_t *ctx);
+#endif /* SSF_BASE64_CONFIG_ENABLE_STREAM */
 
 /* --------------------------------------------------------------------------------------------- */
 /* Unit test                                                                                     */
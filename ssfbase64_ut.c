@@ -32,6 +32,7 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include <stdio.h>
+#include <string.h>
 #include "ssfbase64.h"
 #include "ssfassert.h"
 
@@ -84,6 +85,39 @@ SSBase64UT_t _b64StringUT[] = {
         "AAECAwQFBgcICQoLDA0ODxASExQVFhcYGRobHB0eH+Dh4uPk5ebn6Onq6+zt7u/w8fLz9PX29/j5+vv8/f7/AA==" },
 };
 
+/* RFC 4648 section 10 test vectors, plus bytes encoding to the chars the URL alphabet replaces */
+SSBase64UT_t _b64FmtUT[] = {
+    { (uint8_t *)"", 0, "" },
+    { (uint8_t *)"f", 1, "Zg==" },
+    { (uint8_t *)"fo", 2, "Zm8=" },
+    { (uint8_t *)"foo", 3, "Zm9v" },
+    { (uint8_t *)"foob", 4, "Zm9vYg==" },
+    { (uint8_t *)"fooba", 5, "Zm9vYmE=" },
+    { (uint8_t *)"foobar", 6, "Zm9vYmFy" },
+    { (uint8_t *)"\xfb\xff", 2, "+/8=" },
+    { (uint8_t *)"\xfb\xef\xbe\xfb\xef", 5, "++++++8=" },
+    { (uint8_t *)"\xff\xff\xff\xff", 4, "/////w==" },
+};
+
+/* --------------------------------------------------------------------------------------------- */
+/* Converts std padded Base64 str to fmt in place.                                               */
+/* --------------------------------------------------------------------------------------------- */
+static void _SSFBase64UTToFmt(char *str, SSFBase64Fmt_t fmt)
+{
+    size_t i;
+
+    for (i = 0; str[i] != 0; i++)
+    {
+        if ((fmt == SSF_BASE64_FMT_URL) || (fmt == SSF_BASE64_FMT_URL_NOPAD))
+        {
+            if (str[i] == '+') str[i] = '-';
+            else if (str[i] == '/') str[i] = '_';
+        }
+        if ((str[i] == '=') && ((fmt == SSF_BASE64_FMT_STD_NOPAD) ||
+                                (fmt == SSF_BASE64_FMT_URL_NOPAD))) { str[i] = 0; break; }
+    }
+}
+
 /* --------------------------------------------------------------------------------------------- */
 /* Performs unit test on Base64 external interface.                                              */
 /* --------------------------------------------------------------------------------------------- */
@@ -162,7 +196,361 @@ void SSFBase64UnitTest(void)
                                    decodedBigBin, sizeof(decodedBigBin), &outLen));
         SSF_ASSERT(outLen == _b64StringUT[i].unencodedLen);
         SSF_ASSERT(memcmp(_b64StringUT[i].unencoded, decodedBigBin, outLen) == 0);
+
+        /* Output sized exactly to the decoded length succeeds, one byte less fails */
+        SSF_ASSERT(SSFBase64Decode(_b64StringUT[i].encoded, strlen(_b64StringUT[i].encoded),
+                                   decodedBigBin, _b64StringUT[i].unencodedLen, &outLen));
+        SSF_ASSERT(outLen == _b64StringUT[i].unencodedLen);
+        SSF_ASSERT(memcmp(_b64StringUT[i].unencoded, decodedBigBin, outLen) == 0);
+        SSF_ASSERT(SSFBase64Decode(_b64StringUT[i].encoded, strlen(_b64StringUT[i].encoded),
+                                   decodedBigBin, _b64StringUT[i].unencodedLen - 1,
+                                   &outLen) == false);
+    }
+
+    /* Round trip lengths that exercise bulk decoding and every pad variant */
+    for (i = 0; i < sizeof(decodedBigBin); i++) decodedBigBin[i] = (uint8_t)((i * 167u) + 13u);
+    for (i = 0; i <= 90; i++)
+    {
+        uint8_t roundBin[96];
+
+        SSF_ASSERT(SSFBase64Encode(decodedBigBin, i, encodedBigStr, sizeof(encodedBigStr),
+                                   &outLen));
+        SSF_ASSERT(SSFBase64Decode(encodedBigStr, outLen, roundBin, i, &outLen));
+        SSF_ASSERT(outLen == i);
+        SSF_ASSERT(memcmp(roundBin, decodedBigBin, i) == 0);
+    }
+
+    /* Every char value at every position of a long string only decodes if in the alphabet */
+    SSF_ASSERT(SSFBase64Encode(decodedBigBin, 72, encodedBigStr, sizeof(encodedBigStr),
+                               &outLen));
+    SSF_ASSERT(outLen == 96);
+    for (i = 0; i < 96; i++)
+    {
+        uint32_t c;
+        char orig = encodedBigStr[i];
+
+        for (c = 0; c < 256; c++)
+        {
+            bool valid = (c != 0) && (strchr("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz"
+                                             "0123456789+/", (int)c) != NULL);
+
+            /* A pad ends a quad early, so its validity depends on its position */
+            if (c == '=') continue;
+            encodedBigStr[i] = (char)c;
+            SSF_ASSERT(SSFBase64Decode(encodedBigStr, 96, decodedBin, 0, &outLen) == false);
+            SSF_ASSERT(SSFBase64Decode(encodedBigStr, 96, decodedBigBin, sizeof(decodedBigBin),
+                                       &outLen) == valid);
+            if (valid) SSF_ASSERT(outLen == 72);
+        }
+        encodedBigStr[i] = orig;
+    }
+    SSF_ASSERT(SSFBase64Decode(encodedBigStr, 96, decodedBigBin, sizeof(decodedBigBin),
+                               &outLen));
+    for (i = 0; i < 72; i++) SSF_ASSERT(decodedBigBin[i] == (uint8_t)((i * 167u) + 13u));
+
+    /* Pads are only accepted at the end of a quad */
+    SSF_ASSERT(SSFBase64Decode("AAAAAAAAAAAAAAAAAAAAAAAAAAAAAA=A", 32, decodedBigBin,
+                               sizeof(decodedBigBin), &outLen) == false);
+    SSF_ASSERT(SSFBase64Decode("AAAAAAAAAAAAAAAAAAAAAAAAAAAA=AAA", 32, decodedBigBin,
+                               sizeof(decodedBigBin), &outLen) == false);
+    SSF_ASSERT(SSFBase64Decode("AAAAAAAAAAAAAAAAAAAAAAAAAAAAAA==", 32, decodedBigBin,
+                               sizeof(decodedBigBin), &outLen));
+    SSF_ASSERT(outLen == 22);
+
+    /* Check format selection */
+    SSF_ASSERT_TEST(SSFBase64EncodeFmt(_b64FmtUT[1].unencoded, _b64FmtUT[1].unencodedLen,
+                                       encodedBigStr, sizeof(encodedBigStr), &outLen,
+                                       SSF_BASE64_FMT_MAX));
+    SSF_ASSERT_TEST(SSFBase64DecodeFmt(_b64FmtUT[1].encoded, strlen(_b64FmtUT[1].encoded),
+                                       decodedBigBin, sizeof(decodedBigBin), &outLen,
+                                       SSF_BASE64_FMT_MAX));
+    for (i = 0; i < SSF_BASE64_FMT_MAX; i++)
+    {
+        SSFBase64Fmt_t fmt = (SSFBase64Fmt_t)i;
+        uint32_t j;
+
+        for (j = 0; j < (sizeof(_b64FmtUT) / sizeof(SSBase64UT_t)); j++)
+        {
+            char expStr[16];
+
+            strcpy(expStr, _b64FmtUT[j].encoded);
+            _SSFBase64UTToFmt(expStr, fmt);
+            SSF_ASSERT(SSFBase64EncodeFmt(_b64FmtUT[j].unencoded, _b64FmtUT[j].unencodedLen,
+                                          encodedBigStr, sizeof(encodedBigStr), &outLen, fmt));
+            SSF_ASSERT(outLen == strlen(expStr));
+            SSF_ASSERT(memcmp(encodedBigStr, expStr, outLen + 1) == 0);
+
+            /* Output sized exactly to the encoded length and NULL succeeds, one less fails */
+            SSF_ASSERT(SSFBase64EncodeFmt(_b64FmtUT[j].unencoded, _b64FmtUT[j].unencodedLen,
+                                          encodedBigStr, outLen + 1, &outLen, fmt));
+            SSF_ASSERT(memcmp(encodedBigStr, expStr, outLen + 1) == 0);
+            SSF_ASSERT(SSFBase64EncodeFmt(_b64FmtUT[j].unencoded, _b64FmtUT[j].unencodedLen,
+                                          encodedBigStr, outLen, &outLen, fmt) ==
+                       (_b64FmtUT[j].unencodedLen == 0));
+
+            SSF_ASSERT(SSFBase64DecodeFmt(expStr, strlen(expStr), decodedBigBin,
+                                          sizeof(decodedBigBin), &outLen, fmt));
+            SSF_ASSERT(outLen == _b64FmtUT[j].unencodedLen);
+            SSF_ASSERT(memcmp(decodedBigBin, _b64FmtUT[j].unencoded, outLen) == 0);
+            SSF_ASSERT(SSFBase64DecodeFmt(expStr, strlen(expStr), decodedBigBin, outLen, &outLen,
+                                          fmt));
+            if (outLen != 0)
+            {
+                SSF_ASSERT(SSFBase64DecodeFmt(expStr, strlen(expStr), decodedBigBin, outLen - 1,
+                                              &outLen, fmt) == false);
+            }
+        }
+
+        /* Round trip lengths that exercise bulk encoding and every partial block */
+        for (j = 0; j < sizeof(decodedBigBin); j++) decodedBigBin[j] = (uint8_t)((j * 167u) + 13u);
+        for (j = 0; j <= 90; j++)
+        {
+            uint8_t roundBin[96];
+            char stdStr[128];
+
+            SSF_ASSERT(SSFBase64Encode(decodedBigBin, j, stdStr, sizeof(stdStr), &outLen));
+            _SSFBase64UTToFmt(stdStr, fmt);
+            SSF_ASSERT(SSFBase64EncodeFmt(decodedBigBin, j, encodedBigStr, sizeof(encodedBigStr),
+                                          &outLen, fmt));
+            SSF_ASSERT(outLen == strlen(stdStr));
+            SSF_ASSERT(memcmp(encodedBigStr, stdStr, outLen + 1) == 0);
+            SSF_ASSERT(SSFBase64DecodeFmt(encodedBigStr, outLen, roundBin, j, &outLen, fmt));
+            SSF_ASSERT(outLen == j);
+            SSF_ASSERT(memcmp(roundBin, decodedBigBin, j) == 0);
+        }
+    }
+
+    /* Each alphabet rejects the chars only the other one has */
+    SSF_ASSERT(SSFBase64DecodeFmt("+/8=", 4, decodedBin, sizeof(decodedBin), &outLen,
+                                  SSF_BASE64_FMT_URL) == false);
+    SSF_ASSERT(SSFBase64DecodeFmt("-_8=", 4, decodedBin, sizeof(decodedBin), &outLen,
+                                  SSF_BASE64_FMT_STD) == false);
+    SSF_ASSERT(SSFBase64DecodeFmt("+/8", 3, decodedBin, sizeof(decodedBin), &outLen,
+                                  SSF_BASE64_FMT_URL_NOPAD) == false);
+    SSF_ASSERT(SSFBase64DecodeFmt("-_8", 3, decodedBin, sizeof(decodedBin), &outLen,
+                                  SSF_BASE64_FMT_STD_NOPAD) == false);
+
+    /* Padded formats require whole quads, unpadded formats reject pads and a lone last char */
+    SSF_ASSERT(SSFBase64DecodeFmt("Zm8", 3, decodedBin, sizeof(decodedBin), &outLen,
+                                  SSF_BASE64_FMT_URL) == false);
+    SSF_ASSERT(SSFBase64DecodeFmt("Zm8=", 4, decodedBin, sizeof(decodedBin), &outLen,
+                                  SSF_BASE64_FMT_STD_NOPAD) == false);
+    SSF_ASSERT(SSFBase64DecodeFmt("Zg==", 4, decodedBin, sizeof(decodedBin), &outLen,
+                                  SSF_BASE64_FMT_URL_NOPAD) == false);
+    SSF_ASSERT(SSFBase64DecodeFmt("Zm9vZ", 5, decodedBigBin, sizeof(decodedBigBin), &outLen,
+                                  SSF_BASE64_FMT_STD_NOPAD) == false);
+    SSF_ASSERT(SSFBase64DecodeFmt("Zm9vZ=", 6, decodedBigBin, sizeof(decodedBigBin), &outLen,
+                                  SSF_BASE64_FMT_STD_NOPAD) == false);
+    SSF_ASSERT(SSFBase64DecodeFmt("Zm9vZm=", 7, decodedBigBin, sizeof(decodedBigBin), &outLen,
+                                  SSF_BASE64_FMT_URL_NOPAD) == false);
+    SSF_ASSERT(SSFBase64DecodeFmt("Zm==Zm9v", 8, decodedBigBin, sizeof(decodedBigBin),
+                                  &outLen, SSF_BASE64_FMT_STD_NOPAD) == false);
+    SSF_ASSERT(SSFBase64DecodeFmt("Zm9vZm8", 7, decodedBigBin, sizeof(decodedBigBin), &outLen,
+                                  SSF_BASE64_FMT_STD_NOPAD));
+    SSF_ASSERT(outLen == 5);
+    SSF_ASSERT(memcmp(decodedBigBin, "foofo", 5) == 0);
+
+#if SSF_BASE64_CONFIG_ENABLE_STREAM == 1
+    {
+        SSFBase64Stream_t ctx;
+        SSFBFifo_t fifo;
+        uint8_t fifoBuf[SSF_BFIFO_255 + 1];
+        uint8_t page[16];
+        size_t chunk;
+        size_t j;
+        size_t len;
+        size_t total;
+        size_t encLen;
+
+        SSF_ASSERT_TEST(SSFBase64EncInit(NULL, SSF_BASE64_FMT_STD));
+        SSF_ASSERT_TEST(SSFBase64DecInit(NULL, SSF_BASE64_FMT_STD));
+        SSF_ASSERT_TEST(SSFBase64EncInit(&ctx, SSF_BASE64_FMT_MAX));
+        SSF_ASSERT_TEST(SSFBase64DecInit(&ctx, SSF_BASE64_FMT_MAX));
+        SSF_ASSERT_TEST(SSFBase64StreamDeInit(NULL));
+        memset(&ctx, 0, sizeof(ctx));
+        SSF_ASSERT_TEST(SSFBase64EncUpdate(&ctx, decodedBigBin, 1, encodedBigStr,
+                                           sizeof(encodedBigStr), &outLen));
+        SSF_ASSERT_TEST(SSFBase64DecFinal(&ctx, page, sizeof(page), &outLen));
+        SSFBase64DecInit(&ctx, SSF_BASE64_FMT_STD);
+        SSF_ASSERT_TEST(SSFBase64EncUpdate(&ctx, decodedBigBin, 1, encodedBigStr,
+                                           sizeof(encodedBigStr), &outLen));
+        SSF_ASSERT_TEST(SSFBase64DecUpdate(&ctx, NULL, 1, decodedBigBin, sizeof(decodedBigBin),
+                                           &outLen));
+        SSF_ASSERT_TEST(SSFBase64DecUpdate(&ctx, "AAAA", 4, NULL, sizeof(decodedBigBin),
+                                           &outLen));
+        SSF_ASSERT_TEST(SSFBase64DecUpdate(&ctx, "AAAA", 4, decodedBigBin,
+                                           sizeof(decodedBigBin), NULL));
+        SSF_ASSERT_TEST(SSFBase64DecUpdateBFifo(&ctx, NULL, decodedBigBin, sizeof(decodedBigBin),
+                                                &outLen));
+        SSF_ASSERT_TEST(SSFBase64DecFinal(&ctx, NULL, sizeof(page), &outLen));
+        SSF_ASSERT_TEST(SSFBase64DecFinal(&ctx, page, sizeof(page), NULL));
+        SSFBase64StreamDeInit(&ctx);
+        SSF_ASSERT_TEST(SSFBase64DecFinal(&ctx, page, sizeof(page), &outLen));
+        SSFBase64EncInit(&ctx, SSF_BASE64_FMT_STD);
+        SSF_ASSERT_TEST(SSFBase64DecUpdate(&ctx, "AAAA", 4, decodedBigBin,
+                                           sizeof(decodedBigBin), &outLen));
+        SSF_ASSERT_TEST(SSFBase64EncUpdate(&ctx, NULL, 1, encodedBigStr, sizeof(encodedBigStr),
+                                           &outLen));
+        SSF_ASSERT_TEST(SSFBase64EncFinal(&ctx, NULL, sizeof(encodedBigStr), &outLen));
+
+        /* Chunked encode and decode match the one shot results for every format and chunk size */
+        for (i = 0; i < sizeof(decodedBigBin); i++) decodedBigBin[i] = (uint8_t)((i * 71u) + 5u);
+        for (j = 0; j < (SSF_BASE64_FMT_MAX * 3); j++)
+        {
+            SSFBase64Fmt_t fmt = (SSFBase64Fmt_t)(j / 3);
+            char expected[128];
+            uint8_t roundBin[96];
+
+            len = 88 + (j % 3);
+            SSF_ASSERT(SSFBase64EncodeFmt(decodedBigBin, len, expected, sizeof(expected),
+                                          &encLen, fmt));
+            for (chunk = 1; chunk <= 9; chunk++)
+            {
+                size_t k;
+
+                SSFBase64EncInit(&ctx, fmt);
+                for (total = 0, k = 0; k < len; k += chunk)
+                {
+                    SSF_ASSERT(SSFBase64EncUpdate(&ctx, &decodedBigBin[k],
+                                                  ((len - k) < chunk) ? (len - k) : chunk,
+                                                  &encodedBigStr[total],
+                                                  sizeof(encodedBigStr) - total, &outLen));
+                    total += outLen;
+                }
+                SSF_ASSERT(SSFBase64EncFinal(&ctx, &encodedBigStr[total],
+                                             sizeof(encodedBigStr) - total, &outLen));
+                total += outLen;
+                SSF_ASSERT(total == encLen);
+                SSF_ASSERT(memcmp(encodedBigStr, expected, encLen) == 0);
+                SSF_ASSERT(SSFBase64EncFinal(&ctx, encodedBigStr, 0, &outLen));
+                SSF_ASSERT(outLen == 0);
+                SSFBase64StreamDeInit(&ctx);
+
+                SSFBase64DecInit(&ctx, fmt);
+                for (total = 0, k = 0; k < encLen; k += chunk)
+                {
+                    SSF_ASSERT(SSFBase64DecUpdate(&ctx, &expected[k],
+                                                  ((encLen - k) < chunk) ? (encLen - k) : chunk,
+                                                  &roundBin[total], sizeof(roundBin) - total,
+                                                  &outLen));
+                    total += outLen;
+                }
+                SSF_ASSERT(SSFBase64DecFinal(&ctx, &roundBin[total], sizeof(roundBin) - total,
+                                             &outLen));
+                total += outLen;
+                SSF_ASSERT(total == len);
+                SSF_ASSERT(memcmp(roundBin, decodedBigBin, len) == 0);
+                SSFBase64StreamDeInit(&ctx);
+            }
+        }
+
+        /* Out too small consumes nothing and the call may be repeated */
+        SSFBase64EncInit(&ctx, SSF_BASE64_FMT_STD);
+        SSF_ASSERT(SSFBase64EncUpdate(&ctx, (const uint8_t *)"ab", 2, encodedBigStr, 0,
+                                      &outLen));
+        SSF_ASSERT(outLen == 0);
+        SSF_ASSERT(SSFBase64EncUpdate(&ctx, (const uint8_t *)"cdefg", 5, encodedBigStr, 7,
+                                      &outLen) == false);
+        SSF_ASSERT(SSFBase64EncUpdate(&ctx, (const uint8_t *)"cdefg", 5, encodedBigStr, 8,
+                                      &outLen));
+        SSF_ASSERT(outLen == 8);
+        SSF_ASSERT(SSFBase64EncFinal(&ctx, &encodedBigStr[8], 3, &outLen) == false);
+        SSF_ASSERT(SSFBase64EncFinal(&ctx, &encodedBigStr[8], 4, &outLen));
+        SSF_ASSERT(outLen == 4);
+        SSF_ASSERT(memcmp(encodedBigStr, "YWJjZGVm", 8) == 0);
+        SSF_ASSERT(memcmp(&encodedBigStr[8], "Zw==", 4) == 0);
+        SSFBase64DecInit(&ctx, SSF_BASE64_FMT_STD);
+        SSF_ASSERT(SSFBase64DecUpdate(&ctx, "YWJjZG", 6, decodedBigBin, 2, &outLen) == false);
+        SSF_ASSERT(SSFBase64DecUpdate(&ctx, "YWJjZG", 6, decodedBigBin, 3, &outLen));
+        SSF_ASSERT(outLen == 3);
+        SSF_ASSERT(SSFBase64DecUpdate(&ctx, "Vm", 2, decodedBigBin, 3, &outLen));
+        SSF_ASSERT(outLen == 3);
+        SSF_ASSERT(memcmp(decodedBigBin, "def", 3) == 0);
+        SSF_ASSERT(SSFBase64DecFinal(&ctx, page, sizeof(page), &outLen));
+
+        /* Chars after a pad, a pad early in a quad, invalid chars and partial quads fail */
+        SSF_ASSERT(SSFBase64DecUpdate(&ctx, "YQ==", 4, decodedBigBin, 3, &outLen));
+        SSF_ASSERT(SSFBase64DecUpdate(&ctx, "YQ==", 4, decodedBigBin, 3, &outLen) == false);
+        SSF_ASSERT(SSFBase64DecFinal(&ctx, page, sizeof(page), &outLen) == false);
+        SSF_ASSERT(SSFBase64DecUpdate(&ctx, "YQ==YWJj", 8, decodedBigBin, 6, &outLen) == false);
+        SSF_ASSERT(SSFBase64DecFinal(&ctx, page, sizeof(page), &outLen) == false);
+        SSF_ASSERT(SSFBase64DecUpdate(&ctx, "YQ==YWJjYWJj", 12, decodedBigBin, 9,
+                                      &outLen) == false);
+        SSF_ASSERT(SSFBase64DecFinal(&ctx, page, sizeof(page), &outLen) == false);
+        SSF_ASSERT(SSFBase64DecUpdate(&ctx, "YWI=Y", 5, decodedBigBin, 3, &outLen) == false);
+        SSF_ASSERT(SSFBase64DecFinal(&ctx, page, sizeof(page), &outLen) == false);
+        SSF_ASSERT(SSFBase64DecUpdate(&ctx, "YQ=A", 4, decodedBigBin, 3, &outLen) == false);
+        SSF_ASSERT(SSFBase64DecUpdate(&ctx, "YWJj", 4, decodedBigBin, 3, &outLen) == false);
+        SSF_ASSERT(SSFBase64DecFinal(&ctx, page, sizeof(page), &outLen) == false);
+        SSF_ASSERT(SSFBase64DecUpdate(&ctx, "YW*j", 4, decodedBigBin, 3, &outLen) == false);
+        SSF_ASSERT(SSFBase64DecFinal(&ctx, page, sizeof(page), &outLen) == false);
+        SSF_ASSERT(SSFBase64DecUpdate(&ctx, "YWJjY", 5, decodedBigBin, 3, &outLen));
+        SSF_ASSERT(SSFBase64DecFinal(&ctx, page, sizeof(page), &outLen) == false);
+        SSF_ASSERT(SSFBase64DecUpdate(&ctx, "YQ", 2, decodedBigBin, 3, &outLen));
+        SSF_ASSERT(SSFBase64DecUpdate(&ctx, "==", 2, decodedBigBin, 3, &outLen));
+        SSF_ASSERT((outLen == 1) && (decodedBigBin[0] == 'a'));
+        SSF_ASSERT(SSFBase64DecUpdate(&ctx, "", 0, decodedBigBin, 0, &outLen));
+        SSF_ASSERT(SSFBase64DecFinal(&ctx, page, sizeof(page), &outLen));
+
+        /* Unpadded formats output the partial last quad on final and reject pads */
+        SSFBase64DecInit(&ctx, SSF_BASE64_FMT_STD_NOPAD);
+        SSF_ASSERT(SSFBase64DecUpdate(&ctx, "Zm9vZm8", 7, decodedBigBin, 3, &outLen));
+        SSF_ASSERT((outLen == 3) && (memcmp(decodedBigBin, "foo", 3) == 0));
+        SSF_ASSERT(SSFBase64DecFinal(&ctx, page, 1, &outLen) == false);
+        SSF_ASSERT(SSFBase64DecFinal(&ctx, page, 2, &outLen));
+        SSF_ASSERT((outLen == 2) && (memcmp(page, "fo", 2) == 0));
+        SSF_ASSERT(SSFBase64DecUpdate(&ctx, "Zm9vZ", 5, decodedBigBin, 3, &outLen));
+        SSF_ASSERT(SSFBase64DecFinal(&ctx, page, sizeof(page), &outLen) == false);
+        SSF_ASSERT(outLen == 0);
+        SSF_ASSERT(SSFBase64DecUpdate(&ctx, "Zg=", 3, decodedBigBin, 3, &outLen));
+        SSF_ASSERT(SSFBase64DecFinal(&ctx, page, sizeof(page), &outLen) == false);
+        SSF_ASSERT(SSFBase64DecUpdate(&ctx, "Zg==", 4, decodedBigBin, 3, &outLen) == false);
+        SSF_ASSERT(SSFBase64DecFinal(&ctx, page, sizeof(page), &outLen) == false);
+        SSFBase64DecInit(&ctx, SSF_BASE64_FMT_URL);
+        SSF_ASSERT(SSFBase64DecUpdate(&ctx, "-_8=", 4, decodedBigBin, 3, &outLen));
+        SSF_ASSERT((outLen == 2) && (decodedBigBin[0] == 0xfb) && (decodedBigBin[1] == 0xff));
+        SSF_ASSERT(SSFBase64DecFinal(&ctx, page, sizeof(page), &outLen));
+        SSF_ASSERT(SSFBase64DecUpdate(&ctx, "+/8=", 4, decodedBigBin, 3, &outLen) == false);
+        SSF_ASSERT(SSFBase64DecFinal(&ctx, page, sizeof(page), &outLen) == false);
+        SSFBase64DecInit(&ctx, SSF_BASE64_FMT_STD);
+        SSF_ASSERT(SSFBase64DecUpdate(&ctx, "-_8=", 4, decodedBigBin, 3, &outLen) == false);
+        SSF_ASSERT(SSFBase64DecFinal(&ctx, page, sizeof(page), &outLen) == false);
+        SSFBase64EncInit(&ctx, SSF_BASE64_FMT_URL_NOPAD);
+        SSF_ASSERT(SSFBase64EncUpdate(&ctx, decodedBigBin, 2, encodedBigStr, 0, &outLen));
+        SSF_ASSERT(SSFBase64EncFinal(&ctx, encodedBigStr, 2, &outLen) == false);
+        SSF_ASSERT(SSFBase64EncFinal(&ctx, encodedBigStr, 3, &outLen));
+        SSF_ASSERT((outLen == 3) && (memcmp(encodedBigStr, "-_8", 3) == 0));
+        SSFBase64StreamDeInit(&ctx);
+
+        /* Decode from a fifo into pages, leaving chars whose quads do not fit in the fifo */
+        SSFBFifoInit(&fifo, SSF_BFIFO_255, fifoBuf, sizeof(fifoBuf));
+        for (i = 0; i < sizeof(decodedBigBin); i++) decodedBigBin[i] = (uint8_t)((i * 31u) + 1u);
+        SSF_ASSERT(SSFBase64Encode(decodedBigBin, 89, encodedBigStr, sizeof(encodedBigStr),
+                                   &encLen));
+        for (i = 0; i < encLen; i++) SSFBFifoPutByte(&fifo, (uint8_t)encodedBigStr[i]);
+        SSFBase64DecInit(&ctx, SSF_BASE64_FMT_STD);
+        SSF_ASSERT(SSFBase64DecUpdateBFifo(&ctx, &fifo, page, 2, &outLen));
+        SSF_ASSERT(outLen == 0);
+        SSF_ASSERT(SSFBFifoLen(&fifo) == encLen);
+        total = 0;
+        do
+        {
+            SSF_ASSERT(SSFBase64DecUpdateBFifo(&ctx, &fifo, page, sizeof(page), &outLen));
+            SSF_ASSERT(outLen <= sizeof(page));
+            SSF_ASSERT(memcmp(page, &decodedBigBin[total], outLen) == 0);
+            total += outLen;
+        } while (outLen != 0);
+        SSF_ASSERT(SSFBFifoIsEmpty(&fifo));
+        SSF_ASSERT(total == 89);
+        SSF_ASSERT(SSFBase64DecFinal(&ctx, page, sizeof(page), &outLen));
+
+        /* A fifo holding an invalid char fails */
+        for (i = 0; i < 8; i++) SSFBFifoPutByte(&fifo, (uint8_t)"YWJj*WJj"[i]);
+        SSF_ASSERT(SSFBase64DecUpdateBFifo(&ctx, &fifo, page, sizeof(page), &outLen) == false);
+        SSF_ASSERT(SSFBase64DecFinal(&ctx, page, sizeof(page), &outLen) == false);
+        SSFBase64StreamDeInit(&ctx);
     }
+#endif /* SSF_BASE64_CONFIG_ENABLE_STREAM */
 }
 #endif /* SSF_CONFIG_BASE64_UNIT_TEST */
 
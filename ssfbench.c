@@ -0,0 +1,996 @@
+/* --------------------------------------------------------------------------------------------- */
+/* Small System Framework                                                                        */
+/*                                                                                               */
+/* ssfbench.c                                                                                    */
+/* Provides microbenchmarks for SSF interfaces, built separately from the unit tests.            */
+/*                                                                                               */
+/* BSD-3-Clause License                                                                          */
+/* Copyright 2020 Supurloop Software LLC                                                         */
+/*                                                                                               */
+/* Redistribution and use in source and binary forms, with or without modification, are          */
+/* permitted provided that the following conditions are met:                                     */
+/*                                                                                               */
+/* 1. Redistributions of source code must retain the above copyright notice, this list of        */
+/* conditions and the following disclaimer.                                                      */
+/* 2. Redistributions in binary form must reproduce the above copyright notice, this list of     */
+/* conditions and the following disclaimer in the documentation and/or other materials provided  */
+/* with the distribution.                                                                        */
+/* 3. Neither the name of the copyright holder nor the names of its contributors may be used to  */
+/* endorse or promote products derived from this software without specific prior written         */
+/* permission.                                                                                   */
+/*                                                                                               */
+/* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS   */
+/* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF               */
+/* MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE    */
+/* COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL      */
+/* EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE */
+/* GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED    */
+/* AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING     */
+/* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED  */
+/* OF THE POSSIBILITY OF SUCH DAMAGE.                                                            */
+/* --------------------------------------------------------------------------------------------- */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include "ssfassert.h"
+#include "ssfport.h"
+#include "ssfjson.h"
+#include "ssfcbor.h"
+#include "ssfbase64.h"
+#include "ssfhex.h"
+#include "ssfaes.h"
+#include "ssfaesgcm.h"
+
+/* --------------------------------------------------------------------------------------------- */
+/* Defines                                                                                       */
+/* --------------------------------------------------------------------------------------------- */
+#define SSF_BENCH_NUM_VALUES (1024u)
+#define SSF_BENCH_NUM_OPS (2000000ul)
+#define SSF_BENCH_CORPUS_BYTES (64ul * 1024ul * 1024ul)
+#define SSF_BENCH_CORPUS_SAMPLES (256u)
+#define SSF_BENCH_CORPUS_DOCS (sizeof(_ssfBenchCorpus) / sizeof(_ssfBenchCorpus[0]))
+#define SSF_BENCH_STACK_SIZE (256u * 1024u)
+#define SSF_BENCH_STACK_PAINT (0xa5u)
+
+/* --------------------------------------------------------------------------------------------- */
+/* Structs                                                                                       */
+/* --------------------------------------------------------------------------------------------- */
+typedef struct SSFBenchDoc
+{
+    const char *name;
+    SSFJsonPrintFn_t print;
+    size_t (*get)(SSFCStrIn_t js);
+    SSFCStrIn_t update[SSF_JSON_CONFIG_MAX_IN_DEPTH + 1];
+    size_t (*op)(struct SSFBenchDoc *doc);
+    size_t len;
+    char js[SSF_JSON_CONFIG_MAX_IN_LEN + 1];
+} SSFBenchDoc_t;
+
+typedef size_t (*SSFBenchCorpusOp_t)(SSFBenchDoc_t *doc);
+
+/* --------------------------------------------------------------------------------------------- */
+/* Module variables                                                                              */
+/* --------------------------------------------------------------------------------------------- */
+static long _ssfBenchLongs[SSF_BENCH_NUM_VALUES];
+#if SSF_JSON_CONFIG_ENABLE_FLOAT_GEN == 1
+static double _ssfBenchDoubles[SSF_BENCH_NUM_VALUES];
+#endif /* SSF_JSON_CONFIG_ENABLE_FLOAT_GEN */
+static char _ssfBenchOut[64];
+static char _ssfBenchJs[SSF_BENCH_NUM_VALUES][40];
+static volatile size_t _ssfBenchSink;
+static uint8_t _ssfBenchBlob[1024];
+static char _ssfBenchWork[SSF_JSON_CONFIG_MAX_IN_LEN + 1];
+static uint64_t _ssfBenchStack[SSF_BENCH_STACK_SIZE / sizeof(uint64_t)];
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns the next pseudo-random number of a deterministic sequence.                            */
+/* --------------------------------------------------------------------------------------------- */
+static uint64_t _SSFBenchRand(void)
+{
+    static uint64_t state = 0x0123456789abcdefull;
+
+    state = (state * 6364136223846793005ull) + 1442695040888963407ull;
+    return state ^ (state >> 29);
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Prints the time per operation of a benchmark run of ops operations started at start.          */
+/* --------------------------------------------------------------------------------------------- */
+static void _SSFBenchReport(const char *name, clock_t start, unsigned long ops)
+{
+    double secs = ((double)(clock() - start)) / CLOCKS_PER_SEC;
+
+    printf("%-40s %9.1f ns/op\r\n", name, (secs * 1e9) / ops);
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Compares JSON generator number formatting against the C library.                              */
+/* --------------------------------------------------------------------------------------------- */
+static void _SSFBenchJsonPrintNumbers(void)
+{
+    unsigned long i;
+    size_t end;
+    clock_t start;
+
+    for (i = 0; i < SSF_BENCH_NUM_VALUES; i++)
+    {
+        /* Mostly small telemetry sized values with some full range values */
+        _ssfBenchLongs[i] = (long)_SSFBenchRand();
+        if ((i & 3) != 0) _ssfBenchLongs[i] %= 100000;
+#if SSF_JSON_CONFIG_ENABLE_FLOAT_GEN == 1
+        _ssfBenchDoubles[i] = ((double)_ssfBenchLongs[i]) / 1000.0;
+        if ((i & 7) == 0) _ssfBenchDoubles[i] *= 1e-9;
+#endif /* SSF_JSON_CONFIG_ENABLE_FLOAT_GEN */
+    }
+
+    start = clock();
+    for (i = 0; i < SSF_BENCH_NUM_OPS; i++)
+    {
+        SSF_ASSERT(SSFJsonPrintInt(_ssfBenchOut, sizeof(_ssfBenchOut), 0, &end,
+                                   _ssfBenchLongs[i & (SSF_BENCH_NUM_VALUES - 1)], NULL));
+        _ssfBenchSink += end;
+    }
+    _SSFBenchReport("SSFJsonPrintInt()", start, SSF_BENCH_NUM_OPS);
+
+    start = clock();
+    for (i = 0; i < SSF_BENCH_NUM_OPS; i++)
+    {
+        _ssfBenchSink += (size_t)snprintf(_ssfBenchOut, sizeof(_ssfBenchOut), "%ld",
+                                          _ssfBenchLongs[i & (SSF_BENCH_NUM_VALUES - 1)]);
+    }
+    _SSFBenchReport("snprintf(\"%ld\")", start, SSF_BENCH_NUM_OPS);
+
+    start = clock();
+    for (i = 0; i < SSF_BENCH_NUM_OPS; i++)
+    {
+        SSF_ASSERT(SSFJsonPrintUInt(_ssfBenchOut, sizeof(_ssfBenchOut), 0, &end,
+                                    (unsigned long)_ssfBenchLongs[i & (SSF_BENCH_NUM_VALUES - 1)],
+                                    NULL));
+        _ssfBenchSink += end;
+    }
+    _SSFBenchReport("SSFJsonPrintUInt()", start, SSF_BENCH_NUM_OPS);
+
+    start = clock();
+    for (i = 0; i < SSF_BENCH_NUM_OPS; i++)
+    {
+        _ssfBenchSink += (size_t)snprintf(_ssfBenchOut, sizeof(_ssfBenchOut), "%lu",
+                                          (unsigned long)_ssfBenchLongs[i &
+                                                                        (SSF_BENCH_NUM_VALUES - 1)]);
+    }
+    _SSFBenchReport("snprintf(\"%lu\")", start, SSF_BENCH_NUM_OPS);
+
+#if SSF_JSON_CONFIG_ENABLE_FLOAT_GEN == 1
+    start = clock();
+    for (i = 0; i < SSF_BENCH_NUM_OPS; i++)
+    {
+        SSF_ASSERT(SSFJsonPrintDouble(_ssfBenchOut, sizeof(_ssfBenchOut), 0, &end,
+                                      _ssfBenchDoubles[i & (SSF_BENCH_NUM_VALUES - 1)],
+                                      SSF_JSON_FLT_FMT_SHORTEST, NULL));
+        _ssfBenchSink += end;
+    }
+    _SSFBenchReport("SSFJsonPrintDouble(SHORTEST)", start, SSF_BENCH_NUM_OPS);
+
+    start = clock();
+    for (i = 0; i < SSF_BENCH_NUM_OPS; i++)
+    {
+        SSF_ASSERT(SSFJsonPrintDouble(_ssfBenchOut, sizeof(_ssfBenchOut), 0, &end,
+                                      _ssfBenchDoubles[i & (SSF_BENCH_NUM_VALUES - 1)],
+                                      SSF_JSON_FLT_FMT_SHORT, NULL));
+        _ssfBenchSink += end;
+    }
+    _SSFBenchReport("SSFJsonPrintDouble(SHORT) \"%g\"", start, SSF_BENCH_NUM_OPS);
+
+    start = clock();
+    for (i = 0; i < SSF_BENCH_NUM_OPS; i++)
+    {
+        _ssfBenchSink += (size_t)snprintf(_ssfBenchOut, sizeof(_ssfBenchOut), "%.17g",
+                                          _ssfBenchDoubles[i & (SSF_BENCH_NUM_VALUES - 1)]);
+    }
+    _SSFBenchReport("snprintf(\"%.17g\")", start, SSF_BENCH_NUM_OPS);
+#endif /* SSF_JSON_CONFIG_ENABLE_FLOAT_GEN */
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Compares JSON number parsing against the C library.                                           */
+/* --------------------------------------------------------------------------------------------- */
+static void _SSFBenchJsonGetNumbers(void)
+{
+    unsigned long i;
+    long si;
+    char *endptr;
+    clock_t start;
+    SSFCStrIn_t path[SSF_JSON_CONFIG_MAX_IN_DEPTH + 1];
+#if SSF_JSON_CONFIG_ENABLE_FLOAT_PARSE == 1
+    double d;
+#endif /* SSF_JSON_CONFIG_ENABLE_FLOAT_PARSE */
+
+    memset(path, 0, sizeof(path));
+    path[0] = "n";
+    for (i = 0; i < SSF_BENCH_NUM_VALUES; i++)
+    {
+        snprintf(_ssfBenchJs[i], sizeof(_ssfBenchJs[i]), "{\"n\":%ld}", _ssfBenchLongs[i]);
+    }
+
+    start = clock();
+    for (i = 0; i < SSF_BENCH_NUM_OPS; i++)
+    {
+        SSF_ASSERT(SSFJsonGetLong(_ssfBenchJs[i & (SSF_BENCH_NUM_VALUES - 1)], path, &si));
+        _ssfBenchSink += (size_t)si;
+    }
+    _SSFBenchReport("SSFJsonGetLong()", start, SSF_BENCH_NUM_OPS);
+
+    start = clock();
+    for (i = 0; i < SSF_BENCH_NUM_OPS; i++)
+    {
+        _ssfBenchSink += (size_t)strtol(&_ssfBenchJs[i & (SSF_BENCH_NUM_VALUES - 1)][5], &endptr,
+                                        10);
+    }
+    _SSFBenchReport("strtol()", start, SSF_BENCH_NUM_OPS);
+
+#if SSF_JSON_CONFIG_ENABLE_FLOAT_PARSE == 1
+    for (i = 0; i < SSF_BENCH_NUM_VALUES; i++)
+    {
+        snprintf(_ssfBenchJs[i], sizeof(_ssfBenchJs[i]), "{\"n\":%ld.%03lue%d}",
+                 _ssfBenchLongs[i] / 1000, (unsigned long)(_SSFBenchRand() % 1000),
+                 (int)(_SSFBenchRand() % 16) - 8);
+    }
+
+    start = clock();
+    for (i = 0; i < SSF_BENCH_NUM_OPS; i++)
+    {
+        SSF_ASSERT(SSFJsonGetDouble(_ssfBenchJs[i & (SSF_BENCH_NUM_VALUES - 1)], path, &d));
+        _ssfBenchSink += (size_t)d;
+    }
+    _SSFBenchReport("SSFJsonGetDouble()", start, SSF_BENCH_NUM_OPS);
+
+    start = clock();
+    for (i = 0; i < SSF_BENCH_NUM_OPS; i++)
+    {
+        _ssfBenchSink += (size_t)strtod(&_ssfBenchJs[i & (SSF_BENCH_NUM_VALUES - 1)][5], &endptr);
+    }
+    _SSFBenchReport("strtod()", start, SSF_BENCH_NUM_OPS);
+#endif /* SSF_JSON_CONFIG_ENABLE_FLOAT_PARSE */
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Compares routing on a string value by copying it against comparing its span in place.         */
+/* --------------------------------------------------------------------------------------------- */
+static void _SSFBenchJsonStrings(void)
+{
+    static const char *routes[] = { "sensor/temperature", "sensor/humidity", "actuator/valve",
+                                    "actuator/pump" };
+    unsigned long i;
+    size_t r;
+    clock_t start;
+    SSFJsonStr_t str;
+    SSFCStrIn_t js;
+    SSFCStrIn_t path[SSF_JSON_CONFIG_MAX_IN_DEPTH + 1];
+
+    memset(path, 0, sizeof(path));
+    path[0] = "route";
+    for (i = 0; i < SSF_BENCH_NUM_VALUES; i++)
+    {
+        snprintf(_ssfBenchJs[i], sizeof(_ssfBenchJs[i]), "{\"route\":\"%s\"}",
+                 routes[_SSFBenchRand() & 3]);
+    }
+
+    start = clock();
+    for (i = 0; i < SSF_BENCH_NUM_OPS; i++)
+    {
+        js = _ssfBenchJs[i & (SSF_BENCH_NUM_VALUES - 1)];
+        SSF_ASSERT(SSFJsonGetString(js, path, _ssfBenchOut, sizeof(_ssfBenchOut), NULL));
+        for (r = 0; strcmp(_ssfBenchOut, routes[r]) != 0; r++);
+        _ssfBenchSink += r;
+    }
+    _SSFBenchReport("SSFJsonGetString() + strcmp()", start, SSF_BENCH_NUM_OPS);
+
+    start = clock();
+    for (i = 0; i < SSF_BENCH_NUM_OPS; i++)
+    {
+        js = _ssfBenchJs[i & (SSF_BENCH_NUM_VALUES - 1)];
+        SSF_ASSERT(SSFJsonGetStringSpan(js, path, &str));
+        for (r = 0; !SSFJsonStrIs(&str, routes[r]); r++);
+        _ssfBenchSink += r;
+    }
+    _SSFBenchReport("SSFJsonGetStringSpan() + SSFJsonStrIs()", start, SSF_BENCH_NUM_OPS);
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Measures decoding a large Base64 string.                                                      */
+/* --------------------------------------------------------------------------------------------- */
+static void _SSFBenchBase64Decode(void)
+{
+    static uint8_t bin[3072];
+    static char b64[4097];
+    unsigned long i;
+    size_t len;
+    clock_t start;
+
+    for (i = 0; i < sizeof(bin); i++) bin[i] = (uint8_t)_SSFBenchRand();
+    SSF_ASSERT(SSFBase64Encode(bin, sizeof(bin), b64, sizeof(b64), &len));
+    SSF_ASSERT(len == 4096);
+
+    start = clock();
+    for (i = 0; i < (SSF_BENCH_NUM_OPS / 100); i++)
+    {
+        SSF_ASSERT(SSFBase64Decode(b64, 4096, bin, sizeof(bin), &len));
+        _ssfBenchSink += bin[len - 1];
+    }
+    _SSFBenchReport("SSFBase64Decode() 4096 chars", start, SSF_BENCH_NUM_OPS / 100);
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Measures encoding a large binary buffer as Base64 and Base64url.                              */
+/* --------------------------------------------------------------------------------------------- */
+static void _SSFBenchBase64Encode(void)
+{
+    static uint8_t bin[3072];
+    static char b64[4097];
+    unsigned long i;
+    size_t len;
+    clock_t start;
+
+    for (i = 0; i < sizeof(bin); i++) bin[i] = (uint8_t)_SSFBenchRand();
+
+    start = clock();
+    for (i = 0; i < (SSF_BENCH_NUM_OPS / 100); i++)
+    {
+        SSF_ASSERT(SSFBase64Encode(bin, sizeof(bin), b64, sizeof(b64), &len));
+        _ssfBenchSink += (uint8_t)b64[len - 1];
+    }
+    _SSFBenchReport("SSFBase64Encode() 3072 bytes", start, SSF_BENCH_NUM_OPS / 100);
+
+    start = clock();
+    for (i = 0; i < (SSF_BENCH_NUM_OPS / 100); i++)
+    {
+        SSF_ASSERT(SSFBase64EncodeFmt(bin, sizeof(bin), b64, sizeof(b64), &len,
+                                      SSF_BASE64_FMT_URL_NOPAD));
+        _ssfBenchSink += (uint8_t)b64[len - 1];
+    }
+    _SSFBenchReport("SSFBase64EncodeFmt() URL_NOPAD 3072 bytes", start, SSF_BENCH_NUM_OPS / 100);
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Measures encoding a binary buffer as hex and decoding it back.                                */
+/* --------------------------------------------------------------------------------------------- */
+static void _SSFBenchHex(void)
+{
+    static uint8_t bin[2048];
+    static char hex[4097];
+    unsigned long i;
+    size_t len;
+    clock_t start;
+
+    for (i = 0; i < sizeof(bin); i++) bin[i] = (uint8_t)_SSFBenchRand();
+
+    start = clock();
+    for (i = 0; i < (SSF_BENCH_NUM_OPS / 100); i++)
+    {
+        SSF_ASSERT(SSFHexBinToBytes(bin, sizeof(bin), hex, sizeof(hex), &len, false,
+                                    SSF_HEX_CASE_LOWER));
+        _ssfBenchSink += (uint8_t)hex[len - 1];
+    }
+    _SSFBenchReport("SSFHexBinToBytes() 2048 bytes", start, SSF_BENCH_NUM_OPS / 100);
+
+    start = clock();
+    for (i = 0; i < (SSF_BENCH_NUM_OPS / 100); i++)
+    {
+        SSF_ASSERT(SSFHexBytesToBin(hex, 4096, bin, sizeof(bin), &len, false));
+        _ssfBenchSink += bin[len - 1];
+    }
+    _SSFBenchReport("SSFHexBytesToBin() 4096 chars", start, SSF_BENCH_NUM_OPS / 100);
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Compares AES with and without a key schedule context, and measures AES-GCM.                   */
+/* --------------------------------------------------------------------------------------------- */
+static void _SSFBenchAES(void)
+{
+    static uint8_t pt[1024];
+    static uint8_t ct[1024];
+    uint8_t key[16];
+    uint8_t iv[12];
+    uint8_t tag[16];
+    uint8_t block[SSF_AES_BLOCK_SIZE];
+    SSFAESContext_t context;
+    unsigned long i;
+    clock_t start;
+
+    for (i = 0; i < sizeof(pt); i++) pt[i] = (uint8_t)_SSFBenchRand();
+    for (i = 0; i < sizeof(key); i++) key[i] = (uint8_t)_SSFBenchRand();
+    for (i = 0; i < sizeof(iv); i++) iv[i] = (uint8_t)_SSFBenchRand();
+    memset(block, 0, sizeof(block));
+
+    start = clock();
+    for (i = 0; i < (SSF_BENCH_NUM_OPS / 4); i++)
+    {
+        SSFAES128BlockEncrypt(block, sizeof(block), block, sizeof(block), key, sizeof(key));
+    }
+    _ssfBenchSink += block[0];
+    _SSFBenchReport("SSFAES128BlockEncrypt()", start, SSF_BENCH_NUM_OPS / 4);
+
+    SSFAESInitContext(&context, key, sizeof(key));
+    start = clock();
+    for (i = 0; i < (SSF_BENCH_NUM_OPS / 4); i++)
+    {
+        SSFAESContextBlockEncrypt(&context, block, sizeof(block), block, sizeof(block));
+    }
+    _ssfBenchSink += block[0];
+    _SSFBenchReport("SSFAESContextBlockEncrypt() 128", start, SSF_BENCH_NUM_OPS / 4);
+
+    memset(block, 0, sizeof(block));
+    start = clock();
+    for (i = 0; i < (SSF_BENCH_NUM_OPS / 1000); i++)
+    {
+        SSFAESContextCBCEncrypt(&context, block, sizeof(block), pt, sizeof(pt), ct, sizeof(ct));
+        _ssfBenchSink += ct[0];
+    }
+    _SSFBenchReport("SSFAESContextCBCEncrypt() 1024 bytes", start, SSF_BENCH_NUM_OPS / 1000);
+
+    start = clock();
+    for (i = 0; i < (SSF_BENCH_NUM_OPS / 1000); i++)
+    {
+        SSFAESContextCTR128(&context, block, sizeof(block), pt, sizeof(pt), ct, sizeof(ct));
+        _ssfBenchSink += ct[0];
+    }
+    _SSFBenchReport("SSFAESContextCTR128() 1024 bytes", start, SSF_BENCH_NUM_OPS / 1000);
+    SSFAESDeInitContext(&context);
+
+    start = clock();
+    for (i = 0; i < (SSF_BENCH_NUM_OPS / 1000); i++)
+    {
+        SSFAESGCMEncrypt(pt, sizeof(pt), iv, sizeof(iv), NULL, 0, key, sizeof(key), tag,
+                         sizeof(tag), ct, sizeof(ct));
+        _ssfBenchSink += tag[0];
+    }
+    _SSFBenchReport("SSFAESGCMEncrypt() 1024 bytes", start, SSF_BENCH_NUM_OPS / 1000);
+}
+
+#if SSF_JSON_CONFIG_ENABLE_ITER == 1
+/* --------------------------------------------------------------------------------------------- */
+/* Compares iterating a JSON array against indexing each element by path.                        */
+/* --------------------------------------------------------------------------------------------- */
+static void _SSFBenchJsonIterArray(void)
+{
+    static char js[SSF_JSON_CONFIG_MAX_IN_LEN + 1];
+    unsigned long i;
+    unsigned long ops = 0;
+    size_t n;
+    size_t len;
+    size_t end;
+    long si;
+    bool comma = false;
+    clock_t start;
+    SSFJsonIter_t it;
+    SSFCStrIn_t path[SSF_JSON_CONFIG_MAX_IN_DEPTH + 1];
+
+    memset(path, 0, sizeof(path));
+    path[0] = "a";
+    memcpy(js, "{\"a\":[", 6);
+    end = 6;
+    for (len = 0; len < 256; len++)
+    {
+        SSF_ASSERT(SSFJsonPrintInt(js, sizeof(js), end, &end, _ssfBenchLongs[len] % 1000,
+                                   &comma));
+    }
+    js[end++] = ']';
+    js[end++] = '}';
+    js[end] = 0;
+
+    start = clock();
+    for (i = 0; i < (SSF_BENCH_NUM_OPS / len); i++)
+    {
+        SSF_ASSERT(SSFJsonIterBegin(&it, js, path));
+        while (SSFJsonIterNext(&it))
+        {
+            SSF_ASSERT(SSFJsonIterGetLong(&it, &si));
+            _ssfBenchSink += (size_t)si;
+            ops++;
+        }
+    }
+    _SSFBenchReport("SSFJsonIterNext() 256 elements", start, ops);
+
+    ops = 0;
+    path[1] = (SSFCStrIn_t)&n;
+    start = clock();
+    for (i = 0; i < (SSF_BENCH_NUM_OPS / len / 32); i++)
+    {
+        for (n = 0; n < len; n++)
+        {
+            SSF_ASSERT(SSFJsonGetLong(js, path, &si));
+            _ssfBenchSink += (size_t)si;
+            ops++;
+        }
+    }
+    _SSFBenchReport("SSFJsonGetLong() by index 256 elements", start, ops);
+}
+#endif /* SSF_JSON_CONFIG_ENABLE_ITER */
+
+#if SSF_JSON_CONFIG_ENABLE_MINIFY == 1
+/* --------------------------------------------------------------------------------------------- */
+/* Measures minifying and canonicalizing a pretty printed JSON string.                           */
+/* --------------------------------------------------------------------------------------------- */
+static void _SSFBenchJsonMinify(void)
+{
+    static char js[SSF_JSON_CONFIG_MAX_IN_LEN + 1];
+    static char out[SSF_JSON_CONFIG_MAX_IN_LEN + 1];
+    unsigned long i;
+    size_t len;
+    size_t end;
+    clock_t start;
+
+    /* An object of 32 members in reverse key order, each an object of a few values */
+    end = (size_t)snprintf(js, sizeof(js), "{\n");
+    for (i = 32; i > 0; i--)
+    {
+        end += (size_t)snprintf(&js[end], sizeof(js) - end,
+                                "  \"k%02lu\" : { \"v\" : %ld, \"s\" : \"abc def\", "
+                                "\"a\" : [ 1, 2 ] }%s\n", i, _ssfBenchLongs[i] % 1000,
+                                (i > 1) ? "," : "");
+    }
+    SSF_ASSERT((end + 2) < sizeof(js));
+    memcpy(&js[end], "}", 2);
+
+    start = clock();
+    for (i = 0; i < (SSF_BENCH_NUM_OPS / 1000); i++)
+    {
+        SSF_ASSERT(SSFJsonMinify(js, out, sizeof(out), &len));
+        _ssfBenchSink += len;
+    }
+    _SSFBenchReport("SSFJsonMinify() 32 members", start, SSF_BENCH_NUM_OPS / 1000);
+
+#if SSF_JSON_CONFIG_ENABLE_ITER == 1
+    start = clock();
+    for (i = 0; i < (SSF_BENCH_NUM_OPS / 1000); i++)
+    {
+        SSF_ASSERT(SSFJsonCanonicalize(js, out, sizeof(out), &len));
+        _ssfBenchSink += len;
+    }
+    _SSFBenchReport("SSFJsonCanonicalize() 32 members", start, SSF_BENCH_NUM_OPS / 1000);
+#endif /* SSF_JSON_CONFIG_ENABLE_ITER */
+}
+#endif /* SSF_JSON_CONFIG_ENABLE_MINIFY */
+
+#if SSF_CBOR_CONFIG_ENABLE_JSON == 1
+/* --------------------------------------------------------------------------------------------- */
+/* Compares getting fields of a JSON message against the same message transcoded to CBOR.        */
+/* --------------------------------------------------------------------------------------------- */
+static void _SSFBenchCborGet(void)
+{
+    static const char js[] = "{\"id\":1234567,\"seq\":42,\"name\":\"sensor-7\",\"on\":true,"
+                             "\"t\":[-12,3400,5600,-78],\"key\":\"AAECAwQFBgcICQoLDA0ODw==\"}";
+    uint8_t cbor[128];
+    uint8_t key[18];
+    size_t cborLen;
+    size_t len;
+    unsigned long i;
+    long si;
+    clock_t start;
+    SSFCStrIn_t path[SSF_JSON_CONFIG_MAX_IN_DEPTH + 1];
+    SSFCStrIn_t cpath[SSF_CBOR_CONFIG_MAX_IN_DEPTH + 1];
+
+    memset(path, 0, sizeof(path));
+    memset(cpath, 0, sizeof(cpath));
+    SSF_ASSERT(SSFCborFromJson(js, cbor, sizeof(cbor), &cborLen));
+    printf("%-40s %9lu bytes\r\n", "JSON message", (unsigned long)strlen(js));
+    printf("%-40s %9lu bytes\r\n", "SSFCborFromJson() message", (unsigned long)cborLen);
+
+    path[0] = "seq";
+    cpath[0] = "seq";
+    start = clock();
+    for (i = 0; i < (SSF_BENCH_NUM_OPS / 4); i++)
+    {
+        SSF_ASSERT(SSFJsonGetLong(js, path, &si));
+        _ssfBenchSink += (size_t)si;
+    }
+    _SSFBenchReport("SSFJsonGetLong()", start, SSF_BENCH_NUM_OPS / 4);
+
+    start = clock();
+    for (i = 0; i < (SSF_BENCH_NUM_OPS / 4); i++)
+    {
+        SSF_ASSERT(SSFCborGetLong(cbor, cborLen, cpath, &si));
+        _ssfBenchSink += (size_t)si;
+    }
+    _SSFBenchReport("SSFCborGetLong()", start, SSF_BENCH_NUM_OPS / 4);
+
+    /* The Base64 string only becomes a byte string when it is transcoded back from CBOR */
+    len = cborLen - 26;
+    SSF_ASSERT(SSFCborPrintBytes(cbor, sizeof(cbor), len, &cborLen,
+                                 (const uint8_t *)"\x00\x01\x02\x03\x04\x05\x06\x07\x08\x09\x0a"
+                                 "\x0b\x0c\x0d\x0e\x0f", 16));
+    path[0] = "key";
+    cpath[0] = "key";
+    start = clock();
+    for (i = 0; i < (SSF_BENCH_NUM_OPS / 4); i++)
+    {
+        SSF_ASSERT(SSFJsonGetBase64(js, path, key, sizeof(key), &len));
+        _ssfBenchSink += key[len - 1];
+    }
+    _SSFBenchReport("SSFJsonGetBase64() 16 bytes", start, SSF_BENCH_NUM_OPS / 4);
+
+    start = clock();
+    for (i = 0; i < (SSF_BENCH_NUM_OPS / 4); i++)
+    {
+        SSF_ASSERT(SSFCborGetBytes(cbor, cborLen, cpath, key, sizeof(key), &len));
+        _ssfBenchSink += key[len - 1];
+    }
+    _SSFBenchReport("SSFCborGetBytes() 16 bytes", start, SSF_BENCH_NUM_OPS / 4);
+}
+#endif /* SSF_CBOR_CONFIG_ENABLE_JSON */
+
+/* --------------------------------------------------------------------------------------------- */
+/* Prints the members of a small telemetry message.                                              */
+/* --------------------------------------------------------------------------------------------- */
+static bool _SSFBenchTelemetryPrint(char *js, size_t size, size_t start, size_t *end, void *in)
+{
+    bool comma = false;
+
+    if (!SSFJsonPrintLabel(js, size, start, &start, "id", &comma)) return false;
+    if (!SSFJsonPrintUInt(js, size, start, &start, 3735928559ul, NULL)) return false;
+    if (!SSFJsonPrintLabel(js, size, start, &start, "seq", &comma)) return false;
+    if (!SSFJsonPrintInt(js, size, start, &start, 48213, NULL)) return false;
+    if (!SSFJsonPrintLabel(js, size, start, &start, "ts", &comma)) return false;
+    if (!SSFJsonPrintUInt(js, size, start, &start, 1700000123ul, NULL)) return false;
+    if (!SSFJsonPrintLabel(js, size, start, &start, "name", &comma)) return false;
+    if (!SSFJsonPrintString(js, size, start, &start, "boiler-room/sensor-7", NULL)) return false;
+    if (!SSFJsonPrintLabel(js, size, start, &start, "t", &comma)) return false;
+    if (!SSFJsonPrintInt(js, size, start, &start, -1250, NULL)) return false;
+    if (!SSFJsonPrintLabel(js, size, start, &start, "h", &comma)) return false;
+    if (!SSFJsonPrintInt(js, size, start, &start, 4480, NULL)) return false;
+    if (!SSFJsonPrintLabel(js, size, start, &start, "on", &comma)) return false;
+    if (!SSFJsonPrintTrue(js, size, start, &start, NULL)) return false;
+    if (!SSFJsonPrintLabel(js, size, start, &start, "err", &comma)) return false;
+    if (!SSFJsonPrintNull(js, size, start, end, NULL)) return false;
+    return true;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns the number of fields got from a small telemetry message.                              */
+/* --------------------------------------------------------------------------------------------- */
+static size_t _SSFBenchTelemetryGet(SSFCStrIn_t js)
+{
+    static SSFCStrIn_t id[SSF_JSON_CONFIG_MAX_IN_DEPTH + 1] = { "id" };
+    static SSFCStrIn_t seq[SSF_JSON_CONFIG_MAX_IN_DEPTH + 1] = { "seq" };
+    static SSFCStrIn_t ts[SSF_JSON_CONFIG_MAX_IN_DEPTH + 1] = { "ts" };
+    static SSFCStrIn_t name[SSF_JSON_CONFIG_MAX_IN_DEPTH + 1] = { "name" };
+    static SSFCStrIn_t t[SSF_JSON_CONFIG_MAX_IN_DEPTH + 1] = { "t" };
+    static SSFCStrIn_t h[SSF_JSON_CONFIG_MAX_IN_DEPTH + 1] = { "h" };
+    char str[32];
+    unsigned long ul;
+    long si;
+
+    SSF_ASSERT(SSFJsonGetULong(js, id, &ul));
+    SSF_ASSERT(SSFJsonGetLong(js, seq, &si));
+    SSF_ASSERT(SSFJsonGetULong(js, ts, &ul));
+    SSF_ASSERT(SSFJsonGetString(js, name, str, sizeof(str), NULL));
+    SSF_ASSERT(SSFJsonGetLong(js, t, &si));
+    SSF_ASSERT(SSFJsonGetLong(js, h, &si));
+    _ssfBenchSink += ul + (size_t)si + (size_t)str[0];
+    return 6;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Prints the members of a config object nested to the maximum parse depth.                      */
+/* --------------------------------------------------------------------------------------------- */
+static bool _SSFBenchConfigPrint(char *js, size_t size, size_t start, size_t *end, void *in)
+{
+    size_t level = (in == NULL) ? 1 : *(size_t *)in;
+    char name[16];
+    bool comma = false;
+
+    snprintf(name, sizeof(name), "node-%lu", (unsigned long)level);
+    if (!SSFJsonPrintLabel(js, size, start, &start, "id", &comma)) return false;
+    if (!SSFJsonPrintInt(js, size, start, &start, (long)(level * 1000) + 7, NULL)) return false;
+    if (!SSFJsonPrintLabel(js, size, start, &start, "name", &comma)) return false;
+    if (!SSFJsonPrintString(js, size, start, &start, name, NULL)) return false;
+    if (!SSFJsonPrintLabel(js, size, start, &start, "mode", &comma)) return false;
+    if (!SSFJsonPrintString(js, size, start, &start, "auto", NULL)) return false;
+    if (!SSFJsonPrintLabel(js, size, start, &start, "rate", &comma)) return false;
+    if (!SSFJsonPrintUInt(js, size, start, &start, 115200, NULL)) return false;
+    if (!SSFJsonPrintLabel(js, size, start, &start, "retries", &comma)) return false;
+    if (!SSFJsonPrintUInt(js, size, start, &start, 3, NULL)) return false;
+    if (!SSFJsonPrintLabel(js, size, start, &start, "en", &comma)) return false;
+    if (!SSFJsonPrintFalse(js, size, start, &start, NULL)) return false;
+    if (level < SSF_JSON_CONFIG_MAX_IN_DEPTH)
+    {
+        level++;
+        if (!SSFJsonPrintLabel(js, size, start, &start, "sub", &comma)) return false;
+        if (!SSFJsonPrintObject(js, size, start, &start, _SSFBenchConfigPrint, &level, NULL))
+        { return false; }
+    }
+    *end = start;
+    return true;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns the number of fields got from each level of a nested config object.                   */
+/* --------------------------------------------------------------------------------------------- */
+static size_t _SSFBenchConfigGet(SSFCStrIn_t js)
+{
+    SSFCStrIn_t path[SSF_JSON_CONFIG_MAX_IN_DEPTH + 1];
+    char str[16];
+    size_t level;
+    long si;
+
+    memset(path, 0, sizeof(path));
+    for (level = 0; level < SSF_JSON_CONFIG_MAX_IN_DEPTH; level++)
+    {
+        path[level] = "id";
+        SSF_ASSERT(SSFJsonGetLong(js, path, &si));
+        path[level] = "name";
+        SSF_ASSERT(SSFJsonGetString(js, path, str, sizeof(str), NULL));
+        path[level] = "sub";
+        _ssfBenchSink += (size_t)si + (size_t)str[5];
+    }
+    return level * 2;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Prints the members of a firmware chunk message holding a large Base64 blob.                   */
+/* --------------------------------------------------------------------------------------------- */
+static bool _SSFBenchBlobPrint(char *js, size_t size, size_t start, size_t *end, void *in)
+{
+    bool comma = false;
+
+    if (!SSFJsonPrintLabel(js, size, start, &start, "name", &comma)) return false;
+    if (!SSFJsonPrintString(js, size, start, &start, "fw-1.4.2.bin", NULL)) return false;
+    if (!SSFJsonPrintLabel(js, size, start, &start, "len", &comma)) return false;
+    if (!SSFJsonPrintUInt(js, size, start, &start, sizeof(_ssfBenchBlob), NULL)) return false;
+    if (!SSFJsonPrintLabel(js, size, start, &start, "sha", &comma)) return false;
+    if (!SSFJsonPrintHex(js, size, start, &start, _ssfBenchBlob, 32, false, NULL)) return false;
+    if (!SSFJsonPrintLabel(js, size, start, &start, "data", &comma)) return false;
+    return SSFJsonPrintBase64(js, size, start, end, _ssfBenchBlob, sizeof(_ssfBenchBlob), NULL);
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns the number of fields got from a firmware chunk message.                               */
+/* --------------------------------------------------------------------------------------------- */
+static size_t _SSFBenchBlobGet(SSFCStrIn_t js)
+{
+    static SSFCStrIn_t name[SSF_JSON_CONFIG_MAX_IN_DEPTH + 1] = { "name" };
+    static SSFCStrIn_t len[SSF_JSON_CONFIG_MAX_IN_DEPTH + 1] = { "len" };
+    static SSFCStrIn_t sha[SSF_JSON_CONFIG_MAX_IN_DEPTH + 1] = { "sha" };
+    static SSFCStrIn_t data[SSF_JSON_CONFIG_MAX_IN_DEPTH + 1] = { "data" };
+    static uint8_t bin[sizeof(_ssfBenchBlob) + 3];
+    char str[32];
+    unsigned long ul;
+    size_t binLen;
+
+    SSF_ASSERT(SSFJsonGetString(js, name, str, sizeof(str), NULL));
+    SSF_ASSERT(SSFJsonGetULong(js, len, &ul));
+    SSF_ASSERT(SSFJsonGetHex(js, sha, bin, sizeof(bin), &binLen, false));
+    SSF_ASSERT(SSFJsonGetBase64(js, data, bin, sizeof(bin), &binLen));
+    SSF_ASSERT(binLen == ul);
+    _ssfBenchSink += binLen + (size_t)str[0];
+    return 4;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Prints the samples of a big array.                                                            */
+/* --------------------------------------------------------------------------------------------- */
+static bool _SSFBenchSamplesPrint(char *js, size_t size, size_t start, size_t *end, void *in)
+{
+    size_t i;
+    bool comma = false;
+
+    for (i = 0; i < SSF_BENCH_CORPUS_SAMPLES; i++)
+    {
+        if (!SSFJsonPrintInt(js, size, start, &start, _ssfBenchLongs[i] % 10000, &comma))
+        { return false; }
+    }
+    *end = start;
+    return true;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Prints the members of a message holding a big array.                                          */
+/* --------------------------------------------------------------------------------------------- */
+static bool _SSFBenchArrayPrint(char *js, size_t size, size_t start, size_t *end, void *in)
+{
+    bool comma = false;
+
+    if (!SSFJsonPrintLabel(js, size, start, &start, "n", &comma)) return false;
+    if (!SSFJsonPrintUInt(js, size, start, &start, SSF_BENCH_CORPUS_SAMPLES, NULL)) return false;
+    if (!SSFJsonPrintLabel(js, size, start, &start, "samples", &comma)) return false;
+    return SSFJsonPrintArray(js, size, start, end, _SSFBenchSamplesPrint, NULL, NULL);
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns the number of fields got from a message holding a big array.                          */
+/* --------------------------------------------------------------------------------------------- */
+static size_t _SSFBenchArrayGet(SSFCStrIn_t js)
+{
+    static SSFCStrIn_t n[SSF_JSON_CONFIG_MAX_IN_DEPTH + 1] = { "n" };
+    SSFCStrIn_t path[SSF_JSON_CONFIG_MAX_IN_DEPTH + 1];
+    unsigned long ul;
+    size_t i;
+    long si;
+
+    SSF_ASSERT(SSFJsonGetULong(js, n, &ul));
+    memset(path, 0, sizeof(path));
+    path[0] = "samples";
+    path[1] = (SSFCStrIn_t)&i;
+    for (i = 0; i < ul; i += (SSF_BENCH_CORPUS_SAMPLES / 8))
+    {
+        SSF_ASSERT(SSFJsonGetLong(js, path, &si));
+        _ssfBenchSink += (size_t)si;
+    }
+    return 9;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Corpus of realistic documents.                                                                */
+/* --------------------------------------------------------------------------------------------- */
+static SSFBenchDoc_t _ssfBenchCorpus[] =
+{
+    { "telemetry", _SSFBenchTelemetryPrint, _SSFBenchTelemetryGet, { "seq" }, NULL, 0, "" },
+    { "config", _SSFBenchConfigPrint, _SSFBenchConfigGet, { "sub" }, NULL, 0, "" },
+    { "base64 blob", _SSFBenchBlobPrint, _SSFBenchBlobGet, { "len" }, NULL, 0, "" },
+    { "big array", _SSFBenchArrayPrint, _SSFBenchArrayGet, { "n" }, NULL, 0, "" },
+};
+
+/* --------------------------------------------------------------------------------------------- */
+/* Runs a benchmark function on the painted stack.                                               */
+/* --------------------------------------------------------------------------------------------- */
+static void *_SSFBenchStackThread(void *arg)
+{
+    SSFBenchDoc_t *doc = (SSFBenchDoc_t *)arg;
+
+    if (doc->op != NULL) _ssfBenchSink += doc->op(doc);
+    return NULL;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns the peak stack in bytes used by the doc's op, assumes a downward growing stack.       */
+/* --------------------------------------------------------------------------------------------- */
+static size_t _SSFBenchStackUsed(SSFBenchDoc_t *doc)
+{
+    const uint8_t *stack = (const uint8_t *)_ssfBenchStack;
+    pthread_attr_t attr;
+    pthread_t thread;
+    size_t i;
+
+    /* Run op on a thread whose stack is painted, then find the deepest byte it overwrote */
+    memset(_ssfBenchStack, SSF_BENCH_STACK_PAINT, sizeof(_ssfBenchStack));
+    SSF_ASSERT(pthread_attr_init(&attr) == 0);
+    SSF_ASSERT(pthread_attr_setstack(&attr, _ssfBenchStack, sizeof(_ssfBenchStack)) == 0);
+    SSF_ASSERT(pthread_create(&thread, &attr, _SSFBenchStackThread, doc) == 0);
+    SSF_ASSERT(pthread_join(thread, NULL) == 0);
+    SSF_ASSERT(pthread_attr_destroy(&attr) == 0);
+    for (i = 0; (i < sizeof(_ssfBenchStack)) && (stack[i] == SSF_BENCH_STACK_PAINT); i++);
+    return sizeof(_ssfBenchStack) - i;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns 1 after validating the doc.                                                           */
+/* --------------------------------------------------------------------------------------------- */
+static size_t _SSFBenchCorpusIsValid(SSFBenchDoc_t *doc)
+{
+    SSF_ASSERT(SSFJsonIsValid(doc->js));
+    return 1;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns the number of fields got from the doc.                                                */
+/* --------------------------------------------------------------------------------------------- */
+static size_t _SSFBenchCorpusGet(SSFBenchDoc_t *doc)
+{
+    return doc->get(doc->js);
+}
+
+#if SSF_JSON_CONFIG_ENABLE_UPDATE == 1
+/* --------------------------------------------------------------------------------------------- */
+/* Prints the value written by SSFJsonUpdate().                                                  */
+/* --------------------------------------------------------------------------------------------- */
+static bool _SSFBenchUpdatePrint(char *js, size_t size, size_t start, size_t *end, void *in)
+{
+    return SSFJsonPrintInt(js, size, start, end, 4242, NULL);
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns 1 after updating a value of the doc's working copy.                                   */
+/* --------------------------------------------------------------------------------------------- */
+static size_t _SSFBenchCorpusUpdate(SSFBenchDoc_t *doc)
+{
+    SSF_ASSERT(SSFJsonUpdate(_ssfBenchWork, sizeof(_ssfBenchWork), doc->update,
+                             _SSFBenchUpdatePrint));
+    return 1;
+}
+#endif /* SSF_JSON_CONFIG_ENABLE_UPDATE */
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns 1 after printing the doc.                                                             */
+/* --------------------------------------------------------------------------------------------- */
+static size_t _SSFBenchCorpusPrint(SSFBenchDoc_t *doc)
+{
+    size_t end;
+
+    SSF_ASSERT(SSFJsonPrintObject(_ssfBenchWork, sizeof(_ssfBenchWork), 0, &end, doc->print, NULL,
+                                  NULL));
+    SSF_ASSERT(end == doc->len);
+    return 1;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Prints the throughput, time per field or op, and peak stack of op run over the doc.           */
+/* --------------------------------------------------------------------------------------------- */
+static void _SSFBenchCorpusRun(SSFBenchDoc_t *doc, const char *name, SSFBenchCorpusOp_t op)
+{
+    unsigned long ops = SSF_BENCH_CORPUS_BYTES / doc->len;
+    unsigned long fields = 0;
+    unsigned long i;
+    size_t stack;
+    clock_t start;
+    double secs;
+
+    doc->op = NULL;
+    stack = _SSFBenchStackUsed(doc);
+    doc->op = op;
+    stack = _SSFBenchStackUsed(doc) - stack;
+
+    start = clock();
+    for (i = 0; i < ops; i++) fields += op(doc);
+    secs = ((double)(clock() - start)) / CLOCKS_PER_SEC;
+
+    printf("  %-38s %9.1f MB/s %9.1f ns/%s %6lu B stack\r\n", name,
+           (((double)doc->len) * ops) / (secs * 1e6), (secs * 1e9) / fields,
+           (fields == ops) ? "op   " : "field", (unsigned long)stack);
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Measures parsing, getting, updating and printing a corpus of realistic documents.             */
+/* --------------------------------------------------------------------------------------------- */
+static void _SSFBenchJsonCorpus(void)
+{
+    SSFBenchDoc_t *doc;
+    size_t i;
+
+    for (i = 0; i < sizeof(_ssfBenchBlob); i++) _ssfBenchBlob[i] = (uint8_t)_SSFBenchRand();
+    for (i = 1; i < SSF_JSON_CONFIG_MAX_IN_DEPTH; i++) _ssfBenchCorpus[1].update[i] = "sub";
+    _ssfBenchCorpus[1].update[i - 1] = "id";
+
+    for (doc = _ssfBenchCorpus; doc < &_ssfBenchCorpus[SSF_BENCH_CORPUS_DOCS]; doc++)
+    {
+        SSF_ASSERT(SSFJsonPrintObject(doc->js, sizeof(doc->js), 0, &doc->len, doc->print, NULL,
+                                      NULL));
+        doc->js[doc->len] = 0;
+        SSF_ASSERT(SSFJsonIsValid(doc->js));
+        printf("%s, %lu bytes, %lu fields got\r\n", doc->name, (unsigned long)doc->len,
+               (unsigned long)doc->get(doc->js));
+
+        _SSFBenchCorpusRun(doc, "SSFJsonIsValid()", _SSFBenchCorpusIsValid);
+        _SSFBenchCorpusRun(doc, "SSFJsonGet*()", _SSFBenchCorpusGet);
+#if SSF_JSON_CONFIG_ENABLE_UPDATE == 1
+        memcpy(_ssfBenchWork, doc->js, doc->len + 1);
+        _SSFBenchCorpusRun(doc, "SSFJsonUpdate()", _SSFBenchCorpusUpdate);
+#endif /* SSF_JSON_CONFIG_ENABLE_UPDATE */
+        _SSFBenchCorpusRun(doc, "SSFJsonPrint*()", _SSFBenchCorpusPrint);
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* SSF microbenchmark entry point.                                                               */
+/* --------------------------------------------------------------------------------------------- */
+int main(void)
+{
+    _SSFBenchJsonPrintNumbers();
+    _SSFBenchJsonGetNumbers();
+    _SSFBenchJsonStrings();
+    _SSFBenchBase64Decode();
+    _SSFBenchBase64Encode();
+    _SSFBenchHex();
+    _SSFBenchAES();
+#if SSF_JSON_CONFIG_ENABLE_ITER == 1
+    _SSFBenchJsonIterArray();
+#endif /* SSF_JSON_CONFIG_ENABLE_ITER */
+#if SSF_JSON_CONFIG_ENABLE_MINIFY == 1
+    _SSFBenchJsonMinify();
+#endif /* SSF_JSON_CONFIG_ENABLE_MINIFY */
+#if SSF_CBOR_CONFIG_ENABLE_JSON == 1
+    _SSFBenchCborGet();
+#endif /* SSF_CBOR_CONFIG_ENABLE_JSON */
+    _SSFBenchJsonCorpus();
+    return 0;
+}
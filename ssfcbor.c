@@ -0,0 +1,987 @@
+/* --------------------------------------------------------------------------------------------- */
+/* Small System Framework                                                                        */
+/*                                                                                               */
+/* ssfcbor.c                                                                                     */
+/* Provides CBOR (RFC 8949) encoder/decoder interface.                                           */
+/*                                                                                               */
+/* BSD-3-Clause License                                                                          */
+/* Copyright 2021 Supurloop Software LLC                                                         */
+/*                                                                                               */
+/* Redistribution and use in source and binary forms, with or without modification, are          */
+/* permitted provided that the following conditions are met:                                     */
+/*                                                                                               */
+/* 1. Redistributions of source code must retain the above copyright notice, this list of        */
+/* conditions and the following disclaimer.                                                      */
+/* 2. Redistributions in binary form must reproduce the above copyright notice, this list of     */
+/* conditions and the following disclaimer in the documentation and/or other materials provided  */
+/* with the distribution.                                                                        */
+/* 3. Neither the name of the copyright holder nor the names of its contributors may be used to  */
+/* endorse or promote products derived from this software without specific prior written         */
+/* permission.                                                                                   */
+/*                                                                                               */
+/* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS   */
+/* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF               */
+/* MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE    */
+/* COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL      */
+/* EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE */
+/* GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED    */
+/* AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING     */
+/* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED  */
+/* OF THE POSSIBILITY OF SUCH DAMAGE.                                                            */
+/* --------------------------------------------------------------------------------------------- */
+#include <stdio.h>
+#include <limits.h>
+#include "ssfport.h"
+#include "ssfassert.h"
+#include "ssfcbor.h"
+
+#if SSF_CBOR_CONFIG_ENABLE_FLOAT == 1
+    #include <math.h> /* ldexp() */
+    #include <float.h> /* FLT_MAX */
+#endif /* SSF_CBOR_CONFIG_ENABLE_FLOAT */
+
+#if SSF_CBOR_CONFIG_ENABLE_JSON == 1
+    #include "ssfjson.h"
+    #if SSF_JSON_CONFIG_ENABLE_ITER == 0
+        #error SSFCBOR SSF_CBOR_CONFIG_ENABLE_JSON requires SSF_JSON_CONFIG_ENABLE_ITER.
+    #endif
+#endif /* SSF_CBOR_CONFIG_ENABLE_JSON */
+
+/* --------------------------------------------------------------------------------------------- */
+/* Defines                                                                                       */
+/* --------------------------------------------------------------------------------------------- */
+#define SSF_CBOR_MAJOR_UINT (0u)
+#define SSF_CBOR_MAJOR_NINT (1u)
+#define SSF_CBOR_MAJOR_BYTES (2u)
+#define SSF_CBOR_MAJOR_TEXT (3u)
+#define SSF_CBOR_MAJOR_ARRAY (4u)
+#define SSF_CBOR_MAJOR_MAP (5u)
+#define SSF_CBOR_MAJOR_TAG (6u)
+#define SSF_CBOR_MAJOR_SIMPLE (7u)
+
+#define SSF_CBOR_AI_1BYTE (24u)
+#define SSF_CBOR_AI_2BYTE (25u)
+#define SSF_CBOR_AI_4BYTE (26u)
+#define SSF_CBOR_AI_8BYTE (27u)
+#define SSF_CBOR_AI_INDEF (31u)
+#define SSF_CBOR_BREAK (0xffu)
+
+/* Remaining item count of an indefinite length array or map, ended by a break instead */
+#define SSF_CBOR_REM_INDEF (UINT64_MAX)
+
+/* Maximum head size, initial byte plus an 8 byte argument */
+#define SSF_CBOR_HEAD_MAX (9u)
+
+/* --------------------------------------------------------------------------------------------- */
+/* Structs                                                                                       */
+/* --------------------------------------------------------------------------------------------- */
+typedef struct SSFCborHead
+{
+    uint64_t arg;           /* Value, length, count, tag, simple value or float bits */
+    uint8_t major;
+    uint8_t ai;             /* Additional information, low 5 bits of the initial byte */
+} SSFCborHead_t;
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if a well-formed head is read at cbor[*i] and *i advanced past it, else false.   */
+/* --------------------------------------------------------------------------------------------- */
+static bool _SSFCborHead(const uint8_t *cbor, size_t len, size_t *i, SSFCborHead_t *head)
+{
+    size_t n;
+
+    if (*i >= len) return false;
+    head->major = cbor[*i] >> 5;
+    head->ai = cbor[*i] & 0x1fu;
+    (*i)++;
+
+    if (head->ai < SSF_CBOR_AI_1BYTE) { head->arg = head->ai; return true; }
+    if (head->ai == SSF_CBOR_AI_INDEF)
+    {
+        head->arg = 0;
+        return (head->major != SSF_CBOR_MAJOR_UINT) && (head->major != SSF_CBOR_MAJOR_NINT) &&
+               (head->major != SSF_CBOR_MAJOR_TAG);
+    }
+    if (head->ai > SSF_CBOR_AI_8BYTE) return false;
+
+    /* Argument follows in 1, 2, 4 or 8 bytes in network byte order */
+    n = ((size_t)1) << (head->ai - SSF_CBOR_AI_1BYTE);
+    if ((len - *i) < n) return false;
+    head->arg = 0;
+    while (n != 0)
+    {
+        head->arg = (head->arg << 8) | cbor[*i];
+        (*i)++;
+        n--;
+    }
+    return true;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if one complete data item at cbor[*i] is skipped over, else false.               */
+/* --------------------------------------------------------------------------------------------- */
+static bool _SSFCborSkip(const uint8_t *cbor, size_t len, size_t *i)
+{
+    uint64_t rem[SSF_CBOR_CONFIG_MAX_IN_DEPTH];
+    uint8_t flags[SSF_CBOR_CONFIG_MAX_IN_DEPTH];
+    uint8_t depth = 0;
+    bool isTagged = false;
+    SSFCborHead_t head;
+
+    while (true)
+    {
+        if (!_SSFCborHead(cbor, len, i, &head)) return false;
+        switch (head.major)
+        {
+        case SSF_CBOR_MAJOR_BYTES:
+        case SSF_CBOR_MAJOR_TEXT:
+            if (head.ai == SSF_CBOR_AI_INDEF) return false;
+            if (head.arg > (len - *i)) return false;
+            *i += (size_t)head.arg;
+            break;
+        case SSF_CBOR_MAJOR_ARRAY:
+        case SSF_CBOR_MAJOR_MAP:
+            isTagged = false;
+            /* Empty arrays and maps count toward the depth limit too */
+            if (depth >= SSF_CBOR_CONFIG_MAX_IN_DEPTH) return false;
+            if (head.ai != SSF_CBOR_AI_INDEF)
+            {
+                /* Every item takes at least one byte, so reject counts that cannot fit */
+                if (head.arg > (len - *i)) return false;
+                if (head.major == SSF_CBOR_MAJOR_MAP) head.arg <<= 1;
+                if (head.arg == 0) break;
+            }
+            else head.arg = SSF_CBOR_REM_INDEF;
+            rem[depth] = head.arg;
+            flags[depth] = (uint8_t)(((head.major == SSF_CBOR_MAJOR_MAP) ? 1u : 0) |
+                                     ((head.ai == SSF_CBOR_AI_INDEF) ? 2u : 0));
+            depth++;
+            continue;
+        case SSF_CBOR_MAJOR_TAG:
+            /* The tagged data item follows immediately */
+            isTagged = true;
+            continue;
+        case SSF_CBOR_MAJOR_SIMPLE:
+            if ((head.ai == SSF_CBOR_AI_1BYTE) && (head.arg < 32u)) return false;
+            if (head.ai == SSF_CBOR_AI_INDEF)
+            {
+                /* Break ends the innermost indefinite length array or map of whole items */
+                if (isTagged || (depth == 0) || ((flags[depth - 1] & 2u) == 0)) return false;
+                if (((flags[depth - 1] & 1u) != 0) &&
+                    (((SSF_CBOR_REM_INDEF - rem[depth - 1]) & 1u) != 0)) return false;
+                depth--;
+            }
+            break;
+        default:
+            break;
+        }
+        isTagged = false;
+
+        /* A complete data item counts toward its enclosing array or map, possibly completing it */
+        while (depth != 0)
+        {
+            rem[depth - 1]--;
+            if ((rem[depth - 1] != 0) || ((flags[depth - 1] & 2u) != 0)) break;
+            depth--;
+        }
+        if (depth == 0) return true;
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns the type of the data item with head.                                                  */
+/* --------------------------------------------------------------------------------------------- */
+static SSFCborType_t _SSFCborType(const SSFCborHead_t *head)
+{
+    switch (head->major)
+    {
+    case SSF_CBOR_MAJOR_UINT:
+    case SSF_CBOR_MAJOR_NINT: return SSF_CBOR_TYPE_INT;
+    case SSF_CBOR_MAJOR_BYTES: return SSF_CBOR_TYPE_BYTES;
+    case SSF_CBOR_MAJOR_TEXT: return SSF_CBOR_TYPE_STRING;
+    case SSF_CBOR_MAJOR_ARRAY: return SSF_CBOR_TYPE_ARRAY;
+    case SSF_CBOR_MAJOR_MAP: return SSF_CBOR_TYPE_MAP;
+    case SSF_CBOR_MAJOR_SIMPLE:
+        if (head->ai == SSF_CBOR_SIMPLE_FALSE) return SSF_CBOR_TYPE_FALSE;
+        if (head->ai == SSF_CBOR_SIMPLE_TRUE) return SSF_CBOR_TYPE_TRUE;
+        if (head->ai == SSF_CBOR_SIMPLE_NULL) return SSF_CBOR_TYPE_NULL;
+        if ((head->ai >= SSF_CBOR_AI_2BYTE) && (head->ai <= SSF_CBOR_AI_8BYTE))
+        { return SSF_CBOR_TYPE_FLOAT; }
+        return SSF_CBOR_TYPE_SIMPLE;
+    default:
+        break;
+    }
+    return SSF_CBOR_TYPE_ERROR;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if the head of a data item, after any tags, is read at cbor[*i], else false.     */
+/* --------------------------------------------------------------------------------------------- */
+static bool _SSFCborItemHead(const uint8_t *cbor, size_t len, size_t *i, size_t *start,
+                             SSFCborHead_t *head)
+{
+    do
+    {
+        *start = *i;
+        if (!_SSFCborHead(cbor, len, i, head)) return false;
+    } while (head->major == SSF_CBOR_MAJOR_TAG);
+    return true;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if cbor is exactly one well-formed data item, else false.                        */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFCborIsValid(const uint8_t *cbor, size_t cborLen)
+{
+    size_t i = 0;
+
+    SSF_REQUIRE(cbor != NULL);
+
+    return _SSFCborSkip(cbor, cborLen, &i) && (i == cborLen);
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if path found, start and end set to first and last byte of its item, else false. */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFCborObject(const uint8_t *cbor, size_t cborLen, SSFCStrIn_t *path, size_t *start,
+                   size_t *end, SSFCborType_t *ct)
+{
+    SSFCborHead_t head;
+    SSFCborHead_t key;
+    size_t i = 0;
+    size_t keyStart;
+    size_t keyLen;
+    size_t aidx;
+    uint64_t count;
+    uint8_t depth;
+
+    SSF_REQUIRE(cbor != NULL);
+    SSF_REQUIRE(path != NULL);
+    SSF_REQUIRE(path[SSF_CBOR_CONFIG_MAX_IN_DEPTH] == NULL);
+    SSF_REQUIRE(start != NULL);
+    SSF_REQUIRE(end != NULL);
+    SSF_REQUIRE(ct != NULL);
+
+    *ct = SSF_CBOR_TYPE_ERROR;
+    if (!SSFCborIsValid(cbor, cborLen)) return false;
+
+    /* Items are well-formed from here on, so skipping over them cannot fail */
+    for (depth = 0; path[depth] != NULL; depth++)
+    {
+        _SSFCborItemHead(cbor, cborLen, &i, start, &head);
+        count = (head.ai == SSF_CBOR_AI_INDEF) ? SSF_CBOR_REM_INDEF : head.arg;
+        if (head.major == SSF_CBOR_MAJOR_MAP)
+        {
+            keyLen = strlen(path[depth]);
+            while (true)
+            {
+                if ((count == 0) || (cbor[i] == SSF_CBOR_BREAK)) return false;
+                count--;
+                keyStart = i;
+                _SSFCborItemHead(cbor, cborLen, &keyStart, start, &key);
+                if ((key.major == SSF_CBOR_MAJOR_TEXT) && (key.arg == keyLen) &&
+                    (memcmp(&cbor[keyStart], path[depth], keyLen) == 0))
+                {
+                    i = keyStart + keyLen;
+                    break;
+                }
+                _SSFCborSkip(cbor, cborLen, &i);
+                _SSFCborSkip(cbor, cborLen, &i);
+            }
+        }
+        else if (head.major == SSF_CBOR_MAJOR_ARRAY)
+        {
+            memcpy(&aidx, path[depth], sizeof(aidx));
+            for (; ; aidx--)
+            {
+                if ((count == 0) || (cbor[i] == SSF_CBOR_BREAK)) return false;
+                if (aidx == 0) break;
+                count--;
+                _SSFCborSkip(cbor, cborLen, &i);
+            }
+        }
+        else return false;
+    }
+
+    _SSFCborItemHead(cbor, cborLen, &i, start, &head);
+    i = *start;
+    _SSFCborSkip(cbor, cborLen, &i);
+    *end = i - 1;
+    *ct = _SSFCborType(&head);
+    return true;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if path found and head of its item, after any tags, read, else false.            */
+/* --------------------------------------------------------------------------------------------- */
+static bool _SSFCborFind(const uint8_t *cbor, size_t cborLen, SSFCStrIn_t *path, size_t *i,
+                         SSFCborHead_t *head)
+{
+    size_t start;
+    size_t end;
+    SSFCborType_t ct;
+
+    if (!SSFCborObject(cbor, cborLen, path, &start, &end, &ct)) return false;
+    *i = start;
+    return _SSFCborHead(cbor, cborLen, i, head);
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns SSF_CBOR_TYPE_ERROR if CBOR is invalid or path not found, else valid type.            */
+/* --------------------------------------------------------------------------------------------- */
+SSFCborType_t SSFCborGetType(const uint8_t *cbor, size_t cborLen, SSFCStrIn_t *path)
+{
+    size_t start;
+    size_t end;
+    SSFCborType_t ct;
+
+    if (!SSFCborObject(cbor, cborLen, path, &start, &end, &ct)) ct = SSF_CBOR_TYPE_ERROR;
+    return ct;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if found and is text string copied completely into buffer w/NULL term.           */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFCborGetString(const uint8_t *cbor, size_t cborLen, SSFCStrIn_t *path, SSFCStrOut_t out,
+                      size_t outSize, size_t *outLen)
+{
+    SSFCborHead_t head;
+    size_t i;
+
+    SSF_REQUIRE(out != NULL);
+
+    if (!_SSFCborFind(cbor, cborLen, path, &i, &head)) return false;
+    if (head.major != SSF_CBOR_MAJOR_TEXT) return false;
+    if (head.arg >= outSize) return false;
+    memcpy(out, &cbor[i], (size_t)head.arg);
+    out[head.arg] = 0;
+    if (outLen != NULL) *outLen = (size_t)head.arg;
+    return true;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if found and is byte string copied completely into buffer, else false.           */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFCborGetBytes(const uint8_t *cbor, size_t cborLen, SSFCStrIn_t *path, uint8_t *out,
+                     size_t outSize, size_t *outLen)
+{
+    SSFCborHead_t head;
+    size_t i;
+
+    SSF_REQUIRE(out != NULL);
+    SSF_REQUIRE(outLen != NULL);
+
+    if (!_SSFCborFind(cbor, cborLen, path, &i, &head)) return false;
+    if (head.major != SSF_CBOR_MAJOR_BYTES) return false;
+    if (head.arg > outSize) return false;
+    memcpy(out, &cbor[i], (size_t)head.arg);
+    *outLen = (size_t)head.arg;
+    return true;
+}
+
+#if SSF_CBOR_CONFIG_ENABLE_FLOAT == 1
+/* --------------------------------------------------------------------------------------------- */
+/* Returns the double value of the half precision float with bits half.                          */
+/* --------------------------------------------------------------------------------------------- */
+static double _SSFCborHalfToDouble(uint16_t half)
+{
+    int exp = (half >> 10) & 0x1f;
+    unsigned int mant = half & 0x3ffu;
+    double val;
+
+    if (exp == 0) val = ldexp((double)mant, -24);
+    else if (exp != 31) val = ldexp((double)(mant + 1024u), exp - 25);
+    else val = (mant == 0) ? HUGE_VAL : nan("");
+    return ((half & 0x8000u) != 0) ? -val : val;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if head is a number converted to double, else false.                             */
+/* --------------------------------------------------------------------------------------------- */
+static bool _SSFCborHeadDouble(const SSFCborHead_t *head, double *out)
+{
+    uint32_t u32;
+    float f;
+
+    if (head->major == SSF_CBOR_MAJOR_UINT) *out = (double)head->arg;
+    else if (head->major == SSF_CBOR_MAJOR_NINT) *out = -1.0 - (double)head->arg;
+    else if (head->major != SSF_CBOR_MAJOR_SIMPLE) return false;
+    else if (head->ai == SSF_CBOR_AI_2BYTE) *out = _SSFCborHalfToDouble((uint16_t)head->arg);
+    else if (head->ai == SSF_CBOR_AI_4BYTE)
+    {
+        u32 = (uint32_t)head->arg;
+        memcpy(&f, &u32, sizeof(f));
+        *out = f;
+    }
+    else if (head->ai == SSF_CBOR_AI_8BYTE) memcpy(out, &head->arg, sizeof(*out));
+    else return false;
+    return true;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if found and is an integer or float converted to double, else false.             */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFCborGetDouble(const uint8_t *cbor, size_t cborLen, SSFCStrIn_t *path, double *out)
+{
+    SSFCborHead_t head;
+    size_t i;
+
+    SSF_REQUIRE(out != NULL);
+
+    if (!_SSFCborFind(cbor, cborLen, path, &i, &head)) return false;
+    return _SSFCborHeadDouble(&head, out);
+}
+#endif /* SSF_CBOR_CONFIG_ENABLE_FLOAT */
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if found and is an integer in range of signed long, else false.                  */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFCborGetLong(const uint8_t *cbor, size_t cborLen, SSFCStrIn_t *path, long int *out)
+{
+    SSFCborHead_t head;
+    size_t i;
+
+    SSF_REQUIRE(out != NULL);
+
+    if (!_SSFCborFind(cbor, cborLen, path, &i, &head)) return false;
+    if ((head.major != SSF_CBOR_MAJOR_UINT) && (head.major != SSF_CBOR_MAJOR_NINT)) return false;
+    if (head.arg > (uint64_t)LONG_MAX) return false;
+    /* Negative integers are encoded as -1 - arg, which is in range whenever arg is */
+    *out = (head.major == SSF_CBOR_MAJOR_UINT) ? (long int)head.arg : (-1 - (long int)head.arg);
+    return true;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if found and is an integer in range of unsigned long, else false.                */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFCborGetULong(const uint8_t *cbor, size_t cborLen, SSFCStrIn_t *path,
+                     unsigned long int *out)
+{
+    SSFCborHead_t head;
+    size_t i;
+
+    SSF_REQUIRE(out != NULL);
+
+    if (!_SSFCborFind(cbor, cborLen, path, &i, &head)) return false;
+    if (head.major != SSF_CBOR_MAJOR_UINT) return false;
+    if (head.arg > (uint64_t)ULONG_MAX) return false;
+    *out = (unsigned long int)head.arg;
+    return true;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns the number of bytes of the shortest head that encodes arg.                            */
+/* --------------------------------------------------------------------------------------------- */
+static size_t _SSFCborHeadLen(uint64_t arg)
+{
+    if (arg < SSF_CBOR_AI_1BYTE) return 1;
+    if (arg <= 0xffu) return 2;
+    if (arg <= 0xffffu) return 3;
+    if (arg <= 0xffffffffu) return 5;
+    return SSF_CBOR_HEAD_MAX;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if initial byte ib and argLen bytes of arg are added to cbor, else false.        */
+/* --------------------------------------------------------------------------------------------- */
+static bool _SSFCborPut(uint8_t *cbor, size_t size, size_t start, size_t *end, uint8_t ib,
+                        uint64_t arg, size_t argLen)
+{
+    SSF_REQUIRE(cbor != NULL);
+    SSF_REQUIRE(start <= size);
+    SSF_REQUIRE(end != NULL);
+
+    if ((size - start) <= argLen) return false;
+    cbor[start] = ib;
+    *end = start + 1 + argLen;
+    while (argLen != 0)
+    {
+        cbor[start + argLen] = (uint8_t)arg;
+        arg >>= 8;
+        argLen--;
+    }
+    return true;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if the shortest head of major type and arg is added to cbor, else false.         */
+/* --------------------------------------------------------------------------------------------- */
+static bool _SSFCborPrintHead(uint8_t *cbor, size_t size, size_t start, size_t *end,
+                              uint8_t major, uint64_t arg)
+{
+    size_t n = _SSFCborHeadLen(arg);
+    uint8_t ai;
+
+    if (n == 1) ai = (uint8_t)arg;
+    else if (n == 2) ai = SSF_CBOR_AI_1BYTE;
+    else if (n == 3) ai = SSF_CBOR_AI_2BYTE;
+    else if (n == 5) ai = SSF_CBOR_AI_4BYTE;
+    else ai = SSF_CBOR_AI_8BYTE;
+    return _SSFCborPut(cbor, size, start, end, (uint8_t)((major << 5) | ai), arg, n - 1);
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if head at cbor[hdr] is set to count items in cbor[hdr + 1, bodyEnd), else false. */
+/* --------------------------------------------------------------------------------------------- */
+static bool _SSFCborFinish(uint8_t *cbor, size_t size, size_t hdr, size_t bodyEnd, size_t *end,
+                           uint8_t major, uint64_t count)
+{
+    size_t n = _SSFCborHeadLen(count);
+
+    /* One byte was reserved for the head, move the items up if the count needs a longer one */
+    if (n > 1)
+    {
+        if ((size - bodyEnd) < (n - 1)) return false;
+        memmove(&cbor[hdr + n], &cbor[hdr + 1], bodyEnd - hdr - 1);
+    }
+    _SSFCborPrintHead(cbor, size, hdr, &hdr, major, count);
+    *end = bodyEnd + n - 1;
+    return true;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if signed integer added to cbor, else false.                                     */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFCborPrintInt(uint8_t *cbor, size_t size, size_t start, size_t *end, long in)
+{
+    if (in >= 0) return _SSFCborPrintHead(cbor, size, start, end, SSF_CBOR_MAJOR_UINT,
+                                          (uint64_t)in);
+    return _SSFCborPrintHead(cbor, size, start, end, SSF_CBOR_MAJOR_NINT,
+                             (uint64_t)(-(in + 1)));
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if unsigned integer added to cbor, else false.                                   */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFCborPrintUInt(uint8_t *cbor, size_t size, size_t start, size_t *end, unsigned long in)
+{
+    return _SSFCborPrintHead(cbor, size, start, end, SSF_CBOR_MAJOR_UINT, (uint64_t)in);
+}
+
+#if SSF_CBOR_CONFIG_ENABLE_FLOAT == 1
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if double added to cbor as the shortest float that holds it exactly, else false. */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFCborPrintDouble(uint8_t *cbor, size_t size, size_t start, size_t *end, double in)
+{
+    uint64_t u64;
+    uint32_t u32;
+    uint32_t exp;
+    uint32_t mant;
+    uint32_t sign;
+    float f;
+    uint8_t ib = (SSF_CBOR_MAJOR_SIMPLE << 5);
+
+    if (in != in) return _SSFCborPut(cbor, size, start, end, ib | SSF_CBOR_AI_2BYTE, 0x7e00u, 2);
+    if ((in < -FLT_MAX) || (in > FLT_MAX))
+    {
+        if ((in == HUGE_VAL) || (in == -HUGE_VAL))
+        {
+            return _SSFCborPut(cbor, size, start, end, ib | SSF_CBOR_AI_2BYTE,
+                               (in < 0) ? 0xfc00u : 0x7c00u, 2);
+        }
+        memcpy(&u64, &in, sizeof(u64));
+        return _SSFCborPut(cbor, size, start, end, ib | SSF_CBOR_AI_8BYTE, u64, 8);
+    }
+
+    f = (float)in;
+    if ((double)f != in)
+    {
+        memcpy(&u64, &in, sizeof(u64));
+        return _SSFCborPut(cbor, size, start, end, ib | SSF_CBOR_AI_8BYTE, u64, 8);
+    }
+
+    /* Use a half if it holds the float exactly */
+    memcpy(&u32, &f, sizeof(u32));
+    sign = (u32 >> 16) & 0x8000u;
+    exp = (u32 >> 23) & 0xffu;
+    mant = u32 & 0x7fffffu;
+    if ((exp == 0) && (mant == 0))
+    { return _SSFCborPut(cbor, size, start, end, ib | SSF_CBOR_AI_2BYTE, sign, 2); }
+    if ((exp >= 113u) && (exp <= 142u) && ((mant & 0x1fffu) == 0))
+    {
+        return _SSFCborPut(cbor, size, start, end, ib | SSF_CBOR_AI_2BYTE,
+                           sign | ((exp - 112u) << 10) | (mant >> 13), 2);
+    }
+    /* Floats from 2^-24 up to 2^-14 may be subnormal halves, mantissa with implicit 1 shifted */
+    mant |= 0x800000u;
+    if ((exp >= 103u) && (exp <= 112u) && ((mant & ((1ul << (126u - exp)) - 1u)) == 0))
+    {
+        return _SSFCborPut(cbor, size, start, end, ib | SSF_CBOR_AI_2BYTE,
+                           sign | (mant >> (126u - exp)), 2);
+    }
+    return _SSFCborPut(cbor, size, start, end, ib | SSF_CBOR_AI_4BYTE, u32, 4);
+}
+#endif /* SSF_CBOR_CONFIG_ENABLE_FLOAT */
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if major type string of inLen bytes added to cbor, else false.                   */
+/* --------------------------------------------------------------------------------------------- */
+static bool _SSFCborPrintStr(uint8_t *cbor, size_t size, size_t start, size_t *end,
+                             uint8_t major, const void *in, size_t inLen)
+{
+    SSF_REQUIRE(in != NULL);
+
+    if (!_SSFCborPrintHead(cbor, size, start, &start, major, inLen)) return false;
+    if ((size - start) < inLen) return false;
+    memcpy(&cbor[start], in, inLen);
+    *end = start + inLen;
+    return true;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if NULL terminated string added to cbor as a text string, else false.            */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFCborPrintString(uint8_t *cbor, size_t size, size_t start, size_t *end, SSFCStrIn_t in)
+{
+    SSF_REQUIRE(in != NULL);
+
+    return _SSFCborPrintStr(cbor, size, start, end, SSF_CBOR_MAJOR_TEXT, in, strlen(in));
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if binary data added to cbor as a byte string, else false.                       */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFCborPrintBytes(uint8_t *cbor, size_t size, size_t start, size_t *end, const uint8_t *in,
+                       size_t inLen)
+{
+    return _SSFCborPrintStr(cbor, size, start, end, SSF_CBOR_MAJOR_BYTES, in, inLen);
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if simple value, such as true, false or null, added to cbor, else false.         */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFCborPrintSimple(uint8_t *cbor, size_t size, size_t start, size_t *end, uint8_t in)
+{
+    SSF_REQUIRE((in < SSF_CBOR_AI_1BYTE) || (in >= 32u));
+
+    return _SSFCborPrintHead(cbor, size, start, end, SSF_CBOR_MAJOR_SIMPLE, in);
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if map or array of the items added by fn is added to cbor, else false.           */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFCborPrint(uint8_t *cbor, size_t size, size_t start, size_t *end, SSFCborPrintFn_t fn,
+                  void *in, bool isMap)
+{
+    size_t bodyEnd;
+    size_t i;
+    uint64_t count = 0;
+
+    SSF_REQUIRE(cbor != NULL);
+    SSF_REQUIRE(start <= size);
+    SSF_REQUIRE(end != NULL);
+
+    /* Reserve a byte for the head, then count the items fn added to size it */
+    if (start >= size) return false;
+    bodyEnd = start + 1;
+    if ((fn != NULL) && (!fn(cbor, size, bodyEnd, &bodyEnd, in))) return false;
+    for (i = start + 1; i < bodyEnd; count++)
+    {
+        if (!_SSFCborSkip(cbor, bodyEnd, &i)) return false;
+    }
+    if (isMap)
+    {
+        if ((count & 1u) != 0) return false;
+        count >>= 1;
+    }
+    return _SSFCborFinish(cbor, size, start, bodyEnd, end,
+                          isMap ? SSF_CBOR_MAJOR_MAP : SSF_CBOR_MAJOR_ARRAY, count);
+}
+
+#if SSF_CBOR_CONFIG_ENABLE_JSON == 1
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if raw chars of a JSON string are added to cbor as a text string, else false.    */
+/* --------------------------------------------------------------------------------------------- */
+static bool _SSFCborPrintJsonStr(uint8_t *cbor, size_t size, size_t start, size_t *end,
+                                 const SSFJsonStr_t *str)
+{
+    size_t n;
+    size_t len;
+    size_t body;
+
+    if (!str->hasEsc)
+    {
+        return _SSFCborPrintStr(cbor, size, start, end, SSF_CBOR_MAJOR_TEXT, str->ptr, str->len);
+    }
+
+    /* Unescaped chars are never more than the raw chars, so unescape past the longest head */
+    n = _SSFCborHeadLen(str->len);
+    if ((size - start) <= n) return false;
+    if (!SSFJsonStrUnescape(str, (SSFCStrOut_t)&cbor[start + n], size - start - n, &len))
+    { return false; }
+    if (!_SSFCborPrintHead(cbor, size, start, &body, SSF_CBOR_MAJOR_TEXT, len)) return false;
+    memmove(&cbor[body], &cbor[start + n], len);
+    *end = body + len;
+    return true;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if JSON number at it is added to cbor as an integer or float, else false.        */
+/* --------------------------------------------------------------------------------------------- */
+static bool _SSFCborPrintJsonNum(uint8_t *cbor, size_t size, size_t start, size_t *end,
+                                 const SSFJsonIter_t *it)
+{
+    size_t i;
+    long si;
+    unsigned long ui;
+#if (SSF_JSON_CONFIG_ENABLE_FLOAT_PARSE == 1) && (SSF_CBOR_CONFIG_ENABLE_FLOAT == 1)
+    double d;
+#endif /* SSF_JSON_CONFIG_ENABLE_FLOAT_PARSE && SSF_CBOR_CONFIG_ENABLE_FLOAT */
+
+    /* Numbers without a fraction or exponent are integers, unless out of range of long */
+    for (i = it->start; i <= it->end; i++)
+    {
+        if ((it->js[i] == '.') || (it->js[i] == 'e') || (it->js[i] == 'E')) break;
+    }
+    if (i > it->end)
+    {
+        if (SSFJsonIterGetLong(it, &si)) return SSFCborPrintInt(cbor, size, start, end, si);
+        if (SSFJsonIterGetULong(it, &ui)) return SSFCborPrintUInt(cbor, size, start, end, ui);
+    }
+#if (SSF_JSON_CONFIG_ENABLE_FLOAT_PARSE == 1) && (SSF_CBOR_CONFIG_ENABLE_FLOAT == 1)
+    if (SSFJsonIterGetDouble(it, &d)) return SSFCborPrintDouble(cbor, size, start, end, d);
+#endif /* SSF_JSON_CONFIG_ENABLE_FLOAT_PARSE && SSF_CBOR_CONFIG_ENABLE_FLOAT */
+    return false;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if JSON string is transcoded completely into cbor, else false.                   */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFCborFromJson(SSFCStrIn_t js, uint8_t *cbor, size_t cborSize, size_t *cborLen)
+{
+    SSFJsonIter_t its[SSF_JSON_CONFIG_MAX_IN_DEPTH + 1];
+    size_t hdrs[SSF_JSON_CONFIG_MAX_IN_DEPTH + 1];
+    uint64_t counts[SSF_JSON_CONFIG_MAX_IN_DEPTH + 1];
+    uint8_t majors[SSF_JSON_CONFIG_MAX_IN_DEPTH + 1];
+    SSFCStrIn_t path[SSF_JSON_CONFIG_MAX_IN_DEPTH + 1];
+    SSFJsonIter_t *it;
+    SSFJsonStr_t str;
+    size_t depth = 0;
+    size_t start;
+
+    SSF_REQUIRE(js != NULL);
+    SSF_REQUIRE(cbor != NULL);
+    SSF_REQUIRE(cborLen != NULL);
+
+    /* The JSON string is validated once by SSFJsonIterBegin(), so SSFJsonIterNext() only */
+    /* returns false at the end of an object or array */
+    memset(path, 0, sizeof(path));
+    if (!SSFJsonIterBegin(&its[0], js, path)) return false;
+    if (cborSize == 0) return false;
+    hdrs[0] = 0;
+    counts[0] = 0;
+    majors[0] = SSF_CBOR_MAJOR_MAP;
+    start = 1;
+
+    while (true)
+    {
+        it = &its[depth];
+        if (!SSFJsonIterNext(it))
+        {
+            if (!_SSFCborFinish(cbor, cborSize, hdrs[depth], start, &start, majors[depth],
+                                counts[depth])) return false;
+            if (depth == 0) break;
+            depth--;
+            continue;
+        }
+        counts[depth]++;
+
+        if (it->key != NULL)
+        {
+            str.ptr = it->key;
+            str.len = it->keyLen;
+            str.hasEsc = memchr(it->key, '\\', it->keyLen) != NULL;
+            if (!_SSFCborPrintJsonStr(cbor, cborSize, start, &start, &str)) return false;
+        }
+
+        switch (it->jt)
+        {
+        case SSF_JSON_TYPE_OBJECT:
+        case SSF_JSON_TYPE_ARRAY:
+            if ((depth >= SSF_JSON_CONFIG_MAX_IN_DEPTH) || (start >= cborSize)) return false;
+            SSFJsonIterChild(it, &its[depth + 1]);
+            depth++;
+            hdrs[depth] = start;
+            counts[depth] = 0;
+            majors[depth] = (it->jt == SSF_JSON_TYPE_OBJECT) ? SSF_CBOR_MAJOR_MAP :
+                            SSF_CBOR_MAJOR_ARRAY;
+            start++;
+            break;
+        case SSF_JSON_TYPE_STRING:
+            SSFJsonIterGetStringSpan(it, &str);
+            if (!_SSFCborPrintJsonStr(cbor, cborSize, start, &start, &str)) return false;
+            break;
+        case SSF_JSON_TYPE_NUMBER:
+            if (!_SSFCborPrintJsonNum(cbor, cborSize, start, &start, it)) return false;
+            break;
+        case SSF_JSON_TYPE_TRUE:
+            if (!SSFCborPrintTrue(cbor, cborSize, start, &start)) return false;
+            break;
+        case SSF_JSON_TYPE_FALSE:
+            if (!SSFCborPrintFalse(cbor, cborSize, start, &start)) return false;
+            break;
+        case SSF_JSON_TYPE_NULL:
+            if (!SSFCborPrintNull(cbor, cborSize, start, &start)) return false;
+            break;
+        default:
+            return false;
+        }
+    }
+    *cborLen = start;
+    return true;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if c and a NULL terminator are added to js, else false.                          */
+/* --------------------------------------------------------------------------------------------- */
+static bool _SSFCborJsonChar(SSFCStrOut_t js, size_t size, size_t start, size_t *end, char c)
+{
+    if ((size - start) < 2) return false;
+    js[start] = c;
+    js[start + 1] = 0;
+    *end = start + 1;
+    return true;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if text string of len bytes is added to js as a quoted JSON string, else false.  */
+/* --------------------------------------------------------------------------------------------- */
+static bool _SSFCborJsonText(SSFCStrOut_t js, size_t size, size_t start, size_t *end,
+                             const uint8_t *in, size_t len)
+{
+    char c[2] = { 0, 0 };
+
+    if (!_SSFCborJsonChar(js, size, start, &start, '"')) return false;
+    while (len != 0)
+    {
+        c[0] = (char)*in;
+        if (*in == 0)
+        {
+            if ((size - start) < 7) return false;
+            memcpy(&js[start], "\\u0000", 7);
+            start += 6;
+        }
+        else if ((*in < 0x20u) || (c[0] == '"') || (c[0] == '\\'))
+        {
+            if (!SSFJsonPrintCString(js, size, start, &start, c, NULL)) return false;
+        }
+        /* Other chars, including UTF-8 sequences, are valid in a JSON string as is */
+        else if (!_SSFCborJsonChar(js, size, start, &start, c[0])) return false;
+        in++;
+        len--;
+    }
+    return _SSFCborJsonChar(js, size, start, end, '"');
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if CBOR data item is transcoded completely into js w/NULL term., else false.     */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFCborToJson(const uint8_t *cbor, size_t cborLen, SSFCStrOut_t js, size_t jsSize,
+                   size_t *jsLen)
+{
+    uint64_t rem[SSF_CBOR_CONFIG_MAX_IN_DEPTH];
+    uint64_t n[SSF_CBOR_CONFIG_MAX_IN_DEPTH];
+    bool isMap[SSF_CBOR_CONFIG_MAX_IN_DEPTH];
+    SSFCborHead_t head;
+    size_t depth = 0;
+    size_t i = 0;
+    size_t item;
+    size_t start = 0;
+    bool isKey;
+#if (SSF_CBOR_CONFIG_ENABLE_FLOAT == 1) && (SSF_JSON_CONFIG_ENABLE_FLOAT_GEN == 1)
+    double d;
+#endif /* SSF_CBOR_CONFIG_ENABLE_FLOAT && SSF_JSON_CONFIG_ENABLE_FLOAT_GEN */
+
+    SSF_REQUIRE(cbor != NULL);
+    SSF_REQUIRE(js != NULL);
+    SSF_REQUIRE(jsLen != NULL);
+
+    /* Items are well-formed from here on, so only the JSON output can fail */
+    if (!SSFCborIsValid(cbor, cborLen)) return false;
+    if (jsSize == 0) return false;
+    js[0] = 0;
+
+    do
+    {
+        isKey = false;
+        if (depth != 0)
+        {
+            /* Close the innermost array or map once all of its items are printed */
+            if ((rem[depth - 1] == 0) ||
+                ((rem[depth - 1] == SSF_CBOR_REM_INDEF) && (cbor[i] == SSF_CBOR_BREAK)))
+            {
+                if (rem[depth - 1] == SSF_CBOR_REM_INDEF) i++;
+                depth--;
+                if (!_SSFCborJsonChar(js, jsSize, start, &start, isMap[depth] ? '}' : ']'))
+                { return false; }
+                continue;
+            }
+            if (rem[depth - 1] != SSF_CBOR_REM_INDEF) rem[depth - 1]--;
+
+            /* Map items alternate between keys and values */
+            isKey = isMap[depth - 1] && ((n[depth - 1] & 1u) == 0);
+            if ((n[depth - 1] != 0) &&
+                (!_SSFCborJsonChar(js, jsSize, start, &start, (isMap[depth - 1] && !isKey) ?
+                                   ':' : ','))) return false;
+            n[depth - 1]++;
+        }
+
+        _SSFCborItemHead(cbor, cborLen, &i, &item, &head);
+        if (isKey && (head.major != SSF_CBOR_MAJOR_TEXT)) return false;
+        switch (head.major)
+        {
+        case SSF_CBOR_MAJOR_UINT:
+            if (head.arg > (uint64_t)ULONG_MAX) return false;
+            if (!SSFJsonPrintUInt(js, jsSize, start, &start, (unsigned long)head.arg, NULL))
+            { return false; }
+            break;
+        case SSF_CBOR_MAJOR_NINT:
+            if (head.arg > (uint64_t)LONG_MAX) return false;
+            if (!SSFJsonPrintInt(js, jsSize, start, &start, -1 - (long)head.arg, NULL))
+            { return false; }
+            break;
+        case SSF_CBOR_MAJOR_BYTES:
+            if (!SSFJsonPrintBase64(js, jsSize, start, &start, &cbor[i], (size_t)head.arg, NULL))
+            { return false; }
+            i += (size_t)head.arg;
+            break;
+        case SSF_CBOR_MAJOR_TEXT:
+            if (!_SSFCborJsonText(js, jsSize, start, &start, &cbor[i], (size_t)head.arg))
+            { return false; }
+            i += (size_t)head.arg;
+            break;
+        case SSF_CBOR_MAJOR_ARRAY:
+        case SSF_CBOR_MAJOR_MAP:
+            if (depth >= SSF_CBOR_CONFIG_MAX_IN_DEPTH) return false;
+            isMap[depth] = head.major == SSF_CBOR_MAJOR_MAP;
+            if (head.ai == SSF_CBOR_AI_INDEF) rem[depth] = SSF_CBOR_REM_INDEF;
+            else rem[depth] = isMap[depth] ? (head.arg << 1) : head.arg;
+            n[depth] = 0;
+            if (!_SSFCborJsonChar(js, jsSize, start, &start, isMap[depth] ? '{' : '['))
+            { return false; }
+            depth++;
+            break;
+        default:
+            if (head.ai == SSF_CBOR_SIMPLE_FALSE)
+            { if (!SSFJsonPrintFalse(js, jsSize, start, &start, NULL)) return false; }
+            else if (head.ai == SSF_CBOR_SIMPLE_TRUE)
+            { if (!SSFJsonPrintTrue(js, jsSize, start, &start, NULL)) return false; }
+            else if (head.ai == SSF_CBOR_SIMPLE_NULL)
+            { if (!SSFJsonPrintNull(js, jsSize, start, &start, NULL)) return false; }
+#if (SSF_CBOR_CONFIG_ENABLE_FLOAT == 1) && (SSF_JSON_CONFIG_ENABLE_FLOAT_GEN == 1)
+            else if (_SSFCborHeadDouble(&head, &d))
+            {
+                /* JSON has no representation for NaN or infinity */
+                if ((d != d) || (d == HUGE_VAL) || (d == -HUGE_VAL)) return false;
+                if (!SSFJsonPrintDouble(js, jsSize, start, &start, d, SSF_JSON_FLT_FMT_SHORTEST,
+                                        NULL)) return false;
+            }
+#endif /* SSF_CBOR_CONFIG_ENABLE_FLOAT && SSF_JSON_CONFIG_ENABLE_FLOAT_GEN */
+            else return false;
+            break;
+        }
+    } while (depth != 0);
+    *jsLen = start;
+    return true;
+}
+#endif /* SSF_CBOR_CONFIG_ENABLE_JSON */
@@ -0,0 +1,139 @@
+/* --------------------------------------------------------------------------------------------- */
+/* Small System Framework                                                                        */
+/*                                                                                               */
+/* ssfcbor.h                                                                                     */
+/* Provides CBOR (RFC 8949) encoder/decoder interface.                                           */
+/*                                                                                               */
+/* BSD-3-Clause License                                                                          */
+/* Copyright 2021 Supurloop Software LLC                                                         */
+/*                                                                                               */
+/* Redistribution and use in source and binary forms, with or without modification, are          */
+/* permitted provided that the following conditions are met:                                     */
+/*                                                                                               */
+/* 1. Redistributions of source code must retain the above copyright notice, this list of        */
+/* conditions and the following disclaimer.                                                      */
+/* 2. Redistributions in binary form must reproduce the above copyright notice, this list of     */
+/* conditions and the following disclaimer in the documentation and/or other materials provided  */
+/* with the distribution.                                                                        */
+/* 3. Neither the name of the copyright holder nor the names of its contributors may be used to  */
+/* endorse or promote products derived from this software without specific prior written         */
+/* permission.                                                                                   */
+/*                                                                                               */
+/* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS   */
+/* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF               */
+/* MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE    */
+/* COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL      */
+/* EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE */
+/* GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED    */
+/* AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING     */
+/* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED  */
+/* OF THE POSSIBILITY OF SUCH DAMAGE.                                                            */
+/* --------------------------------------------------------------------------------------------- */
+#ifndef SSF_CBOR_H_INCLUDE
+#define SSF_CBOR_H_INCLUDE
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "ssfport.h"
+
+/* --------------------------------------------------------------------------------------------- */
+/* Limitations                                                                                   */
+/* Parser does not accept indefinite length byte or text strings.                                */
+/* Parser only matches paths against text string map keys, other keys are skipped.               */
+/* Parser and transcoder skip over tags, the tagged data item is used as is.                     */
+/* --------------------------------------------------------------------------------------------- */
+
+/* --------------------------------------------------------------------------------------------- */
+/* Defines                                                                                       */
+/* --------------------------------------------------------------------------------------------- */
+#define SSF_CBOR_SIMPLE_FALSE (20u)
+#define SSF_CBOR_SIMPLE_TRUE (21u)
+#define SSF_CBOR_SIMPLE_NULL (22u)
+
+typedef enum SSFCborType
+{
+    SSF_CBOR_TYPE_ERROR,
+    SSF_CBOR_TYPE_INT,      /* Unsigned or negative integer */
+    SSF_CBOR_TYPE_BYTES,
+    SSF_CBOR_TYPE_STRING,
+    SSF_CBOR_TYPE_ARRAY,
+    SSF_CBOR_TYPE_MAP,
+    SSF_CBOR_TYPE_TRUE,
+    SSF_CBOR_TYPE_FALSE,
+    SSF_CBOR_TYPE_NULL,
+    SSF_CBOR_TYPE_FLOAT,    /* Half, single or double precision float */
+    SSF_CBOR_TYPE_SIMPLE,   /* Any other simple value, such as undefined */
+    SSF_CBOR_TYPE_MAX,
+} SSFCborType_t;
+
+typedef bool (*SSFCborPrintFn_t)(uint8_t *cbor, size_t size, size_t start, size_t *end,
+                                 void *in);
+
+/* --------------------------------------------------------------------------------------------- */
+/* External interface                                                                            */
+/* --------------------------------------------------------------------------------------------- */
+/* Parser */
+bool SSFCborIsValid(const uint8_t *cbor, size_t cborLen);
+SSFCborType_t SSFCborGetType(const uint8_t *cbor, size_t cborLen, SSFCStrIn_t *path);
+bool SSFCborGetString(const uint8_t *cbor, size_t cborLen, SSFCStrIn_t *path, SSFCStrOut_t out,
+                      size_t outSize, size_t *outLen);
+bool SSFCborGetBytes(const uint8_t *cbor, size_t cborLen, SSFCStrIn_t *path, uint8_t *out,
+                     size_t outSize, size_t *outLen);
+#if SSF_CBOR_CONFIG_ENABLE_FLOAT == 1
+bool SSFCborGetDouble(const uint8_t *cbor, size_t cborLen, SSFCStrIn_t *path, double *out);
+#endif /* SSF_CBOR_CONFIG_ENABLE_FLOAT */
+bool SSFCborGetLong(const uint8_t *cbor, size_t cborLen, SSFCStrIn_t *path, long int *out);
+bool SSFCborGetULong(const uint8_t *cbor, size_t cborLen, SSFCStrIn_t *path,
+                     unsigned long int *out);
+bool SSFCborObject(const uint8_t *cbor, size_t cborLen, SSFCStrIn_t *path, size_t *start,
+                   size_t *end, SSFCborType_t *ct);
+
+/* Generator */
+bool SSFCborPrintInt(uint8_t *cbor, size_t size, size_t start, size_t *end, long in);
+bool SSFCborPrintUInt(uint8_t *cbor, size_t size, size_t start, size_t *end, unsigned long in);
+#if SSF_CBOR_CONFIG_ENABLE_FLOAT == 1
+bool SSFCborPrintDouble(uint8_t *cbor, size_t size, size_t start, size_t *end, double in);
+#endif /* SSF_CBOR_CONFIG_ENABLE_FLOAT */
+bool SSFCborPrintString(uint8_t *cbor, size_t size, size_t start, size_t *end, SSFCStrIn_t in);
+#define SSFCborPrintLabel(cbor, size, start, end, in) \
+        SSFCborPrintString(cbor, size, start, end, in)
+bool SSFCborPrintBytes(uint8_t *cbor, size_t size, size_t start, size_t *end, const uint8_t *in,
+                       size_t inLen);
+bool SSFCborPrintSimple(uint8_t *cbor, size_t size, size_t start, size_t *end, uint8_t in);
+#define SSFCborPrintTrue(cbor, size, start, end) \
+        SSFCborPrintSimple(cbor, size, start, end, SSF_CBOR_SIMPLE_TRUE)
+#define SSFCborPrintFalse(cbor, size, start, end) \
+        SSFCborPrintSimple(cbor, size, start, end, SSF_CBOR_SIMPLE_FALSE)
+#define SSFCborPrintNull(cbor, size, start, end) \
+        SSFCborPrintSimple(cbor, size, start, end, SSF_CBOR_SIMPLE_NULL)
+#define SSFCborPrintMap(cbor, size, start, end, fn, in) \
+        SSFCborPrint(cbor, size, start, end, fn, in, true)
+#define SSFCborPrintArray(cbor, size, start, end, fn, in) \
+        SSFCborPrint(cbor, size, start, end, fn, in, false)
+bool SSFCborPrint(uint8_t *cbor, size_t size, size_t start, size_t *end, SSFCborPrintFn_t fn,
+                  void *in, bool isMap);
+
+#if SSF_CBOR_CONFIG_ENABLE_JSON == 1
+/* Transcoder */
+bool SSFCborFromJson(SSFCStrIn_t js, uint8_t *cbor, size_t cborSize, size_t *cborLen);
+bool SSFCborToJson(const uint8_t *cbor, size_t cborLen, SSFCStrOut_t js, size_t jsSize,
+                   size_t *jsLen);
+#endif /* SSF_CBOR_CONFIG_ENABLE_JSON */
+
+/* --------------------------------------------------------------------------------------------- */
+/* Unit test                                                                                     */
+/* --------------------------------------------------------------------------------------------- */
+#if SSF_CONFIG_CBOR_UNIT_TEST == 1
+void SSFCborUnitTest(void);
+#endif /* SSF_CONFIG_CBOR_UNIT_TEST */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SSF_CBOR_H_INCLUDE */
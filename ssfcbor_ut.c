@@ -0,0 +1,549 @@
+/* --------------------------------------------------------------------------------------------- */
+/* Small System Framework                                                                        */
+/*                                                                                               */
+/* ssfcbor_ut.c                                                                                  */
+/* Unit test for CBOR parser/generator interface.                                                */
+/*                                                                                               */
+/* BSD-3-Clause License                                                                          */
+/* Copyright 2021 Supurloop Software LLC                                                         */
+/*                                                                                               */
+/* Redistribution and use in source and binary forms, with or without modification, are          */
+/* permitted provided that the following conditions are met:                                     */
+/*                                                                                               */
+/* 1. Redistributions of source code must retain the above copyright notice, this list of        */
+/* conditions and the following disclaimer.                                                      */
+/* 2. Redistributions in binary form must reproduce the above copyright notice, this list of     */
+/* conditions and the following disclaimer in the documentation and/or other materials provided  */
+/* with the distribution.                                                                        */
+/* 3. Neither the name of the copyright holder nor the names of its contributors may be used to  */
+/* endorse or promote products derived from this software without specific prior written         */
+/* permission.                                                                                   */
+/*                                                                                               */
+/* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS   */
+/* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF               */
+/* MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE    */
+/* COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL      */
+/* EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE */
+/* GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED    */
+/* AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING     */
+/* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED  */
+/* OF THE POSSIBILITY OF SUCH DAMAGE.                                                            */
+/* --------------------------------------------------------------------------------------------- */
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <limits.h>
+#include "ssfcbor.h"
+#include "ssfassert.h"
+#include "ssfport.h"
+
+#if SSF_CBOR_CONFIG_ENABLE_FLOAT == 1
+    #include <math.h> /* HUGE_VAL, nan() */
+#endif /* SSF_CBOR_CONFIG_ENABLE_FLOAT */
+
+#if SSF_CONFIG_CBOR_UNIT_TEST == 1
+#define CTS_NUM_ITEMS(x) (sizeof((x)) / sizeof((x)[0]))
+
+typedef struct SSFCborUTInt
+{
+    const char *cbor;
+    size_t len;
+    long int val;
+} SSFCborUTInt_t;
+
+typedef struct SSFCborUTBin
+{
+    const char *cbor;
+    size_t len;
+} SSFCborUTBin_t;
+
+/* Encoded examples from RFC 8949 Appendix A */
+static const SSFCborUTInt_t _ctsInts[] =
+{
+    { "\x00", 1, 0 },
+    { "\x01", 1, 1 },
+    { "\x0a", 1, 10 },
+    { "\x17", 1, 23 },
+    { "\x18\x18", 2, 24 },
+    { "\x18\x19", 2, 25 },
+    { "\x18\x64", 2, 100 },
+    { "\x19\x03\xe8", 3, 1000 },
+    { "\x1a\x00\x0f\x42\x40", 5, 1000000 },
+    { "\x20", 1, -1 },
+    { "\x29", 1, -10 },
+    { "\x38\x63", 2, -100 },
+    { "\x39\x03\xe7", 3, -1000 },
+};
+
+#if SSF_CBOR_CONFIG_ENABLE_FLOAT == 1
+typedef struct SSFCborUTFlt
+{
+    const char *cbor;
+    size_t len;
+    double val;
+} SSFCborUTFlt_t;
+
+static const SSFCborUTFlt_t _ctsFlts[] =
+{
+    { "\xf9\x00\x00", 3, 0.0 },
+    { "\xf9\x3c\x00", 3, 1.0 },
+    { "\xfb\x3f\xf1\x99\x99\x99\x99\x99\x9a", 9, 1.1 },
+    { "\xf9\x3e\x00", 3, 1.5 },
+    { "\xf9\x7b\xff", 3, 65504.0 },
+    { "\xfa\x47\xc3\x50\x00", 5, 100000.0 },
+    { "\xfa\x7f\x7f\xff\xff", 5, 3.4028234663852886e+38 },
+    { "\xfb\x7e\x37\xe4\x3c\x88\x00\x75\x9c", 9, 1.0e+300 },
+    { "\xf9\x00\x01", 3, 5.960464477539063e-8 },
+    { "\xf9\x04\x00", 3, 0.00006103515625 },
+    { "\xf9\xc4\x00", 3, -4.0 },
+    { "\xfb\xc0\x10\x66\x66\x66\x66\x66\x66", 9, -4.1 },
+};
+#endif /* SSF_CBOR_CONFIG_ENABLE_FLOAT */
+
+static const SSFCborUTBin_t _ctsIsValid[] =
+{
+    { "\x60", 1 },
+    { "\x64\x49\x45\x54\x46", 5 },
+    { "\x62\xc3\xbc", 3 },
+    { "\x44\x01\x02\x03\x04", 5 },
+    { "\x80", 1 },
+    { "\x83\x01\x02\x03", 4 },
+    { "\x83\x01\x82\x02\x03\x82\x04\x05", 8 },
+    { "\xa0", 1 },
+    { "\xa2\x01\x02\x03\x04", 5 },
+    { "\xa2\x61\x61\x01\x61\x62\x82\x02\x03", 9 },
+    { "\x82\x61\x61\xa1\x61\x62\x61\x63", 8 },
+    { "\x9f\xff", 2 },
+    { "\x9f\x01\x82\x02\x03\x9f\x04\x05\xff\xff", 10 },
+    { "\x83\x01\x9f\x02\x03\xff\x82\x04\x05", 9 },
+    { "\xbf\x61\x61\x01\x61\x62\x9f\x02\x03\xff\xff", 11 },
+    { "\xbf\x63\x46\x75\x6e\xf5\x63\x41\x6d\x74\x21\xff", 12 },
+    { "\xc1\x1a\x51\x4b\x67\xb0", 6 },
+    { "\xd8\x20\x76\x68\x74\x74\x70\x3a\x2f\x2f\x77\x77\x77\x2e\x65\x78\x61\x6d\x70\x6c\x65\x2e"
+      "\x63\x6f\x6d", 25 },
+    { "\xf4", 1 },
+    { "\xf5", 1 },
+    { "\xf6", 1 },
+    { "\xf7", 1 },
+    { "\xf0", 1 },
+    { "\xf8\xff", 2 },
+    { "\xf9\x7c\x00", 3 },
+    { "\xfa\x7f\xc0\x00\x00", 5 },
+    { "\x1b\xff\xff\xff\xff\xff\xff\xff\xff", 9 },
+    { "\x3b\xff\xff\xff\xff\xff\xff\xff\xff", 9 },
+    { "\x88\x81\x81\x81\x81\x81\x81\x80\x00\x00\x00\x00\x00\x00\x00", 15 },
+};
+
+static const SSFCborUTBin_t _ctsIsInvalid[] =
+{
+    { "", 0 },
+    { "\x18", 1 },
+    { "\x19\x00", 2 },
+    { "\x1a\x00\x00", 3 },
+    { "\x1b\x00\x00\x00\x00\x00\x00\x00", 8 },
+    { "\x1c", 1 },
+    { "\x1f", 1 },
+    { "\x3f", 1 },
+    { "\x62\x61", 2 },
+    { "\x5f\x41\x00\xff", 4 },
+    { "\x7f\x61\x61\xff", 4 },
+    { "\x82\x01", 2 },
+    { "\x9a\xff\xff\xff\xff\x00", 6 },
+    { "\xa1\x01", 2 },
+    { "\xff", 1 },
+    { "\x81\xff", 2 },
+    { "\x9f\x01", 2 },
+    { "\xbf\x01\xff", 3 },
+    { "\x9f\xc0\xff", 3 },
+    { "\xc0", 1 },
+    { "\xdf\x00", 2 },
+    { "\xf8\x00", 2 },
+    { "\xf8\x1f", 2 },
+    { "\x00\x00", 2 },
+    { "\x81\x81\x81\x81\x81\x81\x81\x81\x81\x00", 10 },
+    { "\x81\x81\x81\x81\x81\x81\x81\x81\x80", 9 },
+    { "\x81\x81\x81\x81\x81\x81\x81\x81\xa0", 9 },
+};
+
+/* --------------------------------------------------------------------------------------------- */
+/* Prints the items of the unit test map.                                                        */
+/* --------------------------------------------------------------------------------------------- */
+static bool _SSFCborUTPrintArray(uint8_t *cbor, size_t size, size_t start, size_t *end, void *in)
+{
+    SSF_ASSERT(in == NULL);
+
+    if (!SSFCborPrintInt(cbor, size, start, &start, 2)) return false;
+    return SSFCborPrintInt(cbor, size, start, end, 3);
+}
+
+static bool _SSFCborUTPrintMap(uint8_t *cbor, size_t size, size_t start, size_t *end, void *in)
+{
+    const uint8_t bytes[] = { 0x01, 0x02 };
+
+    SSF_ASSERT(in == NULL);
+
+    if (!SSFCborPrintLabel(cbor, size, start, &start, "a")) return false;
+    if (!SSFCborPrintInt(cbor, size, start, &start, 1)) return false;
+    if (!SSFCborPrintLabel(cbor, size, start, &start, "b")) return false;
+    if (!SSFCborPrintArray(cbor, size, start, &start, _SSFCborUTPrintArray, NULL)) return false;
+    if (!SSFCborPrintLabel(cbor, size, start, &start, "c")) return false;
+    if (!SSFCborPrintString(cbor, size, start, &start, "text")) return false;
+    if (!SSFCborPrintLabel(cbor, size, start, &start, "d")) return false;
+    if (!SSFCborPrintBytes(cbor, size, start, &start, bytes, sizeof(bytes))) return false;
+    if (!SSFCborPrintLabel(cbor, size, start, &start, "e")) return false;
+    if (!SSFCborPrintInt(cbor, size, start, &start, -2)) return false;
+    if (!SSFCborPrintLabel(cbor, size, start, &start, "f")) return false;
+    if (!SSFCborPrintTrue(cbor, size, start, &start)) return false;
+    if (!SSFCborPrintLabel(cbor, size, start, &start, "g")) return false;
+    if (!SSFCborPrintNull(cbor, size, start, &start)) return false;
+    if (!SSFCborPrintLabel(cbor, size, start, &start, "h")) return false;
+    if (!SSFCborPrintFalse(cbor, size, start, &start)) return false;
+    if (!SSFCborPrintUInt(cbor, size, start, &start, 1)) return false;
+    return SSFCborPrintString(cbor, size, start, end, "intkey");
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Prints the items of an array with more items than fit in a 1 byte head.                       */
+/* --------------------------------------------------------------------------------------------- */
+static bool _SSFCborUTPrintCount(uint8_t *cbor, size_t size, size_t start, size_t *end, void *in)
+{
+    size_t i;
+    size_t count = *(size_t *)in;
+
+    *end = start;
+    for (i = 0; i < count; i++)
+    {
+        if (!SSFCborPrintUInt(cbor, size, *end, end, (unsigned long)i)) return false;
+    }
+    return true;
+}
+
+#if SSF_CBOR_CONFIG_ENABLE_JSON == 1
+/* JSON strings that transcode to CBOR and back unchanged */
+static const char *_ctsJsonRoundTrip[] =
+{
+    "{}",
+    "{\"a\":1,\"b\":[2,3]}",
+    "{\"a\":[true,false,null],\"b\":{\"c\":-12345678,\"d\":[]},\"e\":{}}",
+    "{\"esc\":\"x\\\"y\\\\z\\n\\t\\u0000\",\"\\u0001k\":\"\"}",
+    "{\"utf8\":\"\xc3\xbc\xe2\x82\xac\"}",
+    "{\"big\":4294967295,\"neg\":-2147483648,\"a\":[[[0]]]}",
+#if (SSF_JSON_CONFIG_ENABLE_FLOAT_PARSE == 1) && (SSF_JSON_CONFIG_ENABLE_FLOAT_GEN == 1) && \
+    (SSF_CBOR_CONFIG_ENABLE_FLOAT == 1)
+    "{\"f\":[1.5,-0.25,3.14159,1e+300,65504]}",
+#endif /* SSF_JSON_CONFIG_ENABLE_FLOAT_PARSE && ... */
+};
+#endif /* SSF_CBOR_CONFIG_ENABLE_JSON */
+
+/* --------------------------------------------------------------------------------------------- */
+/* Performs unit test on CBOR external interface.                                                */
+/* --------------------------------------------------------------------------------------------- */
+void SSFCborUnitTest(void)
+{
+    uint8_t cbor[256];
+    uint8_t bytes[8];
+    char str[64];
+    size_t i;
+    size_t j;
+    size_t len;
+    size_t start;
+    size_t end;
+    size_t aidx;
+    long int si;
+    unsigned long int ui;
+    SSFCborType_t ct;
+    SSFCStrIn_t path[SSF_CBOR_CONFIG_MAX_IN_DEPTH + 1];
+#if SSF_CBOR_CONFIG_ENABLE_FLOAT == 1
+    double d;
+#endif /* SSF_CBOR_CONFIG_ENABLE_FLOAT */
+#if SSF_CBOR_CONFIG_ENABLE_JSON == 1
+    char js[256];
+    size_t cborLen;
+#endif /* SSF_CBOR_CONFIG_ENABLE_JSON */
+
+    memset(path, 0, sizeof(path));
+
+    SSF_ASSERT_TEST(SSFCborIsValid(NULL, 1));
+    SSF_ASSERT_TEST(SSFCborObject(NULL, 1, path, &start, &end, &ct));
+    SSF_ASSERT_TEST(SSFCborObject((uint8_t *)"\x00", 1, NULL, &start, &end, &ct));
+    SSF_ASSERT_TEST(SSFCborGetLong((uint8_t *)"\x00", 1, path, NULL));
+    SSF_ASSERT_TEST(SSFCborPrintString(cbor, sizeof(cbor), 0, &end, NULL));
+    SSF_ASSERT_TEST(SSFCborPrintInt(NULL, sizeof(cbor), 0, &end, 0));
+    SSF_ASSERT_TEST(SSFCborPrintInt(cbor, sizeof(cbor), sizeof(cbor) + 1, &end, 0));
+    SSF_ASSERT_TEST(SSFCborPrintSimple(cbor, sizeof(cbor), 0, &end, 24));
+
+    /* Validate parser on well-formed and malformed data items */
+    for (i = 0; i < CTS_NUM_ITEMS(_ctsIsValid); i++)
+    {
+        SSF_ASSERT(SSFCborIsValid((const uint8_t *)_ctsIsValid[i].cbor, _ctsIsValid[i].len));
+    }
+    for (i = 0; i < CTS_NUM_ITEMS(_ctsIsInvalid); i++)
+    {
+        SSF_ASSERT(SSFCborIsValid((const uint8_t *)_ctsIsInvalid[i].cbor,
+                                  _ctsIsInvalid[i].len) == false);
+    }
+
+    /* Integers decode and encode to the RFC examples */
+    for (i = 0; i < CTS_NUM_ITEMS(_ctsInts); i++)
+    {
+        SSF_ASSERT(SSFCborGetType((const uint8_t *)_ctsInts[i].cbor, _ctsInts[i].len, path) ==
+                   SSF_CBOR_TYPE_INT);
+        SSF_ASSERT(SSFCborGetLong((const uint8_t *)_ctsInts[i].cbor, _ctsInts[i].len, path,
+                                  &si));
+        SSF_ASSERT(si == _ctsInts[i].val);
+        SSF_ASSERT(SSFCborGetULong((const uint8_t *)_ctsInts[i].cbor, _ctsInts[i].len, path,
+                                   &ui) == (_ctsInts[i].val >= 0));
+        SSF_ASSERT(SSFCborPrintInt(cbor, sizeof(cbor), 0, &end, _ctsInts[i].val));
+        SSF_ASSERT((end == _ctsInts[i].len) && (memcmp(cbor, _ctsInts[i].cbor, end) == 0));
+        SSF_ASSERT(SSFCborPrintInt(cbor, _ctsInts[i].len - 1, 0, &end, _ctsInts[i].val) == false);
+        if (_ctsInts[i].val >= 0)
+        {
+            SSF_ASSERT(ui == (unsigned long int)_ctsInts[i].val);
+            SSF_ASSERT(SSFCborPrintUInt(cbor, sizeof(cbor), 0, &end, ui));
+            SSF_ASSERT((end == _ctsInts[i].len) && (memcmp(cbor, _ctsInts[i].cbor, end) == 0));
+        }
+    }
+    SSF_ASSERT(SSFCborPrintInt(cbor, sizeof(cbor), 0, &end, LONG_MIN));
+    SSF_ASSERT(SSFCborGetLong(cbor, end, path, &si) && (si == LONG_MIN));
+    SSF_ASSERT(SSFCborPrintUInt(cbor, sizeof(cbor), 0, &end, ULONG_MAX));
+    SSF_ASSERT(SSFCborGetULong(cbor, end, path, &ui) && (ui == ULONG_MAX));
+    SSF_ASSERT(SSFCborGetLong(cbor, end, path, &si) == false);
+#if ULONG_MAX == 0xfffffffffffffffful
+    SSF_ASSERT((end == 9) && (memcmp(cbor, "\x1b\xff\xff\xff\xff\xff\xff\xff\xff", 9) == 0));
+#endif /* ULONG_MAX */
+    SSF_ASSERT(SSFCborGetLong((const uint8_t *)"\x3b\xff\xff\xff\xff\xff\xff\xff\xff", 9, path,
+                              &si) == false);
+    SSF_ASSERT(SSFCborGetLong((const uint8_t *)"\x60", 1, path, &si) == false);
+
+#if SSF_CBOR_CONFIG_ENABLE_FLOAT == 1
+    /* Floats decode and encode to the RFC examples, preferring the shortest exact width */
+    for (i = 0; i < CTS_NUM_ITEMS(_ctsFlts); i++)
+    {
+        SSF_ASSERT(SSFCborGetType((const uint8_t *)_ctsFlts[i].cbor, _ctsFlts[i].len, path) ==
+                   SSF_CBOR_TYPE_FLOAT);
+        SSF_ASSERT(SSFCborGetDouble((const uint8_t *)_ctsFlts[i].cbor, _ctsFlts[i].len, path,
+                                    &d));
+        SSF_ASSERT(d == _ctsFlts[i].val);
+        SSF_ASSERT(SSFCborPrintDouble(cbor, sizeof(cbor), 0, &end, _ctsFlts[i].val));
+        SSF_ASSERT((end == _ctsFlts[i].len) && (memcmp(cbor, _ctsFlts[i].cbor, end) == 0));
+        SSF_ASSERT(SSFCborPrintDouble(cbor, _ctsFlts[i].len - 1, 0, &end, _ctsFlts[i].val) ==
+                   false);
+    }
+    SSF_ASSERT(SSFCborPrintDouble(cbor, sizeof(cbor), 0, &end, -0.0));
+    SSF_ASSERT((end == 3) && (memcmp(cbor, "\xf9\x80\x00", 3) == 0));
+    SSF_ASSERT(SSFCborPrintDouble(cbor, sizeof(cbor), 0, &end, HUGE_VAL));
+    SSF_ASSERT((end == 3) && (memcmp(cbor, "\xf9\x7c\x00", 3) == 0));
+    SSF_ASSERT(SSFCborGetDouble(cbor, end, path, &d) && (d == HUGE_VAL));
+    SSF_ASSERT(SSFCborPrintDouble(cbor, sizeof(cbor), 0, &end, -HUGE_VAL));
+    SSF_ASSERT((end == 3) && (memcmp(cbor, "\xf9\xfc\x00", 3) == 0));
+    SSF_ASSERT(SSFCborPrintDouble(cbor, sizeof(cbor), 0, &end, nan("")));
+    SSF_ASSERT((end == 3) && (memcmp(cbor, "\xf9\x7e\x00", 3) == 0));
+    SSF_ASSERT(SSFCborGetDouble(cbor, end, path, &d) && (d != d));
+    SSF_ASSERT(SSFCborGetDouble((const uint8_t *)"\xfa\x7f\xc0\x00\x00", 5, path, &d) &&
+               (d != d));
+    SSF_ASSERT(SSFCborGetDouble((const uint8_t *)"\x39\x03\xe7", 3, path, &d) && (d == -1000.0));
+    SSF_ASSERT(SSFCborGetDouble((const uint8_t *)"\xf5", 1, path, &d) == false);
+    SSF_ASSERT(SSFCborGetLong((const uint8_t *)"\xf9\x3c\x00", 3, path, &si) == false);
+#endif /* SSF_CBOR_CONFIG_ENABLE_FLOAT */
+
+    /* Strings and simple values */
+    SSF_ASSERT(SSFCborPrintString(cbor, sizeof(cbor), 0, &end, "IETF"));
+    SSF_ASSERT((end == 5) && (memcmp(cbor, "\x64\x49\x45\x54\x46", 5) == 0));
+    SSF_ASSERT(SSFCborPrintString(cbor, 5, 0, &end, "IETF"));
+    SSF_ASSERT(SSFCborPrintString(cbor, 4, 0, &end, "IETF") == false);
+    SSF_ASSERT(SSFCborGetString(cbor, 5, path, str, sizeof(str), &len));
+    SSF_ASSERT((len == 4) && (strcmp(str, "IETF") == 0));
+    SSF_ASSERT(SSFCborGetString(cbor, 5, path, str, 5, NULL));
+    SSF_ASSERT(SSFCborGetString(cbor, 5, path, str, 4, &len) == false);
+    SSF_ASSERT(SSFCborGetBytes(cbor, 5, path, bytes, sizeof(bytes), &len) == false);
+    SSF_ASSERT(SSFCborPrintString(cbor, sizeof(cbor), 0, &end, ""));
+    SSF_ASSERT((end == 1) && (cbor[0] == 0x60));
+    SSF_ASSERT(SSFCborPrintBytes(cbor, sizeof(cbor), 0, &end, (const uint8_t *)"\x01\x02\x03\x04",
+                                 4));
+    SSF_ASSERT((end == 5) && (memcmp(cbor, "\x44\x01\x02\x03\x04", 5) == 0));
+    SSF_ASSERT(SSFCborGetBytes(cbor, 5, path, bytes, 4, &len));
+    SSF_ASSERT((len == 4) && (memcmp(bytes, "\x01\x02\x03\x04", 4) == 0));
+    SSF_ASSERT(SSFCborGetBytes(cbor, 5, path, bytes, 3, &len) == false);
+    SSF_ASSERT(SSFCborGetString(cbor, 5, path, str, sizeof(str), &len) == false);
+    memset(str, 'x', 30);
+    str[30] = 0;
+    SSF_ASSERT(SSFCborPrintString(cbor, sizeof(cbor), 0, &end, str));
+    SSF_ASSERT((end == 32) && (cbor[0] == 0x78) && (cbor[1] == 30));
+    SSF_ASSERT(SSFCborPrintTrue(cbor, sizeof(cbor), 0, &end) && (end == 1) && (cbor[0] == 0xf5));
+    SSF_ASSERT(SSFCborGetType(cbor, end, path) == SSF_CBOR_TYPE_TRUE);
+    SSF_ASSERT(SSFCborPrintFalse(cbor, sizeof(cbor), 0, &end) && (end == 1) && (cbor[0] == 0xf4));
+    SSF_ASSERT(SSFCborGetType(cbor, end, path) == SSF_CBOR_TYPE_FALSE);
+    SSF_ASSERT(SSFCborPrintNull(cbor, sizeof(cbor), 0, &end) && (end == 1) && (cbor[0] == 0xf6));
+    SSF_ASSERT(SSFCborGetType(cbor, end, path) == SSF_CBOR_TYPE_NULL);
+    SSF_ASSERT(SSFCborPrintSimple(cbor, sizeof(cbor), 0, &end, 255));
+    SSF_ASSERT((end == 2) && (memcmp(cbor, "\xf8\xff", 2) == 0));
+    SSF_ASSERT(SSFCborGetType(cbor, end, path) == SSF_CBOR_TYPE_SIMPLE);
+    SSF_ASSERT(SSFCborPrintTrue(cbor, 0, 0, &end) == false);
+
+    /* Tags are skipped over to the tagged data item */
+    SSF_ASSERT(SSFCborGetType((const uint8_t *)_ctsIsValid[16].cbor, _ctsIsValid[16].len, path) ==
+               SSF_CBOR_TYPE_INT);
+    SSF_ASSERT(SSFCborGetLong((const uint8_t *)_ctsIsValid[16].cbor, _ctsIsValid[16].len, path,
+                              &si) && (si == 1363896240l));
+    SSF_ASSERT(SSFCborGetString((const uint8_t *)_ctsIsValid[17].cbor, _ctsIsValid[17].len, path,
+                                str, sizeof(str), &len));
+    SSF_ASSERT((len == 22) && (strcmp(str, "http://www.example.com") == 0));
+
+    /* Generate a map with nested items and look them up by path */
+    SSF_ASSERT(SSFCborPrintMap(cbor, sizeof(cbor), 0, &end, _SSFCborUTPrintMap, NULL));
+    SSF_ASSERT(SSFCborIsValid(cbor, end));
+    SSF_ASSERT(end == 41);
+    SSF_ASSERT(memcmp(cbor, "\xa9\x61\x61\x01\x61\x62\x82\x02\x03\x61\x63\x64text\x61\x64"
+                      "\x42\x01\x02\x61\x65\x21\x61\x66\xf5\x61\x67\xf6\x61\x68\xf4\x01"
+                      "\x66intkey", 41) == 0);
+    for (len = 0; len < end; len++)
+    {
+        SSF_ASSERT(SSFCborPrintMap(cbor, len, 0, &i, _SSFCborUTPrintMap, NULL) == false);
+    }
+    SSF_ASSERT(SSFCborPrintMap(cbor, sizeof(cbor), 0, &end, _SSFCborUTPrintMap, NULL));
+    SSF_ASSERT(SSFCborGetType(cbor, end, path) == SSF_CBOR_TYPE_MAP);
+    SSF_ASSERT(SSFCborObject(cbor, end, path, &start, &i, &ct));
+    SSF_ASSERT((start == 0) && (i == (end - 1)) && (ct == SSF_CBOR_TYPE_MAP));
+    path[0] = "a";
+    SSF_ASSERT(SSFCborGetLong(cbor, end, path, &si) && (si == 1));
+    path[0] = "b";
+    SSF_ASSERT(SSFCborObject(cbor, end, path, &start, &i, &ct));
+    SSF_ASSERT((start == 6) && (i == 8) && (ct == SSF_CBOR_TYPE_ARRAY));
+    aidx = 1;
+    path[1] = (SSFCStrIn_t)&aidx;
+    SSF_ASSERT(SSFCborGetLong(cbor, end, path, &si) && (si == 3));
+    aidx = 2;
+    SSF_ASSERT(SSFCborGetType(cbor, end, path) == SSF_CBOR_TYPE_ERROR);
+    path[1] = NULL;
+    path[0] = "c";
+    SSF_ASSERT(SSFCborGetString(cbor, end, path, str, sizeof(str), &len));
+    SSF_ASSERT((len == 4) && (strcmp(str, "text") == 0));
+    SSF_ASSERT(SSFCborGetLong(cbor, end, path, &si) == false);
+    path[0] = "d";
+    SSF_ASSERT(SSFCborGetBytes(cbor, end, path, bytes, sizeof(bytes), &len));
+    SSF_ASSERT((len == 2) && (bytes[0] == 1) && (bytes[1] == 2));
+    path[0] = "e";
+    SSF_ASSERT(SSFCborGetLong(cbor, end, path, &si) && (si == -2));
+    SSF_ASSERT(SSFCborGetULong(cbor, end, path, &ui) == false);
+    path[0] = "f";
+    SSF_ASSERT(SSFCborGetType(cbor, end, path) == SSF_CBOR_TYPE_TRUE);
+    path[0] = "g";
+    SSF_ASSERT(SSFCborGetType(cbor, end, path) == SSF_CBOR_TYPE_NULL);
+    path[0] = "h";
+    SSF_ASSERT(SSFCborGetType(cbor, end, path) == SSF_CBOR_TYPE_FALSE);
+    path[0] = "intkey";
+    SSF_ASSERT(SSFCborGetType(cbor, end, path) == SSF_CBOR_TYPE_ERROR);
+    path[0] = "z";
+    SSF_ASSERT(SSFCborGetType(cbor, end, path) == SSF_CBOR_TYPE_ERROR);
+    path[0] = "a";
+    path[1] = "b";
+    SSF_ASSERT(SSFCborGetType(cbor, end, path) == SSF_CBOR_TYPE_ERROR);
+    path[1] = NULL;
+    SSF_ASSERT(SSFCborGetType(cbor, end - 1, path) == SSF_CBOR_TYPE_ERROR);
+
+    /* Indefinite length arrays and maps */
+    path[0] = "b";
+    path[1] = (SSFCStrIn_t)&aidx;
+    aidx = 1;
+    SSF_ASSERT(SSFCborGetLong((const uint8_t *)_ctsIsValid[14].cbor, _ctsIsValid[14].len, path,
+                              &si) && (si == 3));
+    aidx = 2;
+    SSF_ASSERT(SSFCborGetType((const uint8_t *)_ctsIsValid[14].cbor, _ctsIsValid[14].len,
+                              path) == SSF_CBOR_TYPE_ERROR);
+    path[1] = NULL;
+    path[0] = "Amt";
+    SSF_ASSERT(SSFCborGetLong((const uint8_t *)_ctsIsValid[15].cbor, _ctsIsValid[15].len, path,
+                              &si) && (si == -2));
+    path[0] = "Zzz";
+    SSF_ASSERT(SSFCborGetType((const uint8_t *)_ctsIsValid[15].cbor, _ctsIsValid[15].len,
+                              path) == SSF_CBOR_TYPE_ERROR);
+    path[0] = NULL;
+
+    /* Array head grows past 1 byte once it has more than 23 items */
+    for (j = 0; j < 30; j++)
+    {
+        SSF_ASSERT(SSFCborPrintArray(cbor, sizeof(cbor), 1, &end, _SSFCborUTPrintCount, &j));
+        SSF_ASSERT(SSFCborIsValid(&cbor[1], end - 1));
+        if (j < 24) SSF_ASSERT(cbor[1] == (0x80 + j));
+        else SSF_ASSERT((cbor[1] == 0x98) && (cbor[2] == j) && (cbor[3] == 0x00));
+        SSF_ASSERT(end == (1 + ((j < 24) ? 1 : 2) + j + ((j > 24) ? (j - 24) : 0)));
+    }
+    j = 30;
+    SSF_ASSERT(SSFCborPrintArray(cbor, 37, 0, &end, _SSFCborUTPrintCount, &j) == false);
+    SSF_ASSERT(SSFCborPrintArray(cbor, 38, 0, &end, _SSFCborUTPrintCount, &j) && (end == 38));
+    SSF_ASSERT(SSFCborPrintArray(cbor, sizeof(cbor), 0, &end, NULL, NULL));
+    SSF_ASSERT((end == 1) && (cbor[0] == 0x80));
+    j = 3;
+    SSF_ASSERT(SSFCborPrintMap(cbor, sizeof(cbor), 0, &end, _SSFCborUTPrintCount, &j) == false);
+    j = 4;
+    SSF_ASSERT(SSFCborPrintMap(cbor, sizeof(cbor), 0, &end, _SSFCborUTPrintCount, &j));
+    SSF_ASSERT((end == 5) && (memcmp(cbor, "\xa2\x00\x01\x02\x03", 5) == 0));
+
+#if SSF_CBOR_CONFIG_ENABLE_JSON == 1
+    /* Transcode JSON to CBOR and back */
+    SSF_ASSERT_TEST(SSFCborFromJson(NULL, cbor, sizeof(cbor), &cborLen));
+    SSF_ASSERT_TEST(SSFCborFromJson("{}", NULL, sizeof(cbor), &cborLen));
+    SSF_ASSERT_TEST(SSFCborFromJson("{}", cbor, sizeof(cbor), NULL));
+    SSF_ASSERT_TEST(SSFCborToJson(NULL, 1, js, sizeof(js), &len));
+    SSF_ASSERT_TEST(SSFCborToJson(cbor, 1, NULL, sizeof(js), &len));
+    SSF_ASSERT_TEST(SSFCborToJson(cbor, 1, js, sizeof(js), NULL));
+
+    for (i = 0; i < CTS_NUM_ITEMS(_ctsJsonRoundTrip); i++)
+    {
+        SSF_ASSERT(SSFCborFromJson(_ctsJsonRoundTrip[i], cbor, sizeof(cbor), &cborLen));
+        SSF_ASSERT(SSFCborIsValid(cbor, cborLen));
+        SSF_ASSERT(cborLen < strlen(_ctsJsonRoundTrip[i]));
+        SSF_ASSERT(SSFCborToJson(cbor, cborLen, js, sizeof(js), &len));
+        SSF_ASSERT((len == strlen(js)) && (strcmp(js, _ctsJsonRoundTrip[i]) == 0));
+
+        /* Output that does not fit fails */
+        for (j = 0; j < cborLen; j++)
+        {
+            SSF_ASSERT(SSFCborFromJson(_ctsJsonRoundTrip[i], cbor, j, &end) == false);
+        }
+        for (j = 0; j <= len; j++)
+        {
+            SSF_ASSERT(SSFCborToJson(cbor, cborLen, js, j, &end) == false);
+        }
+    }
+    SSF_ASSERT(SSFCborFromJson("{\"a\":1,\"b\":[2,3]}", cbor, sizeof(cbor), &cborLen));
+    SSF_ASSERT((cborLen == 9) && (memcmp(cbor, _ctsIsValid[9].cbor, 9) == 0));
+    SSF_ASSERT(SSFCborFromJson("{\"\\u00fc\\/\":\"\\ud83d\\ude00\"}", cbor, sizeof(cbor),
+                               &cborLen));
+    SSF_ASSERT((cborLen == 10) && (memcmp(cbor, "\xa1\x63\xc3\xbc/\x64\xf0\x9f\x98\x80", 10) == 0));
+    SSF_ASSERT(SSFCborFromJson("{\"a\":1", cbor, sizeof(cbor), &cborLen) == false);
+    SSF_ASSERT(SSFCborFromJson("{\"a\":\"\\ud83d\"}", cbor, sizeof(cbor), &cborLen) == false);
+#if (SSF_JSON_CONFIG_ENABLE_FLOAT_PARSE == 0) || (SSF_CBOR_CONFIG_ENABLE_FLOAT == 0)
+    SSF_ASSERT(SSFCborFromJson("{\"a\":1.5}", cbor, sizeof(cbor), &cborLen) == false);
+#endif /* SSF_JSON_CONFIG_ENABLE_FLOAT_PARSE || SSF_CBOR_CONFIG_ENABLE_FLOAT */
+
+    /* Byte strings become Base64 strings, tags and indefinite lengths are dropped */
+    SSF_ASSERT(SSFCborToJson((const uint8_t *)"\xa1\x61\x62\x44\x01\x02\x03\x04", 8, js,
+                             sizeof(js), &len));
+    SSF_ASSERT(strcmp(js, "{\"b\":\"AQIDBA==\"}") == 0);
+    SSF_ASSERT(SSFCborToJson((const uint8_t *)_ctsIsValid[15].cbor, _ctsIsValid[15].len, js,
+                             sizeof(js), &len));
+    SSF_ASSERT(strcmp(js, "{\"Fun\":true,\"Amt\":-2}") == 0);
+    SSF_ASSERT(SSFCborToJson((const uint8_t *)_ctsIsValid[12].cbor, _ctsIsValid[12].len, js,
+                             sizeof(js), &len));
+    SSF_ASSERT(strcmp(js, "[1,[2,3],[4,5]]") == 0);
+    SSF_ASSERT(SSFCborToJson((const uint8_t *)_ctsIsValid[17].cbor, _ctsIsValid[17].len, js,
+                             sizeof(js), &len));
+    SSF_ASSERT(strcmp(js, "\"http://www.example.com\"") == 0);
+
+    /* CBOR without a JSON equivalent fails */
+    SSF_ASSERT(SSFCborToJson((const uint8_t *)"\xa1\x01\x02", 3, js, sizeof(js), &len) == false);
+    SSF_ASSERT(SSFCborToJson((const uint8_t *)"\xf7", 1, js, sizeof(js), &len) == false);
+    SSF_ASSERT(SSFCborToJson((const uint8_t *)"\xf9\x7e\x00", 3, js, sizeof(js), &len) == false);
+    SSF_ASSERT(SSFCborToJson((const uint8_t *)"\xf9\x7c\x00", 3, js, sizeof(js), &len) == false);
+    SSF_ASSERT(SSFCborToJson((const uint8_t *)"\x82\x01", 2, js, sizeof(js), &len) == false);
+
+    /* Empty arrays and maps count toward the depth limit */
+    SSF_ASSERT(SSFCborToJson((const uint8_t *)"\x81\x81\x81\x81\x81\x81\x81\x81\x80", 9, js,
+                             sizeof(js), &len) == false);
+    SSF_ASSERT(SSFCborToJson((const uint8_t *)"\x81\x81\x81\x81\x81\x81\x81\x80", 8, js,
+                             sizeof(js), &len));
+    SSF_ASSERT(strcmp(js, "[[[[[[[[]]]]]]]]") == 0);
+#endif /* SSF_CBOR_CONFIG_ENABLE_JSON */
+}
+#endif /* SSF_CONFIG_CBOR_UNIT_TEST */
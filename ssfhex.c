@@ -33,28 +33,266 @@
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include "ssfhex.h"
 #include "ssfport.h"
 #include "ssfassert.h"
 
+#if SSF_HEX_CONFIG_CODEC == 2
+    #include <tmmintrin.h>
+#elif SSF_HEX_CONFIG_CODEC == 3
+    #include <arm_neon.h>
+#endif /* SSF_HEX_CONFIG_CODEC */
+
+/* --------------------------------------------------------------------------------------------- */
+/* Defines                                                                                       */
+/* --------------------------------------------------------------------------------------------- */
+#if SSF_HEX_CONFIG_CODEC == 1
+#define SSF_HEX_DEC_IN_WIDTH (16u)
+#define SSF_HEX_DEC_OUT_WIDTH (8u)
+#define SSF_HEX_ENC_IN_WIDTH (8u)
+#define SSF_HEX_ENC_OUT_WIDTH (16u)
+#define SSF_HEX_SWAR_ONES (0x0101010101010101ull)
+#define SSF_HEX_SWAR_LOW7 (0x7F7F7F7F7F7F7F7Full)
+#define SSF_HEX_SWAR_HIGH (0x8080808080808080ull)
+#define SSF_HEX_SWAR_NIB (0x0F0F0F0F0F0F0F0Full)
+#elif SSF_HEX_CONFIG_CODEC != 0
+#define SSF_HEX_DEC_IN_WIDTH (32u)
+#define SSF_HEX_DEC_OUT_WIDTH (16u)
+#define SSF_HEX_ENC_IN_WIDTH (16u)
+#define SSF_HEX_ENC_OUT_WIDTH (32u)
+#endif /* SSF_HEX_CONFIG_CODEC */
+#define SSF_HEX_STREAM_MAGIC (0x48455853u)
+#define SSF_HEX_STREAM_CHUNK (128u)
+
+/* --------------------------------------------------------------------------------------------- */
+/* Module variables                                                                              */
+/* --------------------------------------------------------------------------------------------- */
+static const char _hexLower[] = "0123456789abcdef";
+static const char _hexUpper[] = "0123456789ABCDEF";
+
+/* Maps a char to its hex digit value of 0-15, else 0xff if not a hex digit */
+static const uint8_t _hexDec[256] =
+{
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+};
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if the 2 hex chars at hex decoded to the byte at out, else false.                */
+/* --------------------------------------------------------------------------------------------- */
+static bool _SSFHexDecPair(const char *hex, uint8_t *out)
+{
+    uint8_t un = _hexDec[(uint8_t)hex[0]];
+    uint8_t ln = _hexDec[(uint8_t)hex[1]];
+
+    if ((un | ln) > 0x0f) return false;
+    *out = (uint8_t)((un << 4) + ln);
+    return true;
+}
+
+#if SSF_HEX_CONFIG_CODEC == 1
+/* --------------------------------------------------------------------------------------------- */
+/* Returns the digit value of each byte of w, sets the high bit of bad's bytes for non-digits.   */
+/* --------------------------------------------------------------------------------------------- */
+static uint64_t _SSFHexSwarNibs(uint64_t w, uint64_t *bad)
+{
+    uint64_t x = w & SSF_HEX_SWAR_LOW7;
+    uint64_t l = x | (0x20 * SSF_HEX_SWAR_ONES);
+    uint64_t digit;
+    uint64_t alpha;
+
+    /* Adding to 7-bit bytes sets their high bit at a threshold without cross byte carries */
+    digit = (x + (0x50 * SSF_HEX_SWAR_ONES)) & ~(x + (0x46 * SSF_HEX_SWAR_ONES));
+    alpha = (l + (0x1f * SSF_HEX_SWAR_ONES)) & ~(l + (0x19 * SSF_HEX_SWAR_ONES));
+    *bad |= (w | ~(digit | alpha)) & SSF_HEX_SWAR_HIGH;
+    return (x & SSF_HEX_SWAR_NIB) + (((alpha & SSF_HEX_SWAR_HIGH) >> 7) * 9);
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns the 4 bytes packed from the hex digit values in the bytes of n, in memory order.      */
+/* --------------------------------------------------------------------------------------------- */
+static uint32_t _SSFHexSwarPack(uint64_t n)
+{
+#if SSF_CONFIG_LITTLE_ENDIAN == 1
+    n = ((n << 4) | (n >> 8)) & 0x00FF00FF00FF00FFull;
+#else
+    n = ((n >> 4) | n) & 0x00FF00FF00FF00FFull;
+#endif /* SSF_CONFIG_LITTLE_ENDIAN */
+    n = (n | (n >> 8)) & 0x0000FFFF0000FFFFull;
+    return (uint32_t)(n | (n >> 16));
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns the hex digit values of the 4 bytes of in, spread over the bytes of a word in order.  */
+/* --------------------------------------------------------------------------------------------- */
+static uint64_t _SSFHexSwarSpread(const uint8_t *in)
+{
+    uint32_t u;
+    uint64_t n;
+
+    memcpy(&u, in, sizeof(u));
+    n = u;
+    n = (n | (n << 16)) & 0x0000FFFF0000FFFFull;
+    n = (n | (n << 8)) & 0x00FF00FF00FF00FFull;
+#if SSF_CONFIG_LITTLE_ENDIAN == 1
+    return ((n >> 4) & 0x000F000F000F000Full) | ((n & 0x000F000F000F000Full) << 8);
+#else
+    return ((n & 0x00F000F000F000F0ull) << 4) | (n & 0x000F000F000F000Full);
+#endif /* SSF_CONFIG_LITTLE_ENDIAN */
+}
+#endif /* SSF_HEX_CONFIG_CODEC */
+
+#if SSF_HEX_CONFIG_CODEC != 0
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if SSF_HEX_DEC_IN_WIDTH hex chars at in decoded to out, reversed if rev.         */
+/* --------------------------------------------------------------------------------------------- */
+static bool _SSFHexDecBlock(const char *in, uint8_t *out, bool rev)
+{
+#if SSF_HEX_CONFIG_CODEC == 1
+    uint64_t w[2];
+    uint64_t bad = 0;
+    uint32_t b[2];
+    uint8_t tmp[SSF_HEX_DEC_OUT_WIDTH];
+    uint8_t i;
+
+    memcpy(w, in, sizeof(w));
+    b[0] = _SSFHexSwarPack(_SSFHexSwarNibs(w[0], &bad));
+    b[1] = _SSFHexSwarPack(_SSFHexSwarNibs(w[1], &bad));
+    if (bad != 0) return false;
+    if (!rev) { memcpy(out, b, sizeof(b)); return true; }
+    memcpy(tmp, b, sizeof(b));
+    for (i = 0; i < SSF_HEX_DEC_OUT_WIDTH; i++) out[i] = tmp[SSF_HEX_DEC_OUT_WIDTH - 1 - i];
+    return true;
+#elif SSF_HEX_CONFIG_CODEC == 2
+    __m128i ok = _mm_set1_epi8(-1);
+    __m128i n[2];
+    __m128i r;
+    uint8_t i;
+
+    for (i = 0; i < 2; i++)
+    {
+        __m128i v = _mm_loadu_si128((const __m128i *)&in[i << 4]);
+        __m128i l = _mm_or_si128(v, _mm_set1_epi8(0x20));
+        __m128i d = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8('0' - 1)),
+                                  _mm_cmpgt_epi8(_mm_set1_epi8('9' + 1), v));
+        __m128i a = _mm_and_si128(_mm_cmpgt_epi8(l, _mm_set1_epi8('a' - 1)),
+                                  _mm_cmpgt_epi8(_mm_set1_epi8('f' + 1), l));
+
+        ok = _mm_and_si128(ok, _mm_or_si128(d, a));
+        n[i] = _mm_add_epi8(_mm_and_si128(v, _mm_set1_epi8(0x0f)),
+                            _mm_and_si128(a, _mm_set1_epi8(9)));
+        /* Each pair of digits becomes a 16-bit high * 16 + low */
+        n[i] = _mm_maddubs_epi16(n[i], _mm_set1_epi16(0x0110));
+    }
+    if (_mm_movemask_epi8(ok) != 0xffff) return false;
+    r = _mm_packus_epi16(n[0], n[1]);
+    if (rev) r = _mm_shuffle_epi8(r, _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3,
+                                                   2, 1, 0));
+    _mm_storeu_si128((__m128i *)out, r);
+    return true;
+#else
+    uint8x16x2_t v = vld2q_u8((const uint8_t *)in);
+    uint8x16_t ok = vdupq_n_u8(0xff);
+    uint8x16_t n[2];
+    uint8x16_t r;
+    uint8_t i;
+
+    for (i = 0; i < 2; i++)
+    {
+        uint8x16_t l = vorrq_u8(v.val[i], vdupq_n_u8(0x20));
+        uint8x16_t d = vandq_u8(vcgeq_u8(v.val[i], vdupq_n_u8('0')),
+                                vcleq_u8(v.val[i], vdupq_n_u8('9')));
+        uint8x16_t a = vandq_u8(vcgeq_u8(l, vdupq_n_u8('a')), vcleq_u8(l, vdupq_n_u8('f')));
+
+        ok = vandq_u8(ok, vorrq_u8(d, a));
+        n[i] = vaddq_u8(vandq_u8(v.val[i], vdupq_n_u8(0x0f)), vandq_u8(a, vdupq_n_u8(9)));
+    }
+    if (vminvq_u8(ok) != 0xff) return false;
+    r = vorrq_u8(vshlq_n_u8(n[0], 4), n[1]);
+    if (rev) { r = vrev64q_u8(r); r = vextq_u8(r, r, 8); }
+    vst1q_u8(out, r);
+    return true;
+#endif /* SSF_HEX_CONFIG_CODEC */
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Encodes SSF_HEX_ENC_IN_WIDTH bytes at in, reversed if rev, as hex chars of alpha at out.      */
+/* --------------------------------------------------------------------------------------------- */
+static void _SSFHexEncBlock(const uint8_t *in, char *out, bool rev, const char *alpha)
+{
+#if SSF_HEX_CONFIG_CODEC == 1
+    uint8_t tmp[SSF_HEX_ENC_IN_WIDTH];
+    uint64_t n[2];
+    uint64_t off = (alpha == _hexUpper) ? 0x07 : 0x27;
+    uint8_t i;
+
+    if (rev)
+    {
+        for (i = 0; i < SSF_HEX_ENC_IN_WIDTH; i++) tmp[i] = in[SSF_HEX_ENC_IN_WIDTH - 1 - i];
+        in = tmp;
+    }
+    for (i = 0; i < 2; i++)
+    {
+        n[i] = _SSFHexSwarSpread(&in[i << 2]);
+        /* Digits above 9 get the offset from '9' + 1 to the first letter added */
+        n[i] += (0x30 * SSF_HEX_SWAR_ONES) +
+                ((((n[i] + (0x76 * SSF_HEX_SWAR_ONES)) & SSF_HEX_SWAR_HIGH) >> 7) * off);
+    }
+    memcpy(out, n, sizeof(n));
+#elif SSF_HEX_CONFIG_CODEC == 2
+    __m128i v = _mm_loadu_si128((const __m128i *)in);
+    __m128i lut = _mm_loadu_si128((const __m128i *)alpha);
+    __m128i m = _mm_set1_epi8(0x0f);
+    __m128i hi;
+    __m128i lo;
+
+    if (rev) v = _mm_shuffle_epi8(v, _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3,
+                                                   2, 1, 0));
+    hi = _mm_shuffle_epi8(lut, _mm_and_si128(_mm_srli_epi16(v, 4), m));
+    lo = _mm_shuffle_epi8(lut, _mm_and_si128(v, m));
+    _mm_storeu_si128((__m128i *)out, _mm_unpacklo_epi8(hi, lo));
+    _mm_storeu_si128((__m128i *)&out[16], _mm_unpackhi_epi8(hi, lo));
+#else
+    uint8x16_t v = vld1q_u8(in);
+    uint8x16_t lut = vld1q_u8((const uint8_t *)alpha);
+    uint8x16x2_t o;
+
+    if (rev) { v = vrev64q_u8(v); v = vextq_u8(v, v, 8); }
+    o.val[0] = vqtbl1q_u8(lut, vshrq_n_u8(v, 4));
+    o.val[1] = vqtbl1q_u8(lut, vandq_u8(v, vdupq_n_u8(0x0f)));
+    vst2q_u8((uint8_t *)out, o);
+#endif /* SSF_HEX_CONFIG_CODEC */
+}
+#endif /* SSF_HEX_CONFIG_CODEC */
+
 /* --------------------------------------------------------------------------------------------- */
 /* Returns true if binary byte converted successfully to ASCII hex bytes, else false.            */
 /* --------------------------------------------------------------------------------------------- */
 bool SSFHexBinToByte(uint8_t in, char *out, size_t outSize, SSFHexCase_t hcase)
 {
-    #define SSF_HEX_BIN_TO_HEX(n, o, u) if (n <= 9) o = n + 0x30; else o = n + u;
-    uint8_t un;
-    uint8_t ln;
-    uint8_t up;
-    
+    const char *alpha;
+
     SSF_REQUIRE(out != NULL);
     if (outSize < 2) return false;
 
-    un = in >> 4;
-    ln = in & 0x0f;
-    up = (hcase == SSF_HEX_CASE_UPPER) ? 0x37 : 0x57;
-    SSF_HEX_BIN_TO_HEX(un, out[0], up);
-    SSF_HEX_BIN_TO_HEX(ln, out[1], up);
+    alpha = (hcase == SSF_HEX_CASE_UPPER) ? _hexUpper : _hexLower;
+    out[0] = alpha[in >> 4];
+    out[1] = alpha[in & 0x0f];
     if (outSize >= 3) out[2] = 0;
 
     return true;
@@ -65,21 +303,10 @@ bool SSFHexBinToByte(uint8_t in, char *out, size_t outSize, SSFHexCase_t hcase)
 /* --------------------------------------------------------------------------------------------- */
 bool SSFHexByteToBin(const char *hex, uint8_t *out)
 {
-    #define SSF_HEX_TO_BIN(n, i) \
-        if ((i >= '0') && (i <= '9')) n = i - 0x30; \
-        else if ((i >= 'A') && (i <= 'F')) n = i - 0x37; \
-        else if ((i >= 'a') && (i <= 'f')) n = i - 0x57; \
-        else return false;
-    uint8_t un;
-    uint8_t ln;
-
     SSF_REQUIRE(hex != NULL);
     SSF_REQUIRE(out != NULL);
 
-    SSF_HEX_TO_BIN(un, hex[0]);
-    SSF_HEX_TO_BIN(ln, hex[1]);
-    *out = (un << 4) + ln;
-    return true;
+    return _SSFHexDecPair(hex, out);
 }
 
 /* --------------------------------------------------------------------------------------------- */
@@ -94,12 +321,29 @@ bool SSFHexBytesToBin(SSFCStrIn_t in, size_t inLenLim, uint8_t *out, size_t outS
 
     if (inLenLim & 0x01) return false;
     *outLen = 0;
+#if SSF_HEX_CONFIG_CODEC != 0
+    /* Decode wide blocks with one validity check each, taken from the end of in if rev */
+    while ((inLenLim >= SSF_HEX_DEC_IN_WIDTH) && (outSize >= SSF_HEX_DEC_OUT_WIDTH))
+    {
+        if (rev)
+        {if (!_SSFHexDecBlock(&in[inLenLim - SSF_HEX_DEC_IN_WIDTH], out, true)) return false; }
+        else
+        {
+            if (!_SSFHexDecBlock(in, out, false)) return false;
+            in += SSF_HEX_DEC_IN_WIDTH;
+        }
+        inLenLim -= SSF_HEX_DEC_IN_WIDTH;
+        outSize -= SSF_HEX_DEC_OUT_WIDTH;
+        out += SSF_HEX_DEC_OUT_WIDTH;
+        *outLen += SSF_HEX_DEC_OUT_WIDTH;
+    }
+#endif /* SSF_HEX_CONFIG_CODEC */
     while ((inLenLim >= 2) && (outSize != 0))
     {
         if (rev)
-        {if (!SSFHexByteToBin(&in[inLenLim - 2], out)) return false; } else
+        {if (!_SSFHexDecPair(&in[inLenLim - 2], out)) return false; } else
         {
-            if (!SSFHexByteToBin(in, out)) return false;
+            if (!_SSFHexDecPair(in, out)) return false;
             in += 2;
         }
         inLenLim -= 2;
@@ -116,17 +360,32 @@ bool SSFHexBytesToBin(SSFCStrIn_t in, size_t inLenLim, uint8_t *out, size_t outS
 bool SSFHexBinToBytes(const uint8_t *in, size_t inLen, SSFCStrOut_t out, size_t outSize,
                       size_t *outLen, bool rev, SSFHexCase_t hcase)
 {
+    const char *alpha;
+
     SSF_REQUIRE(in != NULL);
     SSF_REQUIRE(out != NULL);
     SSF_REQUIRE(outSize >= 1);
     SSF_REQUIRE(hcase < SSF_HEX_CASE_MAX);
 
-    *out = 0;
+    alpha = (hcase == SSF_HEX_CASE_UPPER) ? _hexUpper : _hexLower;
     if (outLen != NULL) *outLen = 0;
+#if SSF_HEX_CONFIG_CODEC != 0
+    /* Encode wide blocks, taken from the end of in if rev, leaving room for the NULL */
+    while ((inLen >= SSF_HEX_ENC_IN_WIDTH) && (outSize > SSF_HEX_ENC_OUT_WIDTH))
+    {
+        _SSFHexEncBlock(rev ? &in[inLen - SSF_HEX_ENC_IN_WIDTH] : in, out, rev, alpha);
+        if (!rev) in += SSF_HEX_ENC_IN_WIDTH;
+        inLen -= SSF_HEX_ENC_IN_WIDTH;
+        out += SSF_HEX_ENC_OUT_WIDTH;
+        outSize -= SSF_HEX_ENC_OUT_WIDTH;
+        if (outLen != NULL) *outLen += SSF_HEX_ENC_OUT_WIDTH;
+    }
+#endif /* SSF_HEX_CONFIG_CODEC */
     if ((rev) && (inLen > 0)) in += (inLen - 1);
     while ((inLen > 0) && (outSize >= 3))
     {
-        if (!SSFHexBinToByte(*in, out, outSize, hcase)) return false;
+        out[0] = alpha[*in >> 4];
+        out[1] = alpha[*in & 0x0f];
         if (rev) in--;
         else in++;
         inLen--;
@@ -134,6 +393,357 @@ bool SSFHexBinToBytes(const uint8_t *in, size_t inLen, SSFCStrOut_t out, size_t
         outSize -= 2;
         if (outLen != NULL) *outLen += 2;
     }
+    *out = 0;
     return inLen == 0;
 }
 
+#if SSF_HEX_CONFIG_ENABLE_STREAM == 1
+/* --------------------------------------------------------------------------------------------- */
+/* Returns chars an encoder update of inLen bytes appends to its output.                         */
+/* --------------------------------------------------------------------------------------------- */
+static size_t _SSFHexStreamEncNeed(const SSFHexStream_t *ctx, size_t inLen)
+{
+    size_t groups;
+
+    /* Without separators or reversal bytes are encoded as they arrive */
+    if ((ctx->sep == 0) && (!ctx->rev)) return inLen << 1;
+    groups = (ctx->bufLen + inLen) / ctx->group;
+    if (groups == 0) return 0;
+    return (groups * ((size_t)ctx->group << 1)) +
+           ((ctx->sep == 0) ? 0 : (groups - (ctx->isSep ? 0 : 1)));
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns number of chars of group of len bytes at in, with a leading separator, written to out.*/
+/* --------------------------------------------------------------------------------------------- */
+static size_t _SSFHexStreamEncGroup(SSFHexStream_t *ctx, const uint8_t *in, size_t len,
+                                    char *out)
+{
+    char hex[(SSF_HEX_STREAM_MAX_GROUP << 1) + 1];
+    size_t n = 0;
+
+    if (ctx->isSep) { out[0] = ctx->sep; n = 1; }
+    SSF_ASSERT(SSFHexBinToBytes(in, len, hex, sizeof(hex), NULL, ctx->rev, ctx->hcase));
+    memcpy(&out[n], hex, len << 1);
+    ctx->isSep = ctx->sep != 0;
+    return n + (len << 1);
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Inits a streaming encoder of groups of group bytes, separated by sep unless 0.                */
+/* --------------------------------------------------------------------------------------------- */
+void SSFHexEncInit(SSFHexStream_t *ctx, uint8_t group, char sep, bool rev, SSFHexCase_t hcase)
+{
+    SSF_REQUIRE(ctx != NULL);
+    SSF_REQUIRE((group >= 1) && (group <= SSF_HEX_STREAM_MAX_GROUP));
+    SSF_REQUIRE(!SSFIsHex(sep));
+    SSF_REQUIRE(hcase < SSF_HEX_CASE_MAX);
+
+    memset(ctx, 0, sizeof(SSFHexStream_t));
+    ctx->group = group;
+    ctx->sep = sep;
+    ctx->rev = rev;
+    ctx->hcase = hcase;
+    ctx->magic = SSF_HEX_STREAM_MAGIC;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if all of in is encoded or kept for the next call, else false if out too small.  */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFHexEncUpdate(SSFHexStream_t *ctx, const uint8_t *in, size_t inLen, SSFCStrOut_t out,
+                     size_t outSize, size_t *outLen)
+{
+    size_t len;
+
+    SSF_REQUIRE(ctx != NULL);
+    SSF_REQUIRE(ctx->magic == SSF_HEX_STREAM_MAGIC);
+    SSF_REQUIRE(!ctx->isDec);
+    SSF_REQUIRE(in != NULL);
+    SSF_REQUIRE(out != NULL);
+    SSF_REQUIRE(outLen != NULL);
+
+    *outLen = 0;
+    if (_SSFHexStreamEncNeed(ctx, inLen) > outSize) return false;
+    if (inLen == 0) return true;
+
+    if ((ctx->sep == 0) && (!ctx->rev))
+    {
+        /* The last byte is encoded on its own so the NULL is not written past the end of out */
+        if (inLen > 1)
+        {
+            SSF_ASSERT(SSFHexBinToBytes(in, inLen - 1, out, outSize, NULL, false, ctx->hcase));
+        }
+        SSF_ASSERT(SSFHexBinToByte(in[inLen - 1], &out[(inLen - 1) << 1], 2, ctx->hcase));
+        *outLen = inLen << 1;
+        return true;
+    }
+
+    /* Complete the bytes left over from the last call into a group first */
+    if (ctx->bufLen != 0)
+    {
+        len = ctx->group - ctx->bufLen;
+        if (len > inLen) len = inLen;
+        memcpy(&ctx->buf[ctx->bufLen], in, len);
+        ctx->bufLen += (uint8_t)len;
+        in += len;
+        inLen -= len;
+        if (ctx->bufLen < ctx->group) return true;
+        *outLen = _SSFHexStreamEncGroup(ctx, ctx->buf, ctx->group, out);
+        ctx->bufLen = 0;
+    }
+    while (inLen >= ctx->group)
+    {
+        *outLen += _SSFHexStreamEncGroup(ctx, in, ctx->group, &out[*outLen]);
+        in += ctx->group;
+        inLen -= ctx->group;
+    }
+    memcpy(ctx->buf, in, inLen);
+    ctx->bufLen = (uint8_t)inLen;
+    return true;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if all of in is encoded into fifo or kept, else false if fifo lacks room.         */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFHexEncUpdateBFifo(SSFHexStream_t *ctx, const uint8_t *in, size_t inLen,
+                          SSFBFifo_t *fifo)
+{
+    char chunk[SSF_HEX_STREAM_CHUNK];
+    size_t len;
+    size_t n;
+    size_t i;
+
+    SSF_REQUIRE(ctx != NULL);
+    SSF_REQUIRE(ctx->magic == SSF_HEX_STREAM_MAGIC);
+    SSF_REQUIRE(!ctx->isDec);
+    SSF_REQUIRE(in != NULL);
+    SSF_REQUIRE(fifo != NULL);
+
+    if (_SSFHexStreamEncNeed(ctx, inLen) > SSFBFifoUnused(fifo)) return false;
+    while (inLen != 0)
+    {
+        /* Encode as many whole groups as the chunk holds, completing any left over group */
+        n = (sizeof(chunk) / (((size_t)ctx->group << 1) + 1)) * ctx->group - ctx->bufLen;
+        if (n > inLen) n = inLen;
+        SSF_ASSERT(SSFHexEncUpdate(ctx, in, n, chunk, sizeof(chunk), &len));
+        for (i = 0; i < len; i++) SSFBFifoPutByte(fifo, (uint8_t)chunk[i]);
+        in += n;
+        inLen -= n;
+    }
+    return true;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if the left over partial group is encoded and ctx reset, else false.             */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFHexEncFinal(SSFHexStream_t *ctx, SSFCStrOut_t out, size_t outSize, size_t *outLen)
+{
+    SSF_REQUIRE(ctx != NULL);
+    SSF_REQUIRE(ctx->magic == SSF_HEX_STREAM_MAGIC);
+    SSF_REQUIRE(!ctx->isDec);
+    SSF_REQUIRE(out != NULL);
+    SSF_REQUIRE(outLen != NULL);
+
+    *outLen = 0;
+    if (ctx->bufLen != 0)
+    {
+        if (((size_t)(ctx->bufLen << 1) + (ctx->isSep ? 1 : 0)) > outSize) return false;
+        *outLen = _SSFHexStreamEncGroup(ctx, ctx->buf, ctx->bufLen, out);
+    }
+    SSFHexEncInit(ctx, ctx->group, ctx->sep, ctx->rev, ctx->hcase);
+    return true;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns bytes a decoder update with digits hex digits appends to its output.                  */
+/* --------------------------------------------------------------------------------------------- */
+static size_t _SSFHexStreamDecNeed(const SSFHexStream_t *ctx, size_t digits)
+{
+    digits += ctx->isNib ? 1 : 0;
+    /* Bytes are output as they complete unless their group is reversed */
+    if (!ctx->rev) return digits >> 1;
+    return ((((size_t)ctx->bufLen << 1) + digits) / ((size_t)ctx->group << 1)) * ctx->group;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Appends the byte to out, or to its group, and ends the group when complete.                   */
+/* --------------------------------------------------------------------------------------------- */
+static void _SSFHexStreamDecByte(SSFHexStream_t *ctx, uint8_t b, uint8_t *out, size_t *outLen)
+{
+    uint8_t i;
+
+    if (ctx->rev) ctx->buf[ctx->bufLen] = b;
+    else
+    {
+        out[*outLen] = b;
+        (*outLen)++;
+        /* Without separators or reversal there are no group boundaries to track */
+        if (ctx->sep == 0) return;
+    }
+    ctx->bufLen++;
+    if (ctx->bufLen < ctx->group) return;
+    if (ctx->rev)
+    {
+        for (i = ctx->group; i != 0; i--) { out[*outLen] = ctx->buf[i - 1]; (*outLen)++; }
+    }
+    ctx->bufLen = 0;
+    ctx->isSep = ctx->sep != 0;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Inits a streaming decoder of groups of group bytes, separated by sep unless 0.                */
+/* --------------------------------------------------------------------------------------------- */
+void SSFHexDecInit(SSFHexStream_t *ctx, uint8_t group, char sep, bool rev)
+{
+    SSF_REQUIRE(ctx != NULL);
+    SSF_REQUIRE((group >= 1) && (group <= SSF_HEX_STREAM_MAX_GROUP));
+    SSF_REQUIRE(!SSFIsHex(sep));
+
+    memset(ctx, 0, sizeof(SSFHexStream_t));
+    ctx->group = group;
+    ctx->sep = sep;
+    ctx->rev = rev;
+    ctx->isDec = true;
+    ctx->magic = SSF_HEX_STREAM_MAGIC;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if all of in is decoded or kept for the next call, else false.                   */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFHexDecUpdate(SSFHexStream_t *ctx, SSFCStrIn_t in, size_t inLen, uint8_t *out,
+                     size_t outSize, size_t *outLen)
+{
+    size_t digits = inLen;
+    size_t span;
+    size_t len;
+    size_t i;
+    uint8_t v;
+
+    SSF_REQUIRE(ctx != NULL);
+    SSF_REQUIRE(ctx->magic == SSF_HEX_STREAM_MAGIC);
+    SSF_REQUIRE(ctx->isDec);
+    SSF_REQUIRE(in != NULL);
+    SSF_REQUIRE(out != NULL);
+    SSF_REQUIRE(outLen != NULL);
+
+    *outLen = 0;
+    if (ctx->isErr) return false;
+    /* Out too small is not an error, the call may be repeated with more space */
+    if (ctx->sep != 0) { for (i = 0; i < inLen; i++) { if (in[i] == ctx->sep) digits--; } }
+    if (_SSFHexStreamDecNeed(ctx, digits) > outSize) return false;
+
+    while (inLen != 0)
+    {
+        /* Decode whole groups, or without separators or reversal whole runs, in bulk */
+        if ((!ctx->isNib) && (!ctx->isSep) && (ctx->bufLen == 0))
+        {
+            span = (size_t)ctx->group << 1;
+            if ((ctx->sep == 0) && (!ctx->rev)) span = inLen & ~(size_t)1;
+            if ((span != 0) && (inLen >= span))
+            {
+                if (!SSFHexBytesToBin(in, span, &out[*outLen], outSize - *outLen, &len,
+                                      ctx->rev))
+                { ctx->isErr = true; return false; }
+                *outLen += len;
+                in += span;
+                inLen -= span;
+                ctx->isGap = false;
+                ctx->isSep = ctx->sep != 0;
+                continue;
+            }
+        }
+
+        /* Decode a char at a time across group and call boundaries */
+        if ((ctx->sep != 0) && (*in == ctx->sep))
+        {
+            if ((!ctx->isSep) || ctx->isNib || (ctx->bufLen != 0))
+            { ctx->isErr = true; return false; }
+            ctx->isSep = false;
+            ctx->isGap = true;
+        }
+        else
+        {
+            if (ctx->isSep || ((v = _hexDec[(uint8_t)*in]) > 0x0f))
+            { ctx->isErr = true; return false; }
+            ctx->isGap = false;
+            if (!ctx->isNib) { ctx->nib = v; ctx->isNib = true; }
+            else
+            {
+                ctx->isNib = false;
+                _SSFHexStreamDecByte(ctx, (uint8_t)((ctx->nib << 4) | v), out, outLen);
+            }
+        }
+        in++;
+        inLen--;
+    }
+    return true;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if chars taken from fifo, while their bytes fit in out, decoded, else false.     */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFHexDecUpdateBFifo(SSFHexStream_t *ctx, SSFBFifo_t *fifo, uint8_t *out, size_t outSize,
+                          size_t *outLen)
+{
+    char chunk[SSF_HEX_STREAM_CHUNK];
+    size_t len;
+    size_t n;
+
+    SSF_REQUIRE(ctx != NULL);
+    SSF_REQUIRE(ctx->magic == SSF_HEX_STREAM_MAGIC);
+    SSF_REQUIRE(ctx->isDec);
+    SSF_REQUIRE(fifo != NULL);
+    SSF_REQUIRE(out != NULL);
+    SSF_REQUIRE(outLen != NULL);
+
+    *outLen = 0;
+    while (!ctx->isErr)
+    {
+        /* Chars that could complete bytes beyond the room left in out are left in the fifo */
+        for (n = 0; (n < sizeof(chunk)) &&
+                    (_SSFHexStreamDecNeed(ctx, n + 1) <= (outSize - *outLen)) &&
+                    SSFBFifoGetByte(fifo, (uint8_t *)&chunk[n]); n++);
+        if (n == 0) break;
+        if (!SSFHexDecUpdate(ctx, chunk, n, &out[*outLen], outSize - *outLen, &len))
+        { return false; }
+        *outLen += len;
+    }
+    return !ctx->isErr;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if all chars decoded, any partial group output, and ctx reset, else false.       */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFHexDecFinal(SSFHexStream_t *ctx, uint8_t *out, size_t outSize, size_t *outLen)
+{
+    bool rv;
+    uint8_t i;
+
+    SSF_REQUIRE(ctx != NULL);
+    SSF_REQUIRE(ctx->magic == SSF_HEX_STREAM_MAGIC);
+    SSF_REQUIRE(ctx->isDec);
+    SSF_REQUIRE(out != NULL);
+    SSF_REQUIRE(outLen != NULL);
+
+    *outLen = 0;
+    rv = (!ctx->isErr) && (!ctx->isNib) && (!ctx->isGap);
+    if (rv && ctx->rev && (ctx->bufLen != 0))
+    {
+        if (ctx->bufLen > outSize) return false;
+        for (i = ctx->bufLen; i != 0; i--) { out[*outLen] = ctx->buf[i - 1]; (*outLen)++; }
+    }
+    SSFHexDecInit(ctx, ctx->group, ctx->sep, ctx->rev);
+    return rv;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Deinits a streaming encoder or decoder context.                                               */
+/* --------------------------------------------------------------------------------------------- */
+void SSFHexStreamDeInit(SSFHexStream_t *ctx)
+{
+    SSF_REQUIRE(ctx != NULL);
+    SSF_REQUIRE(ctx->magic == SSF_HEX_STREAM_MAGIC);
+
+    memset(ctx, 0, sizeof(SSFHexStream_t));
+}
+#endif /* SSF_HEX_CONFIG_ENABLE_STREAM */
@@ -39,6 +39,9 @@ extern "C" {
 #include <stdint.h>
 #include <stdbool.h>
 #include "ssfport.h"
+#if SSF_HEX_CONFIG_ENABLE_STREAM == 1
+#include "ssfbfifo.h"
+#endif /* SSF_HEX_CONFIG_ENABLE_STREAM */
 
 /* --------------------------------------------------------------------------------------------- */
 /* Defines                                                                                       */
@@ -53,6 +56,27 @@ typedef enum SSFHexCase
 #define SSFIsHex(h) (((h) >= 'a' && (h) <= 'f') || ((h) >= 'A' && (h) <= 'F') || \
                      ((h) >= '0' && (h) <= '9'))
 
+#if SSF_HEX_CONFIG_ENABLE_STREAM == 1
+#define SSF_HEX_STREAM_MAX_GROUP (16u)
+
+typedef struct SSFHexStream
+{
+    uint8_t buf[SSF_HEX_STREAM_MAX_GROUP];  /* Bytes of the partial group when it is reversed */
+    uint8_t bufLen;     /* Bytes of the current group taken so far */
+    uint8_t group;      /* Bytes between separators, reversed as a unit if rev */
+    char sep;           /* Separator between groups, 0 for none */
+    bool rev;
+    SSFHexCase_t hcase;
+    bool isDec;
+    bool isNib;         /* Decoder holds the high nibble of the next byte in nib */
+    uint8_t nib;
+    bool isSep;         /* A separator is due before the next group */
+    bool isGap;         /* Decoder has read a separator and needs a digit next */
+    bool isErr;
+    uint32_t magic;
+} SSFHexStream_t;
+#endif /* SSF_HEX_CONFIG_ENABLE_STREAM */
+
 /* --------------------------------------------------------------------------------------------- */
 /* External Interface                                                                            */
 /* --------------------------------------------------------------------------------------------- */
@@ -64,6 +88,23 @@ bool SSFHexBytesToBin(SSFCStrIn_t in, size_t inLenLim, uint8_t *out, size_t outS
 bool SSFHexBinToBytes(const uint8_t *in, size_t inLen, SSFCStrOut_t out, size_t outSize,
                       size_t *outLen, bool rev, SSFHexCase_t hcase);
 
+#if SSF_HEX_CONFIG_ENABLE_STREAM == 1
+/* Streaming encoder and decoder, out is not NULL terminated and outLen is set per call */
+void SSFHexEncInit(SSFHexStream_t *ctx, uint8_t group, char sep, bool rev, SSFHexCase_t hcase);
+bool SSFHexEncUpdate(SSFHexStream_t *ctx, const uint8_t *in, size_t inLen, SSFCStrOut_t out,
+                     size_t outSize, size_t *outLen);
+bool SSFHexEncUpdateBFifo(SSFHexStream_t *ctx, const uint8_t *in, size_t inLen,
+                          SSFBFifo_t *fifo);
+bool SSFHexEncFinal(SSFHexStream_t *ctx, SSFCStrOut_t out, size_t outSize, size_t *outLen);
+void SSFHexDecInit(SSFHexStream_t *ctx, uint8_t group, char sep, bool rev);
+bool SSFHexDecUpdate(SSFHexStream_t *ctx, SSFCStrIn_t in, size_t inLen, uint8_t *out,
+                     size_t outSize, size_t *outLen);
+bool SSFHexDecUpdateBFifo(SSFHexStream_t *ctx, SSFBFifo_t *fifo, uint8_t *out, size_t outSize,
+                          size_t *outLen);
+bool SSFHexDecFinal(SSFHexStream_t *ctx, uint8_t *out, size_t outSize, size_t *outLen);
+void SSFHexStreamDeInit(SSFHexStream_t *ctx);
+#endif /* SSF_HEX_CONFIG_ENABLE_STREAM */
+
 /* --------------------------------------------------------------------------------------------- */
 /* Unit test                                                                                     */
 /* --------------------------------------------------------------------------------------------- */
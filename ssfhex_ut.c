@@ -32,6 +32,7 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include <stdio.h>
+#include <string.h>
 #include "ssfhex.h"
 #include "ssfassert.h"
 
@@ -61,14 +62,41 @@ SSFHexUT_t _hexUTPass[] =
         (uint8_t *)"\xef\xcd\xab\xef\xcd\xab\x90\x78\x56\x34\x12\xF5\xA1", 13 },
 };
 
+#if SSF_HEX_CONFIG_ENABLE_STREAM == 1
+/* --------------------------------------------------------------------------------------------- */
+/* Returns length of reference dump of in, in groups of group bytes, written to out.             */
+/* --------------------------------------------------------------------------------------------- */
+static size_t _SSFHexUTDump(const uint8_t *in, size_t inLen, uint8_t group, char sep, bool rev,
+                            SSFHexCase_t hcase, char *out)
+{
+    size_t len = 0;
+    size_t i;
+    size_t j;
+    size_t n;
+
+    for (i = 0; i < inLen; i += group)
+    {
+        if ((i != 0) && (sep != 0)) out[len++] = sep;
+        n = ((inLen - i) < group) ? (inLen - i) : group;
+        for (j = 0; j < n; j++)
+        {
+            snprintf(&out[len], 3, (hcase == SSF_HEX_CASE_UPPER) ? "%02X" : "%02x",
+                     in[i + (rev ? (n - 1 - j) : j)]);
+            len += 2;
+        }
+    }
+    return len;
+}
+#endif /* SSF_HEX_CONFIG_ENABLE_STREAM */
+
 /* --------------------------------------------------------------------------------------------- */
 /* Performs unit test on ASCII Hex external interface.                                           */
 /* --------------------------------------------------------------------------------------------- */
 void SSFHexUnitTest(void)
 {
     uint32_t i;
-    uint8_t binout[32];
-    char hexout[65];
+    uint8_t binout[40];
+    char hexout[81];
     size_t outlen;
 
     SSF_ASSERT_TEST(SSFHexBytesToBin(NULL, strlen(_hexUTPass[0].ascii), binout, sizeof(binout),
@@ -152,6 +180,253 @@ void SSFHexUnitTest(void)
         SSF_ASSERT(outlen == strlen(hexout));
         SSF_ASSERT(memcmp(hexout, _hexUTPass[i].asciirevup, outlen + 1) == 0);
     }
+
+    /* Round trip lengths that exercise bulk conversion in both orders and cases */
+    for (i = 0; i <= 40; i++)
+    {
+        uint8_t bin[40];
+        char ref[81];
+        uint32_t j;
+        uint32_t k;
+
+        for (j = 0; j < i; j++) bin[j] = (uint8_t)((j * 167u) + 13u);
+        for (k = 0; k < 4; k++)
+        {
+            bool rev = (k & 1) != 0;
+            SSFHexCase_t hcase = (k & 2) ? SSF_HEX_CASE_UPPER : SSF_HEX_CASE_LOWER;
+
+            for (j = 0; j < i; j++)
+            {
+                snprintf(&ref[j << 1], 3, (hcase == SSF_HEX_CASE_UPPER) ? "%02X" : "%02x",
+                         bin[rev ? (i - 1 - j) : j]);
+            }
+            ref[i << 1] = 0;
+
+            /* Output sized exactly for the chars and NULL succeeds, one less fails */
+            memset(hexout, 0xff, sizeof(hexout));
+            SSF_ASSERT(SSFHexBinToBytes(bin, i, hexout, (i << 1) + 1, &outlen, rev, hcase));
+            SSF_ASSERT(outlen == (i << 1));
+            SSF_ASSERT(memcmp(hexout, ref, outlen + 1) == 0);
+            if (i != 0)
+            {
+                SSF_ASSERT(SSFHexBinToBytes(bin, i, hexout, i << 1, &outlen, rev, hcase) ==
+                           false);
+                SSF_ASSERT(strlen(hexout) < (i << 1));
+            }
+
+            /* Output sized exactly for the bytes succeeds, one less fails */
+            SSF_ASSERT(SSFHexBytesToBin(ref, i << 1, binout, i, &outlen, rev));
+            SSF_ASSERT(outlen == i);
+            SSF_ASSERT(memcmp(binout, bin, i) == 0);
+            if (i != 0)
+            {
+                SSF_ASSERT(SSFHexBytesToBin(ref, i << 1, binout, i - 1, &outlen, rev) == false);
+            }
+        }
+    }
+
+    /* Every char value at every position of a long string only decodes if it is a hex digit */
+    for (i = 0; i < 64; i++) hexout[i] = "0123456789abcdefABCDEF"[i % 22];
+    for (i = 0; i < 64; i++)
+    {
+        uint32_t c;
+        char orig = hexout[i];
+
+        for (c = 0; c < 256; c++)
+        {
+            hexout[i] = (char)c;
+            SSF_ASSERT(SSFHexBytesToBin(hexout, 64, binout, sizeof(binout), &outlen, false) ==
+                       SSFIsHex(c));
+            SSF_ASSERT(SSFHexBytesToBin(hexout, 64, binout, sizeof(binout), &outlen, true) ==
+                       SSFIsHex(c));
+        }
+        hexout[i] = orig;
+    }
+#if SSF_HEX_CONFIG_ENABLE_STREAM == 1
+    {
+        static const uint8_t groups[] = { 1, 2, 4, 7, 16 };
+        static const char seps[] = { 0, ' ', ':' };
+        SSFHexStream_t ctx;
+        SSFHexStream_t dctx;
+        SSFBFifo_t fifo;
+        uint8_t fifoBuf[SSF_BFIFO_255 + 1];
+        uint8_t bin[100];
+        uint8_t dec[100];
+        char ref[400];
+        char enc[400];
+        size_t refLen;
+        size_t total;
+        size_t chunk;
+        size_t len;
+        size_t g;
+        size_t s;
+        size_t j;
+        size_t k;
+        volatile uint32_t seed = 1;
+
+        SSF_ASSERT_TEST(SSFHexEncInit(NULL, 1, 0, false, SSF_HEX_CASE_LOWER));
+        SSF_ASSERT_TEST(SSFHexEncInit(&ctx, 0, 0, false, SSF_HEX_CASE_LOWER));
+        SSF_ASSERT_TEST(SSFHexEncInit(&ctx, SSF_HEX_STREAM_MAX_GROUP + 1, 0, false,
+                                      SSF_HEX_CASE_LOWER));
+        SSF_ASSERT_TEST(SSFHexEncInit(&ctx, 1, 'a', false, SSF_HEX_CASE_LOWER));
+        SSF_ASSERT_TEST(SSFHexEncInit(&ctx, 1, 0, false, SSF_HEX_CASE_MAX));
+        SSF_ASSERT_TEST(SSFHexDecInit(NULL, 1, 0, false));
+        SSF_ASSERT_TEST(SSFHexDecInit(&ctx, 1, '0', false));
+        SSF_ASSERT_TEST(SSFHexStreamDeInit(NULL));
+        memset(&ctx, 0, sizeof(ctx));
+        SSF_ASSERT_TEST(SSFHexEncUpdate(&ctx, bin, 1, enc, sizeof(enc), &len));
+        SSF_ASSERT_TEST(SSFHexDecFinal(&ctx, dec, sizeof(dec), &len));
+        SSFHexDecInit(&ctx, 1, 0, false);
+        SSF_ASSERT_TEST(SSFHexEncUpdate(&ctx, bin, 1, enc, sizeof(enc), &len));
+        SSF_ASSERT_TEST(SSFHexDecUpdate(&ctx, NULL, 2, dec, sizeof(dec), &len));
+        SSF_ASSERT_TEST(SSFHexDecUpdate(&ctx, "00", 2, NULL, sizeof(dec), &len));
+        SSF_ASSERT_TEST(SSFHexDecUpdate(&ctx, "00", 2, dec, sizeof(dec), NULL));
+        SSF_ASSERT_TEST(SSFHexDecUpdateBFifo(&ctx, NULL, dec, sizeof(dec), &len));
+        SSFHexEncInit(&ctx, 1, 0, false, SSF_HEX_CASE_LOWER);
+        SSF_ASSERT_TEST(SSFHexDecUpdate(&ctx, "00", 2, dec, sizeof(dec), &len));
+        SSF_ASSERT_TEST(SSFHexEncUpdate(&ctx, NULL, 1, enc, sizeof(enc), &len));
+        SSF_ASSERT_TEST(SSFHexEncFinal(&ctx, NULL, sizeof(enc), &len));
+        SSFHexStreamDeInit(&ctx);
+        SSF_ASSERT_TEST(SSFHexEncFinal(&ctx, enc, sizeof(enc), &len));
+
+        /* Chunked encode and decode of every format match the reference dump */
+        for (i = 0; i < sizeof(bin); i++) bin[i] = (uint8_t)((i * 73u) + 11u);
+        for (g = 0; g < sizeof(groups); g++)
+        {
+            for (s = 0; s < sizeof(seps); s++)
+            {
+                for (k = 0; k < 4; k++)
+                {
+                    bool rev = (k & 1) != 0;
+                    SSFHexCase_t hcase = (k & 2) ? SSF_HEX_CASE_UPPER : SSF_HEX_CASE_LOWER;
+
+                    for (len = 0; len <= sizeof(bin); len += 33)
+                    {
+                        refLen = _SSFHexUTDump(bin, len, groups[g], seps[s], rev, hcase, ref);
+                        for (chunk = 1; chunk <= 17; chunk += 4)
+                        {
+                            SSFHexEncInit(&ctx, groups[g], seps[s], rev, hcase);
+                            for (total = 0, j = 0; j < len; j += chunk)
+                            {
+                                SSF_ASSERT(SSFHexEncUpdate(&ctx, &bin[j],
+                                                           ((len - j) < chunk) ? (len - j) :
+                                                           chunk, &enc[total],
+                                                           sizeof(enc) - total, &outlen));
+                                total += outlen;
+                            }
+                            SSF_ASSERT(SSFHexEncFinal(&ctx, &enc[total], sizeof(enc) - total,
+                                                      &outlen));
+                            total += outlen;
+                            SSF_ASSERT(total == refLen);
+                            SSF_ASSERT(memcmp(enc, ref, refLen) == 0);
+
+                            /* Odd sized chunks carry a nibble, and separators, across calls */
+                            SSFHexDecInit(&ctx, groups[g], seps[s], rev);
+                            for (total = 0, j = 0; j < refLen; j += chunk)
+                            {
+                                SSF_ASSERT(SSFHexDecUpdate(&ctx, &ref[j],
+                                                           ((refLen - j) < chunk) ? (refLen - j) :
+                                                           chunk, &dec[total],
+                                                           sizeof(dec) - total, &outlen));
+                                total += outlen;
+                            }
+                            SSF_ASSERT(SSFHexDecFinal(&ctx, &dec[total], sizeof(dec) - total,
+                                                      &outlen));
+                            total += outlen;
+                            SSF_ASSERT(total == len);
+                            SSF_ASSERT(memcmp(dec, bin, len) == 0);
+                        }
+
+                        /* Random splits of the dump decode the same */
+                        SSFHexDecInit(&ctx, groups[g], seps[s], rev);
+                        for (total = 0, j = 0; j < refLen; j += chunk)
+                        {
+                            seed = (seed * 1103515245u) + 12345u;
+                            chunk = 1 + ((seed >> 16) % 9);
+                            if (chunk > (refLen - j)) chunk = refLen - j;
+                            SSF_ASSERT(SSFHexDecUpdate(&ctx, &ref[j], chunk, &dec[total],
+                                                       sizeof(dec) - total, &outlen));
+                            total += outlen;
+                        }
+                        SSF_ASSERT(SSFHexDecFinal(&ctx, &dec[total], sizeof(dec) - total,
+                                                  &outlen));
+                        SSF_ASSERT((total + outlen) == len);
+                        SSF_ASSERT(memcmp(dec, bin, len) == 0);
+                    }
+                }
+            }
+        }
+
+        /* Too small out consumes nothing so the call can be repeated */
+        SSFHexEncInit(&ctx, 2, ' ', false, SSF_HEX_CASE_LOWER);
+        SSF_ASSERT(SSFHexEncUpdate(&ctx, (const uint8_t *)"\x01\x02\x03", 3, enc, 4, &outlen));
+        SSF_ASSERT(outlen == 4);
+        SSF_ASSERT(SSFHexEncUpdate(&ctx, (const uint8_t *)"\x04", 1, enc, 4, &outlen) == false);
+        SSF_ASSERT(SSFHexEncUpdate(&ctx, (const uint8_t *)"\x04", 1, enc, 5, &outlen));
+        SSF_ASSERT((outlen == 5) && (memcmp(enc, " 0304", 5) == 0));
+        SSF_ASSERT(SSFHexEncUpdate(&ctx, (const uint8_t *)"\x05", 1, enc, 0, &outlen));
+        SSF_ASSERT(SSFHexEncFinal(&ctx, enc, 2, &outlen) == false);
+        SSF_ASSERT(SSFHexEncFinal(&ctx, enc, 3, &outlen));
+        SSF_ASSERT((outlen == 3) && (memcmp(enc, " 05", 3) == 0));
+        SSFHexDecInit(&ctx, 2, ' ', true);
+        SSF_ASSERT(SSFHexDecUpdate(&ctx, "0102 03", 7, dec, 1, &outlen) == false);
+        SSF_ASSERT(SSFHexDecUpdate(&ctx, "0102 03", 7, dec, 2, &outlen));
+        SSF_ASSERT((outlen == 2) && (memcmp(dec, "\x02\x01", 2) == 0));
+        SSF_ASSERT(SSFHexDecFinal(&ctx, dec, 0, &outlen) == false);
+        SSF_ASSERT(SSFHexDecFinal(&ctx, dec, 1, &outlen));
+        SSF_ASSERT((outlen == 1) && (dec[0] == 3));
+
+        /* Misplaced separators, invalid chars, and partial bytes fail, and errors stick */
+        SSFHexDecInit(&ctx, 2, ':', false);
+        SSF_ASSERT(SSFHexDecUpdate(&ctx, ":0102", 5, dec, sizeof(dec), &outlen) == false);
+        SSF_ASSERT(SSFHexDecUpdate(&ctx, "0102", 4, dec, sizeof(dec), &outlen) == false);
+        SSF_ASSERT(SSFHexDecFinal(&ctx, dec, sizeof(dec), &outlen) == false);
+        SSF_ASSERT(SSFHexDecUpdate(&ctx, "0102::0304", 10, dec, sizeof(dec), &outlen) == false);
+        SSF_ASSERT(SSFHexDecFinal(&ctx, dec, sizeof(dec), &outlen) == false);
+        SSF_ASSERT(SSFHexDecUpdate(&ctx, "01:0203", 7, dec, sizeof(dec), &outlen) == false);
+        SSF_ASSERT(SSFHexDecFinal(&ctx, dec, sizeof(dec), &outlen) == false);
+        SSF_ASSERT(SSFHexDecUpdate(&ctx, "01020304", 8, dec, sizeof(dec), &outlen) == false);
+        SSF_ASSERT(SSFHexDecFinal(&ctx, dec, sizeof(dec), &outlen) == false);
+        SSF_ASSERT(SSFHexDecUpdate(&ctx, "0102:", 5, dec, sizeof(dec), &outlen));
+        SSF_ASSERT(SSFHexDecFinal(&ctx, dec, sizeof(dec), &outlen) == false);
+        SSF_ASSERT(SSFHexDecUpdate(&ctx, "0102:0g", 7, dec, sizeof(dec), &outlen) == false);
+        SSF_ASSERT(SSFHexDecFinal(&ctx, dec, sizeof(dec), &outlen) == false);
+        SSF_ASSERT(SSFHexDecUpdate(&ctx, "0102:0", 6, dec, sizeof(dec), &outlen));
+        SSF_ASSERT(SSFHexDecFinal(&ctx, dec, sizeof(dec), &outlen) == false);
+        SSF_ASSERT(SSFHexDecUpdate(&ctx, "0102:03", 7, dec, sizeof(dec), &outlen));
+        SSF_ASSERT(SSFHexDecFinal(&ctx, dec, sizeof(dec), &outlen));
+        SSF_ASSERT(SSFHexDecFinal(&ctx, dec, sizeof(dec), &outlen));
+        SSF_ASSERT(outlen == 0);
+        SSFHexStreamDeInit(&ctx);
+
+        /* A dump streams through a small fifo in fixed size pieces */
+        SSFBFifoInit(&fifo, SSF_BFIFO_255, fifoBuf, sizeof(fifoBuf));
+        SSFHexEncInit(&ctx, 4, ' ', false, SSF_HEX_CASE_UPPER);
+        SSFHexDecInit(&dctx, 4, ' ', false);
+        refLen = _SSFHexUTDump(bin, sizeof(bin), 4, ' ', false, SSF_HEX_CASE_UPPER, ref);
+        for (total = 0, j = 0; j < sizeof(bin); j += 10)
+        {
+            SSF_ASSERT(SSFHexEncUpdateBFifo(&ctx, &bin[j], 10, &fifo));
+            SSF_ASSERT(SSFHexDecUpdateBFifo(&dctx, &fifo, &dec[total], 7, &outlen));
+            SSF_ASSERT(outlen <= 7);
+            total += outlen;
+        }
+        SSF_ASSERT(SSFHexEncFinal(&ctx, enc, sizeof(enc), &outlen));
+        SSF_ASSERT(outlen == 0);
+        while (!SSFBFifoIsEmpty(&fifo))
+        {
+            SSF_ASSERT(SSFHexDecUpdateBFifo(&dctx, &fifo, &dec[total], 7, &outlen));
+            total += outlen;
+        }
+        SSF_ASSERT(SSFHexDecFinal(&dctx, &dec[total], sizeof(dec) - total, &outlen));
+        SSF_ASSERT((total + outlen) == sizeof(bin));
+        SSF_ASSERT(memcmp(dec, bin, sizeof(bin)) == 0);
+        for (i = 0; i < 250; i++) SSFBFifoPutByte(&fifo, 0);
+        SSF_ASSERT(SSFHexEncUpdateBFifo(&ctx, bin, 12, &fifo) == false);
+        SSFHexStreamDeInit(&ctx);
+        SSFHexStreamDeInit(&dctx);
+    }
+#endif /* SSF_HEX_CONFIG_ENABLE_STREAM */
 }
 #endif /* SSF_CONFIG_HEX_UNIT_TEST */
 
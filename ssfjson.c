@@ -31,6 +31,7 @@
 /* --------------------------------------------------------------------------------------------- */
 #include <stdio.h>
 #include <stdlib.h>
+#include <limits.h>
 #include "ssfsm.h"
 #include "ssfll.h"
 #include "ssfmpool.h"
@@ -40,8 +41,15 @@
 
 #if SSF_JSON_CONFIG_ENABLE_FLOAT_PARSE == 1
     #include <math.h> /* round() */
+    #include <float.h> /* FLT_EVAL_METHOD */
 #endif /* SSF_JSON_CONFIG_ENABLE_FLOAT_PARSE */
 
+#if SSF_JSON_CONFIG_SCAN == 2
+    #include <emmintrin.h>
+#elif SSF_JSON_CONFIG_SCAN == 3
+    #include <arm_neon.h>
+#endif /* SSF_JSON_CONFIG_SCAN */
+
 /* --------------------------------------------------------------------------------------------- */
 /* Defines                                                                                       */
 /* --------------------------------------------------------------------------------------------- */
@@ -50,6 +58,36 @@
                          ((e) == 'u'))
 #define SSFJsonEsc(j, b) do { j[start] = '\\'; start++; if (start >= size) return false; \
                               j[start] = b;} while (0)
+#define SSFJsonIsWhitespace(c) (((c) == ' ') || ((c) == '\n') || ((c) == '\r') || ((c) == '\t'))
+#define SSFJsonIsNumberChar(c) ((((c) >= '0') && ((c) <= '9')) || ((c) == '-') || \
+                                ((c) == '+') || ((c) == '.') || ((c) == 'e') || ((c) == 'E'))
+#define SSF_JSON_STREAM_MAGIC (0x4A53544Du)
+#define SSF_JSON_GEN_MAGIC (0x4A53474Eu)
+#define SSF_JSON_GEN_NUM_SIZE (64u)
+#define SSF_JSON_GEN_BIN_CHUNK (48u)
+#define SSF_JSON_SCHEMA_MAGIC (0x4A534348u)
+#define SSF_JSON_SCHEMA_MAX_SEEDS (4096u)
+#define SSF_JSON_NUM_MANT_MAX_DIV10 (1844674407370955161ull)
+#define SSF_JSON_NUM_EXP_MAX (100000l)
+#define SSF_JSON_DBL_HIDDEN (0x0010000000000000ull)
+#define SSF_JSON_DBL_SIGNIF (0x000FFFFFFFFFFFFFull)
+#define SSF_JSON_DBL_EXP (0x7FF0000000000000ull)
+#define SSF_JSON_DBL_SIGN (0x8000000000000000ull)
+#define SSFJsonUpdateIsExact(up) ((up)->match.path[(up)->match.depth] == NULL)
+#define SSFJsonUpdatePos(up) (SSFJsonUpdateIsExact(up) ? (up)->match.start : \
+                              ((up)->match.start + 1))
+#if SSF_JSON_CONFIG_SCAN == 1
+#define SSF_JSON_SCAN_WIDTH (8u)
+#define SSF_JSON_SWAR_ONES (0x0101010101010101ull)
+#define SSF_JSON_SWAR_LOW7 (0x7F7F7F7F7F7F7F7Full)
+#define SSF_JSON_SWAR_HIGH (0x8080808080808080ull)
+/* Sets the high bit of each byte in word w that equals c, exactly with no cross byte carries. */
+#define SSFJsonSwarEq(w, c) (~(((((w) ^ ((c) * SSF_JSON_SWAR_ONES)) & SSF_JSON_SWAR_LOW7) + \
+                               SSF_JSON_SWAR_LOW7) | ((w) ^ ((c) * SSF_JSON_SWAR_ONES))) & \
+                             SSF_JSON_SWAR_HIGH)
+#elif SSF_JSON_CONFIG_SCAN != 0
+#define SSF_JSON_SCAN_WIDTH (16u)
+#endif /* SSF_JSON_CONFIG_SCAN */
 #define SSF_JSON_COMMA(c) do { \
     if (((c) && (*c)) && (!_SSFJsonPrintUnescChar(js, size, start, &start, ','))) return false; \
     if (c) *c = true; } while (0);
@@ -57,6 +95,94 @@
 /* --------------------------------------------------------------------------------------------- */
 /* Structs                                                                                       */
 /* --------------------------------------------------------------------------------------------- */
+typedef struct SSFJsonGetManyCtx
+{
+    SSFJsonGet_t *gets;
+    size_t getsLen;
+} SSFJsonGetManyCtx_t;
+
+#if SSF_JSON_CONFIG_ENABLE_UPDATE == 1
+typedef struct SSFJsonUpdateManyCtx
+{
+    SSFJsonUpdate_t *ups;
+    size_t upsLen;
+    size_t first;
+    size_t depth;
+} SSFJsonUpdateManyCtx_t;
+#endif /* SSF_JSON_CONFIG_ENABLE_UPDATE */
+
+#if SSF_JSON_CONFIG_ENABLE_MINIFY == 1
+typedef struct SSFJsonMinOut
+{
+    SSFCStrOut_t out;
+    size_t size;
+    size_t len;
+#if SSF_JSON_CONFIG_ENABLE_GEN == 1
+    SSFJsonGen_t *gen;
+#endif /* SSF_JSON_CONFIG_ENABLE_GEN */
+} SSFJsonMinOut_t;
+#endif /* SSF_JSON_CONFIG_ENABLE_MINIFY */
+
+#if SSF_JSON_CONFIG_ENABLE_SCHEMA == 1
+typedef struct SSFJsonSchemaLevel
+{
+    const SSFJsonSchema_t *schema;  /* Schema of object value at this depth, NULL if not decoded */
+    const SSFJsonField_t *field;    /* Field matching key of value at this depth, NULL if unknown */
+    uint8_t *base;                  /* Where value at this depth is decoded */
+} SSFJsonSchemaLevel_t;
+
+typedef struct SSFJsonSchemaCtx
+{
+    SSFCStrIn_t js;
+    SSFJsonSchemaLevel_t level[SSF_JSON_CONFIG_MAX_IN_DEPTH + 1];
+    SSFJsonNum_t num;               /* Number last scanned by the walk */
+} SSFJsonSchemaCtx_t;
+#endif /* SSF_JSON_CONFIG_ENABLE_SCHEMA */
+
+typedef enum SSFJsonNumPart
+{
+    SSF_JSON_NUM_PART_INT,
+    SSF_JSON_NUM_PART_FRAC,
+    SSF_JSON_NUM_PART_EXP,
+} SSFJsonNumPart_t;
+
+typedef enum SSFJsonWalkEvent
+{
+    SSF_JSON_WALK_BEGIN,
+    SSF_JSON_WALK_END,
+} SSFJsonWalkEvent_t;
+
+/* Called at the begin and end of each value; begin provides key/keyLen, 0 for array elements. */
+typedef bool (*SSFJsonWalkFn_t)(void *ctx, SSFJsonWalkEvent_t ev, size_t depth, SSFJsonType_t jt,
+                                size_t key, size_t keyLen, size_t start, size_t end);
+
+#if SSF_JSON_CONFIG_ENABLE_STREAM == 1
+typedef enum SSFJsonStreamState
+{
+    SSF_JSON_STREAM_STATE_START,
+    SSF_JSON_STREAM_STATE_OPEN_OBJECT,
+    SSF_JSON_STREAM_STATE_KEY_START,
+    SSF_JSON_STREAM_STATE_KEY,
+    SSF_JSON_STREAM_STATE_COLON,
+    SSF_JSON_STREAM_STATE_OPEN_ARRAY,
+    SSF_JSON_STREAM_STATE_VALUE,
+    SSF_JSON_STREAM_STATE_STRING,
+    SSF_JSON_STREAM_STATE_NUMBER,
+    SSF_JSON_STREAM_STATE_LITERAL,
+    SSF_JSON_STREAM_STATE_AFTER_VALUE,
+    SSF_JSON_STREAM_STATE_DONE,
+    SSF_JSON_STREAM_STATE_ERROR,
+} SSFJsonStreamState_t;
+#endif /* SSF_JSON_CONFIG_ENABLE_STREAM */
+
+#if SSF_JSON_CONFIG_ENABLE_FLOAT_GEN == 1
+typedef struct SSFJsonDiyFp
+{
+    uint64_t f;
+    int e;
+} SSFJsonDiyFp_t;
+#endif /* SSF_JSON_CONFIG_ENABLE_FLOAT_GEN */
+
 typedef struct SSFJSONAddPath
 {
     SSFCStrIn_t *path;
@@ -65,92 +191,276 @@ typedef struct SSFJSONAddPath
 } SSFJSONAddPath_t;
 
 /* --------------------------------------------------------------------------------------------- */
-/* Local prototypes                                                                              */
+/* Module variables                                                                              */
+/* --------------------------------------------------------------------------------------------- */
+/* Decimal digit pairs "00" through "99" for integer formatting */
+static const char _SSFJsonDigitPairs[200] =
+{
+    '0','0','0','1','0','2','0','3','0','4','0','5','0','6','0','7','0','8','0','9',
+    '1','0','1','1','1','2','1','3','1','4','1','5','1','6','1','7','1','8','1','9',
+    '2','0','2','1','2','2','2','3','2','4','2','5','2','6','2','7','2','8','2','9',
+    '3','0','3','1','3','2','3','3','3','4','3','5','3','6','3','7','3','8','3','9',
+    '4','0','4','1','4','2','4','3','4','4','4','5','4','6','4','7','4','8','4','9',
+    '5','0','5','1','5','2','5','3','5','4','5','5','5','6','5','7','5','8','5','9',
+    '6','0','6','1','6','2','6','3','6','4','6','5','6','6','6','7','6','8','6','9',
+    '7','0','7','1','7','2','7','3','7','4','7','5','7','6','7','7','7','8','7','9',
+    '8','0','8','1','8','2','8','3','8','4','8','5','8','6','8','7','8','8','8','9',
+    '9','0','9','1','9','2','9','3','9','4','9','5','9','6','9','7','9','8','9','9',
+};
+
+#if SSF_JSON_CONFIG_ENABLE_FLOAT_PARSE == 1
+/* Powers of 10 that are exactly representable as doubles */
+static const double _SSFJsonExactPow10[23] =
+{
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16,
+    1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+};
+#endif /* SSF_JSON_CONFIG_ENABLE_FLOAT_PARSE */
+
+#if SSF_JSON_CONFIG_ENABLE_FLOAT_GEN == 1
+/* Normalized 64-bit significands and binary exponents of 10^-348, 10^-340, ..., 10^340 */
+static const uint64_t _SSFJsonCachedPowF[87] =
+{
+    0xfa8fd5a0081c0288ull, 0xbaaee17fa23ebf76ull, 0x8b16fb203055ac76ull,
+    0xcf42894a5dce35eaull, 0x9a6bb0aa55653b2dull, 0xe61acf033d1a45dfull,
+    0xab70fe17c79ac6caull, 0xff77b1fcbebcdc4full, 0xbe5691ef416bd60cull,
+    0x8dd01fad907ffc3cull, 0xd3515c2831559a83ull, 0x9d71ac8fada6c9b5ull,
+    0xea9c227723ee8bcbull, 0xaecc49914078536dull, 0x823c12795db6ce57ull,
+    0xc21094364dfb5637ull, 0x9096ea6f3848984full, 0xd77485cb25823ac7ull,
+    0xa086cfcd97bf97f4ull, 0xef340a98172aace5ull, 0xb23867fb2a35b28eull,
+    0x84c8d4dfd2c63f3bull, 0xc5dd44271ad3cdbaull, 0x936b9fcebb25c996ull,
+    0xdbac6c247d62a584ull, 0xa3ab66580d5fdaf6ull, 0xf3e2f893dec3f126ull,
+    0xb5b5ada8aaff80b8ull, 0x87625f056c7c4a8bull, 0xc9bcff6034c13053ull,
+    0x964e858c91ba2655ull, 0xdff9772470297ebdull, 0xa6dfbd9fb8e5b88full,
+    0xf8a95fcf88747d94ull, 0xb94470938fa89bcfull, 0x8a08f0f8bf0f156bull,
+    0xcdb02555653131b6ull, 0x993fe2c6d07b7facull, 0xe45c10c42a2b3b06ull,
+    0xaa242499697392d3ull, 0xfd87b5f28300ca0eull, 0xbce5086492111aebull,
+    0x8cbccc096f5088ccull, 0xd1b71758e219652cull, 0x9c40000000000000ull,
+    0xe8d4a51000000000ull, 0xad78ebc5ac620000ull, 0x813f3978f8940984ull,
+    0xc097ce7bc90715b3ull, 0x8f7e32ce7bea5c70ull, 0xd5d238a4abe98068ull,
+    0x9f4f2726179a2245ull, 0xed63a231d4c4fb27ull, 0xb0de65388cc8ada8ull,
+    0x83c7088e1aab65dbull, 0xc45d1df942711d9aull, 0x924d692ca61be758ull,
+    0xda01ee641a708deaull, 0xa26da3999aef774aull, 0xf209787bb47d6b85ull,
+    0xb454e4a179dd1877ull, 0x865b86925b9bc5c2ull, 0xc83553c5c8965d3dull,
+    0x952ab45cfa97a0b3ull, 0xde469fbd99a05fe3ull, 0xa59bc234db398c25ull,
+    0xf6c69a72a3989f5cull, 0xb7dcbf5354e9beceull, 0x88fcf317f22241e2ull,
+    0xcc20ce9bd35c78a5ull, 0x98165af37b2153dfull, 0xe2a0b5dc971f303aull,
+    0xa8d9d1535ce3b396ull, 0xfb9b7cd9a4a7443cull, 0xbb764c4ca7a44410ull,
+    0x8bab8eefb6409c1aull, 0xd01fef10a657842cull, 0x9b10a4e5e9913129ull,
+    0xe7109bfba19c0c9dull, 0xac2820d9623bf429ull, 0x80444b5e7aa7cf85ull,
+    0xbf21e44003acdd2dull, 0x8e679c2f5e44ff8full, 0xd433179d9c8cb841ull,
+    0x9e19db92b4e31ba9ull, 0xeb96bf6ebadf77d9ull, 0xaf87023b9bf0ee6bull,
+};
+static const int16_t _SSFJsonCachedPowE[87] =
+{
+    -1220, -1193, -1166, -1140, -1113, -1087, -1060, -1034, -1007, -980, -954, -927,
+    -901, -874, -847, -821, -794, -768, -741, -715, -688, -661, -635, -608,
+    -582, -555, -529, -502, -475, -449, -422, -396, -369, -343, -316, -289,
+    -263, -236, -210, -183, -157, -130, -103, -77, -50, -24, 3, 30,
+    56, 83, 109, 136, 162, 189, 216, 242, 269, 295, 322, 348,
+    375, 402, 428, 455, 481, 508, 534, 561, 588, 614, 641, 667,
+    694, 720, 747, 774, 800, 827, 853, 880, 907, 933, 960, 986,
+    1013, 1039, 1066,
+};
+static const uint64_t _SSFJsonPow10[20] =
+{
+    1ull, 10ull, 100ull, 1000ull, 10000ull, 100000ull, 1000000ull, 10000000ull, 100000000ull,
+    1000000000ull, 10000000000ull, 100000000000ull, 1000000000000ull, 10000000000000ull,
+    100000000000000ull, 1000000000000000ull, 10000000000000000ull, 100000000000000000ull,
+    1000000000000000000ull, 10000000000000000000ull,
+};
+#endif /* SSF_JSON_CONFIG_ENABLE_FLOAT_GEN */
+
+#if SSF_JSON_CONFIG_SCAN != 0
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if all SSF_JSON_SCAN_WIDTH bytes at js are whitespace, else false.               */
+/* --------------------------------------------------------------------------------------------- */
+static bool _SSFJsonScanIsWhitespace(SSFCStrIn_t js)
+{
+#if SSF_JSON_CONFIG_SCAN == 1
+    uint64_t w;
+
+    memcpy(&w, js, sizeof(w));
+    return (SSFJsonSwarEq(w, ' ') | SSFJsonSwarEq(w, '\n') | SSFJsonSwarEq(w, '\r') |
+            SSFJsonSwarEq(w, '\t')) == SSF_JSON_SWAR_HIGH;
+#elif SSF_JSON_CONFIG_SCAN == 2
+    __m128i v = _mm_loadu_si128((const __m128i *)js);
+    __m128i m;
+
+    m = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(' ')),
+                                  _mm_cmpeq_epi8(v, _mm_set1_epi8('\n'))),
+                     _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('\r')),
+                                  _mm_cmpeq_epi8(v, _mm_set1_epi8('\t'))));
+    return _mm_movemask_epi8(m) == 0xFFFF;
+#else
+    uint8x16_t v = vld1q_u8((const uint8_t *)js);
+    uint8x16_t m;
+
+    m = vorrq_u8(vorrq_u8(vceqq_u8(v, vdupq_n_u8(' ')), vceqq_u8(v, vdupq_n_u8('\n'))),
+                 vorrq_u8(vceqq_u8(v, vdupq_n_u8('\r')), vceqq_u8(v, vdupq_n_u8('\t'))));
+    return vminvq_u8(m) == 0xFF;
+#endif /* SSF_JSON_CONFIG_SCAN */
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if no '"', '\\', or NULL is in the SSF_JSON_SCAN_WIDTH bytes at js, else false.   */
 /* --------------------------------------------------------------------------------------------- */
-static bool _SSFJsonValue(SSFCStrIn_t js, size_t *index, size_t *start, size_t *end,
-                          SSFCStrIn_t *path, uint8_t depth, SSFJsonType_t *jt); 
+static bool _SSFJsonScanIsPlain(SSFCStrIn_t js)
+{
+#if SSF_JSON_CONFIG_SCAN == 1
+    uint64_t w;
+
+    memcpy(&w, js, sizeof(w));
+    return (SSFJsonSwarEq(w, '"') | SSFJsonSwarEq(w, '\\') | SSFJsonSwarEq(w, 0)) == 0;
+#elif SSF_JSON_CONFIG_SCAN == 2
+    __m128i v = _mm_loadu_si128((const __m128i *)js);
+    __m128i m;
+
+    m = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('"')),
+                                  _mm_cmpeq_epi8(v, _mm_set1_epi8('\\'))),
+                     _mm_cmpeq_epi8(v, _mm_setzero_si128()));
+    return _mm_movemask_epi8(m) == 0;
+#else
+    uint8x16_t v = vld1q_u8((const uint8_t *)js);
+    uint8x16_t m;
+
+    m = vorrq_u8(vorrq_u8(vceqq_u8(v, vdupq_n_u8('"')), vceqq_u8(v, vdupq_n_u8('\\'))),
+                 vceqq_u8(v, vdupq_n_u8(0)));
+    return vmaxvq_u8(m) == 0;
+#endif /* SSF_JSON_CONFIG_SCAN */
+}
+#endif /* SSF_JSON_CONFIG_SCAN */
 
 /* --------------------------------------------------------------------------------------------- */
-/* Increments index past whitespace in JSON string                                               */
+/* Increments index past whitespace in JSON string; Bytes js[0..len-1] must be readable.         */
 /* --------------------------------------------------------------------------------------------- */
-static void _SSFJsonWhitespace(SSFCStrIn_t js, size_t *index)
+static void _SSFJsonWhitespace(SSFCStrIn_t js, size_t len, size_t *index)
 {
     SSF_REQUIRE(js != NULL);
     SSF_REQUIRE(index != NULL);
 
-    while ((js[*index] == ' ') || (js[*index] == '\n') || (js[*index] == '\r') ||
-           (js[*index] == '\t')) (*index)++;
+    if (!SSFJsonIsWhitespace(js[*index])) return;
+#if SSF_JSON_CONFIG_SCAN != 0
+    while ((((*index) + SSF_JSON_SCAN_WIDTH) <= len) && _SSFJsonScanIsWhitespace(&js[*index]))
+    {(*index) += SSF_JSON_SCAN_WIDTH; }
+#else
+    SSF_UNUSED(len);
+#endif /* SSF_JSON_CONFIG_SCAN */
+    while (SSFJsonIsWhitespace(js[*index])) (*index)++;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Accumulates decimal digit d of part of a number into num.                                     */
+/* --------------------------------------------------------------------------------------------- */
+static void _SSFJsonNumberDigit(SSFJsonNum_t *num, SSFJsonNumPart_t part, uint8_t d)
+{
+    if (part == SSF_JSON_NUM_PART_EXP)
+    {
+        /* Saturate, any larger exponent overflows or underflows all supported types */
+        if (num->exp < SSF_JSON_NUM_EXP_MAX) num->exp = (num->exp * 10) + d;
+    }
+    else if ((num->mant < SSF_JSON_NUM_MANT_MAX_DIV10) ||
+             ((num->mant == SSF_JSON_NUM_MANT_MAX_DIV10) && (d <= 5)))
+    {
+        /* Digit fits in mantissa without overflow */
+        num->mant = (num->mant * 10) + d;
+        if (part == SSF_JSON_NUM_PART_FRAC) num->exp10--;
+    }
+    else if (part == SSF_JSON_NUM_PART_INT)
+    {
+        /* Integer digit dropped, scale up instead */
+        if (num->exp10 < SSF_JSON_NUM_EXP_MAX) num->exp10++;
+    }
 }
 
 /* --------------------------------------------------------------------------------------------- */
 /* Returns true and start/end index if 1 or more digits 0-9 found in JSON string, else false.    */
 /* --------------------------------------------------------------------------------------------- */
-static bool _SSFJsonNumberIsDigits(SSFCStrIn_t js, size_t *index, size_t *end)
+static bool _SSFJsonNumberIsDigits(SSFCStrIn_t js, size_t *index, size_t *end, SSFJsonNum_t *num,
+                                   SSFJsonNumPart_t part)
 {
     bool foundDig = false;
     while ((js[*index] >= '0') && (js[*index] <= '9'))
-    {(*index)++; foundDig = true; }
+    {
+        if (num != NULL) _SSFJsonNumberDigit(num, part, (uint8_t)(js[*index] - '0'));
+        (*index)++; foundDig = true;
+    }
     if (foundDig == true) *end = *index - 1;
     return foundDig;
 }
 
 /* --------------------------------------------------------------------------------------------- */
-/* Returns true and start/end index if number found in JSON string, else false.                  */
+/* Returns true and start/end index if number found in JSON string, else false; Sets num if !NULL*/
 /* --------------------------------------------------------------------------------------------- */
-static bool _SSFJsonNumber(SSFCStrIn_t js, size_t *index, size_t *start, size_t *end)
+static bool _SSFJsonNumber(SSFCStrIn_t js, size_t *index, size_t *start, size_t *end,
+                           SSFJsonNum_t *num)
 {
+    bool expNeg = false;
+
     SSF_REQUIRE(js != NULL);
     SSF_REQUIRE(index != NULL);
     SSF_REQUIRE(start != NULL);
     SSF_REQUIRE(end != NULL);
 
+    if (num != NULL) {memset(num, 0, sizeof(SSFJsonNum_t)); num->isInt = true; }
     if ((js[*index] != '-') && !((js[*index] >= '0') && (js[*index] <= '9'))) return false;
     *start = *index;
-    if (js[*index] == '-') (*index)++;
+    if (js[*index] == '-') {(*index)++; if (num != NULL) num->neg = true; }
     if (js[*index] != '0')
-    {if (!_SSFJsonNumberIsDigits(js, index, end)) return false; } else
+    {if (!_SSFJsonNumberIsDigits(js, index, end, num, SSF_JSON_NUM_PART_INT)) return false; } else
     {(*index)++; }
     if (js[*index] == '.')
-    {(*index)++; if (!_SSFJsonNumberIsDigits(js, index, end)) return false; }
+    {
+        (*index)++;
+        if (num != NULL) num->isInt = false;
+        if (!_SSFJsonNumberIsDigits(js, index, end, num, SSF_JSON_NUM_PART_FRAC)) return false;
+    }
     if ((js[*index] == 'e') || (js[*index] == 'E'))
     {
         (*index)++;
+        if (num != NULL) num->isInt = false;
+        if (js[*index] == '-') expNeg = true;
         if ((js[*index] == '-') || (js[*index] == '+')) (*index)++;
-        return _SSFJsonNumberIsDigits(js, index, end);
+        if (!_SSFJsonNumberIsDigits(js, index, end, num, SSF_JSON_NUM_PART_EXP)) return false;
     }
     *end = *index - 1;
+    if (num != NULL) num->exp10 += expNeg ? -num->exp : num->exp;
     return true;
 }
 
 /* --------------------------------------------------------------------------------------------- */
 /* Returns true and start/end index if string found, else false.                                 */
 /* --------------------------------------------------------------------------------------------- */
-static bool _SSFJsonString(SSFCStrIn_t js, size_t *index, size_t *start, size_t *end)
+static bool _SSFJsonString(SSFCStrIn_t js, size_t len, size_t *index, size_t *start, size_t *end)
 {
     SSF_REQUIRE(js != NULL);
     SSF_REQUIRE(index != NULL);
     SSF_REQUIRE(start != NULL);
     SSF_REQUIRE(end != NULL);
 
-    _SSFJsonWhitespace(js, index);
+    _SSFJsonWhitespace(js, len, index);
     if (js[*index] != '"') return false;
     *start = *index;
     (*index)++;
-    while ((js[*index] != 0) && (js[*index] != '"'))
-    {
-        if (js[*index] == '\\')
-        {
-            (*index)++;
-            if (!SSFJsonIsEsc(js[*index])) return false;
-            if (js[*index] != 'u')
-            {(*index)++; continue; }
-            (*index)++;
-            if (!SSFIsHex(js[*index])) return false;
-            if (!SSFIsHex(js[(*index) + 1])) return false;
-            if (!SSFIsHex(js[(*index) + 2])) return false;
-            if (!SSFIsHex(js[(*index) + 3])) return false;
-            (*index) += 4;
-        } else (*index)++;
+    while (true)
+    {
+#if SSF_JSON_CONFIG_SCAN != 0
+        /* Skip runs of characters that cannot end the string or start an escape */
+        while ((((*index) + SSF_JSON_SCAN_WIDTH) <= len) && _SSFJsonScanIsPlain(&js[*index]))
+        {(*index) += SSF_JSON_SCAN_WIDTH; }
+#endif /* SSF_JSON_CONFIG_SCAN */
+        while ((js[*index] != 0) && (js[*index] != '"') && (js[*index] != '\\')) (*index)++;
+        if (js[*index] != '\\') break;
+        (*index)++;
+        if (!SSFJsonIsEsc(js[*index])) return false;
+        if (js[*index] != 'u')
+        {(*index)++; continue; }
+        (*index)++;
+        if (!SSFIsHex(js[*index])) return false;
+        if (!SSFIsHex(js[(*index) + 1])) return false;
+        if (!SSFIsHex(js[(*index) + 2])) return false;
+        if (!SSFIsHex(js[(*index) + 3])) return false;
+        (*index) += 4;
     }
     if (js[*index] != '"') return false;
     *end = (*index);
@@ -159,116 +469,238 @@ static bool _SSFJsonString(SSFCStrIn_t js, size_t *index, size_t *start, size_t
 }
 
 /* --------------------------------------------------------------------------------------------- */
-/* Returns true if array found, else false; If true returns type/start/end on path index match.  */
+/* Returns true if key and ':' found, else false; If true returns start index and len of key.    */
+/* --------------------------------------------------------------------------------------------- */
+static bool _SSFJsonWalkKey(SSFCStrIn_t js, size_t len, size_t *index, size_t *key,
+                            size_t *keyLen)
+{
+    size_t start;
+    size_t end;
+
+    if (!_SSFJsonString(js, len, index, &start, &end)) return false;
+    _SSFJsonWhitespace(js, len, index);
+    if (js[*index] != ':') return false;
+    (*index)++;
+    *key = start + 1;
+    *keyLen = end - start - 1;
+    return true;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if value at index is valid, else false; Calls fn at begin and end of each value. */
+/* If num not NULL each number is accumulated into it before its end event.                      */
 /* --------------------------------------------------------------------------------------------- */
-static bool _SSFJsonArray(SSFCStrIn_t js, size_t *index, size_t *start, size_t *end,
-                          SSFCStrIn_t *path, uint8_t depth, SSFJsonType_t *jt)
+static bool _SSFJsonWalk(SSFCStrIn_t js, size_t len, size_t *index, uint8_t *stack,
+                         size_t maxDepth, SSFJsonWalkFn_t fn, void *ctx, SSFJsonNum_t *num)
 {
-    size_t valStart;
-    size_t valEnd;
-    size_t curIndex = 0;
-    size_t pindex = (size_t)-1;
-    SSFJsonType_t djt;
+    size_t i;
+    size_t depth = 0;
+    size_t key = 0;
+    size_t keyLen = 0;
+    size_t start;
+    size_t end;
+    SSFJsonType_t jt;
+    bool isArray;
 
     SSF_REQUIRE(js != NULL);
     SSF_REQUIRE(index != NULL);
-    SSF_REQUIRE(start != NULL);
-    SSF_REQUIRE(end != NULL);
-    SSF_REQUIRE(depth >= 1);
-    SSF_REQUIRE(jt != NULL);
-
-    if (depth >= SSF_JSON_CONFIG_MAX_IN_DEPTH) return false;
-    _SSFJsonWhitespace(js, index);
-    if (js[*index] != '[') return false;
-    if ((path != NULL) && (path[depth] == NULL)) *start = *index;
-    (*index)++;
+    SSF_REQUIRE(stack != NULL);
 
-    if ((path != NULL) && (path[depth] != NULL)) memcpy(&pindex, path[depth], sizeof(size_t));
-    while (_SSFJsonValue(js, index, &valStart, &valEnd, path, depth, &djt) == true)
+    i = *index;
+    while (true)
     {
-        if (pindex == curIndex)
-        {*start = valStart; *end = valEnd; *jt = djt; }
-        _SSFJsonWhitespace(js, index);
-        if (js[*index] == ']') break;
-        if (js[*index] != ',') return false;
-        (*index)++;
-        curIndex++;
-    }
-    if ((pindex != (size_t)-1) && (pindex > curIndex)) *jt = SSF_JSON_TYPE_ERROR;
-    if (js[*index] != ']') return false;
+        /* Expecting a value */
+        _SSFJsonWhitespace(js, len, &i);
+        start = i;
+        if ((js[i] == '{') || (js[i] == '['))
+        {
+            /* Open object or array, pushing its type on to the depth stack */
+            isArray = (js[i] == '[');
+            jt = isArray ? SSF_JSON_TYPE_ARRAY : SSF_JSON_TYPE_OBJECT;
+            if (depth >= maxDepth) return false;
+            if ((fn != NULL) && (!fn(ctx, SSF_JSON_WALK_BEGIN, depth, jt, key, keyLen, start, i)))
+            {return false; }
+            if (isArray) stack[depth >> 3] |= (uint8_t)(1u << (depth & 7));
+            else stack[depth >> 3] &= (uint8_t)~(1u << (depth & 7));
+            depth++;
+            i++;
+            _SSFJsonWhitespace(js, len, &i);
+            if (js[i] != (isArray ? ']' : '}'))
+            {
+                key = 0; keyLen = 0;
+                if ((!isArray) && (!_SSFJsonWalkKey(js, len, &i, &key, &keyLen))) return false;
+                continue;
+            }
+        }
+        else
+        {
+            if ((fn != NULL) &&
+                (!fn(ctx, SSF_JSON_WALK_BEGIN, depth, SSF_JSON_TYPE_ERROR, key, keyLen, start, i)))
+            {return false; }
+            if (_SSFJsonString(js, len, &i, &start, &end)) jt = SSF_JSON_TYPE_STRING;
+            else if (_SSFJsonNumber(js, &i, &start, &end, num)) jt = SSF_JSON_TYPE_NUMBER;
+            else if (strncmp(&js[i], "true", 4) == 0) {jt = SSF_JSON_TYPE_TRUE; i += 4; }
+            else if (strncmp(&js[i], "false", 5) == 0) {jt = SSF_JSON_TYPE_FALSE; i += 5; }
+            else if (strncmp(&js[i], "null", 4) == 0) {jt = SSF_JSON_TYPE_NULL; i += 4; }
+            else return false;
+            end = i - 1;
+            if ((fn != NULL) && (!fn(ctx, SSF_JSON_WALK_END, depth, jt, key, keyLen, start, end)))
+            {return false; }
+        }
 
-    if ((path != NULL) && (path[depth] == NULL)) {*end = *index; *jt = SSF_JSON_TYPE_ARRAY; }
-    (*index)++;
+        /* Expecting a comma, or the close of one or more objects or arrays */
+        while (depth != 0)
+        {
+            isArray = (stack[(depth - 1) >> 3] & (1u << ((depth - 1) & 7))) != 0;
+            _SSFJsonWhitespace(js, len, &i);
+            if (js[i] == ',')
+            {
+                i++;
+                key = 0; keyLen = 0;
+                if ((!isArray) && (!_SSFJsonWalkKey(js, len, &i, &key, &keyLen))) return false;
+                break;
+            }
+            if (js[i] != (isArray ? ']' : '}')) return false;
+            depth--;
+            jt = isArray ? SSF_JSON_TYPE_ARRAY : SSF_JSON_TYPE_OBJECT;
+            if ((fn != NULL) && (!fn(ctx, SSF_JSON_WALK_END, depth, jt, 0, 0, i, i))) return false;
+            i++;
+        }
+        if (depth == 0) break;
+    }
+    *index = i;
     return true;
 }
 
 /* --------------------------------------------------------------------------------------------- */
-/* Returns true if value found, else false; If true returns type/start/end on path match.        */
+/* Returns true if JSON string is an object within length and depth limits, else false.          */
 /* --------------------------------------------------------------------------------------------- */
-static bool _SSFJsonValue(SSFCStrIn_t js, size_t *index, size_t *start, size_t *end,
-                          SSFCStrIn_t *path, uint8_t depth, SSFJsonType_t *jt)
+static bool _SSFJsonWalkRoot(SSFCStrIn_t js, size_t *index, uint8_t *stack, size_t maxDepth,
+                             SSFJsonWalkFn_t fn, void *ctx, SSFJsonNum_t *num)
 {
     size_t i;
 
+    for (i = 0; (i <= SSF_JSON_CONFIG_MAX_IN_LEN) && (js[i] != 0); i++);
+    if (i > SSF_JSON_CONFIG_MAX_IN_LEN) return false;
+
+    *index = 0;
+    _SSFJsonWhitespace(js, i, index);
+    if (js[*index] != '{') return false;
+    if (!_SSFJsonWalk(js, i, index, stack, maxDepth, fn, ctx, num)) return false;
+    _SSFJsonWhitespace(js, i, index);
+    return js[*index] == 0;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true to continue walk; Finds the value at the end of a path.                          */
+/* --------------------------------------------------------------------------------------------- */
+static bool _SSFJsonWalkPathFn(void *ctx, SSFJsonWalkEvent_t ev, size_t depth, SSFJsonType_t jt,
+                               size_t key, size_t keyLen, size_t start, size_t end)
+{
+    SSFJsonPathMatch_t *pm = (SSFJsonPathMatch_t *)ctx;
+    size_t pindex;
+    bool match;
+
+    SSF_REQUIRE(ctx != NULL);
+
+    if (pm->done) return true;
+    if (ev == SSF_JSON_WALK_BEGIN)
+    {
+        if (depth == 0) {pm->depth = 0; pm->aindex = 0; pm->start = start; return true; }
+        if ((depth != (pm->depth + 1)) || (pm->path[pm->depth] == NULL)) return true;
+
+        /* Child of last matched value, check if it matches the next path element */
+        if (key != 0)
+        {
+            match = strncmp(pm->path[pm->depth], &pm->js[key],
+                            SSF_MAX(keyLen, strlen(pm->path[pm->depth]))) == 0;
+        }
+        else
+        {
+            memcpy(&pindex, pm->path[pm->depth], sizeof(size_t));
+            match = (pindex == pm->aindex);
+            pm->aindex++;
+        }
+        if (match) {pm->depth = depth; pm->aindex = 0; pm->start = start; }
+    }
+    else if (depth == pm->depth)
+    {
+        /* Last matched value ended, it is the result if the path ends here */
+        if (pm->path[depth] == NULL)
+        {
+            pm->jt = jt;
+            if ((jt != SSF_JSON_TYPE_OBJECT) && (jt != SSF_JSON_TYPE_ARRAY)) pm->start = start;
+            pm->end = end;
+            if ((jt == SSF_JSON_TYPE_NUMBER) && (pm->cur != NULL)) pm->num = *pm->cur;
+        }
+        pm->done = true;
+    }
+    return true;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if JSON string is valid, else false; Uses caller supplied depth stack.           */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFJsonIsValidStack(SSFCStrIn_t js, uint8_t *stack, size_t stackSize)
+{
+    size_t index;
+
     SSF_REQUIRE(js != NULL);
-    SSF_REQUIRE(index != NULL);
-    SSF_REQUIRE(start != NULL);
-    SSF_REQUIRE(end != NULL);
-    SSF_REQUIRE(jt != NULL);
+    SSF_REQUIRE(stack != NULL);
+    SSF_REQUIRE(stackSize > 0);
 
-    _SSFJsonWhitespace(js, index); i = *index;
-    if (_SSFJsonString(js, &i, start, end)) {*jt = SSF_JSON_TYPE_STRING; *index = i; return true; }
-    i = *index;
-    if (SSFJsonObject(js, &i, start, end, path, depth + 1, jt)) {*index = i; return true; }
-    i = *index;
-    if (_SSFJsonArray(js, &i, start, end, path, depth + 1, jt)) {*index = i; return true; }
-    i = *index;
-    if (_SSFJsonNumber(js, &i, start, end)) {*jt = SSF_JSON_TYPE_NUMBER; *index = i; return true; }
-    i = *index;
-    if (strncmp(&js[i], "true", 4) == 0)
-    {*jt = SSF_JSON_TYPE_TRUE; *start = i; i += 4; *end = i - 1; *index = i; return true; }
-    i = *index;
-    if (strncmp(&js[i], "false", 5) == 0)
-    {*jt = SSF_JSON_TYPE_FALSE; *start = i; i += 5; *end = i - 1; *index = i; return true; }
-    i = *index;
-    if (strncmp(&js[i], "null", 4) == 0)
-    {*jt = SSF_JSON_TYPE_NULL; *start = i; i += 4; *end = i - 1; *index = i; return true; }
-    return false;
+    return _SSFJsonWalkRoot(js, &index, stack, stackSize << 3, NULL, NULL, NULL);
 }
 
 /* --------------------------------------------------------------------------------------------- */
-/* Returns true if name/value found, else false; If true returns type/start/end on path match.   */
+/* Returns true if object found, else false; If true returns type/start/end on path match.       */
+/* If num not NULL and a number matches path its value is returned in num.                       */
 /* --------------------------------------------------------------------------------------------- */
-static bool _SSFJsonNameValue(SSFCStrIn_t js, size_t *index, size_t *start, size_t *end,
-                              SSFCStrIn_t *path, uint8_t depth, SSFJsonType_t *jt)
+static bool _SSFJsonObject(SSFCStrIn_t js, size_t *index, size_t *start, size_t *end,
+                           SSFCStrIn_t *path, SSFJsonType_t *jt, SSFJsonNum_t *num)
 {
-    size_t valStart;
-    size_t valEnd;
-    SSFJsonType_t djt;
+    uint8_t stack[SSF_JSON_STACK_SIZE(SSF_JSON_CONFIG_MAX_WALK_DEPTH)];
+    SSFJsonPathMatch_t pm;
+    SSFJsonNum_t cur;
 
     SSF_REQUIRE(js != NULL);
     SSF_REQUIRE(index != NULL);
     SSF_REQUIRE(start != NULL);
     SSF_REQUIRE(end != NULL);
     SSF_REQUIRE(jt != NULL);
+    SSF_REQUIRE((path == NULL) || (path[SSF_JSON_CONFIG_MAX_IN_DEPTH] == NULL));
 
-    if (_SSFJsonString(js, index, &valStart, &valEnd) == false) return false;
-    _SSFJsonWhitespace(js, index);
-    if (js[*index] != ':') return false;
-    (*index)++;
-    if ((path != NULL) && (path[depth] != NULL) &&
-        (strncmp(path[depth], &js[valStart + 1],
-                 SSF_MAX(valEnd - valStart - 1, (size_t)strlen(path[depth]))) == 0))
-    {return _SSFJsonValue(js, index, start, end, path, depth, jt); }
-    else return _SSFJsonValue(js, index, &valStart, &valEnd, NULL, 0, &djt);
+    *jt = SSF_JSON_TYPE_ERROR;
+    if (path == NULL)
+    {
+        return _SSFJsonWalkRoot(js, index, stack, SSF_JSON_CONFIG_MAX_WALK_DEPTH, NULL, NULL,
+                                NULL);
+    }
+    memset(&pm, 0, sizeof(pm));
+    pm.js = js;
+    pm.path = path;
+    pm.jt = SSF_JSON_TYPE_ERROR;
+    if (num != NULL) pm.cur = &cur;
+    if (!_SSFJsonWalkRoot(js, index, stack, SSF_JSON_CONFIG_MAX_WALK_DEPTH, _SSFJsonWalkPathFn,
+                          &pm, (num != NULL) ? &cur : NULL)) return false;
+    if (pm.jt != SSF_JSON_TYPE_ERROR) {*start = pm.start; *end = pm.end; *jt = pm.jt; }
+    if ((num != NULL) && (pm.jt == SSF_JSON_TYPE_NUMBER)) *num = pm.num;
+    return true;
 }
 
 /* --------------------------------------------------------------------------------------------- */
 /* Returns true if object found, else false; If true returns type/start/end on path match.       */
+/* If depth is not 0 the object at index is parsed and matched against path from path[depth].    */
 /* --------------------------------------------------------------------------------------------- */
 bool SSFJsonObject(SSFCStrIn_t js, size_t *index, size_t *start, size_t *end, SSFCStrIn_t *path,
                    uint8_t depth, SSFJsonType_t *jt)
 {
+    uint8_t stack[SSF_JSON_STACK_SIZE(SSF_JSON_CONFIG_MAX_WALK_DEPTH)];
+    SSFJsonPathMatch_t pm;
+    size_t len;
+
+    if (depth == 0) return _SSFJsonObject(js, index, start, end, path, jt, NULL);
+
     SSF_REQUIRE(js != NULL);
     SSF_REQUIRE(index != NULL);
     SSF_REQUIRE(start != NULL);
@@ -276,40 +708,23 @@ bool SSFJsonObject(SSFCStrIn_t js, size_t *index, size_t *start, size_t *end, SS
     SSF_REQUIRE(jt != NULL);
     SSF_REQUIRE((path == NULL) || (path[SSF_JSON_CONFIG_MAX_IN_DEPTH] == NULL));
 
-    if (depth == 0)
-    {
-        uint32_t i;
-        for (i = 0; (i <= SSF_JSON_CONFIG_MAX_IN_LEN) && (js[i] != 0); i++);
-        if (i > SSF_JSON_CONFIG_MAX_IN_LEN) return false;
-        *jt = SSF_JSON_TYPE_ERROR;
-        *index = 0;
-    }
+    /* Nested object, jt is only updated on a match and text may follow it */
     if (depth >= SSF_JSON_CONFIG_MAX_IN_DEPTH) return false;
-
-    _SSFJsonWhitespace(js, index);
+    len = *index + strlen(&js[*index]);
+    _SSFJsonWhitespace(js, len, index);
     if (js[*index] != '{') return false;
-    if ((depth != 0) || ((depth == 0) && (path != NULL) && (path[0] == NULL))) *start = *index;
-    (*index)++;
-    _SSFJsonWhitespace(js, index);
-    if (js[*index] != '}')
-    {
-        if (!_SSFJsonNameValue(js, index, start, end, path, depth, jt)) return false;
-        do
-        {
-            _SSFJsonWhitespace(js, index);
-            if (js[*index] == '}') break;
-            if (js[*index] != ',') return false;
-            (*index)++;
-            if (!_SSFJsonNameValue(js, index, start, end, path, depth, jt)) return false;
-        } while (true);
-        if (js[*index] != '}') return false;
-    }
-    if (((path != NULL) && (path[depth] == NULL)) ||
-        ((depth == 0) && (path != NULL) && (path[0] == NULL)))
-    {*end = *index; *jt = SSF_JSON_TYPE_OBJECT; }
-    (*index)++;
-    if (depth == 0)
-    {_SSFJsonWhitespace(js, index); if (js[*index] != 0) return false; }
+    if (path == NULL)
+    {
+        return _SSFJsonWalk(js, len, index, stack, SSF_JSON_CONFIG_MAX_WALK_DEPTH - depth, NULL,
+                            NULL, NULL);
+    }
+    memset(&pm, 0, sizeof(pm));
+    pm.js = js;
+    pm.path = &path[depth];
+    pm.jt = SSF_JSON_TYPE_ERROR;
+    if (!_SSFJsonWalk(js, len, index, stack, SSF_JSON_CONFIG_MAX_WALK_DEPTH - depth,
+                      _SSFJsonWalkPathFn, &pm, NULL)) return false;
+    if (pm.jt != SSF_JSON_TYPE_ERROR) {*start = pm.start; *end = pm.end; *jt = pm.jt; }
     return true;
 }
 
@@ -350,164 +765,465 @@ SSFJsonType_t SSFJsonGetType(SSFCStrIn_t js, SSFCStrIn_t *path)
 }
 
 /* --------------------------------------------------------------------------------------------- */
-/* Returns true if found and is unescaped completely into buffer w/NULL term., else false.       */
+/* Returns true if 4 hex digits at in are converted to a UTF-16 code unit, else false.           */
 /* --------------------------------------------------------------------------------------------- */
-bool SSFJsonGetString(SSFCStrIn_t js, SSFCStrIn_t *path, char *out, size_t outSize,
-                      size_t *outLen)
+static bool _SSFJsonUnescHex4(SSFCStrIn_t in, uint32_t *out)
 {
-    size_t start;
-    size_t end;
-    size_t index;
-    size_t len;
-    SSFJsonType_t jt;
-
-    SSF_REQUIRE(js != NULL);
-    SSF_REQUIRE(path != NULL);
-    SSF_REQUIRE(path[SSF_JSON_CONFIG_MAX_IN_DEPTH] == NULL);
-    SSF_REQUIRE(out != NULL);
-
-    if (!SSFJsonObject(js, &index, &start, &end, path, 0, &jt)) return false;
-    if (jt != SSF_JSON_TYPE_STRING) return false;
-    start++; end--;
+    uint8_t hi;
+    uint8_t lo;
 
-    index = 0;
-    len = end - start + 1;
-    if (outLen != NULL) *outLen = 0;
-
-    while ((len != 0) && (index < (outSize - 1)))
-    {
-        if (js[start] == '\\')
-        {
-            start++; len--;
-            if (len == 0) return false;
-            /* Potential escape sequence */
-            if (js[start] == '"' || js[start] == '\\' || js[start] == '/')
-            {out[index] = js[start]; }
-            else if (js[start] == 'n') out[index] = '\x0a';
-            else if (js[start] == 'r') out[index] = '\x0d';
-            else if (js[start] == 't') out[index] = '\x09';
-            else if (js[start] == 'f') out[index] = '\x0c';
-            else if (js[start] == 'b') out[index] = '\x08';
-            else if (js[start] != 'u') return false;
-
-            if (outLen != NULL) (*outLen)++;
-            start++; len--;
-            if (len < 4) return false;
-            if (index >= (outSize - 1 - 2)) return false;
-            if (!SSFHexByteToBin(&js[start], (uint8_t *)&out[index])) return false;
-            index++;
-            if (!SSFHexByteToBin(&js[start + 2], (uint8_t *)&out[index])) return false;
-            start += 3; len -= 3;
-        }
-        else { out[index] = js[start]; }
-        if (outLen != NULL) (*outLen)++;
-        start++; index++; len--;
-    }
-    if (index < outSize) out[index] = 0;
-    return len == 0;
+    if (!SSFHexByteToBin(in, &hi)) return false;
+    if (!SSFHexByteToBin(&in[2], &lo)) return false;
+    *out = (((uint32_t)hi) << 8) | lo;
+    return true;
 }
 
-#if SSF_JSON_CONFIG_ENABLE_FLOAT_PARSE == 1
 /* --------------------------------------------------------------------------------------------- */
-/* Returns true if found and is converted to double, else false.                                 */
+/* Returns true if escape sequence at in[*i] is decoded into 1 to 4 UTF-8 bytes, else false.     */
 /* --------------------------------------------------------------------------------------------- */
-bool SSFJsonGetDouble(SSFCStrIn_t js, SSFCStrIn_t *path, double *out)
+static bool _SSFJsonUnescNext(SSFCStrIn_t in, size_t len, size_t *i, uint8_t *utf8,
+                              size_t *utf8Len)
 {
-    size_t index;
-    size_t start;
-    size_t end;
-    SSFJsonType_t jt;
-    char *endptr;
+    uint32_t cp;
+    uint32_t lo;
 
-    SSF_REQUIRE(js != NULL);
-    SSF_REQUIRE(path != NULL);
-    SSF_REQUIRE(path[SSF_JSON_CONFIG_MAX_IN_DEPTH] == NULL);
-    SSF_REQUIRE(out != NULL);
+    SSF_REQUIRE(in[*i] == '\\');
 
-    if (!SSFJsonObject(js, &index, &start, &end, path, 0, &jt)) return false;
-    if (jt != SSF_JSON_TYPE_NUMBER) return false;
-    *out = strtod(&js[start], &endptr);
-    if ((endptr - 1) != &js[end]) return false;
+    (*i)++;
+    if (*i >= len) return false;
+    *utf8Len = 1;
+    switch (in[*i])
+    {
+    case '"':
+    case '\\':
+    case '/': utf8[0] = (uint8_t)in[*i]; break;
+    case 'n': utf8[0] = '\x0a'; break;
+    case 'r': utf8[0] = '\x0d'; break;
+    case 't': utf8[0] = '\x09'; break;
+    case 'f': utf8[0] = '\x0c'; break;
+    case 'b': utf8[0] = '\x08'; break;
+    case 'u':
+        if ((len - *i) < 5) return false;
+        if (!_SSFJsonUnescHex4(&in[*i + 1], &cp)) return false;
+        *i += 4;
+        if ((cp >= 0xdc00ul) && (cp <= 0xdffful)) return false;
+        if ((cp >= 0xd800ul) && (cp <= 0xdbfful))
+        {
+            /* High surrogate must be followed by an escaped low surrogate */
+            if ((len - *i) < 7) return false;
+            if ((in[*i + 1] != '\\') || (in[*i + 2] != 'u')) return false;
+            if (!_SSFJsonUnescHex4(&in[*i + 3], &lo)) return false;
+            if ((lo < 0xdc00ul) || (lo > 0xdffful)) return false;
+            *i += 6;
+            cp = 0x10000ul + ((cp - 0xd800ul) << 10) + (lo - 0xdc00ul);
+        }
+        if (cp < 0x80ul) utf8[0] = (uint8_t)cp;
+        else if (cp < 0x800ul)
+        {
+            utf8[0] = (uint8_t)(0xc0u | (cp >> 6));
+            utf8[1] = (uint8_t)(0x80u | (cp & 0x3fu));
+            *utf8Len = 2;
+        }
+        else if (cp < 0x10000ul)
+        {
+            utf8[0] = (uint8_t)(0xe0u | (cp >> 12));
+            utf8[1] = (uint8_t)(0x80u | ((cp >> 6) & 0x3fu));
+            utf8[2] = (uint8_t)(0x80u | (cp & 0x3fu));
+            *utf8Len = 3;
+        }
+        else
+        {
+            utf8[0] = (uint8_t)(0xf0u | (cp >> 18));
+            utf8[1] = (uint8_t)(0x80u | ((cp >> 12) & 0x3fu));
+            utf8[2] = (uint8_t)(0x80u | ((cp >> 6) & 0x3fu));
+            utf8[3] = (uint8_t)(0x80u | (cp & 0x3fu));
+            *utf8Len = 4;
+        }
+        break;
+    default: return false;
+    }
+    (*i)++;
     return true;
 }
 
 /* --------------------------------------------------------------------------------------------- */
-/* Returns true if found and is converted to signed int, else false.                             */
+/* Returns true if raw chars in are unescaped completely into out w/NULL term., else false.      */
 /* --------------------------------------------------------------------------------------------- */
-bool SSFJsonGetLong(SSFCStrIn_t js, SSFCStrIn_t *path, long int *out)
+static bool _SSFJsonUnescape(SSFCStrIn_t in, size_t len, char *out, size_t outSize,
+                             size_t *outLen)
 {
-    double dout;
+    SSFCStrIn_t esc;
+    size_t i = 0;
+    size_t index = 0;
+    size_t run;
+    uint8_t utf8[4];
+    size_t utf8Len;
+    bool rv = false;
 
-    if (!SSFJsonGetDouble(js, path, &dout)) return false;
-    *out = (int32_t)round(dout);
-    return true;
+    SSF_REQUIRE(in != NULL);
+    SSF_REQUIRE(out != NULL);
+
+    if (outSize == 0) return false;
+    while (true)
+    {
+        /* Copy the run of unescaped chars up to the next escape sequence in one step */
+        esc = (SSFCStrIn_t)memchr(&in[i], '\\', len - i);
+        run = (esc == NULL) ? (len - i) : (size_t)(esc - &in[i]);
+        if (run >= (outSize - index)) break;
+        memcpy(&out[index], &in[i], run);
+        index += run;
+        i += run;
+        if (esc == NULL) { rv = true; break; }
+
+        if (!_SSFJsonUnescNext(in, len, &i, utf8, &utf8Len)) break;
+        if (utf8Len >= (outSize - index)) break;
+        memcpy(&out[index], utf8, utf8Len);
+        index += utf8Len;
+    }
+    out[index] = 0;
+    if (outLen != NULL) *outLen = index;
+    return rv;
 }
 
 /* --------------------------------------------------------------------------------------------- */
-/* Returns true if found and is converted to unsigned int, else false.                           */
+/* Returns true if string span is unescaped completely into buffer w/NULL term., else false.     */
 /* --------------------------------------------------------------------------------------------- */
-bool SSFJsonGetULong(SSFCStrIn_t js, SSFCStrIn_t *path, unsigned long int *out)
+static bool _SSFJsonSpanString(SSFCStrIn_t js, size_t start, size_t end, char *out,
+                               size_t outSize, size_t *outLen)
 {
-    double dout;
+    SSF_REQUIRE(js != NULL);
 
-    if (!SSFJsonGetDouble(js, path, &dout)) return false;
-    if (dout < 0) return false;
-    *out = (uint32_t)round(dout);
-    return true;
+    return _SSFJsonUnescape(&js[start + 1], end - start - 1, out, outSize, outLen);
 }
-#else
+
 /* --------------------------------------------------------------------------------------------- */
-/* Returns true if found and is converted to signed int, else false.                             */
+/* Returns true after setting str to the raw chars of the string span, without its quotes.       */
 /* --------------------------------------------------------------------------------------------- */
-bool _SSFJsonGetXLong(SSFCStrIn_t js, SSFCStrIn_t *path, long int *outs, unsigned long int *outu)
+static bool _SSFJsonSpanStr(SSFCStrIn_t js, size_t start, size_t end, SSFJsonStr_t *str)
 {
-    size_t index;
-    size_t start;
-    size_t end;
-    SSFJsonType_t jt;
-    char *endptr;
-
     SSF_REQUIRE(js != NULL);
-    SSF_REQUIRE(path != NULL);
-    SSF_REQUIRE(path[SSF_JSON_CONFIG_MAX_IN_DEPTH] == NULL);
-    SSF_REQUIRE(((outs != NULL) && (outu == NULL)) || ((outs == NULL) && (outu != NULL)));
+    SSF_REQUIRE(str != NULL);
 
-    if (!SSFJsonObject(js, &index, &start, &end, path, 0, &jt)) return false;
-    if (jt != SSF_JSON_TYPE_NUMBER) return false;
-    if (outu != NULL)
-    {
-        if (js[start] == '-') return false;
-        *outu = strtoul(&js[start], &endptr, 10);
-    } else *outs = strtol(&js[start], &endptr, 10);
-    if ((endptr - 1) != &js[end]) return false;
+    str->ptr = &js[start + 1];
+    str->len = end - start - 1;
+    str->hasEsc = memchr(str->ptr, '\\', str->len) != NULL;
     return true;
 }
 
 /* --------------------------------------------------------------------------------------------- */
-/* Returns true if found and is converted to signed int, else false.                             */
+/* Returns true if unescaped str equals the NULL terminated string cstr, else false.             */
 /* --------------------------------------------------------------------------------------------- */
-bool SSFJsonGetLong(SSFCStrIn_t js, SSFCStrIn_t *path, long int *out)
+bool SSFJsonStrIs(const SSFJsonStr_t *str, SSFCStrIn_t cstr)
 {
-    return _SSFJsonGetXLong(js, path, out, NULL);
+    SSFCStrIn_t esc = NULL;
+    size_t i = 0;
+    size_t k;
+    size_t run;
+    size_t utf8Len;
+    uint8_t utf8[4];
+
+    SSF_REQUIRE(str != NULL);
+    SSF_REQUIRE(str->ptr != NULL);
+    SSF_REQUIRE(cstr != NULL);
+
+    /* Most mismatches against a set of constants are decided by the first char */
+    if ((str->len != 0) && (str->ptr[0] != *cstr) && (str->ptr[0] != '\\')) return false;
+    while (true)
+    {
+        /* Raw chars never match the NULL terminator, so cstr is never read past its end */
+        if (str->hasEsc) esc = (SSFCStrIn_t)memchr(&str->ptr[i], '\\', str->len - i);
+        run = (esc == NULL) ? (str->len - i) : (size_t)(esc - &str->ptr[i]);
+        if (strncmp(&str->ptr[i], cstr, run) != 0) return false;
+        i += run;
+        cstr += run;
+        if (esc == NULL) break;
+
+        if (!_SSFJsonUnescNext(str->ptr, str->len, &i, utf8, &utf8Len)) return false;
+        for (k = 0; k < utf8Len; k++)
+        {
+            /* An escaped NULL never matches since cstr cannot contain one */
+            if ((*cstr == 0) || (((uint8_t)*cstr) != utf8[k])) return false;
+            cstr++;
+        }
+    }
+    return *cstr == 0;
 }
 
 /* --------------------------------------------------------------------------------------------- */
-/* Returns true if found and is converted to unsigned int, else false.                           */
+/* Returns true if str is unescaped completely into buffer w/NULL term., else false.             */
 /* --------------------------------------------------------------------------------------------- */
-bool SSFJsonGetULong(SSFCStrIn_t js, SSFCStrIn_t *path, unsigned long int *out)
+bool SSFJsonStrUnescape(const SSFJsonStr_t *str, SSFCStrOut_t out, size_t outSize,
+                        size_t *outLen)
 {
-    return _SSFJsonGetXLong(js, path, NULL, out);
+    SSF_REQUIRE(str != NULL);
+    SSF_REQUIRE(str->ptr != NULL);
+    SSF_REQUIRE(out != NULL);
+
+    return _SSFJsonUnescape(str->ptr, str->len, out, outSize, outLen);
 }
-#endif /* SSF_JSON_CONFIG_ENABLE_FLOAT_PARSE */
 
 /* --------------------------------------------------------------------------------------------- */
-/* Returns true if found and completely converted to binary data, else false.                    */
+/* Returns true if number span is scanned and its value accumulated into num, else false.        */
 /* --------------------------------------------------------------------------------------------- */
-bool SSFJsonGetHex(SSFCStrIn_t js, SSFCStrIn_t *path, uint8_t *out, size_t outSize,
-                   size_t *outLen, bool rev)
+static bool _SSFJsonSpanNum(SSFCStrIn_t js, size_t start, size_t end, SSFJsonNum_t *num)
 {
-    size_t start;
-    size_t end;
+    size_t index = start;
+    size_t nstart;
+    size_t nend;
+
+    SSF_REQUIRE(js != NULL);
+    SSF_REQUIRE(num != NULL);
+
+    if (!_SSFJsonNumber(js, &index, &nstart, &nend, num)) return false;
+    return nend == end;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if integer num fits in signed or unsigned long and is converted, else false.     */
+/* --------------------------------------------------------------------------------------------- */
+static bool _SSFJsonNumToXLong(const SSFJsonNum_t *num, long int *outs, unsigned long int *outu)
+{
+    /* Must be an integer token whose digits all fit in the mantissa */
+    if ((!num->isInt) || (num->exp10 != 0)) return false;
+    if (outu != NULL)
+    {
+        if (num->neg || (num->mant > ULONG_MAX)) return false;
+        *outu = (unsigned long int)num->mant;
+    }
+    else if (num->neg)
+    {
+        if (num->mant > (((uint64_t)LONG_MAX) + 1)) return false;
+        *outs = (num->mant == 0) ? 0 : (-((long int)(num->mant - 1)) - 1);
+    }
+    else
+    {
+        if (num->mant > LONG_MAX) return false;
+        *outs = (long int)num->mant;
+    }
+    return true;
+}
+
+#if SSF_JSON_CONFIG_ENABLE_FLOAT_PARSE == 1
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if number span is converted to double, else false; num is its value if scanned.  */
+/* --------------------------------------------------------------------------------------------- */
+static bool _SSFJsonSpanDouble(SSFCStrIn_t js, size_t start, size_t end, const SSFJsonNum_t *num,
+                               double *out)
+{
+    SSFJsonNum_t snum;
+    char *endptr;
+
+    SSF_REQUIRE(js != NULL);
+    SSF_REQUIRE(out != NULL);
+
+    if (num == NULL)
+    {
+        if (!_SSFJsonSpanNum(js, start, end, &snum)) return false;
+        num = &snum;
+    }
+
+#if defined(FLT_EVAL_METHOD) && (FLT_EVAL_METHOD == 0)
+    /* Clinger's fast path, mantissa and power of 10 are exact doubles so one rounding is exact */
+    if (num->mant == 0) {*out = num->neg ? -0.0 : 0.0; return true; }
+    if ((num->mant <= (1ull << 53)) && (num->exp10 >= -22) && (num->exp10 <= 22))
+    {
+        *out = (double)num->mant;
+        if (num->exp10 < 0) *out /= _SSFJsonExactPow10[-num->exp10];
+        else *out *= _SSFJsonExactPow10[num->exp10];
+        if (num->neg) *out = -(*out);
+        return true;
+    }
+#endif /* FLT_EVAL_METHOD */
+
+    /* Slow path, correctly rounded by the C library */
+    *out = strtod(&js[start], &endptr);
+    if ((endptr - 1) != &js[end]) return false;
+    return true;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if number span is converted to signed or unsigned int, else false; num as above.  */
+/* --------------------------------------------------------------------------------------------- */
+static bool _SSFJsonSpanXLong(SSFCStrIn_t js, size_t start, size_t end, const SSFJsonNum_t *num,
+                              long int *outs, unsigned long int *outu)
+{
+    SSFJsonNum_t snum;
+    double dout;
+
+    SSF_REQUIRE(((outs != NULL) && (outu == NULL)) || ((outs == NULL) && (outu != NULL)));
+
+    /* Integers convert exactly, others are rounded to the nearest integer */
+    if (num == NULL)
+    {
+        if (!_SSFJsonSpanNum(js, start, end, &snum)) return false;
+        num = &snum;
+    }
+    if (num->isInt) return _SSFJsonNumToXLong(num, outs, outu);
+    if (!_SSFJsonSpanDouble(js, start, end, num, &dout)) return false;
+    dout = round(dout);
+    if (outu != NULL)
+    {
+        if ((dout < 0) || (dout >= (((double)((ULONG_MAX >> 1) + 1)) * 2.0))) return false;
+        *outu = (unsigned long int)dout;
+    }
+    else
+    {
+        if ((dout < (double)LONG_MIN) || (dout >= -((double)LONG_MIN))) return false;
+        *outs = (long int)dout;
+    }
+    return true;
+}
+#else
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if number span is converted to signed or unsigned int, else false; num as above.  */
+/* --------------------------------------------------------------------------------------------- */
+static bool _SSFJsonSpanXLong(SSFCStrIn_t js, size_t start, size_t end, const SSFJsonNum_t *num,
+                              long int *outs, unsigned long int *outu)
+{
+    SSFJsonNum_t snum;
+
+    SSF_REQUIRE(js != NULL);
+    SSF_REQUIRE(((outs != NULL) && (outu == NULL)) || ((outs == NULL) && (outu != NULL)));
+
+    if (num == NULL)
+    {
+        if (!_SSFJsonSpanNum(js, start, end, &snum)) return false;
+        num = &snum;
+    }
+    return _SSFJsonNumToXLong(num, outs, outu);
+}
+#endif /* SSF_JSON_CONFIG_ENABLE_FLOAT_PARSE */
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if string span completely converted to binary data, else false.                  */
+/* --------------------------------------------------------------------------------------------- */
+static bool _SSFJsonSpanHex(SSFCStrIn_t js, size_t start, size_t end, uint8_t *out,
+                            size_t outSize, size_t *outLen, bool rev)
+{
+    start++; end--;
+    return SSFHexBytesToBin(&js[start], (end - start + 1), out, outSize, outLen, rev);
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if string span entire decode successful, and outLen updated, else false.         */
+/* --------------------------------------------------------------------------------------------- */
+static bool _SSFJsonSpanBase64(SSFCStrIn_t js, size_t start, size_t end, uint8_t *out,
+                               size_t outSize, size_t *outLen, SSFBase64Fmt_t fmt)
+{
+    start++; end--;
+    return SSFBase64DecodeFmt(&js[start], (end - start + 1), out, outSize, outLen, fmt);
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if found and is unescaped completely into buffer w/NULL term., else false.       */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFJsonGetString(SSFCStrIn_t js, SSFCStrIn_t *path, char *out, size_t outSize,
+                      size_t *outLen)
+{
+    size_t start;
+    size_t end;
+    size_t index;
+    SSFJsonType_t jt;
+
+    SSF_REQUIRE(js != NULL);
+    SSF_REQUIRE(path != NULL);
+    SSF_REQUIRE(path[SSF_JSON_CONFIG_MAX_IN_DEPTH] == NULL);
+    SSF_REQUIRE(out != NULL);
+
+    if (!SSFJsonObject(js, &index, &start, &end, path, 0, &jt)) return false;
+    if (jt != SSF_JSON_TYPE_STRING) return false;
+    return _SSFJsonSpanString(js, start, end, out, outSize, outLen);
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if found and out set to its raw chars in js without copying, else false.         */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFJsonGetStringSpan(SSFCStrIn_t js, SSFCStrIn_t *path, SSFJsonStr_t *out)
+{
+    size_t start;
+    size_t end;
+    size_t index;
+    SSFJsonType_t jt;
+
+    SSF_REQUIRE(js != NULL);
+    SSF_REQUIRE(path != NULL);
+    SSF_REQUIRE(path[SSF_JSON_CONFIG_MAX_IN_DEPTH] == NULL);
+    SSF_REQUIRE(out != NULL);
+
+    if (!SSFJsonObject(js, &index, &start, &end, path, 0, &jt)) return false;
+    if (jt != SSF_JSON_TYPE_STRING) return false;
+    return _SSFJsonSpanStr(js, start, end, out);
+}
+
+#if SSF_JSON_CONFIG_ENABLE_FLOAT_PARSE == 1
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if found and is converted to double, else false.                                 */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFJsonGetDouble(SSFCStrIn_t js, SSFCStrIn_t *path, double *out)
+{
+    size_t index;
+    size_t start;
+    size_t end;
+    SSFJsonType_t jt;
+    SSFJsonNum_t num;
+
+    SSF_REQUIRE(js != NULL);
+    SSF_REQUIRE(path != NULL);
+    SSF_REQUIRE(path[SSF_JSON_CONFIG_MAX_IN_DEPTH] == NULL);
+    SSF_REQUIRE(out != NULL);
+
+    if (!_SSFJsonObject(js, &index, &start, &end, path, &jt, &num)) return false;
+    if (jt != SSF_JSON_TYPE_NUMBER) return false;
+    return _SSFJsonSpanDouble(js, start, end, &num, out);
+}
+#endif /* SSF_JSON_CONFIG_ENABLE_FLOAT_PARSE */
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if found and is converted to signed or unsigned int, else false.                 */
+/* --------------------------------------------------------------------------------------------- */
+static bool _SSFJsonGetXLong(SSFCStrIn_t js, SSFCStrIn_t *path, long int *outs,
+                             unsigned long int *outu)
+{
+    size_t index;
+    size_t start;
+    size_t end;
+    SSFJsonType_t jt;
+    SSFJsonNum_t num;
+
+    SSF_REQUIRE(js != NULL);
+    SSF_REQUIRE(path != NULL);
+    SSF_REQUIRE(path[SSF_JSON_CONFIG_MAX_IN_DEPTH] == NULL);
+    SSF_REQUIRE(((outs != NULL) && (outu == NULL)) || ((outs == NULL) && (outu != NULL)));
+
+    if (!_SSFJsonObject(js, &index, &start, &end, path, &jt, &num)) return false;
+    if (jt != SSF_JSON_TYPE_NUMBER) return false;
+    return _SSFJsonSpanXLong(js, start, end, &num, outs, outu);
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if found and is converted to signed int, else false.                             */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFJsonGetLong(SSFCStrIn_t js, SSFCStrIn_t *path, long int *out)
+{
+    return _SSFJsonGetXLong(js, path, out, NULL);
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if found and is converted to unsigned int, else false.                           */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFJsonGetULong(SSFCStrIn_t js, SSFCStrIn_t *path, unsigned long int *out)
+{
+    return _SSFJsonGetXLong(js, path, NULL, out);
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if found and completely converted to binary data, else false.                    */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFJsonGetHex(SSFCStrIn_t js, SSFCStrIn_t *path, uint8_t *out, size_t outSize,
+                   size_t *outLen, bool rev)
+{
+    size_t start;
+    size_t end;
     size_t index;
     SSFJsonType_t jt;
 
@@ -519,15 +1235,14 @@ bool SSFJsonGetHex(SSFCStrIn_t js, SSFCStrIn_t *path, uint8_t *out, size_t outSi
 
     if (!SSFJsonObject(js, &index, &start, &end, path, 0, &jt)) return false;
     if (jt != SSF_JSON_TYPE_STRING) return false;
-    start++; end--;
-    return SSFHexBytesToBin(&js[start], (end - start + 1), out, outSize, outLen, rev);
+    return _SSFJsonSpanHex(js, start, end, out, outSize, outLen, rev);
 }
 
 /* --------------------------------------------------------------------------------------------- */
 /* Returns true if found, entire decode successful, and outLen updated, else false.              */
 /* --------------------------------------------------------------------------------------------- */
-bool SSFJsonGetBase64(SSFCStrIn_t js, SSFCStrIn_t *path, uint8_t *out, size_t outSize,
-                      size_t *outLen)
+bool SSFJsonGetBase64Fmt(SSFCStrIn_t js, SSFCStrIn_t *path, uint8_t *out, size_t outSize,
+                         size_t *outLen, SSFBase64Fmt_t fmt)
 {
     size_t start;
     size_t end;
@@ -542,345 +1257,2568 @@ bool SSFJsonGetBase64(SSFCStrIn_t js, SSFCStrIn_t *path, uint8_t *out, size_t ou
 
     if (!SSFJsonObject(js, &index, &start, &end, path, 0, &jt)) return false;
     if (jt != SSF_JSON_TYPE_STRING) return false;
-    start++; end--;
+    return _SSFJsonSpanBase64(js, start, end, out, outSize, outLen, fmt);
+}
 
-    return SSFBase64Decode(&js[start], (end - start + 1), out, outSize, outLen);
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if found, entire decode successful, and outLen updated, else false.              */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFJsonGetBase64(SSFCStrIn_t js, SSFCStrIn_t *path, uint8_t *out, size_t outSize,
+                      size_t *outLen)
+{
+    return SSFJsonGetBase64Fmt(js, path, out, outSize, outLen, SSF_BASE64_FMT_STD);
 }
 
 /* --------------------------------------------------------------------------------------------- */
-/* Returns true if char added to js, else false.                                                 */
+/* Returns true to continue walk; Advances the path match of every batch request.                */
 /* --------------------------------------------------------------------------------------------- */
-static bool _SSFJsonPrintUnescChar(SSFCStrOut_t js, size_t size, size_t start, size_t *end, const char in)
+static bool _SSFJsonGetManyWalkFn(void *ctx, SSFJsonWalkEvent_t ev, size_t depth, SSFJsonType_t jt,
+                                  size_t key, size_t keyLen, size_t start, size_t end)
 {
-    SSF_REQUIRE(js != NULL);
-    SSF_REQUIRE(end != NULL);
+    SSFJsonGetManyCtx_t *gm = (SSFJsonGetManyCtx_t *)ctx;
+    SSFJsonGet_t *get;
 
-    if (start >= size) return false;
-    js[start] = in;
-    *end = start + 1;
+    SSF_REQUIRE(ctx != NULL);
+
+    for (get = gm->gets; get < &gm->gets[gm->getsLen]; get++)
+    {
+        if (get->match.done) continue;
+        _SSFJsonWalkPathFn(&get->match, ev, depth, jt, key, keyLen, start, end);
+    }
     return true;
 }
 
 /* --------------------------------------------------------------------------------------------- */
-/* Returns true if in string added successfully as escaped string, else false.                   */
+/* Returns true if value found for request is converted into its output, else false.             */
 /* --------------------------------------------------------------------------------------------- */
-bool SSFJsonPrintCString(SSFCStrOut_t js, size_t size, size_t start, size_t *end, SSFCStrIn_t in,
-                         bool *comma)
+static bool _SSFJsonGetManyConvert(SSFCStrIn_t js, SSFJsonGet_t *get)
 {
-    SSF_REQUIRE(js != NULL);
-    SSF_REQUIRE(end != NULL);
-    SSF_REQUIRE(in != NULL);
-    SSF_REQUIRE((comma == NULL) || (comma != (bool *)true));
+    size_t start = get->match.start;
+    size_t end = get->match.end;
 
-    SSF_JSON_COMMA(comma);
-    while (start < size)
+    if (get->kind == SSF_JSON_GET_TYPE) return get->jt != SSF_JSON_TYPE_ERROR;
+    if (get->kind == SSF_JSON_GET_STRING)
     {
-        if (*in == '\\') SSFJsonEsc(js, '\\');
-        else if (*in == '\"') SSFJsonEsc(js, '\"');
-        else if (*in == '/') SSFJsonEsc(js, '/');
-        else if (*in == '\r') SSFJsonEsc(js, 'r');
-        else if (*in == '\n') SSFJsonEsc(js, 'n');
-        else if (*in == '\t') SSFJsonEsc(js, 't');
-        else if (*in == '\b') SSFJsonEsc(js, 'b');
-        else if (*in == '\f') SSFJsonEsc(js, 'f');
-        else if (((*in > 0x1f) && (*in < 0x7f)) || (*in == 0))
-        {js[start] = *in; } /* Normal ASCII character */
-        else
-        {
-            if (start + 6 >= size) return false;
-            js[start] = '\\'; start++;
-            js[start] = 'u'; start++;
-            js[start] = '0'; start++;
-            js[start] = '0'; start++;
-            snprintf(&js[start], 3, "%02X", (uint8_t)*in);
-            start++;
-        }
-        if (*in == 0)
-        {*end = start; return true; }
-        start++;
-        in++;
+        if (get->jt != SSF_JSON_TYPE_STRING) return false;
+        return _SSFJsonSpanString(js, start, end, (char *)get->out, get->outSize, &get->outLen);
+    }
+    if (get->kind == SSF_JSON_GET_STRING_SPAN)
+    {
+        if (get->jt != SSF_JSON_TYPE_STRING) return false;
+        return _SSFJsonSpanStr(js, start, end, (SSFJsonStr_t *)get->out);
+    }
+    if ((get->kind == SSF_JSON_GET_HEX) || (get->kind == SSF_JSON_GET_HEX_REV))
+    {
+        if (get->jt != SSF_JSON_TYPE_STRING) return false;
+        return _SSFJsonSpanHex(js, start, end, (uint8_t *)get->out, get->outSize, &get->outLen,
+                               get->kind == SSF_JSON_GET_HEX_REV);
+    }
+    if (get->kind == SSF_JSON_GET_BASE64)
+    {
+        if (get->jt != SSF_JSON_TYPE_STRING) return false;
+        return _SSFJsonSpanBase64(js, start, end, (uint8_t *)get->out, get->outSize,
+                                  &get->outLen, SSF_BASE64_FMT_STD);
+    }
+    if (get->jt != SSF_JSON_TYPE_NUMBER) return false;
+    if (get->kind == SSF_JSON_GET_LONG)
+    {return _SSFJsonSpanXLong(js, start, end, &get->match.num, (long int *)get->out, NULL); }
+    if (get->kind == SSF_JSON_GET_ULONG)
+    {
+        return _SSFJsonSpanXLong(js, start, end, &get->match.num, NULL,
+                                 (unsigned long int *)get->out);
     }
+#if SSF_JSON_CONFIG_ENABLE_FLOAT_PARSE == 1
+    if (get->kind == SSF_JSON_GET_DOUBLE)
+    {return _SSFJsonSpanDouble(js, start, end, &get->match.num, (double *)get->out); }
+#endif /* SSF_JSON_CONFIG_ENABLE_FLOAT_PARSE */
     return false;
 }
 
 /* --------------------------------------------------------------------------------------------- */
-/* Returns true if in string added successfully as quoted escaped string, else false.            */
+/* Returns true if all requests found and converted in one pass, else false; Sets each ok flag.  */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFJsonGetMany(SSFCStrIn_t js, SSFJsonGet_t *gets, size_t getsLen)
+{
+    uint8_t stack[SSF_JSON_STACK_SIZE(SSF_JSON_CONFIG_MAX_WALK_DEPTH)];
+    SSFJsonGetManyCtx_t gm;
+    SSFJsonGet_t *get;
+    SSFJsonNum_t cur;
+    size_t index;
+    bool valid;
+    bool needNum = false;
+    bool rv = true;
+
+    SSF_REQUIRE(js != NULL);
+    SSF_REQUIRE(gets != NULL);
+
+    for (get = gets; get < &gets[getsLen]; get++)
+    {
+        SSF_REQUIRE(get->path != NULL);
+        SSF_REQUIRE(get->path[SSF_JSON_CONFIG_MAX_IN_DEPTH] == NULL);
+        SSF_REQUIRE(get->kind < SSF_JSON_GET_MAX);
+        SSF_REQUIRE((get->out != NULL) || (get->kind == SSF_JSON_GET_TYPE));
+
+        memset(&get->match, 0, sizeof(get->match));
+        get->match.js = js;
+        get->match.path = get->path;
+        get->match.jt = SSF_JSON_TYPE_ERROR;
+        get->outLen = 0;
+
+        /* Numbers are accumulated once by the walk instead of being scanned again */
+        if ((get->kind == SSF_JSON_GET_LONG) || (get->kind == SSF_JSON_GET_ULONG))
+        {get->match.cur = &cur; }
+#if SSF_JSON_CONFIG_ENABLE_FLOAT_PARSE == 1
+        if (get->kind == SSF_JSON_GET_DOUBLE) get->match.cur = &cur;
+#endif /* SSF_JSON_CONFIG_ENABLE_FLOAT_PARSE */
+        if (get->match.cur != NULL) needNum = true;
+    }
+
+    gm.gets = gets;
+    gm.getsLen = getsLen;
+    valid = _SSFJsonWalkRoot(js, &index, stack, SSF_JSON_CONFIG_MAX_WALK_DEPTH,
+                             _SSFJsonGetManyWalkFn, &gm, needNum ? &cur : NULL);
+
+    for (get = gets; get < &gets[getsLen]; get++)
+    {
+        get->jt = valid ? get->match.jt : SSF_JSON_TYPE_ERROR;
+        get->ok = _SSFJsonGetManyConvert(js, get);
+        if (!get->ok) rv = false;
+    }
+    return rv;
+}
+
+#if SSF_JSON_CONFIG_ENABLE_INDEX == 1
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true to continue walk, false if out of tokens; Appends a token per value to index.    */
+/* --------------------------------------------------------------------------------------------- */
+static bool _SSFJsonIndexWalkFn(void *ctx, SSFJsonWalkEvent_t ev, size_t depth, SSFJsonType_t jt,
+                                size_t key, size_t keyLen, size_t start, size_t end)
+{
+    SSFJsonIndex_t *idx = (SSFJsonIndex_t *)ctx;
+    SSFJsonTok_t *tok;
+
+    SSF_REQUIRE(ctx != NULL);
+    SSF_UNUSED(depth);
+
+    if ((ev == SSF_JSON_WALK_END) && ((jt == SSF_JSON_TYPE_OBJECT) || (jt == SSF_JSON_TYPE_ARRAY)))
+    {
+        /* Object or array closed, all of its descendants are now on the tape */
+        tok = &idx->toks[idx->cur];
+        tok->end = end;
+        tok->next = idx->toksLen;
+        idx->cur = tok->parent;
+        return true;
+    }
+    if (ev == SSF_JSON_WALK_BEGIN)
+    {
+        idx->key = key;
+        idx->keyLen = keyLen;
+        /* Scalar tokens are appended once their end is known */
+        if (jt == SSF_JSON_TYPE_ERROR) return true;
+    }
+    if (idx->toksLen >= idx->toksSize) return false;
+    tok = &idx->toks[idx->toksLen];
+    tok->start = start;
+    tok->end = end;
+    tok->key = idx->key;
+    tok->keyLen = idx->keyLen;
+    tok->next = idx->toksLen + 1;
+    tok->parent = idx->cur;
+    tok->type = jt;
+    if (ev == SSF_JSON_WALK_BEGIN) idx->cur = idx->toksLen;
+    idx->toksLen++;
+    return true;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if JSON string is valid and fits in toks, else false; Builds index in one pass.  */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFJsonIndex(SSFJsonIndex_t *idx, SSFCStrIn_t js, SSFJsonTok_t *toks, size_t toksSize)
+{
+    uint8_t stack[SSF_JSON_STACK_SIZE(SSF_JSON_CONFIG_MAX_WALK_DEPTH)];
+    size_t index;
+
+    SSF_REQUIRE(idx != NULL);
+    SSF_REQUIRE(js != NULL);
+    SSF_REQUIRE(toks != NULL);
+    SSF_REQUIRE(toksSize > 0);
+
+    idx->js = js;
+    idx->toks = toks;
+    idx->toksSize = toksSize;
+    idx->toksLen = 0;
+    idx->cur = SSF_JSON_TOK_NONE;
+    return _SSFJsonWalkRoot(js, &index, stack, SSF_JSON_CONFIG_MAX_WALK_DEPTH, _SSFJsonIndexWalkFn,
+                            idx, NULL);
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if path found in index and tok set to its token, else false.                     */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFJsonIndexFind(const SSFJsonIndex_t *idx, SSFCStrIn_t *path, size_t *tok)
+{
+    const SSFJsonTok_t *toks;
+    size_t cur = 0;
+    size_t child;
+    size_t pindex;
+    size_t aindex;
+    size_t plen;
+    uint8_t depth;
+
+    SSF_REQUIRE(idx != NULL);
+    SSF_REQUIRE(idx->toks != NULL);
+    SSF_REQUIRE(path != NULL);
+    SSF_REQUIRE(path[SSF_JSON_CONFIG_MAX_IN_DEPTH] == NULL);
+    SSF_REQUIRE(tok != NULL);
+
+    toks = idx->toks;
+    if (idx->toksLen == 0) return false;
+    for (depth = 0; path[depth] != NULL; depth++)
+    {
+        if (toks[cur].type == SSF_JSON_TYPE_OBJECT)
+        {
+            plen = strlen(path[depth]);
+            for (child = cur + 1; child < toks[cur].next; child = toks[child].next)
+            {
+                if (strncmp(path[depth], &idx->js[toks[child].key],
+                            SSF_MAX(toks[child].keyLen, plen)) == 0) break;
+            }
+        }
+        else if (toks[cur].type == SSF_JSON_TYPE_ARRAY)
+        {
+            memcpy(&pindex, path[depth], sizeof(size_t));
+            aindex = 0;
+            for (child = cur + 1; child < toks[cur].next; child = toks[child].next)
+            {
+                if (aindex == pindex) break;
+                aindex++;
+            }
+        }
+        else return false;
+        if (child >= toks[cur].next) return false;
+        cur = child;
+    }
+    *tok = cur;
+    return true;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns SSF_JSON_TYPE_ERROR if path not found in index, else valid type.                      */
+/* --------------------------------------------------------------------------------------------- */
+SSFJsonType_t SSFJsonIndexGetType(const SSFJsonIndex_t *idx, SSFCStrIn_t *path)
+{
+    size_t tok;
+
+    if (!SSFJsonIndexFind(idx, path, &tok)) return SSF_JSON_TYPE_ERROR;
+    return idx->toks[tok].type;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if path found in index and is of type jt, else false.                            */
+/* --------------------------------------------------------------------------------------------- */
+static bool _SSFJsonIndexFindType(const SSFJsonIndex_t *idx, SSFCStrIn_t *path,
+                                  SSFJsonType_t jt, size_t *start, size_t *end)
+{
+    size_t tok;
+
+    if (!SSFJsonIndexFind(idx, path, &tok)) return false;
+    if (idx->toks[tok].type != jt) return false;
+    *start = idx->toks[tok].start;
+    *end = idx->toks[tok].end;
+    return true;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if found in index and is unescaped completely into buffer, else false.           */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFJsonIndexGetString(const SSFJsonIndex_t *idx, SSFCStrIn_t *path, SSFCStrOut_t out,
+                           size_t outSize, size_t *outLen)
+{
+    size_t start;
+    size_t end;
+
+    SSF_REQUIRE(out != NULL);
+
+    if (!_SSFJsonIndexFindType(idx, path, SSF_JSON_TYPE_STRING, &start, &end)) return false;
+    return _SSFJsonSpanString(idx->js, start, end, out, outSize, outLen);
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if found in index and out set to its raw chars without copying, else false.      */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFJsonIndexGetStringSpan(const SSFJsonIndex_t *idx, SSFCStrIn_t *path, SSFJsonStr_t *out)
+{
+    size_t start;
+    size_t end;
+
+    SSF_REQUIRE(out != NULL);
+
+    if (!_SSFJsonIndexFindType(idx, path, SSF_JSON_TYPE_STRING, &start, &end)) return false;
+    return _SSFJsonSpanStr(idx->js, start, end, out);
+}
+
+#if SSF_JSON_CONFIG_ENABLE_FLOAT_PARSE == 1
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if found in index and is converted to double, else false.                        */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFJsonIndexGetDouble(const SSFJsonIndex_t *idx, SSFCStrIn_t *path, double *out)
+{
+    size_t start;
+    size_t end;
+
+    SSF_REQUIRE(out != NULL);
+
+    if (!_SSFJsonIndexFindType(idx, path, SSF_JSON_TYPE_NUMBER, &start, &end)) return false;
+    return _SSFJsonSpanDouble(idx->js, start, end, NULL, out);
+}
+#endif /* SSF_JSON_CONFIG_ENABLE_FLOAT_PARSE */
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if found in index and is converted to signed int, else false.                    */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFJsonIndexGetLong(const SSFJsonIndex_t *idx, SSFCStrIn_t *path, long int *out)
+{
+    size_t start;
+    size_t end;
+
+    SSF_REQUIRE(out != NULL);
+
+    if (!_SSFJsonIndexFindType(idx, path, SSF_JSON_TYPE_NUMBER, &start, &end)) return false;
+    return _SSFJsonSpanXLong(idx->js, start, end, NULL, out, NULL);
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if found in index and is converted to unsigned int, else false.                  */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFJsonIndexGetULong(const SSFJsonIndex_t *idx, SSFCStrIn_t *path, unsigned long int *out)
+{
+    size_t start;
+    size_t end;
+
+    SSF_REQUIRE(out != NULL);
+
+    if (!_SSFJsonIndexFindType(idx, path, SSF_JSON_TYPE_NUMBER, &start, &end)) return false;
+    return _SSFJsonSpanXLong(idx->js, start, end, NULL, NULL, out);
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if found in index and completely converted to binary data, else false.           */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFJsonIndexGetHex(const SSFJsonIndex_t *idx, SSFCStrIn_t *path, uint8_t *out,
+                        size_t outSize, size_t *outLen, bool rev)
+{
+    size_t start;
+    size_t end;
+
+    SSF_REQUIRE(out != NULL);
+    SSF_REQUIRE(outLen != NULL);
+
+    if (!_SSFJsonIndexFindType(idx, path, SSF_JSON_TYPE_STRING, &start, &end)) return false;
+    return _SSFJsonSpanHex(idx->js, start, end, out, outSize, outLen, rev);
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if found in index, entire decode successful, and outLen updated, else false.     */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFJsonIndexGetBase64(const SSFJsonIndex_t *idx, SSFCStrIn_t *path, uint8_t *out,
+                           size_t outSize, size_t *outLen)
+{
+    size_t start;
+    size_t end;
+
+    SSF_REQUIRE(out != NULL);
+    SSF_REQUIRE(outLen != NULL);
+
+    if (!_SSFJsonIndexFindType(idx, path, SSF_JSON_TYPE_STRING, &start, &end)) return false;
+    return _SSFJsonSpanBase64(idx->js, start, end, out, outSize, outLen, SSF_BASE64_FMT_STD);
+}
+#endif /* SSF_JSON_CONFIG_ENABLE_INDEX */
+
+#if SSF_JSON_CONFIG_ENABLE_ITER == 1
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if iterator is positioned before first child of object or array at start.        */
+/* --------------------------------------------------------------------------------------------- */
+static bool _SSFJsonIterInit(SSFJsonIter_t *it, SSFCStrIn_t js, size_t len, size_t start,
+                             SSFJsonType_t jt)
+{
+    if ((jt != SSF_JSON_TYPE_OBJECT) && (jt != SSF_JSON_TYPE_ARRAY)) return false;
+    memset(it, 0, sizeof(SSFJsonIter_t));
+    it->js = js;
+    it->len = len;
+    it->index = start + 1;
+    it->jt = SSF_JSON_TYPE_ERROR;
+    it->isArray = (jt == SSF_JSON_TYPE_ARRAY);
+    it->isFirst = true;
+    return true;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if object or array at path found and iterator begun on it, else false.           */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFJsonIterBegin(SSFJsonIter_t *it, SSFCStrIn_t js, SSFCStrIn_t *path)
+{
+    size_t index;
+    size_t start;
+    size_t end;
+    SSFJsonType_t jt;
+
+    SSF_REQUIRE(it != NULL);
+    SSF_REQUIRE(js != NULL);
+    SSF_REQUIRE(path != NULL);
+    SSF_REQUIRE(path[SSF_JSON_CONFIG_MAX_IN_DEPTH] == NULL);
+
+    if (!SSFJsonObject(js, &index, &start, &end, path, 0, &jt)) return false;
+    return _SSFJsonIterInit(it, js, index, start, jt);
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if current value of it is an object or array and child begun on it, else false.  */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFJsonIterChild(const SSFJsonIter_t *it, SSFJsonIter_t *child)
+{
+    SSF_REQUIRE(it != NULL);
+    SSF_REQUIRE(it->js != NULL);
+    SSF_REQUIRE(child != NULL);
+
+    return _SSFJsonIterInit(child, it->js, it->len, it->start, it->jt);
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if advanced to next member or element, else false at end of object or array.     */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFJsonIterNext(SSFJsonIter_t *it)
+{
+    uint8_t stack[SSF_JSON_STACK_SIZE(SSF_JSON_CONFIG_MAX_WALK_DEPTH)];
+    size_t i;
+    size_t key;
+    size_t keyLen;
+    char close;
+
+    SSF_REQUIRE(it != NULL);
+    SSF_REQUIRE(it->js != NULL);
+
+    if (it->isDone) return false;
+    it->isDone = true;
+    it->jt = SSF_JSON_TYPE_ERROR;
+    it->key = NULL;
+    it->keyLen = 0;
+    close = it->isArray ? ']' : '}';
+
+    /* Resume just past the previous value, already validated when iteration began */
+    i = it->index;
+    _SSFJsonWhitespace(it->js, it->len, &i);
+    if (it->js[i] == close) return false;
+    if (!it->isFirst)
+    {
+        if (it->js[i] != ',') return false;
+        i++;
+        _SSFJsonWhitespace(it->js, it->len, &i);
+    }
+    if (!it->isArray)
+    {
+        if (!_SSFJsonWalkKey(it->js, it->len, &i, &key, &keyLen)) return false;
+        _SSFJsonWhitespace(it->js, it->len, &i);
+        it->key = &it->js[key];
+        it->keyLen = keyLen;
+    }
+
+    /* Skip over the value, nested objects and arrays included */
+    it->start = i;
+    switch (it->js[i])
+    {
+    case '{': it->jt = SSF_JSON_TYPE_OBJECT; break;
+    case '[': it->jt = SSF_JSON_TYPE_ARRAY; break;
+    case '"': it->jt = SSF_JSON_TYPE_STRING; break;
+    case 't': it->jt = SSF_JSON_TYPE_TRUE; break;
+    case 'f': it->jt = SSF_JSON_TYPE_FALSE; break;
+    case 'n': it->jt = SSF_JSON_TYPE_NULL; break;
+    default: it->jt = SSF_JSON_TYPE_NUMBER; break;
+    }
+    if (!_SSFJsonWalk(it->js, it->len, &i, stack, SSF_JSON_CONFIG_MAX_WALK_DEPTH, NULL, NULL,
+                      NULL))
+    {it->jt = SSF_JSON_TYPE_ERROR; return false; }
+    it->end = i - 1;
+    it->index = i;
+    it->isFirst = false;
+    it->isDone = false;
+    return true;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if current value is an object member with key, else false.                       */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFJsonIterKeyIs(const SSFJsonIter_t *it, SSFCStrIn_t key)
+{
+    SSF_REQUIRE(it != NULL);
+    SSF_REQUIRE(key != NULL);
+
+    if (it->key == NULL) return false;
+    return (strncmp(it->key, key, it->keyLen) == 0) && (key[it->keyLen] == 0);
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if current value is a string unescaped completely into out, else false.          */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFJsonIterGetString(const SSFJsonIter_t *it, SSFCStrOut_t out, size_t outSize,
+                          size_t *outLen)
+{
+    SSF_REQUIRE(it != NULL);
+    SSF_REQUIRE(out != NULL);
+
+    if (it->jt != SSF_JSON_TYPE_STRING) return false;
+    return _SSFJsonSpanString(it->js, it->start, it->end, out, outSize, outLen);
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if current value is a string and out set to its raw chars, else false.           */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFJsonIterGetStringSpan(const SSFJsonIter_t *it, SSFJsonStr_t *out)
+{
+    SSF_REQUIRE(it != NULL);
+    SSF_REQUIRE(out != NULL);
+
+    if (it->jt != SSF_JSON_TYPE_STRING) return false;
+    return _SSFJsonSpanStr(it->js, it->start, it->end, out);
+}
+
+#if SSF_JSON_CONFIG_ENABLE_FLOAT_PARSE == 1
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if current value is a number converted to double, else false.                    */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFJsonIterGetDouble(const SSFJsonIter_t *it, double *out)
+{
+    SSF_REQUIRE(it != NULL);
+    SSF_REQUIRE(out != NULL);
+
+    if (it->jt != SSF_JSON_TYPE_NUMBER) return false;
+    return _SSFJsonSpanDouble(it->js, it->start, it->end, NULL, out);
+}
+#endif /* SSF_JSON_CONFIG_ENABLE_FLOAT_PARSE */
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if current value is a number converted to signed int, else false.                */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFJsonIterGetLong(const SSFJsonIter_t *it, long int *out)
+{
+    SSF_REQUIRE(it != NULL);
+    SSF_REQUIRE(out != NULL);
+
+    if (it->jt != SSF_JSON_TYPE_NUMBER) return false;
+    return _SSFJsonSpanXLong(it->js, it->start, it->end, NULL, out, NULL);
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if current value is a number converted to unsigned int, else false.              */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFJsonIterGetULong(const SSFJsonIter_t *it, unsigned long int *out)
+{
+    SSF_REQUIRE(it != NULL);
+    SSF_REQUIRE(out != NULL);
+
+    if (it->jt != SSF_JSON_TYPE_NUMBER) return false;
+    return _SSFJsonSpanXLong(it->js, it->start, it->end, NULL, NULL, out);
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if current value is a string completely converted to binary data, else false.    */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFJsonIterGetHex(const SSFJsonIter_t *it, uint8_t *out, size_t outSize, size_t *outLen,
+                       bool rev)
+{
+    SSF_REQUIRE(it != NULL);
+    SSF_REQUIRE(out != NULL);
+    SSF_REQUIRE(outLen != NULL);
+
+    if (it->jt != SSF_JSON_TYPE_STRING) return false;
+    return _SSFJsonSpanHex(it->js, it->start, it->end, out, outSize, outLen, rev);
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if current value is a string, entire decode successful, else false.              */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFJsonIterGetBase64(const SSFJsonIter_t *it, uint8_t *out, size_t outSize, size_t *outLen)
+{
+    SSF_REQUIRE(it != NULL);
+    SSF_REQUIRE(out != NULL);
+    SSF_REQUIRE(outLen != NULL);
+
+    if (it->jt != SSF_JSON_TYPE_STRING) return false;
+    return _SSFJsonSpanBase64(it->js, it->start, it->end, out, outSize, outLen,
+                              SSF_BASE64_FMT_STD);
+}
+#endif /* SSF_JSON_CONFIG_ENABLE_ITER */
+
+#if SSF_JSON_CONFIG_ENABLE_STREAM == 1
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if event callback accepts the event, else false.                                 */
+/* --------------------------------------------------------------------------------------------- */
+static bool _SSFJsonStreamEmit(SSFJsonStream_t *jss, SSFJsonStreamEvent_t ev, SSFJsonType_t jt,
+                               SSFCStrIn_t val, size_t valLen)
+{
+    SSFCStrIn_t key = NULL;
+    size_t index = 0;
+
+    if (jss->depth != 0)
+    {
+        index = jss->count[jss->depth - 1];
+        if ((!jss->isArray[jss->depth - 1]) && (ev != SSF_JSON_STREAM_EVENT_CLOSE))
+        {key = jss->key; }
+    }
+    return jss->fn(ev, jt, key, index, val, valLen, jss->depth, jss->ctx);
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if value is complete and parser state is advanced, else false.                   */
+/* --------------------------------------------------------------------------------------------- */
+static bool _SSFJsonStreamValueDone(SSFJsonStream_t *jss, SSFJsonType_t jt)
+{
+    jss->val[jss->valLen] = 0;
+    if (!_SSFJsonStreamEmit(jss, SSF_JSON_STREAM_EVENT_VALUE, jt, jss->val, jss->valLen))
+    {return false; }
+    jss->count[jss->depth - 1]++;
+    jss->state = SSF_JSON_STREAM_STATE_AFTER_VALUE;
+    return true;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if object or array is opened, else false.                                        */
+/* --------------------------------------------------------------------------------------------- */
+static bool _SSFJsonStreamOpen(SSFJsonStream_t *jss, bool isArray)
+{
+    if (jss->depth >= SSF_JSON_CONFIG_MAX_IN_DEPTH) return false;
+    if (!_SSFJsonStreamEmit(jss, SSF_JSON_STREAM_EVENT_OPEN,
+                            isArray ? SSF_JSON_TYPE_ARRAY : SSF_JSON_TYPE_OBJECT, NULL, 0))
+    {return false; }
+    jss->isArray[jss->depth] = isArray;
+    jss->count[jss->depth] = 0;
+    jss->depth++;
+    jss->state = isArray ? SSF_JSON_STREAM_STATE_OPEN_ARRAY : SSF_JSON_STREAM_STATE_OPEN_OBJECT;
+    return true;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if c closes the open object or array, else false.                                */
+/* --------------------------------------------------------------------------------------------- */
+static bool _SSFJsonStreamClose(SSFJsonStream_t *jss, char c)
+{
+    bool isArray;
+
+    isArray = jss->isArray[jss->depth - 1];
+    if (c != (isArray ? ']' : '}')) return false;
+    jss->depth--;
+    if (!_SSFJsonStreamEmit(jss, SSF_JSON_STREAM_EVENT_CLOSE,
+                            isArray ? SSF_JSON_TYPE_ARRAY : SSF_JSON_TYPE_OBJECT, NULL, 0))
+    {return false; }
+    if (jss->depth == 0) {jss->state = SSF_JSON_STREAM_STATE_DONE; return true; }
+    jss->count[jss->depth - 1]++;
+    jss->state = SSF_JSON_STREAM_STATE_AFTER_VALUE;
+    return true;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if c is added to key or string token, else false.                                */
+/* --------------------------------------------------------------------------------------------- */
+static bool _SSFJsonStreamStringChar(SSFJsonStream_t *jss, char *buf, size_t *len,
+                                     size_t maxLen, char c, bool *done)
+{
+    *done = false;
+    if (c == 0) return false;
+    if (jss->sub == 1)
+    {
+        /* Char after a backslash */
+        if (!SSFJsonIsEsc(c)) return false;
+        jss->sub = (c == 'u') ? 2 : 0;
+    }
+    else if (jss->sub != 0)
+    {
+        /* One of the 4 hex digits of a \uXXXX escape */
+        if (!SSFIsHex(c)) return false;
+        jss->sub = (jss->sub == 5) ? 0 : jss->sub + 1;
+    }
+    else if (c == '\\') jss->sub = 1;
+    else if (c == '"') {buf[*len] = 0; *done = true; return true; }
+    if (*len >= maxLen) return false;
+    buf[*len] = c;
+    (*len)++;
+    return true;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if c is accepted by the parser state machine, else false.                        */
+/* --------------------------------------------------------------------------------------------- */
+static bool _SSFJsonStreamChar(SSFJsonStream_t *jss, char c)
+{
+    bool done;
+    size_t i;
+    size_t start;
+    size_t end;
+
+    switch (jss->state)
+    {
+    case SSF_JSON_STREAM_STATE_START:
+        if (SSFJsonIsWhitespace(c)) return true;
+        if (c != '{') return false;
+        return _SSFJsonStreamOpen(jss, false);
+    case SSF_JSON_STREAM_STATE_OPEN_OBJECT:
+        if (c == '}') return _SSFJsonStreamClose(jss, c);
+        /* Falls through */
+    case SSF_JSON_STREAM_STATE_KEY_START:
+        if (SSFJsonIsWhitespace(c)) return true;
+        if (c != '"') return false;
+        jss->keyLen = 0;
+        jss->sub = 0;
+        jss->state = SSF_JSON_STREAM_STATE_KEY;
+        return true;
+    case SSF_JSON_STREAM_STATE_KEY:
+        if (!_SSFJsonStreamStringChar(jss, jss->key, &jss->keyLen,
+                                      SSF_JSON_CONFIG_STREAM_MAX_KEY_LEN, c, &done)) return false;
+        if (done) jss->state = SSF_JSON_STREAM_STATE_COLON;
+        return true;
+    case SSF_JSON_STREAM_STATE_COLON:
+        if (SSFJsonIsWhitespace(c)) return true;
+        if (c != ':') return false;
+        jss->state = SSF_JSON_STREAM_STATE_VALUE;
+        return true;
+    case SSF_JSON_STREAM_STATE_OPEN_ARRAY:
+        if (c == ']') return _SSFJsonStreamClose(jss, c);
+        /* Falls through */
+    case SSF_JSON_STREAM_STATE_VALUE:
+        if (SSFJsonIsWhitespace(c)) return true;
+        jss->valLen = 0;
+        jss->sub = 0;
+        if (c == '{') return _SSFJsonStreamOpen(jss, false);
+        if (c == '[') return _SSFJsonStreamOpen(jss, true);
+        if (c == '"') {jss->state = SSF_JSON_STREAM_STATE_STRING; return true; }
+        if ((c == '-') || ((c >= '0') && (c <= '9')))
+        {
+            jss->val[jss->valLen] = c;
+            jss->valLen++;
+            jss->state = SSF_JSON_STREAM_STATE_NUMBER;
+            return true;
+        }
+        if (c == 't') jss->lit = "true";
+        else if (c == 'f') jss->lit = "false";
+        else if (c == 'n') jss->lit = "null";
+        else return false;
+        jss->val[jss->valLen] = c;
+        jss->valLen++;
+        jss->state = SSF_JSON_STREAM_STATE_LITERAL;
+        return true;
+    case SSF_JSON_STREAM_STATE_STRING:
+        /* Deliver a full buffer as a part, early if an escape sequence would not fit */
+        if ((jss->sub == 0) && (c != '"') &&
+            ((jss->valLen == SSF_JSON_CONFIG_STREAM_MAX_VAL_LEN) ||
+             ((c == '\\') && (jss->valLen > (SSF_JSON_CONFIG_STREAM_MAX_VAL_LEN - 6)))))
+        {
+            jss->val[jss->valLen] = 0;
+            if (!_SSFJsonStreamEmit(jss, SSF_JSON_STREAM_EVENT_PART, SSF_JSON_TYPE_STRING,
+                                    jss->val, jss->valLen)) return false;
+            jss->valLen = 0;
+        }
+        if (!_SSFJsonStreamStringChar(jss, jss->val, &jss->valLen,
+                                      SSF_JSON_CONFIG_STREAM_MAX_VAL_LEN, c, &done)) return false;
+        if (done) return _SSFJsonStreamValueDone(jss, SSF_JSON_TYPE_STRING);
+        return true;
+    case SSF_JSON_STREAM_STATE_NUMBER:
+        if (SSFJsonIsNumberChar(c))
+        {
+            if (jss->valLen >= SSF_JSON_CONFIG_STREAM_MAX_VAL_LEN) return false;
+            jss->val[jss->valLen] = c;
+            jss->valLen++;
+            return true;
+        }
+        /* Number ends at first non-number char, which is then processed as a delimiter */
+        jss->val[jss->valLen] = 0;
+        i = 0;
+        if ((!_SSFJsonNumber(jss->val, &i, &start, &end, NULL)) || (i != jss->valLen))
+        {return false; }
+        if (!_SSFJsonStreamValueDone(jss, SSF_JSON_TYPE_NUMBER)) return false;
+        return _SSFJsonStreamChar(jss, c);
+    case SSF_JSON_STREAM_STATE_LITERAL:
+        if (c != jss->lit[jss->valLen]) return false;
+        jss->val[jss->valLen] = c;
+        jss->valLen++;
+        if (jss->lit[jss->valLen] != 0) return true;
+        if (jss->lit[0] == 't') return _SSFJsonStreamValueDone(jss, SSF_JSON_TYPE_TRUE);
+        if (jss->lit[0] == 'f') return _SSFJsonStreamValueDone(jss, SSF_JSON_TYPE_FALSE);
+        return _SSFJsonStreamValueDone(jss, SSF_JSON_TYPE_NULL);
+    case SSF_JSON_STREAM_STATE_AFTER_VALUE:
+        if (SSFJsonIsWhitespace(c)) return true;
+        if (c != ',') return _SSFJsonStreamClose(jss, c);
+        jss->state = jss->isArray[jss->depth - 1] ? SSF_JSON_STREAM_STATE_VALUE :
+                                                    SSF_JSON_STREAM_STATE_KEY_START;
+        return true;
+    case SSF_JSON_STREAM_STATE_DONE:
+        return SSFJsonIsWhitespace(c);
+    default:
+        break;
+    }
+    return false;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Inits or reinits a streaming parser context.                                                  */
+/* --------------------------------------------------------------------------------------------- */
+void SSFJsonStreamInit(SSFJsonStream_t *jss, SSFJsonStreamFn_t fn, void *ctx)
+{
+    SSF_REQUIRE(jss != NULL);
+    SSF_REQUIRE(fn != NULL);
+
+    memset(jss, 0, sizeof(SSFJsonStream_t));
+    jss->fn = fn;
+    jss->ctx = ctx;
+    jss->state = SSF_JSON_STREAM_STATE_START;
+    jss->magic = SSF_JSON_STREAM_MAGIC;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Deinits a streaming parser context.                                                           */
+/* --------------------------------------------------------------------------------------------- */
+void SSFJsonStreamDeInit(SSFJsonStream_t *jss)
+{
+    SSF_REQUIRE(jss != NULL);
+    SSF_REQUIRE(jss->magic == SSF_JSON_STREAM_MAGIC);
+
+    memset(jss, 0, sizeof(SSFJsonStream_t));
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if chunk of JSON string parsed without error so far, else false.                 */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFJsonStreamFeed(SSFJsonStream_t *jss, SSFCStrIn_t in, size_t inLen)
+{
+    SSF_REQUIRE(jss != NULL);
+    SSF_REQUIRE(jss->magic == SSF_JSON_STREAM_MAGIC);
+    SSF_REQUIRE(in != NULL);
+
+    if (jss->state == SSF_JSON_STREAM_STATE_ERROR) return false;
+    while (inLen != 0)
+    {
+        if (!_SSFJsonStreamChar(jss, *in))
+        {jss->state = SSF_JSON_STREAM_STATE_ERROR; return false; }
+        in++;
+        inLen--;
+    }
+    return true;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if all bytes in fifo parsed without error so far, else false; Empties fifo.      */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFJsonStreamFeedBFifo(SSFJsonStream_t *jss, SSFBFifo_t *fifo)
+{
+    uint8_t c;
+    bool rv = true;
+
+    SSF_REQUIRE(jss != NULL);
+    SSF_REQUIRE(jss->magic == SSF_JSON_STREAM_MAGIC);
+    SSF_REQUIRE(fifo != NULL);
+
+    while (SSFBFifoGetByte(fifo, &c))
+    {
+        if (rv) rv = SSFJsonStreamFeed(jss, (SSFCStrIn_t)&c, 1);
+    }
+    return rv;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if a complete JSON object has been parsed, else false.                           */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFJsonStreamIsDone(const SSFJsonStream_t *jss)
+{
+    SSF_REQUIRE(jss != NULL);
+    SSF_REQUIRE(jss->magic == SSF_JSON_STREAM_MAGIC);
+
+    return jss->state == SSF_JSON_STREAM_STATE_DONE;
+}
+#endif /* SSF_JSON_CONFIG_ENABLE_STREAM */
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if char added to js, else false.                                                 */
+/* --------------------------------------------------------------------------------------------- */
+static bool _SSFJsonPrintUnescChar(SSFCStrOut_t js, size_t size, size_t start, size_t *end, const char in)
+{
+    SSF_REQUIRE(js != NULL);
+    SSF_REQUIRE(end != NULL);
+
+    if (start >= size) return false;
+    js[start] = in;
+    *end = start + 1;
+    return true;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if in string added successfully as escaped string, else false.                   */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFJsonPrintCString(SSFCStrOut_t js, size_t size, size_t start, size_t *end, SSFCStrIn_t in,
+                         bool *comma)
+{
+    SSF_REQUIRE(js != NULL);
+    SSF_REQUIRE(end != NULL);
+    SSF_REQUIRE(in != NULL);
+    SSF_REQUIRE((comma == NULL) || (comma != (bool *)true));
+
+    SSF_JSON_COMMA(comma);
+    while (start < size)
+    {
+        if (*in == '\\') SSFJsonEsc(js, '\\');
+        else if (*in == '\"') SSFJsonEsc(js, '\"');
+        else if (*in == '/') SSFJsonEsc(js, '/');
+        else if (*in == '\r') SSFJsonEsc(js, 'r');
+        else if (*in == '\n') SSFJsonEsc(js, 'n');
+        else if (*in == '\t') SSFJsonEsc(js, 't');
+        else if (*in == '\b') SSFJsonEsc(js, 'b');
+        else if (*in == '\f') SSFJsonEsc(js, 'f');
+        else if (((*in > 0x1f) && (*in < 0x7f)) || (*in == 0))
+        {js[start] = *in; } /* Normal ASCII character */
+        else
+        {
+            if (start + 6 >= size) return false;
+            js[start] = '\\'; start++;
+            js[start] = 'u'; start++;
+            js[start] = '0'; start++;
+            js[start] = '0'; start++;
+            snprintf(&js[start], 3, "%02X", (uint8_t)*in);
+            start++;
+        }
+        if (*in == 0)
+        {*end = start; return true; }
+        start++;
+        in++;
+    }
+    return false;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if in string added successfully as quoted escaped string, else false.            */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFJsonPrintString(SSFCStrOut_t js, size_t size, size_t start, size_t *end, SSFCStrIn_t in,
+                        bool *comma)
+{
+    SSF_REQUIRE(js != NULL);
+    SSF_REQUIRE(end != NULL);
+    SSF_REQUIRE(in != NULL);
+    SSF_REQUIRE((comma == NULL) || (comma != (bool *)true));
+
+    SSF_JSON_COMMA(comma);
+    if (!_SSFJsonPrintUnescChar(js, size, start, &start, '\"')) return false;
+    if (!SSFJsonPrintCString(js, size, start, &start, in, false)) return false;
+    if (!_SSFJsonPrintUnescChar(js, size, start, &start, '\"')) return false;
+    *end = start;
+    return true;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if in label element added successfully, else false.                              */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFJsonPrintLabel(SSFCStrOut_t js, size_t size, size_t start, size_t *end, SSFCStrIn_t in,
+                       bool *comma)
+{
+    SSF_REQUIRE(js != NULL);
+    SSF_REQUIRE(end != NULL);
+    SSF_REQUIRE(in != NULL);
+    SSF_REQUIRE((comma == NULL) || (comma != (bool *)true));
+
+    SSF_JSON_COMMA(comma);
+    if (!SSFJsonPrintString(js, size, start, &start, in, false)) return false;
+    if (!_SSFJsonPrintUnescChar(js, size, start, &start, ':')) return false;
+    *end = start;
+    return true;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if in data added successfully as quoted ASCII hex string, else false.            */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFJsonPrintHex(SSFCStrOut_t js, size_t size, size_t start, size_t *end, const uint8_t *in,
+                     size_t inLen, bool rev, bool *comma)
+{
+    size_t outLen;
+
+    SSF_REQUIRE(js != NULL);
+    SSF_REQUIRE(end != NULL);
+    SSF_REQUIRE(in != NULL);
+    SSF_REQUIRE((comma == NULL) || (comma != (bool *)true));
+
+    SSF_JSON_COMMA(comma);
+    if (!_SSFJsonPrintUnescChar(js, size, start, &start, '"')) return false;
+    if (start >= size) return false;
+    if (!SSFHexBinToBytes(in, inLen, &js[start], size - start, &outLen, rev, SSF_HEX_CASE_UPPER))
+    {return false; }
+    start += outLen;
+    if (!_SSFJsonPrintUnescChar(js, size, start, &start, '"')) return false;
+    *end = start;
+    return true;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if in data added successfully as quoted Base64 string in fmt, else false.        */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFJsonPrintBase64Fmt(SSFCStrOut_t js, size_t size, size_t start, size_t *end,
+                           const uint8_t *in, size_t inLen, SSFBase64Fmt_t fmt, bool *comma)
+{
+    size_t outLen;
+
+    SSF_REQUIRE(js != NULL);
+    SSF_REQUIRE(end != NULL);
+    SSF_REQUIRE(in != NULL);
+    SSF_REQUIRE((comma == NULL) || (comma != (bool *)true));
+
+    SSF_JSON_COMMA(comma);
+    if (!_SSFJsonPrintUnescChar(js, size, start, &start, '"')) return false;
+    if (!SSFBase64EncodeFmt(in, inLen, &js[start], size - start, &outLen, fmt)) return false;
+    start += outLen;
+    if (!_SSFJsonPrintUnescChar(js, size, start, &start, '"')) return false;
+    *end = start;
+    return true;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if in data added successfully as quoted Base64 string, else false.               */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFJsonPrintBase64(SSFCStrOut_t js, size_t size, size_t start, size_t *end,
+                        const uint8_t *in, size_t inLen, bool *comma)
+{
+    return SSFJsonPrintBase64Fmt(js, size, start, end, in, inLen, SSF_BASE64_FMT_STD, comma);
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if in, negative if neg, added to JSON string as decimal digits, else false.      */
+/* --------------------------------------------------------------------------------------------- */
+static bool _SSFJsonPrintDigits(SSFCStrOut_t js, size_t size, size_t start, size_t *end,
+                                unsigned long in, bool neg)
+{
+    char buf[24];
+    size_t i = sizeof(buf);
+    size_t len;
+
+    /* Convert two digits per divide, least significant first */
+    while (in >= 100)
+    {
+        i -= 2;
+        memcpy(&buf[i], &_SSFJsonDigitPairs[(in % 100) << 1], 2);
+        in /= 100;
+    }
+    if (in >= 10)
+    {
+        i -= 2;
+        memcpy(&buf[i], &_SSFJsonDigitPairs[in << 1], 2);
+    }
+    else buf[--i] = (char)('0' + in);
+    if (neg) buf[--i] = '-';
+
+    len = sizeof(buf) - i;
+    if (len >= (size - start)) return false;
+    memcpy(&js[start], &buf[i], len);
+    js[start + len] = 0;
+    *end = start + len;
+    return true;
+}
+
+#if SSF_JSON_CONFIG_ENABLE_FLOAT_GEN == 1
+/* --------------------------------------------------------------------------------------------- */
+/* Returns x * y rounded to the upper 64 bits of the product.                                    */
+/* --------------------------------------------------------------------------------------------- */
+static SSFJsonDiyFp_t _SSFJsonDiyFpMul(SSFJsonDiyFp_t x, SSFJsonDiyFp_t y)
+{
+    SSFJsonDiyFp_t r;
+    uint64_t a = x.f >> 32;
+    uint64_t b = x.f & 0xFFFFFFFFull;
+    uint64_t c = y.f >> 32;
+    uint64_t d = y.f & 0xFFFFFFFFull;
+    uint64_t ac = a * c;
+    uint64_t bc = b * c;
+    uint64_t ad = a * d;
+    uint64_t bd = b * d;
+    uint64_t tmp;
+
+    tmp = (bd >> 32) + (ad & 0xFFFFFFFFull) + (bc & 0xFFFFFFFFull);
+    tmp += 1ull << 31;
+    r.f = ac + (ad >> 32) + (bc >> 32) + (tmp >> 32);
+    r.e = x.e + y.e + 64;
+    return r;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns x shifted left until the most significant bit of f is set.                            */
+/* --------------------------------------------------------------------------------------------- */
+static SSFJsonDiyFp_t _SSFJsonDiyFpNorm(SSFJsonDiyFp_t x)
+{
+    while ((x.f & SSF_JSON_DBL_SIGN) == 0) {x.f <<= 1; x.e--; }
+    return x;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Adjusts last digit of buf to be the closest to the exact value within the rounding interval.  */
+/* --------------------------------------------------------------------------------------------- */
+static void _SSFJsonGrisuRound(char *buf, size_t len, uint64_t delta, uint64_t rest,
+                               uint64_t tenKappa, uint64_t wpw)
+{
+    while ((rest < wpw) && ((delta - rest) >= tenKappa) &&
+           (((rest + tenKappa) < wpw) || ((wpw - rest) > (rest + tenKappa - wpw))))
+    {
+        buf[len - 1]--;
+        rest += tenKappa;
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Generates the fewest digits of mp that stay within delta of it; Adjusts decimal exponent k.   */
+/* --------------------------------------------------------------------------------------------- */
+static void _SSFJsonGrisuDigits(SSFJsonDiyFp_t w, SSFJsonDiyFp_t mp, uint64_t delta, char *buf,
+                                size_t *len, int *k)
+{
+    uint64_t one = 1ull << -mp.e;
+    uint64_t wpw = mp.f - w.f;
+    uint32_t p1 = (uint32_t)(mp.f >> -mp.e);
+    uint64_t p2 = mp.f & (one - 1);
+    uint32_t d;
+    uint64_t rest;
+    int kappa;
+
+    for (kappa = 1; (kappa < 10) && (p1 >= _SSFJsonPow10[kappa]); kappa++);
+
+    /* Integer part digits */
+    *len = 0;
+    while (kappa > 0)
+    {
+        d = (uint32_t)(p1 / _SSFJsonPow10[kappa - 1]);
+        p1 = (uint32_t)(p1 % _SSFJsonPow10[kappa - 1]);
+        if ((d != 0) || (*len != 0)) buf[(*len)++] = (char)('0' + d);
+        kappa--;
+        rest = (((uint64_t)p1) << -mp.e) + p2;
+        if (rest <= delta)
+        {
+            *k += kappa;
+            _SSFJsonGrisuRound(buf, *len, delta, rest, _SSFJsonPow10[kappa] << -mp.e, wpw);
+            return;
+        }
+    }
+
+    /* Fractional part digits */
+    while (true)
+    {
+        p2 *= 10;
+        delta *= 10;
+        d = (uint32_t)(p2 >> -mp.e);
+        if ((d != 0) || (*len != 0)) buf[(*len)++] = (char)('0' + d);
+        p2 &= one - 1;
+        kappa--;
+        if (p2 < delta)
+        {
+            *k += kappa;
+            _SSFJsonGrisuRound(buf, *len, delta, p2, one,
+                               wpw * ((-kappa < 20) ? _SSFJsonPow10[-kappa] : 0));
+            return;
+        }
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Generates shortest digits of finite in > 0 that round trip; in == buf * 10^k (Grisu2).        */
+/* --------------------------------------------------------------------------------------------- */
+static void _SSFJsonGrisu2(double in, char *buf, size_t *len, int *k)
+{
+    uint64_t u;
+    SSFJsonDiyFp_t v;
+    SSFJsonDiyFp_t mp;
+    SSFJsonDiyFp_t mm;
+    SSFJsonDiyFp_t c;
+    double dk;
+    int ck;
+    size_t index;
+
+    /* Unpack in, and its rounding interval boundaries, into normalized binary floating point */
+    memcpy(&u, &in, sizeof(u));
+    v.e = (int)((u & SSF_JSON_DBL_EXP) >> 52);
+    v.f = u & SSF_JSON_DBL_SIGNIF;
+    if (v.e != 0) {v.f += SSF_JSON_DBL_HIDDEN; v.e -= 1075; }
+    else v.e = -1074;
+    mp.f = (v.f << 1) + 1;
+    mp.e = v.e - 1;
+    while ((mp.f & (SSF_JSON_DBL_HIDDEN << 1)) == 0) {mp.f <<= 1; mp.e--; }
+    mp.f <<= 10;
+    mp.e -= 10;
+    if (v.f == SSF_JSON_DBL_HIDDEN) {mm.f = (v.f << 2) - 1; mm.e = v.e - 2; }
+    else {mm.f = (v.f << 1) - 1; mm.e = v.e - 1; }
+    mm.f <<= mm.e - mp.e;
+    mm.e = mp.e;
+
+    /* Scale by a cached power of 10 so the upper boundary's exponent is within [-60, -32] */
+    dk = ((-61 - mp.e) * 0.30102999566398114) + 347;
+    ck = (int)dk;
+    if ((dk - ck) > 0.0) ck++;
+    index = (size_t)((ck >> 3) + 1);
+    *k = -(-348 + (int)(index << 3));
+    c.f = _SSFJsonCachedPowF[index];
+    c.e = _SSFJsonCachedPowE[index];
+
+    v = _SSFJsonDiyFpMul(_SSFJsonDiyFpNorm(v), c);
+    mp = _SSFJsonDiyFpMul(mp, c);
+    mm = _SSFJsonDiyFpMul(mm, c);
+    mm.f++;
+    mp.f--;
+    _SSFJsonGrisuDigits(v, mp, mp.f - mm.f, buf, len, k);
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if finite in added to JSON string with fewest digits that round trip, else false.*/
+/* --------------------------------------------------------------------------------------------- */
+static bool _SSFJsonPrintShortest(SSFCStrOut_t js, size_t size, size_t start, size_t *end,
+                                  double in)
+{
+    char digits[20];
+    char buf[32];
+    size_t dlen;
+    size_t len = 0;
+    uint64_t u;
+    int k;
+    int n;
+    int i;
+
+    memcpy(&u, &in, sizeof(u));
+    if ((u & SSF_JSON_DBL_EXP) == SSF_JSON_DBL_EXP) return false;
+    if ((u & SSF_JSON_DBL_SIGN) != 0) {buf[len++] = '-'; u &= ~SSF_JSON_DBL_SIGN; }
+    if (u == 0) {digits[0] = '0'; dlen = 1; k = 0; }
+    else
+    {
+        memcpy(&in, &u, sizeof(in));
+        _SSFJsonGrisu2(in, digits, &dlen, &k);
+    }
+
+    /* Value is 0.digits * 10^n, print like JavaScript's Number.prototype.toString() */
+    n = (int)dlen + k;
+    if ((k >= 0) && (n <= 21))
+    {
+        /* 1234e7 -> 12340000000 */
+        memcpy(&buf[len], digits, dlen);
+        len += dlen;
+        for (i = 0; i < k; i++) buf[len++] = '0';
+    }
+    else if ((n > 0) && (n <= 21))
+    {
+        /* 1234e-2 -> 12.34 */
+        memcpy(&buf[len], digits, (size_t)n);
+        len += (size_t)n;
+        buf[len++] = '.';
+        memcpy(&buf[len], &digits[n], dlen - (size_t)n);
+        len += dlen - (size_t)n;
+    }
+    else if ((n > -6) && (n <= 0))
+    {
+        /* 1234e-6 -> 0.001234 */
+        buf[len++] = '0';
+        buf[len++] = '.';
+        for (i = n; i < 0; i++) buf[len++] = '0';
+        memcpy(&buf[len], digits, dlen);
+        len += dlen;
+    }
+    else
+    {
+        /* 1234e30 -> 1.234e+33 */
+        buf[len++] = digits[0];
+        if (dlen > 1)
+        {
+            buf[len++] = '.';
+            memcpy(&buf[len], &digits[1], dlen - 1);
+            len += dlen - 1;
+        }
+        buf[len++] = 'e';
+        buf[len++] = (n > 0) ? '+' : '-';
+        n = (n > 0) ? (n - 1) : (1 - n);
+        if (n >= 100) {buf[len++] = (char)('0' + (n / 100)); n %= 100; }
+        else if (n < 10) {buf[len++] = (char)('0' + n); n = -1; }
+        if (n >= 0)
+        {
+            memcpy(&buf[len], &_SSFJsonDigitPairs[n << 1], 2);
+            len += 2;
+        }
+    }
+
+    if (len >= (size - start)) return false;
+    memcpy(&js[start], buf, len);
+    js[start + len] = 0;
+    *end = start + len;
+    return true;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if in double added successfully to JSON string, else false.                      */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFJsonPrintDouble(SSFCStrOut_t js, size_t size, size_t start, size_t *end, double in,
+                        SSFJsonFltFmt_t fmt, bool *comma)
+{
+    int len = 0;
+
+    SSF_REQUIRE(js != NULL);
+    SSF_REQUIRE(start <= size);
+    SSF_REQUIRE(end != NULL);
+    SSF_REQUIRE((fmt >= 0) && (fmt < SSF_JSON_FLT_FMT_MAX));
+    SSF_REQUIRE((comma == NULL) || (comma != (bool *)true));
+
+    SSF_JSON_COMMA(comma);
+    if (fmt == SSF_JSON_FLT_FMT_SHORTEST) return _SSFJsonPrintShortest(js, size, start, end, in);
+    if (fmt == SSF_JSON_FLT_FMT_SHORT) len = snprintf(&js[start], size - start, "%g", in);
+    else if (fmt == SSF_JSON_FLT_FMT_STD) len = snprintf(&js[start], size - start, "%f", in);
+    else
+    {
+        size_t delta = size - start;
+        char *ptr = &js[start];
+
+        switch (fmt)
+        {
+            case 0: len = snprintf(ptr, delta, "%.0f", in); break;
+            case 1: len = snprintf(ptr, delta, "%.1f", in); break;
+            case 2: len = snprintf(ptr, delta, "%.2f", in); break;
+            case 3: len = snprintf(ptr, delta, "%.3f", in); break;
+            case 4: len = snprintf(ptr, delta, "%.4f", in); break;
+            case 5: len = snprintf(ptr, delta, "%.5f", in); break;
+            case 6: len = snprintf(ptr, delta, "%.6f", in); break;
+            case 7: len = snprintf(ptr, delta, "%.7f", in); break;
+            case 8: len = snprintf(ptr, delta, "%.8f", in); break;
+            case 9: len = snprintf(ptr, delta, "%.9f", in); break;
+            case SSF_JSON_FLT_FMT_SHORT:
+            case SSF_JSON_FLT_FMT_SHORTEST:
+            case SSF_JSON_FLT_FMT_STD:
+            case SSF_JSON_FLT_FMT_MAX:
+            default:
+                SSF_ERROR(); break;
+        }
+    }
+    if ((len < 0) || (((size_t)len) >= (size - start))) return false;
+    *end = start + len;
+    return true;
+}
+#endif /* SSF_JSON_CONFIG_ENABLE_FLOAT_GEN */
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if in signed int added successfully to JSON string, else false.                  */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFJsonPrintInt(SSFCStrOut_t js, size_t size, size_t start, size_t *end, long in,
+                     bool *comma)
+{
+    SSF_REQUIRE(js != NULL);
+    SSF_REQUIRE(start <= size);
+    SSF_REQUIRE(end != NULL);
+    SSF_REQUIRE((comma == NULL) || (comma != (bool *)true));
+
+    SSF_JSON_COMMA(comma);
+    if (in < 0) return _SSFJsonPrintDigits(js, size, start, end, 0ul - (unsigned long)in, true);
+    return _SSFJsonPrintDigits(js, size, start, end, (unsigned long)in, false);
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if in unsigned int added successfully to JSON string, else false.                */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFJsonPrintUInt(SSFCStrOut_t js, size_t size, size_t start, size_t *end, unsigned long in,
+                      bool *comma)
+{
+    SSF_REQUIRE(js != NULL);
+    SSF_REQUIRE(start <= size);
+    SSF_REQUIRE(end != NULL);
+    SSF_REQUIRE((comma == NULL) || (comma != (bool *)true));
+
+    SSF_JSON_COMMA(comma);
+    return _SSFJsonPrintDigits(js, size, start, end, in, false);
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if all printing added successfully to JSON string, else false.                   */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFJsonPrint(SSFCStrOut_t js, size_t size, size_t start, size_t *end, SSFJsonPrintFn_t fn,
+                  void *in, const char *oc, bool *comma)
+{
+    SSF_REQUIRE(js != NULL);
+    SSF_REQUIRE(start <= size);
+    SSF_REQUIRE(end != NULL);
+    SSF_REQUIRE((comma == NULL) || (comma != (bool *)true));
+
+    SSF_JSON_COMMA(comma);
+    if ((oc != NULL) && (!_SSFJsonPrintUnescChar(js, size, start, &start, oc[0]))) return false;
+    if ((fn != NULL) && (!fn(js, size, start, &start, in))) return false;
+    if ((oc != NULL) && (!_SSFJsonPrintUnescChar(js, size, start, &start, oc[1]))) return false;
+    if (!_SSFJsonPrintUnescChar(js, size, start, &start, 0)) return false;
+    *end = start - 1;
+    return true;
+}
+
+#if SSF_JSON_CONFIG_ENABLE_UPDATE == 1
+/* --------------------------------------------------------------------------------------------- */
+/* Printer function for SSFJsonUpdate() when adding paths is required.                           */
+/* --------------------------------------------------------------------------------------------- */
+static bool _SSFJsonUpdateAddPath(SSFCStrOut_t js, size_t size, size_t start, size_t *end,
+                                  void *in)
+{
+    SSFJSONAddPath_t *ap = (SSFJSONAddPath_t *)in;
+
+    SSF_REQUIRE(in != NULL);
+
+    if (ap->path[ap->depth] != NULL)
+    {
+        if (!SSFJsonPrintLabel(js, size, start, &start, ap->path[ap->depth], false))
+        {return false; }
+        ap->depth++;
+        if (ap->path[ap->depth] == NULL)
+        {
+            if (!SSFJsonPrint(js, size, start, &start, _SSFJsonUpdateAddPath, ap, NULL, false))
+            {return false; }
+        } else
+        {
+            if (!SSFJsonPrintObject(js, size, start, &start, _SSFJsonUpdateAddPath, ap, false))
+            {return false; }
+        }
+    } else ap->fn(js, size, start, &start, NULL);
+    *end = start;
+    return true;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if field value updated, object path created as needed, else false.               */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFJsonUpdate(SSFCStrOut_t js, size_t size, SSFCStrIn_t *path, SSFJsonPrintFn_t fn)
+{
+    size_t start;
+    size_t end;
+    size_t index;
+    SSFJsonType_t jt;
+    size_t len;
+    char *path2[SSF_JSON_CONFIG_MAX_IN_DEPTH + 1];
+    uint8_t i;
+    size_t startn;
+    SSFJSONAddPath_t ap;
+
+    SSF_REQUIRE(js != NULL);
+    SSF_REQUIRE(path != NULL);
+    SSF_REQUIRE(path[SSF_JSON_CONFIG_MAX_IN_DEPTH] == NULL);
+    SSF_REQUIRE(fn != NULL);
+
+    memcpy(path2, path, sizeof(path2));
+    do
+    {
+        if (!SSFJsonObject(js, &index, &start, &end, (SSFCStrIn_t *)path2, 0, &jt)) return false;
+        if (jt != SSF_JSON_TYPE_ERROR) break;
+        for (i = SSF_JSON_CONFIG_MAX_IN_DEPTH; (path2[i] == NULL) && (i >= 1); i--);
+        path2[i] = NULL;
+    } while (jt == SSF_JSON_TYPE_ERROR);
+
+    if (memcmp(path, path2, sizeof(path2)) == 0)
+    {
+        size_t end2;
+
+        /* Exact match to request, updated existing value */
+        len = strlen(js);
+        memmove(&js[size - len + end], &js[end + 1], len - end);
+        if (!fn(&js[start], size - len - end, 0, &end2, &jt)) return false;
+        memmove(&js[start + end2], &js[size - len + end], len - end);
+        return true;
+    }
+    /* Not exact match to request, create missing path */
+    if (jt != SSF_JSON_TYPE_OBJECT) return false;
+
+    for (ap.depth = 0; (path2[ap.depth] != NULL) && (ap.depth <= SSF_JSON_CONFIG_MAX_IN_DEPTH);
+         ap.depth++);
+    len = strlen(js);
+    startn = start + 1;
+    end = end + 1;
+    ap.fn = fn;
+    ap.path = path;
+    memmove(&js[size - len], &js[start + 1], len);
+    if (!SSFJsonPrint(js, size - len - 1, startn, &end, _SSFJsonUpdateAddPath, &ap, NULL, false))
+    {return false; }
+    index = size - len;
+    _SSFJsonWhitespace(js, size, &index);
+    if ((js[index] != '}') && (!_SSFJsonPrintUnescChar(js, size - len - 1, end, &end, ',')))
+    { return false; }
+    memmove(&js[start + (end - startn + 1)], &js[size - len], len);
+    return true;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if path elements from up to but not including to are the same, else false.      */
+/* --------------------------------------------------------------------------------------------- */
+static bool _SSFJsonUpdateManyKeysEq(SSFCStrIn_t *a, SSFCStrIn_t *b, size_t from, size_t to)
+{
+    for (; from < to; from++)
+    {
+        if ((a[from] == NULL) || (b[from] == NULL)) return a[from] == b[from];
+        if (strcmp(a[from], b[from]) != 0) return false;
+    }
+    return true;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true to continue walk; Finds the value, or deepest existing value, at each path.      */
+/* --------------------------------------------------------------------------------------------- */
+static bool _SSFJsonUpdateManyWalkFn(void *ctx, SSFJsonWalkEvent_t ev, size_t depth,
+                                     SSFJsonType_t jt, size_t key, size_t keyLen, size_t start,
+                                     size_t end)
+{
+    SSFJsonUpdateManyCtx_t *um = (SSFJsonUpdateManyCtx_t *)ctx;
+    SSFJsonUpdate_t *up;
+
+    SSF_REQUIRE(ctx != NULL);
+
+    for (up = um->ups; up < &um->ups[um->upsLen]; up++)
+    {
+        if (up->match.done) continue;
+        _SSFJsonWalkPathFn(&up->match, ev, depth, jt, key, keyLen, start, end);
+        if (up->match.done) up->jt = jt;
+    }
+    return true;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if no update changes a value that another update changes or adds to, else false. */
+/* --------------------------------------------------------------------------------------------- */
+static bool _SSFJsonUpdateManyIsDisjoint(const SSFJsonUpdate_t *a, const SSFJsonUpdate_t *b)
+{
+    size_t i;
+
+    if (SSFJsonUpdateIsExact(a))
+    {
+        if (SSFJsonUpdateIsExact(b))
+        {
+            return (a->match.end < b->match.start) || (b->match.end < a->match.start);
+        }
+        return (b->match.start < a->match.start) || (b->match.start > a->match.end);
+    }
+    if (SSFJsonUpdateIsExact(b)) return _SSFJsonUpdateManyIsDisjoint(b, a);
+
+    /* Both add to the same object, neither added path may be a prefix of the other */
+    if (a->match.start != b->match.start) return true;
+    for (i = a->match.depth; (a->path[i] != NULL) && (b->path[i] != NULL); i++)
+    {if (strcmp(a->path[i], b->path[i]) != 0) return true; }
+    return false;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Printer function for SSFJsonUpdateMany() adding all missing paths that share a prefix.        */
+/* --------------------------------------------------------------------------------------------- */
+static bool _SSFJsonUpdateManyAddPath(SSFCStrOut_t js, size_t size, size_t start, size_t *end,
+                                      void *in)
+{
+    SSFJsonUpdateManyCtx_t *um = (SSFJsonUpdateManyCtx_t *)in;
+    SSFJsonUpdateManyCtx_t umn;
+    SSFJsonUpdate_t *first;
+    SSFJsonUpdate_t *up;
+    SSFJsonUpdate_t *prev;
+    bool comma = false;
+
+    SSF_REQUIRE(in != NULL);
+
+    first = &um->ups[um->first];
+    for (up = first; up < &um->ups[um->upsLen]; up++)
+    {
+        /* Skip updates that do not add under the same prefix as first */
+        if (SSFJsonUpdateIsExact(up) || (up->match.start != first->match.start) ||
+            (!_SSFJsonUpdateManyKeysEq(up->path, first->path, first->match.depth, um->depth)))
+        {continue; }
+
+        /* Skip updates whose key at this depth was already printed by an earlier update */
+        for (prev = first; prev < up; prev++)
+        {
+            if ((!SSFJsonUpdateIsExact(prev)) && (prev->match.start == first->match.start) &&
+                _SSFJsonUpdateManyKeysEq(prev->path, up->path, first->match.depth,
+                                         um->depth + 1)) break;
+        }
+        if (prev != up) continue;
+
+        if (!SSFJsonPrintLabel(js, size, start, &start, up->path[um->depth], &comma))
+        {return false; }
+        if (up->path[um->depth + 1] == NULL)
+        {
+            if (!up->fn(js, size, start, &start, up->in)) return false;
+        }
+        else
+        {
+            umn = *um;
+            umn.first = (size_t)(up - um->ups);
+            umn.depth = um->depth + 1;
+            if (!SSFJsonPrintObject(js, size, start, &start, _SSFJsonUpdateManyAddPath, &umn,
+                                    false)) return false;
+        }
+    }
+    *end = start;
+    return true;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if js copied to out with all values updated, object paths created as needed.     */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFJsonUpdateMany(SSFCStrIn_t js, SSFCStrOut_t out, size_t outSize, size_t *outLen,
+                       SSFJsonUpdate_t *ups, size_t upsLen)
+{
+    uint8_t stack[SSF_JSON_STACK_SIZE(SSF_JSON_CONFIG_MAX_WALK_DEPTH)];
+    SSFJsonUpdateManyCtx_t um;
+    SSFJsonUpdate_t *up;
+    SSFJsonUpdate_t *next;
+    SSFJsonUpdate_t *up2;
+    size_t len;
+    size_t index;
+    size_t prev;
+    size_t i;
+    size_t o = 0;
+
+    SSF_REQUIRE(js != NULL);
+    SSF_REQUIRE(out != NULL);
+    SSF_REQUIRE(out != js);
+    SSF_REQUIRE(ups != NULL);
+
+    for (up = ups; up < &ups[upsLen]; up++)
+    {
+        SSF_REQUIRE(up->path != NULL);
+        SSF_REQUIRE(up->path[0] != NULL);
+        SSF_REQUIRE(up->path[SSF_JSON_CONFIG_MAX_IN_DEPTH] == NULL);
+        SSF_REQUIRE(up->fn != NULL);
+
+        memset(&up->match, 0, sizeof(up->match));
+        up->match.js = js;
+        up->match.path = up->path;
+        up->match.jt = SSF_JSON_TYPE_ERROR;
+        up->jt = SSF_JSON_TYPE_ERROR;
+    }
+
+    /* Locate every value, or the deepest existing object on its path, in one pass */
+    um.ups = ups;
+    um.upsLen = upsLen;
+    if (!_SSFJsonWalkRoot(js, &len, stack, SSF_JSON_CONFIG_MAX_WALK_DEPTH,
+                          _SSFJsonUpdateManyWalkFn, &um, NULL)) return false;
+    for (up = ups; up < &ups[upsLen]; up++)
+    {
+        if ((!SSFJsonUpdateIsExact(up)) && (up->jt != SSF_JSON_TYPE_OBJECT)) return false;
+        for (up2 = ups; up2 < up; up2++)
+        {if (!_SSFJsonUpdateManyIsDisjoint(up, up2)) return false; }
+    }
+
+    /* Copy js to out in one pass, rewriting each located value in order of position */
+    index = 0;
+    prev = 0;
+    while (true)
+    {
+        for (next = NULL, up = ups; up < &ups[upsLen]; up++)
+        {
+            if ((SSFJsonUpdatePos(up) > prev) &&
+                ((next == NULL) || (SSFJsonUpdatePos(up) < SSFJsonUpdatePos(next)))) next = up;
+        }
+        prev = (next == NULL) ? len : SSFJsonUpdatePos(next);
+        if ((o + (prev - index)) >= outSize) return false;
+        memcpy(&out[o], &js[index], prev - index);
+        o += prev - index;
+        index = prev;
+        if (next == NULL) break;
+
+        if (SSFJsonUpdateIsExact(next))
+        {
+            /* Replace existing value */
+            if (!next->fn(out, outSize, o, &o, next->in)) return false;
+            index = next->match.end + 1;
+        }
+        else
+        {
+            /* Add missing paths to start of object, separated from existing members by a comma */
+            um.first = (size_t)(next - ups);
+            um.depth = next->match.depth;
+            if (!_SSFJsonUpdateManyAddPath(out, outSize, o, &o, &um)) return false;
+            i = index;
+            _SSFJsonWhitespace(js, len, &i);
+            if ((js[i] != '}') && (!_SSFJsonPrintUnescChar(out, outSize, o, &o, ','))) return false;
+        }
+    }
+    if (o >= outSize) return false;
+    out[o] = 0;
+    if (outLen != NULL) *outLen = o;
+    return true;
+}
+#endif
+
+#if SSF_JSON_CONFIG_ENABLE_GEN == 1
+/* --------------------------------------------------------------------------------------------- */
+/* Inits a streaming generator that stages output in buf and passes it to fn when full.          */
+/* --------------------------------------------------------------------------------------------- */
+void SSFJsonGenInit(SSFJsonGen_t *gen, uint8_t *buf, size_t bufSize, SSFJsonGenFlushFn_t fn,
+                    void *ctx)
+{
+    SSF_REQUIRE(gen != NULL);
+    SSF_REQUIRE(buf != NULL);
+    SSF_REQUIRE(bufSize > 0);
+    SSF_REQUIRE(fn != NULL);
+
+    memset(gen, 0, sizeof(SSFJsonGen_t));
+    gen->buf = buf;
+    gen->bufSize = bufSize;
+    gen->fn = fn;
+    gen->ctx = ctx;
+    gen->magic = SSF_JSON_GEN_MAGIC;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Inits a streaming generator that puts output in fifo, calling fn if !NULL when it is full.   */
+/* --------------------------------------------------------------------------------------------- */
+void SSFJsonGenInitBFifo(SSFJsonGen_t *gen, SSFBFifo_t *fifo, SSFJsonGenFlushFn_t fn, void *ctx)
+{
+    SSF_REQUIRE(gen != NULL);
+    SSF_REQUIRE(fifo != NULL);
+
+    memset(gen, 0, sizeof(SSFJsonGen_t));
+    gen->fifo = fifo;
+    gen->fn = fn;
+    gen->ctx = ctx;
+    gen->magic = SSF_JSON_GEN_MAGIC;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Deinits a streaming generator context.                                                        */
+/* --------------------------------------------------------------------------------------------- */
+void SSFJsonGenDeInit(SSFJsonGen_t *gen)
+{
+    SSF_REQUIRE(gen != NULL);
+    SSF_REQUIRE(gen->magic == SSF_JSON_GEN_MAGIC);
+
+    memset(gen, 0, sizeof(SSFJsonGen_t));
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if in chars written to the sink, else false and generator is in error.           */
+/* --------------------------------------------------------------------------------------------- */
+static bool _SSFJsonGenPut(SSFJsonGen_t *gen, const char *in, size_t inLen)
+{
+    size_t len;
+
+    if (gen->isErr) return false;
+    gen->len += inLen;
+    if (gen->fifo != NULL)
+    {
+        while (inLen > 0)
+        {
+            /* Ask the application to drain a full fifo, fail if it cannot make room */
+            if (SSF_BFIFO_IS_FULL(gen->fifo))
+            {
+                if ((gen->fn == NULL) || (!gen->fn(NULL, 0, gen->ctx)) ||
+                    SSF_BFIFO_IS_FULL(gen->fifo))
+                {gen->isErr = true; return false; }
+            }
+            SSF_BFIFO_PUT_BYTE(gen->fifo, (uint8_t)*in);
+            in++; inLen--;
+        }
+        return true;
+    }
+    while (inLen > 0)
+    {
+        if (gen->bufLen == gen->bufSize)
+        {
+            if (!gen->fn(gen->buf, gen->bufLen, gen->ctx)) {gen->isErr = true; return false; }
+            gen->bufLen = 0;
+        }
+        len = gen->bufSize - gen->bufLen;
+        if (len > inLen) len = inLen;
+        memcpy(&gen->buf[gen->bufLen], in, len);
+        gen->bufLen += len;
+        in += len; inLen -= len;
+    }
+    return true;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if separator before a new value written if required, else false.                 */
+/* --------------------------------------------------------------------------------------------- */
+static bool _SSFJsonGenValue(SSFJsonGen_t *gen)
+{
+    SSF_REQUIRE(gen != NULL);
+    SSF_REQUIRE(gen->magic == SSF_JSON_GEN_MAGIC);
+
+    if (gen->comma && (!_SSFJsonGenPut(gen, ",", 1))) return false;
+    gen->comma = true;
+    return !gen->isErr;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if object or array opened, else false.                                           */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFJsonGenOpen(SSFJsonGen_t *gen, bool isArray)
+{
+    if (!_SSFJsonGenValue(gen)) return false;
+    if (gen->depth >= SSF_JSON_CONFIG_GEN_MAX_DEPTH) {gen->isErr = true; return false; }
+    if (isArray) gen->stack[gen->depth >> 3] |= (uint8_t)(1u << (gen->depth & 7));
+    else gen->stack[gen->depth >> 3] &= (uint8_t)~(1u << (gen->depth & 7));
+    gen->depth++;
+    gen->comma = false;
+    return _SSFJsonGenPut(gen, isArray ? "[" : "{", 1);
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if innermost open object or array closed, else false.                            */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFJsonGenClose(SSFJsonGen_t *gen, bool isArray)
+{
+    SSF_REQUIRE(gen != NULL);
+    SSF_REQUIRE(gen->magic == SSF_JSON_GEN_MAGIC);
+
+    if ((gen->depth == 0) ||
+        (((gen->stack[(gen->depth - 1) >> 3] & (1u << ((gen->depth - 1) & 7))) != 0) != isArray))
+    {gen->isErr = true; return false; }
+    gen->depth--;
+    gen->comma = true;
+    return _SSFJsonGenPut(gen, isArray ? "]" : "}", 1);
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if in written as escaped string body, else false.                                */
+/* --------------------------------------------------------------------------------------------- */
+static bool _SSFJsonGenEscaped(SSFJsonGen_t *gen, SSFCStrIn_t in)
+{
+    size_t len;
+    char c[2];
+    char esc[7];
+    size_t escLen;
+
+    while (*in != 0)
+    {
+        /* Write runs of characters that need no escaping at once */
+        for (len = 0; (((in[len] > 0x1f) && (in[len] < 0x7f)) && (in[len] != '\\') &&
+                       (in[len] != '"') && (in[len] != '/')); len++);
+        if ((len > 0) && (!_SSFJsonGenPut(gen, in, len))) return false;
+        in += len;
+        if (*in == 0) break;
+
+        /* Same escapes as SSFJsonPrintCString() */
+        c[0] = *in;
+        c[1] = 0;
+        SSF_ASSERT(SSFJsonPrintCString(esc, sizeof(esc), 0, &escLen, c, NULL));
+        if (!_SSFJsonGenPut(gen, esc, escLen)) return false;
+        in++;
+    }
+    return true;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if in label written, else false.                                                 */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFJsonGenLabel(SSFJsonGen_t *gen, SSFCStrIn_t in)
+{
+    SSF_REQUIRE(in != NULL);
+
+    if (!_SSFJsonGenValue(gen)) return false;
+    gen->comma = false;
+    if (!_SSFJsonGenPut(gen, "\"", 1)) return false;
+    if (!_SSFJsonGenEscaped(gen, in)) return false;
+    return _SSFJsonGenPut(gen, "\":", 2);
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if in written as quoted escaped string, else false.                              */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFJsonGenString(SSFJsonGen_t *gen, SSFCStrIn_t in)
+{
+    SSF_REQUIRE(in != NULL);
+
+    if (!_SSFJsonGenValue(gen)) return false;
+    if (!_SSFJsonGenPut(gen, "\"", 1)) return false;
+    if (!_SSFJsonGenEscaped(gen, in)) return false;
+    return _SSFJsonGenPut(gen, "\"", 1);
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if in written unmodified as a value, else false.                                 */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFJsonGenRaw(SSFJsonGen_t *gen, SSFCStrIn_t in)
+{
+    SSF_REQUIRE(in != NULL);
+
+    if (!_SSFJsonGenValue(gen)) return false;
+    return _SSFJsonGenPut(gen, in, strlen(in));
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if in signed int written, else false.                                            */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFJsonGenInt(SSFJsonGen_t *gen, long in)
+{
+    char num[SSF_JSON_GEN_NUM_SIZE];
+    size_t len;
+
+    if (!_SSFJsonGenValue(gen)) return false;
+    SSF_ASSERT(SSFJsonPrintInt(num, sizeof(num), 0, &len, in, NULL));
+    return _SSFJsonGenPut(gen, num, len);
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if in unsigned int written, else false.                                          */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFJsonGenUInt(SSFJsonGen_t *gen, unsigned long in)
+{
+    char num[SSF_JSON_GEN_NUM_SIZE];
+    size_t len;
+
+    if (!_SSFJsonGenValue(gen)) return false;
+    SSF_ASSERT(SSFJsonPrintUInt(num, sizeof(num), 0, &len, in, NULL));
+    return _SSFJsonGenPut(gen, num, len);
+}
+
+#if SSF_JSON_CONFIG_ENABLE_FLOAT_GEN == 1
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if in double written in fmt, else false; fails if longer than 63 characters.     */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFJsonGenDouble(SSFJsonGen_t *gen, double in, SSFJsonFltFmt_t fmt)
+{
+    char num[SSF_JSON_GEN_NUM_SIZE];
+    size_t len;
+
+    if (!_SSFJsonGenValue(gen)) return false;
+    if (!SSFJsonPrintDouble(num, sizeof(num), 0, &len, in, fmt, NULL))
+    {gen->isErr = true; return false; }
+    return _SSFJsonGenPut(gen, num, len);
+}
+#endif /* SSF_JSON_CONFIG_ENABLE_FLOAT_GEN */
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if in data written as quoted ASCII hex string, else false.                       */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFJsonGenHex(SSFJsonGen_t *gen, const uint8_t *in, size_t inLen, bool rev)
+{
+    char hex[(SSF_JSON_GEN_BIN_CHUNK << 1) + 1];
+    size_t len;
+    size_t outLen;
+
+    SSF_REQUIRE(in != NULL);
+
+    if (!_SSFJsonGenValue(gen)) return false;
+    if (!_SSFJsonGenPut(gen, "\"", 1)) return false;
+    while (inLen > 0)
+    {
+        /* Reversed output converts chunks from the end of in */
+        len = (inLen > SSF_JSON_GEN_BIN_CHUNK) ? SSF_JSON_GEN_BIN_CHUNK : inLen;
+        SSF_ASSERT(SSFHexBinToBytes(rev ? &in[inLen - len] : in, len, hex, sizeof(hex), &outLen,
+                                    rev, SSF_HEX_CASE_UPPER));
+        if (!_SSFJsonGenPut(gen, hex, outLen)) return false;
+        if (!rev) in += len;
+        inLen -= len;
+    }
+    return _SSFJsonGenPut(gen, "\"", 1);
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if in data written as quoted Base64 string, else false.                          */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFJsonGenBase64(SSFJsonGen_t *gen, const uint8_t *in, size_t inLen)
+{
+    char b64[((SSF_JSON_GEN_BIN_CHUNK / 3) << 2) + 1];
+    size_t len;
+    size_t outLen;
+
+    SSF_REQUIRE(in != NULL);
+
+    if (!_SSFJsonGenValue(gen)) return false;
+    if (!_SSFJsonGenPut(gen, "\"", 1)) return false;
+    while (inLen > 0)
+    {
+        /* Chunks are a multiple of 3 bytes so only the last one may be padded */
+        len = (inLen > SSF_JSON_GEN_BIN_CHUNK) ? SSF_JSON_GEN_BIN_CHUNK : inLen;
+        SSF_ASSERT(SSFBase64Encode(in, len, b64, sizeof(b64), &outLen));
+        if (!_SSFJsonGenPut(gen, b64, outLen)) return false;
+        in += len;
+        inLen -= len;
+    }
+    return _SSFJsonGenPut(gen, "\"", 1);
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if staged output passed to the flush callback, else false.                       */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFJsonGenFlush(SSFJsonGen_t *gen)
+{
+    SSF_REQUIRE(gen != NULL);
+    SSF_REQUIRE(gen->magic == SSF_JSON_GEN_MAGIC);
+
+    if (gen->isErr) return false;
+    if ((gen->fifo == NULL) && (gen->bufLen > 0))
+    {
+        if (!gen->fn(gen->buf, gen->bufLen, gen->ctx)) {gen->isErr = true; return false; }
+        gen->bufLen = 0;
+    }
+    return true;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if complete JSON string generated and flushed without error, else false.         */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFJsonGenEnd(SSFJsonGen_t *gen, size_t *outLen)
+{
+    if (!SSFJsonGenFlush(gen)) return false;
+    if (outLen != NULL) *outLen = gen->len;
+    return (gen->depth == 0) && (gen->len > 0);
+}
+#endif /* SSF_JSON_CONFIG_ENABLE_GEN */
+
+#if SSF_JSON_CONFIG_ENABLE_MINIFY == 1
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if in chars added to output buffer or generator, else false.                     */
+/* --------------------------------------------------------------------------------------------- */
+static bool _SSFJsonMinPut(SSFJsonMinOut_t *mo, SSFCStrIn_t in, size_t inLen)
+{
+#if SSF_JSON_CONFIG_ENABLE_GEN == 1
+    if (mo->gen != NULL) return _SSFJsonGenPut(mo->gen, in, inLen);
+#endif /* SSF_JSON_CONFIG_ENABLE_GEN */
+
+    /* Keep room for NULL terminator; Output trails input when minifying in place, so memmove() */
+    if ((mo->size - mo->len) <= inLen) return false;
+    memmove(&mo->out[mo->len], in, inLen);
+    mo->len += inLen;
+    return true;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if valid JSON of len chars added to output without whitespace, else false.       */
+/* --------------------------------------------------------------------------------------------- */
+static bool _SSFJsonMinify(SSFCStrIn_t js, size_t len, SSFJsonMinOut_t *mo)
+{
+    size_t i = 0;
+    size_t run;
+    size_t start;
+    size_t end;
+
+    _SSFJsonWhitespace(js, len, &i);
+    while (i < len)
+    {
+        /* Copy each run up to the next whitespace outside of a string in one go */
+        run = i;
+        while ((i < len) && (!SSFJsonIsWhitespace(js[i])))
+        {
+            if (js[i] == '"') _SSFJsonString(js, len, &i, &start, &end);
+            else i++;
+        }
+        if (!_SSFJsonMinPut(mo, &js[run], i - run)) return false;
+        _SSFJsonWhitespace(js, len, &i);
+    }
+    return true;
+}
+
+#if SSF_JSON_CONFIG_ENABLE_ITER == 1
+/* --------------------------------------------------------------------------------------------- */
+/* Returns <0, 0, or >0 if raw key a sorts before, equal to, or after raw key b.                 */
+/* --------------------------------------------------------------------------------------------- */
+static int _SSFJsonCanonKeyCmp(SSFCStrIn_t a, size_t aLen, SSFCStrIn_t b, size_t bLen)
+{
+    int cmp = memcmp(a, b, (aLen < bLen) ? aLen : bLen);
+
+    if (cmp != 0) return cmp;
+    if (aLen == bLen) return 0;
+    return (aLen < bLen) ? -1 : 1;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if current value of it added to output in canonical form, else false.            */
+/* --------------------------------------------------------------------------------------------- */
+static bool _SSFJsonCanon(const SSFJsonIter_t *it, SSFJsonMinOut_t *mo)
+{
+    SSFJsonIter_t child;
+    SSFJsonIter_t next;
+    SSFCStrIn_t prev = NULL;
+    size_t prevLen = 0;
+    bool comma = false;
+    bool found;
+    int cmp;
+
+    if (it->jt == SSF_JSON_TYPE_ARRAY)
+    {
+        if (!_SSFJsonMinPut(mo, "[", 1)) return false;
+        SSFJsonIterChild(it, &child);
+        while (SSFJsonIterNext(&child))
+        {
+            if (comma && (!_SSFJsonMinPut(mo, ",", 1))) return false;
+            comma = true;
+            if (!_SSFJsonCanon(&child, mo)) return false;
+        }
+        return _SSFJsonMinPut(mo, "]", 1);
+    }
+    if (it->jt != SSF_JSON_TYPE_OBJECT)
+    {
+        /* Strings, numbers and literals never contain insignificant whitespace */
+        return _SSFJsonMinPut(mo, &it->js[it->start], it->end - it->start + 1);
+    }
+
+    /* Without memory to sort in, each pass over the members picks the least key greater than */
+    /* the last one output; Duplicate keys have no canonical order and are rejected */
+    if (!_SSFJsonMinPut(mo, "{", 1)) return false;
+    while (true)
+    {
+        found = false;
+        SSFJsonIterChild(it, &child);
+        while (SSFJsonIterNext(&child))
+        {
+            if ((prev != NULL) &&
+                (_SSFJsonCanonKeyCmp(child.key, child.keyLen, prev, prevLen) <= 0)) continue;
+            if (found)
+            {
+                cmp = _SSFJsonCanonKeyCmp(child.key, child.keyLen, next.key, next.keyLen);
+                if (cmp == 0) return false;
+                if (cmp > 0) continue;
+            }
+            memcpy(&next, &child, sizeof(next));
+            found = true;
+        }
+        if (!found) break;
+        if (comma && (!_SSFJsonMinPut(mo, ",", 1))) return false;
+        comma = true;
+        if (!_SSFJsonMinPut(mo, next.key - 1, next.keyLen + 2)) return false;
+        if (!_SSFJsonMinPut(mo, ":", 1)) return false;
+        if (!_SSFJsonCanon(&next, mo)) return false;
+        prev = next.key;
+        prevLen = next.keyLen;
+    }
+    return _SSFJsonMinPut(mo, "}", 1);
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if JSON string is valid and it set to its root object, else false.               */
+/* --------------------------------------------------------------------------------------------- */
+static bool _SSFJsonCanonRoot(SSFCStrIn_t js, SSFJsonIter_t *it)
+{
+    SSFCStrIn_t path[SSF_JSON_CONFIG_MAX_IN_DEPTH + 1];
+
+    memset(path, 0, sizeof(path));
+    memset(it, 0, sizeof(SSFJsonIter_t));
+    it->js = js;
+    return SSFJsonObject(js, &it->len, &it->start, &it->end, path, 0, &it->jt);
+}
+#endif /* SSF_JSON_CONFIG_ENABLE_ITER */
+
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if js copied to out without whitespace w/NULL term., else false; out may be js.  */
 /* --------------------------------------------------------------------------------------------- */
-bool SSFJsonPrintString(SSFCStrOut_t js, size_t size, size_t start, size_t *end, SSFCStrIn_t in,
-                        bool *comma)
+bool SSFJsonMinify(SSFCStrIn_t js, SSFCStrOut_t out, size_t outSize, size_t *outLen)
 {
+    SSFJsonMinOut_t mo;
+    size_t len;
+    size_t start;
+    size_t end;
+    SSFJsonType_t jt;
+
     SSF_REQUIRE(js != NULL);
-    SSF_REQUIRE(end != NULL);
-    SSF_REQUIRE(in != NULL);
-    SSF_REQUIRE((comma == NULL) || (comma != (bool *)true));
+    SSF_REQUIRE(out != NULL);
+    SSF_REQUIRE(outLen != NULL);
 
-    SSF_JSON_COMMA(comma);
-    if (!_SSFJsonPrintUnescChar(js, size, start, &start, '\"')) return false;
-    if (!SSFJsonPrintCString(js, size, start, &start, in, false)) return false;
-    if (!_SSFJsonPrintUnescChar(js, size, start, &start, '\"')) return false;
-    *end = start;
+    if (!SSFJsonObject(js, &len, &start, &end, NULL, 0, &jt)) return false;
+    if (outSize == 0) return false;
+    memset(&mo, 0, sizeof(mo));
+    mo.out = out;
+    mo.size = outSize;
+    if (!_SSFJsonMinify(js, len, &mo)) {out[0] = 0; return false; }
+    out[mo.len] = 0;
+    *outLen = mo.len;
     return true;
 }
 
+#if SSF_JSON_CONFIG_ENABLE_ITER == 1
 /* --------------------------------------------------------------------------------------------- */
-/* Returns true if in label element added successfully, else false.                              */
+/* Returns true if js copied to out in canonical form w/NULL term., else false; out not js.      */
 /* --------------------------------------------------------------------------------------------- */
-bool SSFJsonPrintLabel(SSFCStrOut_t js, size_t size, size_t start, size_t *end, SSFCStrIn_t in,
-                       bool *comma)
+bool SSFJsonCanonicalize(SSFCStrIn_t js, SSFCStrOut_t out, size_t outSize, size_t *outLen)
 {
+    SSFJsonMinOut_t mo;
+    SSFJsonIter_t it;
+
     SSF_REQUIRE(js != NULL);
-    SSF_REQUIRE(end != NULL);
-    SSF_REQUIRE(in != NULL);
-    SSF_REQUIRE((comma == NULL) || (comma != (bool *)true));
+    SSF_REQUIRE(out != NULL);
+    SSF_REQUIRE(out != js);
+    SSF_REQUIRE(outLen != NULL);
 
-    SSF_JSON_COMMA(comma);
-    if (!SSFJsonPrintString(js, size, start, &start, in, false)) return false;
-    if (!_SSFJsonPrintUnescChar(js, size, start, &start, ':')) return false;
-    *end = start;
+    if (!_SSFJsonCanonRoot(js, &it)) return false;
+    if (outSize == 0) return false;
+    memset(&mo, 0, sizeof(mo));
+    mo.out = out;
+    mo.size = outSize;
+    if (!_SSFJsonCanon(&it, &mo)) {out[0] = 0; return false; }
+    out[mo.len] = 0;
+    *outLen = mo.len;
     return true;
 }
+#endif /* SSF_JSON_CONFIG_ENABLE_ITER */
 
+#if SSF_JSON_CONFIG_ENABLE_GEN == 1
 /* --------------------------------------------------------------------------------------------- */
-/* Returns true if in data added successfully as quoted ASCII hex string, else false.            */
+/* Returns true if js written to generator as a value without whitespace, else false.            */
 /* --------------------------------------------------------------------------------------------- */
-bool SSFJsonPrintHex(SSFCStrOut_t js, size_t size, size_t start, size_t *end, const uint8_t *in,
-                     size_t inLen, bool rev, bool *comma)
+bool SSFJsonGenMinify(SSFJsonGen_t *gen, SSFCStrIn_t js)
 {
-    size_t outLen;
+    SSFJsonMinOut_t mo;
+    size_t len;
+    size_t start;
+    size_t end;
+    SSFJsonType_t jt;
 
     SSF_REQUIRE(js != NULL);
-    SSF_REQUIRE(end != NULL);
-    SSF_REQUIRE(in != NULL);
-    SSF_REQUIRE((comma == NULL) || (comma != (bool *)true));
 
-    SSF_JSON_COMMA(comma);
-    if (!_SSFJsonPrintUnescChar(js, size, start, &start, '"')) return false;
-    if (!SSFHexBinToBytes(in, inLen, &js[start], size - start, &outLen, rev, SSF_HEX_CASE_UPPER))
-    {return false; }
-    start += outLen;
-    if (!_SSFJsonPrintUnescChar(js, size, start, &start, '"')) return false;
-    *end = start;
-    return true;
+    if (!SSFJsonObject(js, &len, &start, &end, NULL, 0, &jt)) return false;
+    if (!_SSFJsonGenValue(gen)) return false;
+    memset(&mo, 0, sizeof(mo));
+    mo.gen = gen;
+    return _SSFJsonMinify(js, len, &mo);
 }
 
+#if SSF_JSON_CONFIG_ENABLE_ITER == 1
 /* --------------------------------------------------------------------------------------------- */
-/* Returns true if in data added successfully as quoted Base64 string, else false.               */
+/* Returns true if js written to generator in canonical form, else false and maybe gen in error. */
 /* --------------------------------------------------------------------------------------------- */
-bool SSFJsonPrintBase64(SSFCStrOut_t js, size_t size, size_t start, size_t *end,
-                        const uint8_t *in, size_t inLen, bool *comma)
+bool SSFJsonGenCanonicalize(SSFJsonGen_t *gen, SSFCStrIn_t js)
 {
-    size_t outLen;
+    SSFJsonMinOut_t mo;
+    SSFJsonIter_t it;
 
     SSF_REQUIRE(js != NULL);
-    SSF_REQUIRE(end != NULL);
-    SSF_REQUIRE(in != NULL);
-    SSF_REQUIRE((comma == NULL) || (comma != (bool *)true));
 
-    SSF_JSON_COMMA(comma);
-    if (!_SSFJsonPrintUnescChar(js, size, start, &start, '"')) return false;
-    if (!SSFBase64Encode(in, inLen, &js[start], size - start, &outLen)) return false;
-    start += outLen;
-    if (!_SSFJsonPrintUnescChar(js, size, start, &start, '"')) return false;
-    *end = start;
+    if (!_SSFJsonCanonRoot(js, &it)) return false;
+    if (!_SSFJsonGenValue(gen)) return false;
+    memset(&mo, 0, sizeof(mo));
+    mo.gen = gen;
+
+    /* Duplicate keys are only found part way through output, which cannot be taken back */
+    if (!_SSFJsonCanon(&it, &mo)) {gen->isErr = true; return false; }
     return true;
 }
+#endif /* SSF_JSON_CONFIG_ENABLE_ITER */
+#endif /* SSF_JSON_CONFIG_ENABLE_GEN */
+#endif /* SSF_JSON_CONFIG_ENABLE_MINIFY */
 
-#if SSF_JSON_CONFIG_ENABLE_FLOAT_GEN == 1
+#if SSF_JSON_CONFIG_ENABLE_SCHEMA == 1
 /* --------------------------------------------------------------------------------------------- */
-/* Returns true if in double added successfully to JSON string, else false.                      */
+/* Returns seeded FNV-1a hash of key.                                                            */
 /* --------------------------------------------------------------------------------------------- */
-bool SSFJsonPrintDouble(SSFCStrOut_t js, size_t size, size_t start, size_t *end, double in,
-                        SSFJsonFltFmt_t fmt, bool *comma)
+static uint32_t _SSFJsonSchemaHash(SSFCStrIn_t key, size_t keyLen, uint32_t seed)
 {
-    int len = 0;
+    uint32_t h = 2166136261u ^ seed;
 
-    SSF_REQUIRE(js != NULL);
-    SSF_REQUIRE(start <= size);
-    SSF_REQUIRE(end != NULL);
-    SSF_REQUIRE((fmt >= 0) && (fmt < SSF_JSON_FLT_FMT_MAX));
-    SSF_REQUIRE((comma == NULL) || (comma != (bool *)true));
+    while (keyLen > 0)
+    {
+        h ^= (uint8_t)*key;
+        h *= 16777619u;
+        key++; keyLen--;
+    }
+    return h ^ (h >> 15);
+}
 
-    SSF_JSON_COMMA(comma);
-    if (fmt == SSF_JSON_FLT_FMT_SHORT) len = snprintf(&js[start], size - start, "%g", in);
-    else if (fmt == SSF_JSON_FLT_FMT_STD) len = snprintf(&js[start], size - start, "%f", in);
-    else
+/* --------------------------------------------------------------------------------------------- */
+/* Inits schema's perfect hash of field keys, must be called once before schema is used.         */
+/* --------------------------------------------------------------------------------------------- */
+void SSFJsonSchemaInit(SSFJsonSchema_t *schema)
+{
+    size_t i;
+    size_t j;
+    size_t slot;
+    uint32_t size;
+
+    SSF_REQUIRE(schema != NULL);
+    SSF_REQUIRE(schema->fields != NULL);
+    SSF_REQUIRE(schema->fieldsLen > 0);
+    SSF_REQUIRE(schema->fieldsLen <= SSF_JSON_CONFIG_SCHEMA_MAX_FIELDS);
+
+    for (i = 0; i < schema->fieldsLen; i++)
     {
-        size_t delta = size - start;
-        char *ptr = &js[start];
+        SSF_REQUIRE(schema->fields[i].key != NULL);
+        SSF_REQUIRE(schema->fields[i].kind < SSF_JSON_FIELD_MAX);
+        SSF_REQUIRE((schema->fields[i].kind == SSF_JSON_FIELD_OBJECT) ==
+                    (schema->fields[i].sub != NULL));
+        for (j = 0; j < i; j++)
+        {
+            SSF_REQUIRE((schema->fields[i].keyLen != schema->fields[j].keyLen) ||
+                        (memcmp(schema->fields[i].key, schema->fields[j].key,
+                                schema->fields[i].keyLen) != 0));
+        }
+    }
 
-        switch (fmt)
+    /* Search for a seed that maps every key to its own slot, growing the table if needed */
+    schema->probes = 1;
+    for (size = 4; size < (schema->fieldsLen << 2); size <<= 1);
+    for (; size <= SSF_JSON_SCHEMA_SLOTS; size <<= 1)
+    {
+        schema->mask = size - 1;
+        for (schema->seed = 0; schema->seed < SSF_JSON_SCHEMA_MAX_SEEDS; schema->seed++)
         {
-            case 0: len = snprintf(ptr, delta, "%.0f", in); break;
-            case 1: len = snprintf(ptr, delta, "%.1f", in); break;
-            case 2: len = snprintf(ptr, delta, "%.2f", in); break;
-            case 3: len = snprintf(ptr, delta, "%.3f", in); break;
-            case 4: len = snprintf(ptr, delta, "%.4f", in); break;
-            case 5: len = snprintf(ptr, delta, "%.5f", in); break;
-            case 6: len = snprintf(ptr, delta, "%.6f", in); break;
-            case 7: len = snprintf(ptr, delta, "%.7f", in); break;
-            case 8: len = snprintf(ptr, delta, "%.8f", in); break;
-            case 9: len = snprintf(ptr, delta, "%.9f", in); break;
-            case SSF_JSON_FLT_FMT_SHORT:
-            case SSF_JSON_FLT_FMT_STD:
-            case SSF_JSON_FLT_FMT_MAX:
-            default:
-                SSF_ERROR(); break;
+            memset(schema->slots, 0, sizeof(schema->slots));
+            for (i = 0; i < schema->fieldsLen; i++)
+            {
+                slot = _SSFJsonSchemaHash(schema->fields[i].key, schema->fields[i].keyLen,
+                                          schema->seed) & schema->mask;
+                if (schema->slots[slot] != 0) break;
+                schema->slots[slot] = (uint8_t)(i + 1);
+            }
+            if (i == schema->fieldsLen) {schema->magic = SSF_JSON_SCHEMA_MAGIC; return; }
         }
     }
-    if ((len < 0) || (((size_t)len) >= (size - start))) return false;
-    *end = start + len;
-    return true;
+
+    /* No perfect hash found, fall back to linear probing of the largest table */
+    memset(schema->slots, 0, sizeof(schema->slots));
+    schema->seed = 0;
+    schema->mask = SSF_JSON_SCHEMA_SLOTS - 1;
+    for (i = 0; i < schema->fieldsLen; i++)
+    {
+        slot = _SSFJsonSchemaHash(schema->fields[i].key, schema->fields[i].keyLen, 0);
+        for (j = 0; schema->slots[(slot + j) & schema->mask] != 0; j++);
+        schema->slots[(slot + j) & schema->mask] = (uint8_t)(i + 1);
+        if (j >= schema->probes) schema->probes = (uint32_t)(j + 1);
+    }
+    schema->magic = SSF_JSON_SCHEMA_MAGIC;
 }
-#endif /* SSF_JSON_CONFIG_ENABLE_FLOAT_GEN */
 
 /* --------------------------------------------------------------------------------------------- */
-/* Returns true if in signed int added successfully to JSON string, else false.                  */
+/* Returns field of schema matching key, else NULL.                                              */
 /* --------------------------------------------------------------------------------------------- */
-bool SSFJsonPrintInt(SSFCStrOut_t js, size_t size, size_t start, size_t *end, long in,
-                     bool *comma)
+static const SSFJsonField_t *_SSFJsonSchemaFind(const SSFJsonSchema_t *schema, SSFCStrIn_t key,
+                                                size_t keyLen)
 {
-    int len;
+    uint32_t h;
+    uint32_t n;
+    uint8_t slot;
+    const SSFJsonField_t *field;
 
-    SSF_REQUIRE(js != NULL);
-    SSF_REQUIRE(start <= size);
-    SSF_REQUIRE(end != NULL);
-    SSF_REQUIRE((comma == NULL) || (comma != (bool *)true));
+    h = _SSFJsonSchemaHash(key, keyLen, schema->seed);
+    for (n = 0; n < schema->probes; n++)
+    {
+        slot = schema->slots[(h + n) & schema->mask];
+        if (slot == 0) return NULL;
+        field = &schema->fields[slot - 1];
+        if ((field->keyLen == keyLen) && (memcmp(field->key, key, keyLen) == 0)) return field;
+    }
+    return NULL;
+}
 
-    SSF_JSON_COMMA(comma);
-    len = snprintf(&js[start], size - start, "%ld", in);
-    if ((len < 0) || (((size_t)len) >= (size - start))) return false;
-    *end = start + len;
-    return true;
+/* --------------------------------------------------------------------------------------------- */
+/* Returns true if value span converted into field at out, else false; num is value if a number. */
+/* --------------------------------------------------------------------------------------------- */
+static bool _SSFJsonSchemaDecodeValue(SSFCStrIn_t js, const SSFJsonField_t *field, uint8_t *out,
+                                      SSFJsonType_t jt, size_t start, size_t end,
+                                      const SSFJsonNum_t *num)
+{
+    size_t outLen;
+
+    switch (field->kind)
+    {
+    case SSF_JSON_FIELD_STRING:
+        if (jt != SSF_JSON_TYPE_STRING) return false;
+        return _SSFJsonSpanString(js, start, end, (char *)out, field->size, NULL);
+    case SSF_JSON_FIELD_LONG:
+        if ((jt != SSF_JSON_TYPE_NUMBER) || (!num->isInt)) return false;
+        return _SSFJsonSpanXLong(js, start, end, num, (long int *)out, NULL);
+    case SSF_JSON_FIELD_ULONG:
+        if ((jt != SSF_JSON_TYPE_NUMBER) || (!num->isInt)) return false;
+        return _SSFJsonSpanXLong(js, start, end, num, NULL, (unsigned long int *)out);
+    case SSF_JSON_FIELD_BOOL:
+        if ((jt != SSF_JSON_TYPE_TRUE) && (jt != SSF_JSON_TYPE_FALSE)) return false;
+        *((bool *)out) = (jt == SSF_JSON_TYPE_TRUE);
+        return true;
+#if (SSF_JSON_CONFIG_ENABLE_FLOAT_PARSE == 1) && (SSF_JSON_CONFIG_ENABLE_FLOAT_GEN == 1)
+    case SSF_JSON_FIELD_DOUBLE:
+        if (jt != SSF_JSON_TYPE_NUMBER) return false;
+        return _SSFJsonSpanDouble(js, start, end, num, (double *)out);
+#endif /* SSF_JSON_CONFIG_ENABLE_FLOAT_PARSE && SSF_JSON_CONFIG_ENABLE_FLOAT_GEN */
+    case SSF_JSON_FIELD_HEX:
+        if (jt != SSF_JSON_TYPE_STRING) return false;
+        if (!_SSFJsonSpanHex(js, start, end, out, field->size, &outLen, false)) return false;
+        return outLen == field->size;
+    case SSF_JSON_FIELD_BASE64:
+        if (jt != SSF_JSON_TYPE_STRING) return false;
+        if (!_SSFJsonSpanBase64(js, start, end, out, field->size, &outLen, SSF_BASE64_FMT_STD))
+        {return false; }
+        return outLen == field->size;
+    default:
+        SSF_ERROR();
+    }
+    return false;
 }
 
 /* --------------------------------------------------------------------------------------------- */
-/* Returns true if in unsigned int added successfully to JSON string, else false.                */
+/* Returns true to continue walk; Decodes values whose keys match schema fields.                 */
 /* --------------------------------------------------------------------------------------------- */
-bool SSFJsonPrintUInt(SSFCStrOut_t js, size_t size, size_t start, size_t *end, unsigned long in,
-                      bool *comma)
+static bool _SSFJsonSchemaWalkFn(void *ctx, SSFJsonWalkEvent_t ev, size_t depth, SSFJsonType_t jt,
+                                 size_t key, size_t keyLen, size_t start, size_t end)
 {
-    int len;
+    SSFJsonSchemaCtx_t *sc = (SSFJsonSchemaCtx_t *)ctx;
+    SSFJsonSchemaLevel_t *lvl;
+    const SSFJsonSchemaLevel_t *parent;
 
-    SSF_REQUIRE(js != NULL);
-    SSF_REQUIRE(start <= size);
-    SSF_REQUIRE(end != NULL);
-    SSF_REQUIRE((comma == NULL) || (comma != (bool *)true));
+    SSF_REQUIRE(ctx != NULL);
 
-    SSF_JSON_COMMA(comma);
-    len = snprintf(&js[start], size - start, "%lu", in);
-    if ((len < 0) || (((size_t)len) >= (size - start))) return false;
-    *end = start + len;
-    return true;
+    /* Values nested deeper than the schema levels are skipped, unless an object there decodes */
+    if (depth > SSF_JSON_CONFIG_MAX_IN_DEPTH)
+    {return sc->level[SSF_JSON_CONFIG_MAX_IN_DEPTH].schema == NULL; }
+    lvl = &sc->level[depth];
+    if (ev == SSF_JSON_WALK_BEGIN)
+    {
+        if (depth == 0) return true;
+        lvl->schema = NULL;
+        lvl->field = NULL;
+        parent = &sc->level[depth - 1];
+        if ((parent->schema == NULL) || (key == 0)) return true;
+
+        /* Member of an object being decoded, one hash probe finds its field */
+        lvl->field = _SSFJsonSchemaFind(parent->schema, &sc->js[key], keyLen);
+        if (lvl->field == NULL) return true;
+        lvl->base = parent->base + lvl->field->offset;
+        if (lvl->field->kind == SSF_JSON_FIELD_OBJECT)
+        {
+            if (jt != SSF_JSON_TYPE_OBJECT) return false;
+            lvl->schema = lvl->field->sub;
+            SSF_REQUIRE(lvl->schema->magic == SSF_JSON_SCHEMA_MAGIC);
+            return true;
+        }
+        return (jt != SSF_JSON_TYPE_OBJECT) && (jt != SSF_JSON_TYPE_ARRAY);
+    }
+    if ((depth == 0) || (lvl->field == NULL) || (lvl->field->kind == SSF_JSON_FIELD_OBJECT))
+    {return true; }
+    return _SSFJsonSchemaDecodeValue(sc->js, lvl->field, lvl->base, jt, start, end, &sc->num);
 }
 
 /* --------------------------------------------------------------------------------------------- */
-/* Returns true if all printing added successfully to JSON string, else false.                   */
+/* Returns true if JSON string valid and all fields present decoded into out, else false.        */
 /* --------------------------------------------------------------------------------------------- */
-bool SSFJsonPrint(SSFCStrOut_t js, size_t size, size_t start, size_t *end, SSFJsonPrintFn_t fn,
-                  void *in, const char *oc, bool *comma)
+bool SSFJsonSchemaDecode(SSFCStrIn_t js, const SSFJsonSchema_t *schema, void *out)
 {
+    uint8_t stack[SSF_JSON_STACK_SIZE(SSF_JSON_CONFIG_MAX_WALK_DEPTH)];
+    SSFJsonSchemaCtx_t sc;
+    size_t index;
+
     SSF_REQUIRE(js != NULL);
-    SSF_REQUIRE(start <= size);
-    SSF_REQUIRE(end != NULL);
-    SSF_REQUIRE((comma == NULL) || (comma != (bool *)true));
+    SSF_REQUIRE(schema != NULL);
+    SSF_REQUIRE(schema->magic == SSF_JSON_SCHEMA_MAGIC);
+    SSF_REQUIRE(out != NULL);
 
-    SSF_JSON_COMMA(comma);
-    if ((oc != NULL) && (!_SSFJsonPrintUnescChar(js, size, start, &start, oc[0]))) return false;
-    if ((fn != NULL) && (!fn(js, size, start, &start, in))) return false;
-    if ((oc != NULL) && (!_SSFJsonPrintUnescChar(js, size, start, &start, oc[1]))) return false;
-    if (!_SSFJsonPrintUnescChar(js, size, start, &start, 0)) return false;
-    *end = start - 1;
-    return true;
+    sc.js = js;
+    sc.level[0].schema = schema;
+    sc.level[0].field = NULL;
+    sc.level[0].base = (uint8_t *)out;
+    return _SSFJsonWalkRoot(js, &index, stack, SSF_JSON_CONFIG_MAX_WALK_DEPTH, _SSFJsonSchemaWalkFn,
+                            &sc, &sc.num);
 }
 
-#if SSF_JSON_CONFIG_ENABLE_UPDATE == 1
 /* --------------------------------------------------------------------------------------------- */
-/* Printer function for SSFJsonUpdate() when adding paths is required.                           */
+/* Returns true if in struct added successfully as JSON object, else false.                      */
 /* --------------------------------------------------------------------------------------------- */
-static bool _SSFJsonUpdateAddPath(SSFCStrOut_t js, size_t size, size_t start, size_t *end,
-                                  void *in)
+bool SSFJsonSchemaPrint(SSFCStrOut_t js, size_t size, size_t start, size_t *end,
+                        const SSFJsonSchema_t *schema, const void *in, bool *comma)
 {
-    SSFJSONAddPath_t *ap = (SSFJSONAddPath_t *)in;
+    const SSFJsonField_t *field;
+    const uint8_t *val;
+    bool fcomma = false;
+    size_t i;
 
+    SSF_REQUIRE(js != NULL);
+    SSF_REQUIRE(end != NULL);
+    SSF_REQUIRE(schema != NULL);
+    SSF_REQUIRE(schema->magic == SSF_JSON_SCHEMA_MAGIC);
     SSF_REQUIRE(in != NULL);
+    SSF_REQUIRE((comma == NULL) || (comma != (bool *)true));
 
-    if (ap->path[ap->depth] != NULL)
+    SSF_JSON_COMMA(comma);
+    if (!_SSFJsonPrintUnescChar(js, size, start, &start, '{')) return false;
+    for (i = 0; i < schema->fieldsLen; i++)
     {
-        if (!SSFJsonPrintLabel(js, size, start, &start, ap->path[ap->depth], false))
-        {return false; }
-        ap->depth++;
-        if (ap->path[ap->depth] == NULL)
+        field = &schema->fields[i];
+        val = ((const uint8_t *)in) + field->offset;
+        if (!SSFJsonPrintLabel(js, size, start, &start, field->key, &fcomma)) return false;
+        switch (field->kind)
         {
-            if (!SSFJsonPrint(js, size, start, &start, _SSFJsonUpdateAddPath, ap, NULL, false))
+        case SSF_JSON_FIELD_STRING:
+            if (memchr(val, 0, field->size) == NULL) return false;
+            if (!SSFJsonPrintString(js, size, start, &start, (SSFCStrIn_t)val, NULL))
             {return false; }
-        } else
-        {
-            if (!SSFJsonPrintObject(js, size, start, &start, _SSFJsonUpdateAddPath, ap, false))
+            break;
+        case SSF_JSON_FIELD_LONG:
+            if (!SSFJsonPrintInt(js, size, start, &start, *((const long int *)val), NULL))
+            {return false; }
+            break;
+        case SSF_JSON_FIELD_ULONG:
+            if (!SSFJsonPrintUInt(js, size, start, &start, *((const unsigned long int *)val),
+                                  NULL))
+            {return false; }
+            break;
+        case SSF_JSON_FIELD_BOOL:
+            if (!SSFJsonPrintCString(js, size, start, &start,
+                                     *((const bool *)val) ? "true" : "false", NULL))
             {return false; }
+            break;
+#if (SSF_JSON_CONFIG_ENABLE_FLOAT_PARSE == 1) && (SSF_JSON_CONFIG_ENABLE_FLOAT_GEN == 1)
+        case SSF_JSON_FIELD_DOUBLE:
+            if (!SSFJsonPrintDouble(js, size, start, &start, *((const double *)val),
+                                    SSF_JSON_FLT_FMT_SHORTEST, NULL))
+            {return false; }
+            break;
+#endif /* SSF_JSON_CONFIG_ENABLE_FLOAT_PARSE && SSF_JSON_CONFIG_ENABLE_FLOAT_GEN */
+        case SSF_JSON_FIELD_HEX:
+            if (!SSFJsonPrintHex(js, size, start, &start, val, field->size, false, NULL))
+            {return false; }
+            break;
+        case SSF_JSON_FIELD_BASE64:
+            if (!SSFJsonPrintBase64(js, size, start, &start, val, field->size, NULL))
+            {return false; }
+            break;
+        case SSF_JSON_FIELD_OBJECT:
+            if (!SSFJsonSchemaPrint(js, size, start, &start, field->sub, val, NULL))
+            {return false; }
+            break;
+        default:
+            SSF_ERROR();
         }
-    } else ap->fn(js, size, start, &start, NULL);
+    }
+    if (!_SSFJsonPrintUnescChar(js, size, start, &start, '}')) return false;
+    if (start >= size) return false;
+    js[start] = 0;
     *end = start;
     return true;
 }
 
+#if SSF_JSON_CONFIG_ENABLE_GEN == 1
 /* --------------------------------------------------------------------------------------------- */
-/* Returns true if field value updated, object path created as needed, else false.               */
+/* Returns true if in struct written as JSON object by streaming generator, else false.          */
 /* --------------------------------------------------------------------------------------------- */
-bool SSFJsonUpdate(SSFCStrOut_t js, size_t size, SSFCStrIn_t *path, SSFJsonPrintFn_t fn)
+bool SSFJsonSchemaGen(SSFJsonGen_t *gen, const SSFJsonSchema_t *schema, const void *in)
 {
-    size_t start;
-    size_t end;
-    size_t index;
-    SSFJsonType_t jt;
-    size_t len;
-    char *path2[SSF_JSON_CONFIG_MAX_IN_DEPTH + 1];
-    uint8_t i;
-    size_t startn;
-    SSFJSONAddPath_t ap;
-
-    SSF_REQUIRE(js != NULL);
-    SSF_REQUIRE(path != NULL);
-    SSF_REQUIRE(path[SSF_JSON_CONFIG_MAX_IN_DEPTH] == NULL);
-    SSF_REQUIRE(fn != NULL);
+    const SSFJsonField_t *field;
+    const uint8_t *val;
+    size_t i;
 
-    memcpy(path2, path, sizeof(path2));
-    do
-    {
-        if (!SSFJsonObject(js, &index, &start, &end, (SSFCStrIn_t *)path2, 0, &jt)) return false;
-        if (jt != SSF_JSON_TYPE_ERROR) break;
-        for (i = SSF_JSON_CONFIG_MAX_IN_DEPTH; (path2[i] == NULL) && (i >= 1); i--);
-        path2[i] = NULL;
-    } while (jt == SSF_JSON_TYPE_ERROR);
+    SSF_REQUIRE(schema != NULL);
+    SSF_REQUIRE(schema->magic == SSF_JSON_SCHEMA_MAGIC);
+    SSF_REQUIRE(in != NULL);
 
-    if (memcmp(path, path2, sizeof(path2)) == 0)
+    if (!SSFJsonGenObjectBegin(gen)) return false;
+    for (i = 0; i < schema->fieldsLen; i++)
     {
-        size_t end2;
-
-        /* Exact match to request, updated existing value */
-        len = strlen(js);
-        memmove(&js[size - len + end], &js[end + 1], len - end);
-        if (!fn(&js[start], size - len - end, 0, &end2, &jt)) return false;
-        memmove(&js[start + end2], &js[size - len + end], len - end);
-        return true;
+        field = &schema->fields[i];
+        val = ((const uint8_t *)in) + field->offset;
+        if (!SSFJsonGenLabel(gen, field->key)) return false;
+        switch (field->kind)
+        {
+        case SSF_JSON_FIELD_STRING:
+            if (memchr(val, 0, field->size) == NULL) {gen->isErr = true; return false; }
+            if (!SSFJsonGenString(gen, (SSFCStrIn_t)val)) return false;
+            break;
+        case SSF_JSON_FIELD_LONG:
+            if (!SSFJsonGenInt(gen, *((const long int *)val))) return false;
+            break;
+        case SSF_JSON_FIELD_ULONG:
+            if (!SSFJsonGenUInt(gen, *((const unsigned long int *)val))) return false;
+            break;
+        case SSF_JSON_FIELD_BOOL:
+            if (!SSFJsonGenRaw(gen, *((const bool *)val) ? "true" : "false")) return false;
+            break;
+#if (SSF_JSON_CONFIG_ENABLE_FLOAT_PARSE == 1) && (SSF_JSON_CONFIG_ENABLE_FLOAT_GEN == 1)
+        case SSF_JSON_FIELD_DOUBLE:
+            if (!SSFJsonGenDouble(gen, *((const double *)val), SSF_JSON_FLT_FMT_SHORTEST))
+            {return false; }
+            break;
+#endif /* SSF_JSON_CONFIG_ENABLE_FLOAT_PARSE && SSF_JSON_CONFIG_ENABLE_FLOAT_GEN */
+        case SSF_JSON_FIELD_HEX:
+            if (!SSFJsonGenHex(gen, val, field->size, false)) return false;
+            break;
+        case SSF_JSON_FIELD_BASE64:
+            if (!SSFJsonGenBase64(gen, val, field->size)) return false;
+            break;
+        case SSF_JSON_FIELD_OBJECT:
+            if (!SSFJsonSchemaGen(gen, field->sub, val)) return false;
+            break;
+        default:
+            SSF_ERROR();
+        }
     }
-    /* Not exact match to request, create missing path */
-    if (jt != SSF_JSON_TYPE_OBJECT) return false;
-
-    for (ap.depth = 0; (path2[ap.depth] != NULL) && (ap.depth <= SSF_JSON_CONFIG_MAX_IN_DEPTH);
-         ap.depth++);
-    len = strlen(js);
-    startn = start + 1;
-    end = end + 1;
-    ap.fn = fn;
-    ap.path = path;
-    memmove(&js[size - len], &js[start + 1], len);
-    if (!SSFJsonPrint(js, size - len - 1, startn, &end, _SSFJsonUpdateAddPath, &ap, NULL, false))
-    {return false; }
-    index = size - len;
-    _SSFJsonWhitespace(js, &index);
-    if ((js[index] != '}') && (!_SSFJsonPrintUnescChar(js, size - len - 1, end, &end, ',')))
-    { return false; }
-    memmove(&js[start + (end - startn + 1)], &js[size - len], len);
-    return true;
+    return SSFJsonGenObjectEnd(gen);
 }
-#endif
+#endif /* SSF_JSON_CONFIG_ENABLE_GEN */
+#endif /* SSF_JSON_CONFIG_ENABLE_SCHEMA */
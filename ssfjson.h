@@ -36,21 +36,30 @@
 extern "C" {
 #endif
 
+#include <stddef.h>
 #include <stdint.h>
 #include <stdbool.h>
 #include "ssfport.h"
+#include "ssfbase64.h"
+#if (SSF_JSON_CONFIG_ENABLE_STREAM == 1) || (SSF_JSON_CONFIG_ENABLE_GEN == 1)
+#include "ssfbfifo.h"
+#endif /* SSF_JSON_CONFIG_ENABLE_STREAM || SSF_JSON_CONFIG_ENABLE_GEN */
 
 /* --------------------------------------------------------------------------------------------- */
 /* Limitations                                                                                   */
 /* Parser considers inputs with duplicate object keys valid.                                     */
 /* Parser will only match the first of more than one duplicate object key.                       */
 /* Parser only performs literal path match on object keys.                                       */
+/* Canonical form only sorts object keys by their raw bytes, strings and numbers are as is.      */
 // Parser only accepts 8-bit ASCII encoded strings, embedded NULL/0 values terminate input.      */
 /* --------------------------------------------------------------------------------------------- */
 
 /* --------------------------------------------------------------------------------------------- */
 /* Defines                                                                                       */
 /* --------------------------------------------------------------------------------------------- */
+/* Size in bytes of a depth stack that allows depth levels of nesting, 1 bit per level. */
+#define SSF_JSON_STACK_SIZE(depth) ((size_t)(((depth) + 7u) >> 3))
+
 typedef enum SSFJsonType
 {
     SSF_JSON_TYPE_ERROR,
@@ -79,20 +88,255 @@ typedef enum SSFJsonFltFmt
     SSF_JSON_FLT_FMT_PREC_9,
     SSF_JSON_FLT_FMT_STD,
     SSF_JSON_FLT_FMT_SHORT,
+    SSF_JSON_FLT_FMT_SHORTEST,
     SSF_JSON_FLT_FMT_MAX,
 } SSFJsonFltFmt_t;
 #endif /* SSF_JSON_CONFIG_ENABLE_FLOAT_GEN */
 
+typedef struct SSFJsonStr
+{
+    SSFCStrIn_t ptr;        /* Raw chars of string between its quotes, not NULL terminated */
+    size_t len;             /* Number of raw chars at ptr */
+    bool hasEsc;            /* True if raw chars contain escape sequences */
+} SSFJsonStr_t;
+
+/* Number token value accumulated while it is scanned; Value is mant * 10^exp10. */
+typedef struct SSFJsonNum
+{
+    uint64_t mant;
+    long exp10;
+    long exp;
+    bool neg;
+    bool isInt;
+} SSFJsonNum_t;
+
+typedef struct SSFJsonPathMatch
+{
+    SSFCStrIn_t js;
+    SSFCStrIn_t *path;
+    size_t depth;
+    size_t aindex;
+    size_t start;
+    size_t end;
+    SSFJsonType_t jt;
+    bool done;
+    const SSFJsonNum_t *cur;    /* Number last scanned by the walk, NULL if not accumulated */
+    SSFJsonNum_t num;           /* Value of number found at path if cur not NULL */
+} SSFJsonPathMatch_t;
+
+typedef enum SSFJsonGetKind
+{
+    SSF_JSON_GET_TYPE,      /* out unused, only jt is returned */
+    SSF_JSON_GET_STRING,    /* out is char[outSize] */
+    SSF_JSON_GET_LONG,      /* out is long int */
+    SSF_JSON_GET_ULONG,     /* out is unsigned long int */
+#if SSF_JSON_CONFIG_ENABLE_FLOAT_PARSE == 1
+    SSF_JSON_GET_DOUBLE,    /* out is double */
+#endif /* SSF_JSON_CONFIG_ENABLE_FLOAT_PARSE */
+    SSF_JSON_GET_HEX,       /* out is uint8_t[outSize] */
+    SSF_JSON_GET_HEX_REV,   /* out is uint8_t[outSize], byte order reversed */
+    SSF_JSON_GET_BASE64,    /* out is uint8_t[outSize] */
+    SSF_JSON_GET_STRING_SPAN, /* out is SSFJsonStr_t, outSize unused */
+    SSF_JSON_GET_MAX,
+} SSFJsonGetKind_t;
+
+typedef struct SSFJsonGet
+{
+    SSFCStrIn_t *path;          /* In: path to value, same as path for SSFJsonGet*() */
+    SSFJsonGetKind_t kind;      /* In: how value is converted into out */
+    void *out;                  /* In: where the converted value is written */
+    size_t outSize;             /* In: size of string or binary out buffer */
+    size_t outLen;              /* Out: length of string or binary data written to out */
+    SSFJsonType_t jt;           /* Out: type of value found, SSF_JSON_TYPE_ERROR if not found */
+    bool ok;                    /* Out: true if value found and converted into out */
+    SSFJsonPathMatch_t match;   /* Private */
+} SSFJsonGet_t;
+
+#if SSF_JSON_CONFIG_ENABLE_INDEX == 1
+#define SSF_JSON_TOK_NONE ((size_t)-1)
+
+typedef struct SSFJsonTok
+{
+    size_t start;           /* Index of first char of value */
+    size_t end;             /* Index of last char of value */
+    size_t key;             /* Index of first char of key, 0 if not an object member */
+    size_t keyLen;          /* Length of key in chars */
+    size_t next;            /* Index of next sibling token, or end of parent's descendants */
+    size_t parent;          /* Index of parent token, SSF_JSON_TOK_NONE for root */
+    SSFJsonType_t type;
+} SSFJsonTok_t;
+
+typedef struct SSFJsonIndex
+{
+    SSFCStrIn_t js;
+    SSFJsonTok_t *toks;
+    size_t toksSize;
+    size_t toksLen;
+    size_t cur;
+    size_t key;
+    size_t keyLen;
+} SSFJsonIndex_t;
+#endif /* SSF_JSON_CONFIG_ENABLE_INDEX */
+
+#if SSF_JSON_CONFIG_ENABLE_ITER == 1
+typedef struct SSFJsonIter
+{
+    SSFCStrIn_t js;
+    SSFCStrIn_t key;        /* Out: key of current object member, NULL for array elements */
+    size_t keyLen;          /* Out: length of key, it is not NULL terminated */
+    size_t start;           /* Out: index of first char of current value */
+    size_t end;             /* Out: index of last char of current value */
+    SSFJsonType_t jt;       /* Out: type of current value */
+    size_t len;             /* Private */
+    size_t index;           /* Private */
+    bool isArray;           /* Private */
+    bool isFirst;           /* Private */
+    bool isDone;            /* Private */
+} SSFJsonIter_t;
+#endif /* SSF_JSON_CONFIG_ENABLE_ITER */
+
+#if SSF_JSON_CONFIG_ENABLE_STREAM == 1
+typedef enum SSFJsonStreamEvent
+{
+    SSF_JSON_STREAM_EVENT_OPEN,     /* Object or array started */
+    SSF_JSON_STREAM_EVENT_CLOSE,    /* Object or array ended */
+    SSF_JSON_STREAM_EVENT_VALUE,    /* String, number, true, false or null value parsed */
+    SSF_JSON_STREAM_EVENT_PART,     /* Leading part of a string value too long for one event */
+    SSF_JSON_STREAM_EVENT_MAX,
+} SSFJsonStreamEvent_t;
+
+/* key is NULL for array elements and close events, index is the position in the parent, */
+/* val is the raw value text w/NULL term. excluding quotes, depth is 0 for the root object. */
+/* A string longer than SSF_JSON_CONFIG_STREAM_MAX_VAL_LEN arrives as PART events followed */
+/* by a VALUE event with its remaining chars; Parts never split an escape sequence. */
+typedef bool (*SSFJsonStreamFn_t)(SSFJsonStreamEvent_t ev, SSFJsonType_t jt, SSFCStrIn_t key,
+                                  size_t index, SSFCStrIn_t val, size_t valLen, uint8_t depth,
+                                  void *ctx);
+
+typedef struct SSFJsonStream
+{
+    SSFJsonStreamFn_t fn;
+    void *ctx;
+    SSFCStrIn_t lit;
+    size_t count[SSF_JSON_CONFIG_MAX_IN_DEPTH];
+    bool isArray[SSF_JSON_CONFIG_MAX_IN_DEPTH];
+    uint8_t depth;
+    uint8_t state;
+    uint8_t sub;
+    size_t keyLen;
+    size_t valLen;
+    char key[SSF_JSON_CONFIG_STREAM_MAX_KEY_LEN + 1];
+    char val[SSF_JSON_CONFIG_STREAM_MAX_VAL_LEN + 1];
+    uint32_t magic;
+} SSFJsonStream_t;
+#endif /* SSF_JSON_CONFIG_ENABLE_STREAM */
+
 typedef bool (*SSFJsonPrintFn_t)(char *js, size_t size, size_t start, size_t *end, void *in);
 
+#if SSF_JSON_CONFIG_ENABLE_UPDATE == 1
+typedef struct SSFJsonUpdate
+{
+    SSFCStrIn_t *path;          /* In: path to value, same as path for SSFJsonUpdate() */
+    SSFJsonPrintFn_t fn;        /* In: prints the new value */
+    void *in;                   /* In: passed to fn */
+    SSFJsonType_t jt;           /* Private */
+    SSFJsonPathMatch_t match;   /* Private */
+} SSFJsonUpdate_t;
+#endif /* SSF_JSON_CONFIG_ENABLE_UPDATE */
+
+#if SSF_JSON_CONFIG_ENABLE_GEN == 1
+/* Called with staged output to send, or with out NULL and outLen 0 when the BFifo is full and */
+/* must be drained before generation can continue. */
+typedef bool (*SSFJsonGenFlushFn_t)(const uint8_t *out, size_t outLen, void *ctx);
+
+typedef struct SSFJsonGen
+{
+    SSFBFifo_t *fifo;
+    SSFJsonGenFlushFn_t fn;
+    void *ctx;
+    uint8_t *buf;
+    size_t bufSize;
+    size_t bufLen;
+    size_t len;
+    uint8_t stack[SSF_JSON_STACK_SIZE(SSF_JSON_CONFIG_GEN_MAX_DEPTH)];
+    uint8_t depth;
+    bool comma;
+    bool isErr;
+    uint32_t magic;
+} SSFJsonGen_t;
+#endif /* SSF_JSON_CONFIG_ENABLE_GEN */
+
+#if SSF_JSON_CONFIG_ENABLE_SCHEMA == 1
+#if SSF_JSON_CONFIG_SCHEMA_MAX_FIELDS > 127
+#error SSFJSON invalid SSF_JSON_CONFIG_SCHEMA_MAX_FIELDS.
+#endif
+/* Number of hash slots in a schema, a power of 2 at least four times the maximum fields. */
+#define SSF_JSON_SCHEMA_SLOTS (SSF_JSON_CONFIG_SCHEMA_MAX_FIELDS <= 4 ? 16u : \
+                               SSF_JSON_CONFIG_SCHEMA_MAX_FIELDS <= 8 ? 32u : \
+                               SSF_JSON_CONFIG_SCHEMA_MAX_FIELDS <= 16 ? 64u : \
+                               SSF_JSON_CONFIG_SCHEMA_MAX_FIELDS <= 32 ? 128u : \
+                               SSF_JSON_CONFIG_SCHEMA_MAX_FIELDS <= 64 ? 256u : 512u)
+
+typedef enum SSFJsonFieldKind
+{
+    SSF_JSON_FIELD_STRING,      /* char[] member, NULL terminated */
+    SSF_JSON_FIELD_LONG,        /* long int member */
+    SSF_JSON_FIELD_ULONG,       /* unsigned long int member */
+    SSF_JSON_FIELD_BOOL,        /* bool member, true or false */
+#if (SSF_JSON_CONFIG_ENABLE_FLOAT_PARSE == 1) && (SSF_JSON_CONFIG_ENABLE_FLOAT_GEN == 1)
+    SSF_JSON_FIELD_DOUBLE,      /* double member */
+#endif /* SSF_JSON_CONFIG_ENABLE_FLOAT_PARSE && SSF_JSON_CONFIG_ENABLE_FLOAT_GEN */
+    SSF_JSON_FIELD_HEX,         /* uint8_t[] member, exactly sizeof member bytes as hex string */
+    SSF_JSON_FIELD_BASE64,      /* uint8_t[] member, exactly sizeof member bytes as Base64 */
+    SSF_JSON_FIELD_OBJECT,      /* struct member described by sub schema */
+    SSF_JSON_FIELD_MAX,
+} SSFJsonFieldKind_t;
+
+typedef struct SSFJsonField
+{
+    SSFCStrIn_t key;
+    size_t keyLen;
+    size_t offset;
+    size_t size;
+    SSFJsonFieldKind_t kind;
+    struct SSFJsonSchema *sub;
+} SSFJsonField_t;
+
+typedef struct SSFJsonSchema
+{
+    const SSFJsonField_t *fields;
+    size_t fieldsLen;
+    uint32_t seed;                          /* Private */
+    uint32_t mask;                          /* Private */
+    uint32_t probes;                        /* Private */
+    uint8_t slots[SSF_JSON_SCHEMA_SLOTS];   /* Private */
+    uint32_t magic;                         /* Private */
+} SSFJsonSchema_t;
+
+/* Expands one X(type, member, key, kind, sub) entry of a schema field list into a field. */
+#define SSF_JSON_SCHEMA_FIELD(type, member, key, kind, sub) \
+        { key, sizeof(key) - 1, offsetof(type, member), sizeof(((type *)0)->member), kind, sub },
+
+/* Defines schema name for struct type from an X-macro field list, init with SSFJsonSchemaInit(). */
+#define SSF_JSON_SCHEMA_DEFINE(name, type, fields) \
+        static const SSFJsonField_t name##Fields[] = { fields(SSF_JSON_SCHEMA_FIELD, type) }; \
+        SSFJsonSchema_t name = { name##Fields, sizeof(name##Fields) / sizeof(SSFJsonField_t), \
+                                 0, 0, 0, { 0 }, 0 }
+#endif /* SSF_JSON_CONFIG_ENABLE_SCHEMA */
+
 /* --------------------------------------------------------------------------------------------- */
 /* External interface                                                                            */
 /* --------------------------------------------------------------------------------------------- */
 /* Parser */
 bool SSFJsonIsValid(SSFCStrIn_t js);
+bool SSFJsonIsValidStack(SSFCStrIn_t js, uint8_t *stack, size_t stackSize);
 SSFJsonType_t SSFJsonGetType(SSFCStrIn_t js, SSFCStrIn_t *path);
 bool SSFJsonGetString(SSFCStrIn_t js, SSFCStrIn_t *path, SSFCStrOut_t out, size_t outSize,
                       size_t *outLen);
+bool SSFJsonGetStringSpan(SSFCStrIn_t js, SSFCStrIn_t *path, SSFJsonStr_t *out);
+bool SSFJsonStrIs(const SSFJsonStr_t *str, SSFCStrIn_t cstr);
+bool SSFJsonStrUnescape(const SSFJsonStr_t *str, SSFCStrOut_t out, size_t outSize,
+                        size_t *outLen);
 #if SSF_JSON_CONFIG_ENABLE_FLOAT_PARSE == 1
 bool SSFJsonGetDouble(SSFCStrIn_t js, SSFCStrIn_t *path, double *out);
 #endif /* SSF_JSON_CONFIG_ENABLE_FLOAT_PARSE */
@@ -102,8 +346,58 @@ bool SSFJsonGetHex(SSFCStrIn_t js, SSFCStrIn_t *path, uint8_t *out, size_t outSi
                    size_t *outLen, bool rev);
 bool SSFJsonGetBase64(SSFCStrIn_t js, SSFCStrIn_t *path, uint8_t *out, size_t outSize,
                       size_t *outLen);
+bool SSFJsonGetBase64Fmt(SSFCStrIn_t js, SSFCStrIn_t *path, uint8_t *out, size_t outSize,
+                         size_t *outLen, SSFBase64Fmt_t fmt);
 bool SSFJsonObject(SSFCStrIn_t js, size_t *index, size_t *start, size_t *end, SSFCStrIn_t *path,
                    uint8_t depth, SSFJsonType_t *jt);
+bool SSFJsonGetMany(SSFCStrIn_t js, SSFJsonGet_t *gets, size_t getsLen);
+
+#if SSF_JSON_CONFIG_ENABLE_INDEX == 1
+/* Index */
+bool SSFJsonIndex(SSFJsonIndex_t *idx, SSFCStrIn_t js, SSFJsonTok_t *toks, size_t toksSize);
+bool SSFJsonIndexFind(const SSFJsonIndex_t *idx, SSFCStrIn_t *path, size_t *tok);
+SSFJsonType_t SSFJsonIndexGetType(const SSFJsonIndex_t *idx, SSFCStrIn_t *path);
+bool SSFJsonIndexGetString(const SSFJsonIndex_t *idx, SSFCStrIn_t *path, SSFCStrOut_t out,
+                           size_t outSize, size_t *outLen);
+bool SSFJsonIndexGetStringSpan(const SSFJsonIndex_t *idx, SSFCStrIn_t *path, SSFJsonStr_t *out);
+#if SSF_JSON_CONFIG_ENABLE_FLOAT_PARSE == 1
+bool SSFJsonIndexGetDouble(const SSFJsonIndex_t *idx, SSFCStrIn_t *path, double *out);
+#endif /* SSF_JSON_CONFIG_ENABLE_FLOAT_PARSE */
+bool SSFJsonIndexGetLong(const SSFJsonIndex_t *idx, SSFCStrIn_t *path, long int *out);
+bool SSFJsonIndexGetULong(const SSFJsonIndex_t *idx, SSFCStrIn_t *path, unsigned long int *out);
+bool SSFJsonIndexGetHex(const SSFJsonIndex_t *idx, SSFCStrIn_t *path, uint8_t *out,
+                        size_t outSize, size_t *outLen, bool rev);
+bool SSFJsonIndexGetBase64(const SSFJsonIndex_t *idx, SSFCStrIn_t *path, uint8_t *out,
+                           size_t outSize, size_t *outLen);
+#endif /* SSF_JSON_CONFIG_ENABLE_INDEX */
+
+#if SSF_JSON_CONFIG_ENABLE_ITER == 1
+/* Iterator */
+bool SSFJsonIterBegin(SSFJsonIter_t *it, SSFCStrIn_t js, SSFCStrIn_t *path);
+bool SSFJsonIterChild(const SSFJsonIter_t *it, SSFJsonIter_t *child);
+bool SSFJsonIterNext(SSFJsonIter_t *it);
+bool SSFJsonIterKeyIs(const SSFJsonIter_t *it, SSFCStrIn_t key);
+bool SSFJsonIterGetString(const SSFJsonIter_t *it, SSFCStrOut_t out, size_t outSize,
+                          size_t *outLen);
+bool SSFJsonIterGetStringSpan(const SSFJsonIter_t *it, SSFJsonStr_t *out);
+#if SSF_JSON_CONFIG_ENABLE_FLOAT_PARSE == 1
+bool SSFJsonIterGetDouble(const SSFJsonIter_t *it, double *out);
+#endif /* SSF_JSON_CONFIG_ENABLE_FLOAT_PARSE */
+bool SSFJsonIterGetLong(const SSFJsonIter_t *it, long int *out);
+bool SSFJsonIterGetULong(const SSFJsonIter_t *it, unsigned long int *out);
+bool SSFJsonIterGetHex(const SSFJsonIter_t *it, uint8_t *out, size_t outSize, size_t *outLen,
+                       bool rev);
+bool SSFJsonIterGetBase64(const SSFJsonIter_t *it, uint8_t *out, size_t outSize, size_t *outLen);
+#endif /* SSF_JSON_CONFIG_ENABLE_ITER */
+
+#if SSF_JSON_CONFIG_ENABLE_STREAM == 1
+/* Streaming parser */
+void SSFJsonStreamInit(SSFJsonStream_t *jss, SSFJsonStreamFn_t fn, void *ctx);
+void SSFJsonStreamDeInit(SSFJsonStream_t *jss);
+bool SSFJsonStreamFeed(SSFJsonStream_t *jss, SSFCStrIn_t in, size_t inLen);
+bool SSFJsonStreamFeedBFifo(SSFJsonStream_t *jss, SSFBFifo_t *fifo);
+bool SSFJsonStreamIsDone(const SSFJsonStream_t *jss);
+#endif /* SSF_JSON_CONFIG_ENABLE_STREAM */
 
 /* Generator */
 bool SSFJsonPrintString(SSFCStrOut_t js, size_t size, size_t start, size_t *end, SSFCStrIn_t in,
@@ -121,6 +415,8 @@ bool SSFJsonPrintHex(SSFCStrOut_t js, size_t size, size_t start, size_t *end, co
                      bool rev, bool *comma);
 bool SSFJsonPrintBase64(SSFCStrOut_t jstr, size_t size, size_t start, size_t *end,
                         const uint8_t *in, size_t inLen, bool *comma);
+bool SSFJsonPrintBase64Fmt(SSFCStrOut_t jstr, size_t size, size_t start, size_t *end,
+                           const uint8_t *in, size_t inLen, SSFBase64Fmt_t fmt, bool *comma);
 #if SSF_JSON_CONFIG_ENABLE_FLOAT_GEN == 1
 bool SSFJsonPrintDouble(SSFCStrOut_t js, size_t size, size_t start, size_t *end, double in,
                         SSFJsonFltFmt_t fmt, bool *comma);
@@ -139,8 +435,64 @@ bool SSFJsonPrint(SSFCStrOut_t js, size_t size, size_t start, size_t *end, SSFJs
                   void *in, const char *oc, bool *comma);
 #if SSF_JSON_CONFIG_ENABLE_UPDATE == 1
 bool SSFJsonUpdate(SSFCStrOut_t js, size_t size, SSFCStrIn_t *path, SSFJsonPrintFn_t fn);
+bool SSFJsonUpdateMany(SSFCStrIn_t js, SSFCStrOut_t out, size_t outSize, size_t *outLen,
+                       SSFJsonUpdate_t *ups, size_t upsLen);
 #endif /* SSF_JSON_CONFIG_ENABLE_UPDATE */
 
+#if SSF_JSON_CONFIG_ENABLE_GEN == 1
+/* Streaming generator */
+void SSFJsonGenInit(SSFJsonGen_t *gen, uint8_t *buf, size_t bufSize, SSFJsonGenFlushFn_t fn,
+                    void *ctx);
+void SSFJsonGenInitBFifo(SSFJsonGen_t *gen, SSFBFifo_t *fifo, SSFJsonGenFlushFn_t fn, void *ctx);
+void SSFJsonGenDeInit(SSFJsonGen_t *gen);
+bool SSFJsonGenOpen(SSFJsonGen_t *gen, bool isArray);
+bool SSFJsonGenClose(SSFJsonGen_t *gen, bool isArray);
+#define SSFJsonGenObjectBegin(gen) SSFJsonGenOpen(gen, false)
+#define SSFJsonGenObjectEnd(gen) SSFJsonGenClose(gen, false)
+#define SSFJsonGenArrayBegin(gen) SSFJsonGenOpen(gen, true)
+#define SSFJsonGenArrayEnd(gen) SSFJsonGenClose(gen, true)
+bool SSFJsonGenLabel(SSFJsonGen_t *gen, SSFCStrIn_t in);
+bool SSFJsonGenString(SSFJsonGen_t *gen, SSFCStrIn_t in);
+bool SSFJsonGenRaw(SSFJsonGen_t *gen, SSFCStrIn_t in);
+#define SSFJsonGenTrue(gen) SSFJsonGenRaw(gen, "true")
+#define SSFJsonGenFalse(gen) SSFJsonGenRaw(gen, "false")
+#define SSFJsonGenNull(gen) SSFJsonGenRaw(gen, "null")
+bool SSFJsonGenInt(SSFJsonGen_t *gen, long in);
+bool SSFJsonGenUInt(SSFJsonGen_t *gen, unsigned long in);
+#if SSF_JSON_CONFIG_ENABLE_FLOAT_GEN == 1
+bool SSFJsonGenDouble(SSFJsonGen_t *gen, double in, SSFJsonFltFmt_t fmt);
+#endif /* SSF_JSON_CONFIG_ENABLE_FLOAT_GEN */
+bool SSFJsonGenHex(SSFJsonGen_t *gen, const uint8_t *in, size_t inLen, bool rev);
+bool SSFJsonGenBase64(SSFJsonGen_t *gen, const uint8_t *in, size_t inLen);
+bool SSFJsonGenFlush(SSFJsonGen_t *gen);
+bool SSFJsonGenEnd(SSFJsonGen_t *gen, size_t *outLen);
+#endif /* SSF_JSON_CONFIG_ENABLE_GEN */
+
+#if SSF_JSON_CONFIG_ENABLE_MINIFY == 1
+/* Minify and canonicalize */
+bool SSFJsonMinify(SSFCStrIn_t js, SSFCStrOut_t out, size_t outSize, size_t *outLen);
+#if SSF_JSON_CONFIG_ENABLE_ITER == 1
+bool SSFJsonCanonicalize(SSFCStrIn_t js, SSFCStrOut_t out, size_t outSize, size_t *outLen);
+#endif /* SSF_JSON_CONFIG_ENABLE_ITER */
+#if SSF_JSON_CONFIG_ENABLE_GEN == 1
+bool SSFJsonGenMinify(SSFJsonGen_t *gen, SSFCStrIn_t js);
+#if SSF_JSON_CONFIG_ENABLE_ITER == 1
+bool SSFJsonGenCanonicalize(SSFJsonGen_t *gen, SSFCStrIn_t js);
+#endif /* SSF_JSON_CONFIG_ENABLE_ITER */
+#endif /* SSF_JSON_CONFIG_ENABLE_GEN */
+#endif /* SSF_JSON_CONFIG_ENABLE_MINIFY */
+
+#if SSF_JSON_CONFIG_ENABLE_SCHEMA == 1
+/* Schema codec */
+void SSFJsonSchemaInit(SSFJsonSchema_t *schema);
+bool SSFJsonSchemaDecode(SSFCStrIn_t js, const SSFJsonSchema_t *schema, void *out);
+bool SSFJsonSchemaPrint(SSFCStrOut_t js, size_t size, size_t start, size_t *end,
+                        const SSFJsonSchema_t *schema, const void *in, bool *comma);
+#if SSF_JSON_CONFIG_ENABLE_GEN == 1
+bool SSFJsonSchemaGen(SSFJsonGen_t *gen, const SSFJsonSchema_t *schema, const void *in);
+#endif /* SSF_JSON_CONFIG_ENABLE_GEN */
+#endif /* SSF_JSON_CONFIG_ENABLE_SCHEMA */
+
 /* --------------------------------------------------------------------------------------------- */
 /* Unit test                                                                                     */
 /* --------------------------------------------------------------------------------------------- */
@@ -32,6 +32,8 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
 #include "ssfjson.h"
 #include "ssfassert.h"
 #include "ssfport.h"
@@ -305,6 +307,9 @@ const char *_jtsComplex[] =
 };
 
 char _jsOut[1024];
+#if SSF_JSON_CONFIG_ENABLE_ITER == 1
+char _jsIterIn[2048];
+#endif /* SSF_JSON_CONFIG_ENABLE_ITER */
 
 /* --------------------------------------------------------------------------------------------- */
 /* Printer function.                                                                             */
@@ -424,6 +429,17 @@ bool p4fn(char *js, size_t size, size_t start, size_t *end, void *in)
     return true;
 }
 
+/* --------------------------------------------------------------------------------------------- */
+/* Printer function.                                                                             */
+/* --------------------------------------------------------------------------------------------- */
+bool p5fn(char *js, size_t size, size_t start, size_t *end, void *in)
+{
+    SSF_REQUIRE(in != NULL);
+    if (!SSFJsonPrintInt(js, size, start, &start, *(long *)in, false)) return false;
+    *end = start;
+    return true;
+}
+
     #if SSF_JSON_CONFIG_ENABLE_UPDATE == 1
 /* --------------------------------------------------------------------------------------------- */
 /* Printer function.                                                                             */
@@ -432,6 +448,9 @@ void SSFJsonUnitTestUpdate(char *out, size_t outSize, char *path0, char *path1,
                            const char *initial, const char *expected)
 {
     char *path[SSF_JSON_CONFIG_MAX_IN_DEPTH + 1];
+    char many[1024];
+    size_t manyLen;
+    SSFJsonUpdate_t up;
 
     memset(out, 0xff, outSize);
     memcpy(out, initial, SSF_MIN(outSize, strlen(initial) + 1));
@@ -439,12 +458,308 @@ void SSFJsonUnitTestUpdate(char *out, size_t outSize, char *path0, char *path1,
     path[0] = path0;
     path[1] = path1;
     path[2] = path2;
+    up.path = (SSFCStrIn_t *)path;
+    up.fn = p4fn;
+    up.in = NULL;
+    SSF_ASSERT(SSFJsonUpdateMany(initial, many, sizeof(many), &manyLen, &up, 1) == true);
+    SSF_ASSERT(manyLen == strlen(many));
     SSF_ASSERT(SSFJsonUpdate(out, outSize, (SSFCStrIn_t *)path, p4fn) == true);
     SSF_ASSERT(SSFJsonIsValid(out) == true);
     if (expected != NULL) SSF_ASSERT(strncmp(out, expected, outSize) == 0);
+    SSF_ASSERT(strcmp(out, many) == 0);
 }
     #endif /* SSF_JSON_CONFIG_ENABLE_UPDATE */
 
+#if SSF_JSON_CONFIG_ENABLE_INDEX == 1
+/* --------------------------------------------------------------------------------------------- */
+/* Verifies that index getters return the same results as the path getters.                      */
+/* --------------------------------------------------------------------------------------------- */
+void SSFJsonUnitTestIndexPath(SSFCStrIn_t js, const SSFJsonIndex_t *idx, SSFCStrIn_t *path)
+{
+    char strOut1[256];
+    char strOut2[256];
+    size_t outLen1;
+    size_t outLen2;
+    uint8_t binOut1[256];
+    uint8_t binOut2[256];
+    long int si1;
+    long int si2;
+    unsigned long int ui1;
+    unsigned long int ui2;
+    SSFJsonStr_t str1;
+    SSFJsonStr_t str2;
+    bool rv;
+
+    SSF_ASSERT(SSFJsonIndexGetType(idx, path) == SSFJsonGetType(js, path));
+
+    outLen1 = 0; outLen2 = 0;
+    rv = SSFJsonGetString(js, path, strOut1, sizeof(strOut1), &outLen1);
+    SSF_ASSERT(SSFJsonIndexGetString(idx, path, strOut2, sizeof(strOut2), &outLen2) == rv);
+    if (rv) { SSF_ASSERT((outLen1 == outLen2) && (memcmp(strOut1, strOut2, outLen1) == 0)); }
+
+    rv = SSFJsonGetStringSpan(js, path, &str1);
+    SSF_ASSERT(SSFJsonIndexGetStringSpan(idx, path, &str2) == rv);
+    if (rv) { SSF_ASSERT((str1.ptr == str2.ptr) && (str1.len == str2.len)); }
+
+    rv = SSFJsonGetLong(js, path, &si1);
+    SSF_ASSERT(SSFJsonIndexGetLong(idx, path, &si2) == rv);
+    if (rv) { SSF_ASSERT(si1 == si2); }
+
+    rv = SSFJsonGetULong(js, path, &ui1);
+    SSF_ASSERT(SSFJsonIndexGetULong(idx, path, &ui2) == rv);
+    if (rv) { SSF_ASSERT(ui1 == ui2); }
+
+#if SSF_JSON_CONFIG_ENABLE_FLOAT_PARSE == 1
+    {
+        double d1;
+        double d2;
+
+        rv = SSFJsonGetDouble(js, path, &d1);
+        SSF_ASSERT(SSFJsonIndexGetDouble(idx, path, &d2) == rv);
+        if (rv) { SSF_ASSERT(d1 == d2); }
+    }
+#endif /* SSF_JSON_CONFIG_ENABLE_FLOAT_PARSE */
+
+    outLen1 = 0; outLen2 = 0;
+    rv = SSFJsonGetHex(js, path, binOut1, sizeof(binOut1), &outLen1, true);
+    SSF_ASSERT(SSFJsonIndexGetHex(idx, path, binOut2, sizeof(binOut2), &outLen2, true) == rv);
+    if (rv) { SSF_ASSERT((outLen1 == outLen2) && (memcmp(binOut1, binOut2, outLen1) == 0)); }
+
+    outLen1 = 0; outLen2 = 0;
+    rv = SSFJsonGetBase64(js, path, binOut1, sizeof(binOut1), &outLen1);
+    SSF_ASSERT(SSFJsonIndexGetBase64(idx, path, binOut2, sizeof(binOut2), &outLen2) == rv);
+    if (rv) { SSF_ASSERT((outLen1 == outLen2) && (memcmp(binOut1, binOut2, outLen1) == 0)); }
+}
+#endif /* SSF_JSON_CONFIG_ENABLE_INDEX */
+
+#if SSF_JSON_CONFIG_ENABLE_STREAM == 1
+char _jsStreamTrace[4096];
+size_t _jsStreamTraceLen;
+size_t _jsStreamAbortAt;
+
+/* --------------------------------------------------------------------------------------------- */
+/* Streaming parser event function, appends a description of each event to a trace string.     */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFJsonUnitTestStreamFn(SSFJsonStreamEvent_t ev, SSFJsonType_t jt, SSFCStrIn_t key,
+                             size_t index, SSFCStrIn_t val, size_t valLen, uint8_t depth,
+                             void *ctx)
+{
+    int len;
+
+    SSF_ASSERT(ev < SSF_JSON_STREAM_EVENT_MAX);
+    SSF_ASSERT(jt < SSF_JSON_TYPE_MAX);
+    SSF_ASSERT(depth < SSF_JSON_CONFIG_MAX_IN_DEPTH);
+    SSF_ASSERT(ctx == &_jsStreamTraceLen);
+    if ((ev == SSF_JSON_STREAM_EVENT_VALUE) || (ev == SSF_JSON_STREAM_EVENT_PART))
+    { SSF_ASSERT((val != NULL) && (strlen(val) == valLen)); }
+    else { SSF_ASSERT((val == NULL) && (valLen == 0)); }
+    if (ev == SSF_JSON_STREAM_EVENT_CLOSE) { SSF_ASSERT(key == NULL); }
+
+    if (_jsStreamAbortAt != 0)
+    {
+        _jsStreamAbortAt--;
+        if (_jsStreamAbortAt == 0) return false;
+    }
+    len = snprintf(&_jsStreamTrace[_jsStreamTraceLen], sizeof(_jsStreamTrace) - _jsStreamTraceLen,
+                   "%c%d%u%s%s%lu%s%s;", "OCVP"[ev], (int)jt, (unsigned int)depth,
+                   key == NULL ? "" : key, key == NULL ? "#" : ":", (unsigned long)index,
+                   val == NULL ? "" : "=", val == NULL ? "" : val);
+    SSF_ASSERT((len > 0) && ((size_t)len < (sizeof(_jsStreamTrace) - _jsStreamTraceLen)));
+    _jsStreamTraceLen += (size_t)len;
+    return true;
+}
+#endif /* SSF_JSON_CONFIG_ENABLE_STREAM */
+
+#if SSF_JSON_CONFIG_ENABLE_GEN == 1
+char _jsGenOut[4096];
+size_t _jsGenOutLen;
+size_t _jsGenFailAt;
+SSFBFifo_t _jsGenFifo;
+uint8_t _jsGenFifoBuf[SSF_BFIFO_255 + 1];
+
+/* --------------------------------------------------------------------------------------------- */
+/* Streaming generator flush function, appends output or drains fifo into _jsGenOut.             */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFJsonUnitTestGenFn(const uint8_t *out, size_t outLen, void *ctx)
+{
+    SSF_ASSERT(ctx == &_jsGenOutLen);
+
+    if (_jsGenFailAt != 0)
+    {
+        _jsGenFailAt--;
+        if (_jsGenFailAt == 0) return false;
+    }
+    if (out == NULL)
+    {
+        SSF_ASSERT(outLen == 0);
+        while (SSFBFifoGetByte(&_jsGenFifo, (uint8_t *)&_jsGenOut[_jsGenOutLen]))
+        {_jsGenOutLen++; SSF_ASSERT(_jsGenOutLen < sizeof(_jsGenOut)); }
+        return true;
+    }
+    SSF_ASSERT((outLen > 0) && ((_jsGenOutLen + outLen) < sizeof(_jsGenOut)));
+    memcpy(&_jsGenOut[_jsGenOutLen], out, outLen);
+    _jsGenOutLen += outLen;
+    return true;
+}
+
+/* --------------------------------------------------------------------------------------------- */
+/* Generates a test document, returns result of SSFJsonGenEnd().                                 */
+/* --------------------------------------------------------------------------------------------- */
+bool SSFJsonUnitTestGenDoc(SSFJsonGen_t *gen, size_t *len)
+{
+    uint8_t bin[] = { 0x01, 0x02, 0x03, 0x04 };
+    size_t i;
+
+    SSFJsonGenObjectBegin(gen);
+    SSFJsonGenLabel(gen, "a");
+    SSFJsonGenInt(gen, 1);
+    SSFJsonGenLabel(gen, "b\"");
+    SSFJsonGenArrayBegin(gen);
+    SSFJsonGenTrue(gen);
+    SSFJsonGenFalse(gen);
+    SSFJsonGenNull(gen);
+    SSFJsonGenInt(gen, -5);
+    SSFJsonGenString(gen, "s\"\\/\r\n\x01x");
+    SSFJsonGenArrayEnd(gen);
+    SSFJsonGenLabel(gen, "c");
+    SSFJsonGenObjectBegin(gen);
+    SSFJsonGenObjectEnd(gen);
+    SSFJsonGenLabel(gen, "d");
+    SSFJsonGenArrayBegin(gen);
+    SSFJsonGenArrayBegin(gen);
+    SSFJsonGenArrayEnd(gen);
+    SSFJsonGenObjectBegin(gen);
+    SSFJsonGenObjectEnd(gen);
+    SSFJsonGenArrayEnd(gen);
+    SSFJsonGenLabel(gen, "h");
+    SSFJsonGenHex(gen, bin, sizeof(bin), false);
+    SSFJsonGenLabel(gen, "hr");
+    SSFJsonGenHex(gen, bin, sizeof(bin), true);
+    SSFJsonGenLabel(gen, "b64");
+    SSFJsonGenBase64(gen, bin, sizeof(bin));
+    SSFJsonGenLabel(gen, "e");
+    SSFJsonGenString(gen, "");
+    SSFJsonGenLabel(gen, "u");
+    SSFJsonGenUInt(gen, 4294967295ul);
+#if SSF_JSON_CONFIG_ENABLE_FLOAT_GEN == 1
+    SSFJsonGenLabel(gen, "f");
+    SSFJsonGenDouble(gen, 1.5, SSF_JSON_FLT_FMT_SHORTEST);
+#endif /* SSF_JSON_CONFIG_ENABLE_FLOAT_GEN */
+    SSFJsonGenLabel(gen, "big");
+    SSFJsonGenArrayBegin(gen);
+    for (i = 0; i < 100; i++) SSFJsonGenUInt(gen, i);
+    SSFJsonGenArrayEnd(gen);
+    SSFJsonGenObjectEnd(gen);
+    return SSFJsonGenEnd(gen, len);
+}
+#endif /* SSF_JSON_CONFIG_ENABLE_GEN */
+
+#if SSF_JSON_CONFIG_ENABLE_SCHEMA == 1
+typedef struct
+{
+    long x;
+    long y;
+} SSFJsonUTPos_t;
+
+typedef struct
+{
+    long id;
+    unsigned long seq;
+    char name[8];
+    bool on;
+    SSFJsonUTPos_t pos;
+    uint8_t key[4];
+    uint8_t iv[5];
+#if (SSF_JSON_CONFIG_ENABLE_FLOAT_PARSE == 1) && (SSF_JSON_CONFIG_ENABLE_FLOAT_GEN == 1)
+    double temp;
+#endif /* SSF_JSON_CONFIG_ENABLE_FLOAT_PARSE && SSF_JSON_CONFIG_ENABLE_FLOAT_GEN */
+} SSFJsonUTMsg_t;
+
+#define SSF_JSON_UT_MANY_LEN (32u)
+typedef struct
+{
+    unsigned long v[SSF_JSON_UT_MANY_LEN];
+} SSFJsonUTMany_t;
+
+#define SSF_JSON_UT_POS_FIELDS(X, T) \
+    X(T, x, "x", SSF_JSON_FIELD_LONG, NULL) \
+    X(T, y, "y", SSF_JSON_FIELD_LONG, NULL)
+
+#if (SSF_JSON_CONFIG_ENABLE_FLOAT_PARSE == 1) && (SSF_JSON_CONFIG_ENABLE_FLOAT_GEN == 1)
+#define SSF_JSON_UT_MSG_DOUBLE_FIELD(X, T) X(T, temp, "temp", SSF_JSON_FIELD_DOUBLE, NULL)
+#else
+#define SSF_JSON_UT_MSG_DOUBLE_FIELD(X, T)
+#endif /* SSF_JSON_CONFIG_ENABLE_FLOAT_PARSE && SSF_JSON_CONFIG_ENABLE_FLOAT_GEN */
+
+#define SSF_JSON_UT_MSG_FIELDS(X, T) \
+    X(T, id, "id", SSF_JSON_FIELD_LONG, NULL) \
+    X(T, seq, "seq", SSF_JSON_FIELD_ULONG, NULL) \
+    X(T, name, "name", SSF_JSON_FIELD_STRING, NULL) \
+    X(T, on, "on", SSF_JSON_FIELD_BOOL, NULL) \
+    X(T, pos, "pos", SSF_JSON_FIELD_OBJECT, &_jsPosSchema) \
+    X(T, key, "key", SSF_JSON_FIELD_HEX, NULL) \
+    X(T, iv, "iv", SSF_JSON_FIELD_BASE64, NULL) \
+    SSF_JSON_UT_MSG_DOUBLE_FIELD(X, T)
+
+#define SSF_JSON_UT_DUP_FIELDS(X, T) \
+    X(T, x, "x", SSF_JSON_FIELD_LONG, NULL) \
+    X(T, y, "x", SSF_JSON_FIELD_LONG, NULL)
+
+#define SSF_JSON_UT_MANY_FIELDS(X, T) \
+    X(T, v[0], "k00", SSF_JSON_FIELD_ULONG, NULL) \
+    X(T, v[1], "k01", SSF_JSON_FIELD_ULONG, NULL) \
+    X(T, v[2], "k02", SSF_JSON_FIELD_ULONG, NULL) \
+    X(T, v[3], "k03", SSF_JSON_FIELD_ULONG, NULL) \
+    X(T, v[4], "k04", SSF_JSON_FIELD_ULONG, NULL) \
+    X(T, v[5], "k05", SSF_JSON_FIELD_ULONG, NULL) \
+    X(T, v[6], "k06", SSF_JSON_FIELD_ULONG, NULL) \
+    X(T, v[7], "k07", SSF_JSON_FIELD_ULONG, NULL) \
+    X(T, v[8], "k08", SSF_JSON_FIELD_ULONG, NULL) \
+    X(T, v[9], "k09", SSF_JSON_FIELD_ULONG, NULL) \
+    X(T, v[10], "k10", SSF_JSON_FIELD_ULONG, NULL) \
+    X(T, v[11], "k11", SSF_JSON_FIELD_ULONG, NULL) \
+    X(T, v[12], "k12", SSF_JSON_FIELD_ULONG, NULL) \
+    X(T, v[13], "k13", SSF_JSON_FIELD_ULONG, NULL) \
+    X(T, v[14], "k14", SSF_JSON_FIELD_ULONG, NULL) \
+    X(T, v[15], "k15", SSF_JSON_FIELD_ULONG, NULL) \
+    X(T, v[16], "k16", SSF_JSON_FIELD_ULONG, NULL) \
+    X(T, v[17], "k17", SSF_JSON_FIELD_ULONG, NULL) \
+    X(T, v[18], "k18", SSF_JSON_FIELD_ULONG, NULL) \
+    X(T, v[19], "k19", SSF_JSON_FIELD_ULONG, NULL) \
+    X(T, v[20], "k20", SSF_JSON_FIELD_ULONG, NULL) \
+    X(T, v[21], "k21", SSF_JSON_FIELD_ULONG, NULL) \
+    X(T, v[22], "k22", SSF_JSON_FIELD_ULONG, NULL) \
+    X(T, v[23], "k23", SSF_JSON_FIELD_ULONG, NULL) \
+    X(T, v[24], "k24", SSF_JSON_FIELD_ULONG, NULL) \
+    X(T, v[25], "k25", SSF_JSON_FIELD_ULONG, NULL) \
+    X(T, v[26], "k26", SSF_JSON_FIELD_ULONG, NULL) \
+    X(T, v[27], "k27", SSF_JSON_FIELD_ULONG, NULL) \
+    X(T, v[28], "k28", SSF_JSON_FIELD_ULONG, NULL) \
+    X(T, v[29], "k29", SSF_JSON_FIELD_ULONG, NULL) \
+    X(T, v[30], "k30", SSF_JSON_FIELD_ULONG, NULL) \
+    X(T, v[31], "k31", SSF_JSON_FIELD_ULONG, NULL) \
+
+SSF_JSON_SCHEMA_DEFINE(_jsPosSchema, SSFJsonUTPos_t, SSF_JSON_UT_POS_FIELDS);
+SSF_JSON_SCHEMA_DEFINE(_jsMsgSchema, SSFJsonUTMsg_t, SSF_JSON_UT_MSG_FIELDS);
+SSF_JSON_SCHEMA_DEFINE(_jsDupSchema, SSFJsonUTPos_t, SSF_JSON_UT_DUP_FIELDS);
+SSF_JSON_SCHEMA_DEFINE(_jsManySchema, SSFJsonUTMany_t, SSF_JSON_UT_MANY_FIELDS);
+
+/* --------------------------------------------------------------------------------------------- */
+/* Asserts that all fields of two test messages are equal.                                       */
+/* --------------------------------------------------------------------------------------------- */
+void SSFJsonUnitTestSchemaMsgEq(const SSFJsonUTMsg_t *a, const SSFJsonUTMsg_t *b)
+{
+    SSF_ASSERT((a->id == b->id) && (a->seq == b->seq) && (a->on == b->on));
+    SSF_ASSERT(strcmp(a->name, b->name) == 0);
+    SSF_ASSERT((a->pos.x == b->pos.x) && (a->pos.y == b->pos.y));
+    SSF_ASSERT(memcmp(a->key, b->key, sizeof(a->key)) == 0);
+    SSF_ASSERT(memcmp(a->iv, b->iv, sizeof(a->iv)) == 0);
+#if (SSF_JSON_CONFIG_ENABLE_FLOAT_PARSE == 1) && (SSF_JSON_CONFIG_ENABLE_FLOAT_GEN == 1)
+    SSF_ASSERT(a->temp == b->temp);
+#endif /* SSF_JSON_CONFIG_ENABLE_FLOAT_PARSE && SSF_JSON_CONFIG_ENABLE_FLOAT_GEN */
+}
+#endif /* SSF_JSON_CONFIG_ENABLE_SCHEMA */
+
 /* --------------------------------------------------------------------------------------------- */
 /* Performs unit test on ssfjson's external interface.                                           */
 /* --------------------------------------------------------------------------------------------- */
@@ -469,6 +784,170 @@ void SSFJsonUnitTest(void)
         SSF_ASSERT(!SSFJsonIsValid(_jtsIsInvalid[i]));
     }
 
+    /* Nonzero depth parses the object at index, matching path from path[depth] on */
+    {
+        const char *njs = "[1, {\"a\":{\"b\":2}, \"c\":3} ,4]";
+        size_t index;
+        SSFJsonType_t jt;
+
+        memset(path, 0, sizeof(path));
+        path[0] = "x";
+        path[1] = "a";
+        path[2] = "b";
+        index = 3;
+        jt = SSF_JSON_TYPE_STRING;
+        SSF_ASSERT(SSFJsonObject(njs, &index, &start, &end, (SSFCStrIn_t *)path, 1, &jt));
+        SSF_ASSERT((jt == SSF_JSON_TYPE_NUMBER) && (start == 14) && (end == 14));
+        SSF_ASSERT(index == 24);
+        path[2] = NULL;
+        index = 3;
+        SSF_ASSERT(SSFJsonObject(njs, &index, &start, &end, (SSFCStrIn_t *)path, 1, &jt));
+        SSF_ASSERT((jt == SSF_JSON_TYPE_OBJECT) && (start == 9) && (end == 15));
+        path[1] = NULL;
+        index = 3;
+        SSF_ASSERT(SSFJsonObject(njs, &index, &start, &end, (SSFCStrIn_t *)path, 1, &jt));
+        SSF_ASSERT((jt == SSF_JSON_TYPE_OBJECT) && (start == 4) && (end == 23));
+        path[1] = "z";
+        index = 3;
+        jt = SSF_JSON_TYPE_STRING;
+        SSF_ASSERT(SSFJsonObject(njs, &index, &start, &end, (SSFCStrIn_t *)path, 1, &jt));
+        SSF_ASSERT((jt == SSF_JSON_TYPE_STRING) && (index == 24));
+        index = 3;
+        SSF_ASSERT(SSFJsonObject(njs, &index, &start, &end, NULL, 1, &jt) && (index == 24));
+        index = 1;
+        SSF_ASSERT(!SSFJsonObject(njs, &index, &start, &end, (SSFCStrIn_t *)path, 1, &jt));
+        index = 3;
+        SSF_ASSERT(!SSFJsonObject(njs, &index, &start, &end, (SSFCStrIn_t *)path,
+                                  SSF_JSON_CONFIG_MAX_IN_DEPTH, &jt));
+    }
+
+    /* Validate parser with caller supplied depth stack */
+    {
+        uint8_t stack[SSF_JSON_STACK_SIZE(24)];
+        size_t depth;
+        long int si;
+
+        SSF_ASSERT(sizeof(stack) == 3);
+        SSF_ASSERT(SSF_JSON_STACK_SIZE(1) == 1);
+        SSF_ASSERT(SSF_JSON_STACK_SIZE(8) == 1);
+        SSF_ASSERT(SSF_JSON_STACK_SIZE(9) == 2);
+        SSF_ASSERT_TEST(SSFJsonIsValidStack(NULL, stack, sizeof(stack)));
+        SSF_ASSERT_TEST(SSFJsonIsValidStack("{}", NULL, sizeof(stack)));
+        SSF_ASSERT_TEST(SSFJsonIsValidStack("{}", stack, 0));
+
+        for (i = 0; i < JTS_NUM_ITEMS(_jtsIsValid, sizeof(char *)); i++)
+        {
+            SSF_ASSERT(SSFJsonIsValidStack(_jtsIsValid[i], stack, sizeof(stack)));
+        }
+        for (i = 0; i < JTS_NUM_ITEMS(_jtsIsInvalid, sizeof(char *)); i++)
+        {
+            SSF_ASSERT(!SSFJsonIsValidStack(_jtsIsInvalid[i], stack, sizeof(stack)));
+        }
+
+        /* Nest 24 levels of alternating objects and arrays, {"a":[{"a":[...]}]} */
+        for (depth = 0, end = 0; depth < 24; depth++)
+        {
+            if ((depth & 1) == 0) { memcpy(&_jsOut[end], "{\"a\":", 5); end += 5; }
+            else { _jsOut[end] = '['; end++; }
+        }
+        for (depth = 24; depth > 0; depth--)
+        {
+            _jsOut[end] = ((depth - 1) & 1) ? ']' : '}';
+            end++;
+        }
+        _jsOut[end] = 0;
+        SSF_ASSERT(SSFJsonIsValidStack(_jsOut, stack, sizeof(stack)));
+        SSF_ASSERT(!SSFJsonIsValidStack(_jsOut, stack, sizeof(stack) - 1));
+        SSF_ASSERT(SSFJsonIsValid(_jsOut) == (24 <= SSF_JSON_CONFIG_MAX_WALK_DEPTH));
+        _jsOut[end - 1] = ']';
+        SSF_ASSERT(!SSFJsonIsValidStack(_jsOut, stack, sizeof(stack)));
+
+        /* Paths that continue past a string, number, true, false or null are not found */
+        memset(path, 0, sizeof(path));
+        path[0] = "b1";
+        path[1] = "b1";
+        SSF_ASSERT(SSFJsonGetType(_jtsComplex[0], (SSFCStrIn_t *)path) == SSF_JSON_TYPE_ERROR);
+        path[0] = "a2";
+        path[1] = (char *)&depth;
+        path[2] = (char *)&depth;
+        depth = 0;
+        SSF_ASSERT(SSFJsonGetType(_jtsComplex[0], (SSFCStrIn_t *)path) == SSF_JSON_TYPE_ERROR);
+        depth = 7;
+        SSF_ASSERT(SSFJsonGetType(_jtsComplex[0], (SSFCStrIn_t *)path) == SSF_JSON_TYPE_ERROR);
+        depth = 9;
+        SSF_ASSERT(SSFJsonGetType(_jtsComplex[0], (SSFCStrIn_t *)path) == SSF_JSON_TYPE_ERROR);
+        depth = 1;
+        path[2] = "s1-";
+        SSF_ASSERT(SSFJsonGetType(_jtsComplex[0], (SSFCStrIn_t *)path) == SSF_JSON_TYPE_ERROR);
+
+        /* Values off the path may nest deeper than SSF_JSON_CONFIG_MAX_IN_DEPTH */
+        memset(path, 0, sizeof(path));
+        path[0] = "id";
+        SSF_ASSERT(SSFJsonIsValid("{\"a\":{\"b\":{\"c\":{\"d\":{\"e\":1}}}},\"id\":7}"));
+        SSF_ASSERT(SSFJsonGetLong("{\"a\":{\"b\":{\"c\":{\"d\":{\"e\":1}}}},\"id\":7}",
+                                  (SSFCStrIn_t *)path, &si));
+        SSF_ASSERT(si == 7);
+
+        /* Paths match the first of duplicate keys */
+        path[0] = "b";
+        SSF_ASSERT(SSFJsonGetType("{\"b\":[],\"b\":\"\"}", (SSFCStrIn_t *)path) ==
+                   SSF_JSON_TYPE_ARRAY);
+        SSF_ASSERT(SSFJsonGetType("{\"b\":\"\",\"b\":[]}", (SSFCStrIn_t *)path) ==
+                   SSF_JSON_TYPE_STRING);
+    }
+
+    /* Scan whitespace runs and string bodies of every length across scan word boundaries */
+    {
+        size_t ws;
+        size_t n;
+        size_t k;
+        size_t vstart;
+        size_t vend;
+        SSFJsonType_t jt;
+
+        memset(path, 0, sizeof(path));
+        path[0] = "k";
+        for (ws = 0; ws < 34; ws++)
+        {
+            for (n = 0; n < 34; n++)
+            {
+                /* {<ws>"k":<ws>"abc...\""<ws>} */
+                end = 0;
+                _jsOut[end++] = '{';
+                for (k = 0; k < ws; k++) _jsOut[end++] = " \t\r\n"[k & 3];
+                memcpy(&_jsOut[end], "\"k\":", 4);
+                end += 4;
+                for (k = 0; k < ws; k++) _jsOut[end++] = " \t\r\n"[k & 3];
+                _jsOut[end++] = '"';
+                start = end;
+                for (k = 0; k < n; k++) _jsOut[end++] = (char)('a' + (k % 26));
+                if (n >= 2) { _jsOut[end - 2] = '\\'; _jsOut[end - 1] = '"'; }
+                _jsOut[end++] = '"';
+                for (k = 0; k < ws; k++) _jsOut[end++] = " \t\r\n"[k & 3];
+                _jsOut[end++] = '}';
+                _jsOut[end] = 0;
+
+                SSF_ASSERT(SSFJsonIsValid(_jsOut));
+                SSF_ASSERT(SSFJsonObject(_jsOut, &k, &vstart, &vend, (SSFCStrIn_t *)path, 0,
+                                         &jt));
+                SSF_ASSERT(jt == SSF_JSON_TYPE_STRING);
+                SSF_ASSERT(vstart == (start - 1));
+                SSF_ASSERT(vend == (start + n));
+
+                /* Bad escape */
+                if (n >= 2)
+                {
+                    _jsOut[start + n - 1] = 'x';
+                    SSF_ASSERT(!SSFJsonIsValid(_jsOut));
+                }
+
+                /* Unterminated string */
+                _jsOut[start + n] = 0;
+                SSF_ASSERT(!SSFJsonIsValid(_jsOut));
+            }
+        }
+    }
+
     /* Validate parser on number types */
     memset(path, 0, sizeof(path));
     path[0] = "n";
@@ -1028,6 +1507,11 @@ void SSFJsonUnitTest(void)
         SSF_ASSERT(SSFJsonGetBase64(_jtsComplex[i], (SSFCStrIn_t *)path, binOut, sizeof(binOut), &binOutLen) == true);
         SSF_ASSERT(binOutLen == 94);
         SSF_ASSERT(memcmp(binOut, "1234567890abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ!@#$%^&*()`~-_+={}[]:;'\"<>,./?|\\", binOutLen) == 0);
+        SSF_ASSERT(SSFJsonGetBase64Fmt(_jtsComplex[i], (SSFCStrIn_t *)path, binOut, sizeof(binOut), &binOutLen, SSF_BASE64_FMT_STD) == true);
+        SSF_ASSERT(binOutLen == 94);
+        SSF_ASSERT(SSFJsonGetBase64Fmt(_jtsComplex[i], (SSFCStrIn_t *)path, binOut, sizeof(binOut), &binOutLen, SSF_BASE64_FMT_STD_NOPAD) == false);
+        SSF_ASSERT(SSFJsonGetBase64Fmt(_jtsComplex[i], (SSFCStrIn_t *)path, binOut, sizeof(binOut), &binOutLen, SSF_BASE64_FMT_URL) == true);
+        SSF_ASSERT(SSFJsonGetBase64Fmt(_jtsComplex[i], (SSFCStrIn_t *)path, binOut, sizeof(binOut), &binOutLen, SSF_BASE64_FMT_URL_NOPAD) == false);
         jtype = SSF_JSON_TYPE_MAX;
         SSF_ASSERT(SSFJsonObject(_jtsComplex[i], &index, &start, &end, (SSFCStrIn_t *)path, 0, &jtype) == true);
         SSF_ASSERT(jtype == SSF_JSON_TYPE_STRING);
@@ -1187,6 +1671,637 @@ void SSFJsonUnitTest(void)
         SSF_ASSERT(memcmp(&_jtsComplex[i][start], "-42", (end - start + 1)) == 0);
     }
 
+    /* Batch extraction tests */
+    {
+        SSFJsonGet_t gets[13];
+        char *p0[SSF_JSON_CONFIG_MAX_IN_DEPTH + 1];
+        char *p1[SSF_JSON_CONFIG_MAX_IN_DEPTH + 1];
+        char *p2[SSF_JSON_CONFIG_MAX_IN_DEPTH + 1];
+        char *p3[SSF_JSON_CONFIG_MAX_IN_DEPTH + 1];
+        char *p4[SSF_JSON_CONFIG_MAX_IN_DEPTH + 1];
+        char *p5[SSF_JSON_CONFIG_MAX_IN_DEPTH + 1];
+        char *p6[SSF_JSON_CONFIG_MAX_IN_DEPTH + 1];
+        char *p7[SSF_JSON_CONFIG_MAX_IN_DEPTH + 1];
+        char *p8[SSF_JSON_CONFIG_MAX_IN_DEPTH + 1];
+        char strOut[32];
+        uint8_t hexOut[16];
+        uint8_t hexRevOut[16];
+        uint8_t b64Out[8];
+        long int si1;
+        long int si2;
+        long int si3;
+        unsigned long int ui1;
+        unsigned long int ui2;
+        size_t aidx3 = 3;
+        size_t aidx10 = 10;
+
+        memset(p0, 0, sizeof(p0)); p0[0] = "b1";
+        memset(p1, 0, sizeof(p1)); p1[0] = "s1-";
+        memset(p2, 0, sizeof(p2)); p2[0] = "a2"; p2[1] = (char *)&aidx3;
+        memset(p3, 0, sizeof(p3)); p3[0] = "a2"; p3[1] = (char *)&aidx10; p3[2] = "hex2";
+        memset(p4, 0, sizeof(p4)); p4[0] = "obj2"; p4[1] = "objdeep"; p4[2] = "hex3";
+        memset(p5, 0, sizeof(p5)); p5[0] = "obj2"; p5[1] = "objdeep"; p5[2] = "NUMFAR";
+        memset(p6, 0, sizeof(p6)); p6[0] = "obj2"; p6[1] = "b64_2";
+        memset(p7, 0, sizeof(p7)); p7[0] = "obj2"; p7[1] = "missing";
+        memset(p8, 0, sizeof(p8)); p8[0] = "n1";
+
+        memset(gets, 0, sizeof(gets));
+        gets[0].path = (SSFCStrIn_t *)p0; gets[0].kind = SSF_JSON_GET_TYPE;
+        gets[1].path = (SSFCStrIn_t *)p1; gets[1].kind = SSF_JSON_GET_STRING;
+        gets[1].out = strOut; gets[1].outSize = sizeof(strOut);
+        gets[2].path = (SSFCStrIn_t *)p2; gets[2].kind = SSF_JSON_GET_LONG; gets[2].out = &si1;
+        gets[3].path = (SSFCStrIn_t *)p2; gets[3].kind = SSF_JSON_GET_ULONG; gets[3].out = &ui1;
+        gets[4].path = (SSFCStrIn_t *)p3; gets[4].kind = SSF_JSON_GET_HEX;
+        gets[4].out = hexOut; gets[4].outSize = sizeof(hexOut);
+        gets[5].path = (SSFCStrIn_t *)p4; gets[5].kind = SSF_JSON_GET_HEX_REV;
+        gets[5].out = hexRevOut; gets[5].outSize = sizeof(hexRevOut);
+        gets[6].path = (SSFCStrIn_t *)p5; gets[6].kind = SSF_JSON_GET_LONG; gets[6].out = &si2;
+        gets[7].path = (SSFCStrIn_t *)p6; gets[7].kind = SSF_JSON_GET_BASE64;
+        gets[7].out = b64Out; gets[7].outSize = sizeof(b64Out);
+        gets[8].path = (SSFCStrIn_t *)p7; gets[8].kind = SSF_JSON_GET_TYPE;
+        gets[9].path = (SSFCStrIn_t *)p5; gets[9].kind = SSF_JSON_GET_ULONG; gets[9].out = &ui2;
+        gets[10].path = (SSFCStrIn_t *)p1; gets[10].kind = SSF_JSON_GET_LONG; gets[10].out = &si3;
+        gets[11].path = (SSFCStrIn_t *)p8; gets[11].kind = SSF_JSON_GET_TYPE;
+        gets[12].path = (SSFCStrIn_t *)p1; gets[12].kind = SSF_JSON_GET_TYPE;
+
+        SSF_ASSERT_TEST(SSFJsonGetMany(NULL, gets, JTS_NUM_ITEMS(gets, sizeof(SSFJsonGet_t))));
+        SSF_ASSERT_TEST(SSFJsonGetMany(_jtsComplex[0], NULL, 1));
+        gets[2].out = NULL;
+        SSF_ASSERT_TEST(SSFJsonGetMany(_jtsComplex[0], gets, JTS_NUM_ITEMS(gets, sizeof(SSFJsonGet_t))));
+        gets[2].out = &si1;
+        gets[2].kind = SSF_JSON_GET_MAX;
+        SSF_ASSERT_TEST(SSFJsonGetMany(_jtsComplex[0], gets, JTS_NUM_ITEMS(gets, sizeof(SSFJsonGet_t))));
+        gets[2].kind = SSF_JSON_GET_LONG;
+        SSF_ASSERT(SSFJsonGetMany(_jtsComplex[0], gets, 0));
+
+        for (i = 0; i < JTS_NUM_ITEMS(_jtsComplex, sizeof(char *)); i++)
+        {
+            SSF_ASSERT(SSFJsonGetMany(_jtsComplex[i], gets, JTS_NUM_ITEMS(gets, sizeof(SSFJsonGet_t))) == false);
+            SSF_ASSERT(gets[0].ok && (gets[0].jt == SSF_JSON_TYPE_TRUE));
+            SSF_ASSERT(gets[1].ok && (gets[1].jt == SSF_JSON_TYPE_STRING));
+            SSF_ASSERT((gets[1].outLen == 6) && (strcmp(strOut, "level0") == 0));
+            SSF_ASSERT(gets[2].ok && (gets[2].jt == SSF_JSON_TYPE_NUMBER) && (si1 == 1234567890));
+            SSF_ASSERT(gets[3].ok && (gets[3].jt == SSF_JSON_TYPE_NUMBER) && (ui1 == 1234567890));
+            SSF_ASSERT(gets[4].ok && (gets[4].outLen == 11));
+            SSF_ASSERT(memcmp(hexOut, "\x12\x34\x56\x78\x90\xAB\xCD\xEF\xab\xcd\xef", 11) == 0);
+            SSF_ASSERT(gets[5].ok && (gets[5].outLen == 11));
+            SSF_ASSERT(memcmp(hexRevOut, "\xf6\xe5\xd4\xc3\xb2\xa1\x56\x47\x38\x29\x10", 11) == 0);
+            SSF_ASSERT(gets[6].ok && (si2 == -42));
+            SSF_ASSERT(gets[7].ok && (gets[7].outLen == 3) && (memcmp(b64Out, "abc", 3) == 0));
+            SSF_ASSERT((!gets[8].ok) && (gets[8].jt == SSF_JSON_TYPE_ERROR));
+            SSF_ASSERT((!gets[9].ok) && (gets[9].jt == SSF_JSON_TYPE_NUMBER));
+            SSF_ASSERT((!gets[10].ok) && (gets[10].jt == SSF_JSON_TYPE_STRING));
+            SSF_ASSERT(gets[11].ok && (gets[11].jt == SSF_JSON_TYPE_NUMBER));
+            SSF_ASSERT(gets[12].ok && (gets[12].jt == SSF_JSON_TYPE_STRING));
+
+            /* All requests satisfied */
+            SSF_ASSERT(SSFJsonGetMany(_jtsComplex[i], gets, 8));
+        }
+
+        /* Invalid JSON satisfies no requests */
+        SSF_ASSERT(SSFJsonGetMany("{\"b1\":true,}", gets, 1) == false);
+        SSF_ASSERT((!gets[0].ok) && (gets[0].jt == SSF_JSON_TYPE_ERROR));
+    }
+
+    /* Zero-copy string spans and unescape */
+    {
+        SSFJsonStr_t str;
+        SSFJsonGet_t gets[2];
+        char *sp[SSF_JSON_CONFIG_MAX_IN_DEPTH + 1];
+        char *np[SSF_JSON_CONFIG_MAX_IN_DEPTH + 1];
+        char strOut[16];
+        uint8_t bin[4];
+        size_t strOutLen;
+        const char *js = "{\"plain\":\"route/a\",\"esc\":\"a\\\"b\\\\c\\/d\\n\\r\\t\\b\\f\","
+                         "\"u\":\"\\u0041\\u00e9\\u20AC\\uD83D\\uDE00\",\"n\":1,\"e\":\"\","
+                         "\"hi\":\"\\uD83D\",\"lo\":\"\\uDE00x\",\"hix\":\"\\uD83D\\u0041\","
+                         "\"hin\":\"\\uD83Dabcdef\",\"nul\":\"\\u0000\",\"route\":\"r\\u006Fute\"}";
+        static const char esc[] = "a\"b\\c/d\n\r\t\b\f";
+        static const char u[] = "A\xc3\xa9\xe2\x82\xac\xf0\x9f\x98\x80";
+
+        memset(sp, 0, sizeof(sp));
+        SSF_ASSERT_TEST(SSFJsonGetStringSpan(NULL, (SSFCStrIn_t *)sp, &str));
+        SSF_ASSERT_TEST(SSFJsonGetStringSpan(js, NULL, &str));
+        SSF_ASSERT_TEST(SSFJsonGetStringSpan(js, (SSFCStrIn_t *)sp, NULL));
+        SSF_ASSERT_TEST(SSFJsonStrIs(NULL, ""));
+        SSF_ASSERT_TEST(SSFJsonStrUnescape(NULL, strOut, sizeof(strOut), NULL));
+
+        /* Spans point into js without copying */
+        sp[0] = "plain";
+        SSF_ASSERT(SSFJsonGetStringSpan(js, (SSFCStrIn_t *)sp, &str));
+        SSF_ASSERT((str.ptr == strstr(js, "route/a")) && (str.len == 7) && !str.hasEsc);
+        SSF_ASSERT(SSFJsonStrIs(&str, "route/a"));
+        SSF_ASSERT(!SSFJsonStrIs(&str, "route/"));
+        SSF_ASSERT(!SSFJsonStrIs(&str, "route/ab"));
+        SSF_ASSERT(!SSFJsonStrIs(&str, ""));
+        SSF_ASSERT_TEST(SSFJsonStrIs(&str, NULL));
+        SSF_ASSERT(SSFJsonStrUnescape(&str, strOut, sizeof(strOut), &strOutLen));
+        SSF_ASSERT((strOutLen == 7) && (strcmp(strOut, "route/a") == 0));
+        SSF_ASSERT(SSFJsonStrUnescape(&str, strOut, 8, &strOutLen) && (strOutLen == 7));
+        SSF_ASSERT(!SSFJsonStrUnescape(&str, strOut, 7, &strOutLen));
+        SSF_ASSERT(!SSFJsonStrUnescape(&str, strOut, 0, NULL));
+        sp[0] = "e";
+        SSF_ASSERT(SSFJsonGetStringSpan(js, (SSFCStrIn_t *)sp, &str));
+        SSF_ASSERT((str.len == 0) && !str.hasEsc && SSFJsonStrIs(&str, ""));
+        SSF_ASSERT(SSFJsonStrUnescape(&str, strOut, 1, &strOutLen) && (strOutLen == 0));
+        SSF_ASSERT(SSFJsonGetHex(js, (SSFCStrIn_t *)sp, bin, sizeof(bin), &strOutLen, false));
+        SSF_ASSERT(strOutLen == 0);
+        SSF_ASSERT(SSFJsonGetHex(js, (SSFCStrIn_t *)sp, bin, sizeof(bin), &strOutLen, true));
+        SSF_ASSERT(strOutLen == 0);
+        SSF_ASSERT(SSFJsonGetBase64(js, (SSFCStrIn_t *)sp, bin, sizeof(bin), &strOutLen));
+        SSF_ASSERT(strOutLen == 0);
+        sp[0] = "n";
+        SSF_ASSERT(!SSFJsonGetStringSpan(js, (SSFCStrIn_t *)sp, &str));
+        sp[0] = "x";
+        SSF_ASSERT(!SSFJsonGetStringSpan(js, (SSFCStrIn_t *)sp, &str));
+
+        /* Every single char escape unescapes to its char */
+        sp[0] = "esc";
+        SSF_ASSERT(SSFJsonGetStringSpan(js, (SSFCStrIn_t *)sp, &str) && str.hasEsc);
+        SSF_ASSERT(str.len == 20);
+        SSF_ASSERT(SSFJsonStrIs(&str, esc));
+        SSF_ASSERT(!SSFJsonStrIs(&str, "a\"b\\c/d\n\r\t\b"));
+        SSF_ASSERT(SSFJsonStrUnescape(&str, strOut, sizeof(strOut), &strOutLen));
+        SSF_ASSERT((strOutLen == sizeof(esc) - 1) && (strcmp(strOut, esc) == 0));
+        SSF_ASSERT(SSFJsonGetString(js, (SSFCStrIn_t *)sp, strOut, sizeof(strOut), &strOutLen));
+        SSF_ASSERT((strOutLen == sizeof(esc) - 1) && (strcmp(strOut, esc) == 0));
+        SSF_ASSERT(!SSFJsonGetString(js, (SSFCStrIn_t *)sp, strOut, sizeof(esc) - 1, &strOutLen));
+
+        /* \u escapes unescape to UTF-8, surrogate pairs to a single 4 byte sequence */
+        sp[0] = "u";
+        SSF_ASSERT(SSFJsonGetString(js, (SSFCStrIn_t *)sp, strOut, sizeof(strOut), &strOutLen));
+        SSF_ASSERT((strOutLen == sizeof(u) - 1) && (strcmp(strOut, u) == 0));
+        SSF_ASSERT(!SSFJsonGetString(js, (SSFCStrIn_t *)sp, strOut, sizeof(u) - 1, &strOutLen));
+        SSF_ASSERT(strOutLen == 6);
+        SSF_ASSERT(SSFJsonGetStringSpan(js, (SSFCStrIn_t *)sp, &str) && SSFJsonStrIs(&str, u));
+        SSF_ASSERT(!SSFJsonStrIs(&str, "A\xc3\xa9\xe2\x82\xac\xf0\x9f\x98"));
+        sp[0] = "route";
+        SSF_ASSERT(SSFJsonGetStringSpan(js, (SSFCStrIn_t *)sp, &str) && str.hasEsc);
+        SSF_ASSERT(SSFJsonStrIs(&str, "route") && !SSFJsonStrIs(&str, "r\\u006Fute"));
+        sp[0] = "nul";
+        SSF_ASSERT(SSFJsonGetStringSpan(js, (SSFCStrIn_t *)sp, &str));
+        SSF_ASSERT(!SSFJsonStrIs(&str, ""));
+        SSF_ASSERT(SSFJsonStrUnescape(&str, strOut, sizeof(strOut), &strOutLen));
+        SSF_ASSERT((strOutLen == 1) && (strOut[0] == 0));
+
+        /* Unpaired surrogates do not unescape */
+        sp[0] = "hi";
+        SSF_ASSERT(!SSFJsonGetString(js, (SSFCStrIn_t *)sp, strOut, sizeof(strOut), NULL));
+        SSF_ASSERT(SSFJsonGetStringSpan(js, (SSFCStrIn_t *)sp, &str) && !SSFJsonStrIs(&str, ""));
+        sp[0] = "lo";
+        SSF_ASSERT(!SSFJsonGetString(js, (SSFCStrIn_t *)sp, strOut, sizeof(strOut), NULL));
+        sp[0] = "hix";
+        SSF_ASSERT(!SSFJsonGetString(js, (SSFCStrIn_t *)sp, strOut, sizeof(strOut), NULL));
+        sp[0] = "hin";
+        SSF_ASSERT(!SSFJsonGetString(js, (SSFCStrIn_t *)sp, strOut, sizeof(strOut), NULL));
+
+        /* Spans in a batch */
+        memset(gets, 0, sizeof(gets));
+        sp[0] = "plain";
+        gets[0].path = (SSFCStrIn_t *)sp;
+        gets[0].kind = SSF_JSON_GET_STRING_SPAN;
+        gets[0].out = &str;
+        gets[1] = gets[0];
+        memset(np, 0, sizeof(np));
+        np[0] = "n";
+        gets[1].path = (SSFCStrIn_t *)np;
+        SSF_ASSERT(SSFJsonGetMany(js, gets, 2) == false);
+        SSF_ASSERT(gets[0].ok && !gets[1].ok && SSFJsonStrIs(&str, "route/a"));
+    }
+
+#if SSF_JSON_CONFIG_ENABLE_INDEX == 1
+    /* Index tests */
+    {
+        SSFJsonTok_t toks[64];
+        SSFJsonIndex_t idx;
+        size_t tok;
+        size_t aidx1;
+        size_t aidx2;
+        SSFJsonType_t jtype;
+        static const char *keys0[] = { "b1", "b2", "nil1", "n1", "s1-", "a1", "a2", "obj1", "obj2",
+                                       "s1", "b", "" };
+        static const char *keys1[] = { "b64_1", "b64_2", "b64_3", "b3", "b4", "nil2", "array",
+                                       "objdeep", "hex3", "b64" };
+        static const char *keys2[] = { "hex3", "NUMFAR", "hex1", "hex2", "NUMFA" };
+        uint32_t j;
+
+        SSF_ASSERT_TEST(SSFJsonIndex(NULL, _jtsComplex[0], toks, JTS_NUM_ITEMS(toks, sizeof(SSFJsonTok_t))));
+        SSF_ASSERT_TEST(SSFJsonIndex(&idx, NULL, toks, JTS_NUM_ITEMS(toks, sizeof(SSFJsonTok_t))));
+        SSF_ASSERT_TEST(SSFJsonIndex(&idx, _jtsComplex[0], NULL, JTS_NUM_ITEMS(toks, sizeof(SSFJsonTok_t))));
+        SSF_ASSERT_TEST(SSFJsonIndex(&idx, _jtsComplex[0], toks, 0));
+
+        /* Validate index agrees with parser on valid and invalid JSON strings */
+        for (i = 0; i < JTS_NUM_ITEMS(_jtsIsValid, sizeof(char *)); i++)
+        {
+            SSF_ASSERT(SSFJsonIndex(&idx, _jtsIsValid[i], toks, JTS_NUM_ITEMS(toks, sizeof(SSFJsonTok_t))));
+        }
+        for (i = 0; i < JTS_NUM_ITEMS(_jtsIsInvalid, sizeof(char *)); i++)
+        {
+            SSF_ASSERT(!SSFJsonIndex(&idx, _jtsIsInvalid[i], toks, JTS_NUM_ITEMS(toks, sizeof(SSFJsonTok_t))));
+        }
+
+        /* Validate index fails when token array is too small */
+        SSF_ASSERT(!SSFJsonIndex(&idx, _jtsComplex[0], toks, 8));
+        SSF_ASSERT(SSFJsonIndex(&idx, "{}", toks, 1));
+        SSF_ASSERT(idx.toksLen == 1);
+        SSF_ASSERT(!SSFJsonIndex(&idx, "{\"a\":1}", toks, 1));
+
+        for (i = 0; i < JTS_NUM_ITEMS(_jtsComplex, sizeof(char *)); i++)
+        {
+            SSF_ASSERT(SSFJsonIndex(&idx, _jtsComplex[i], toks, JTS_NUM_ITEMS(toks, sizeof(SSFJsonTok_t))));
+            SSF_ASSERT(idx.toks[0].type == SSF_JSON_TYPE_OBJECT);
+            SSF_ASSERT(idx.toks[0].next == idx.toksLen);
+
+            /* Root path */
+            memset(path, 0, sizeof(path));
+            SSF_ASSERT(SSFJsonIndexFind(&idx, (SSFCStrIn_t *)path, &tok));
+            SSF_ASSERT(tok == 0);
+            SSFJsonUnitTestIndexPath(_jtsComplex[i], &idx, (SSFCStrIn_t *)path);
+
+            /* Object member paths */
+            for (j = 0; j < JTS_NUM_ITEMS(keys0, sizeof(char *)); j++)
+            {
+                memset(path, 0, sizeof(path));
+                path[0] = (char *)keys0[j];
+                SSFJsonUnitTestIndexPath(_jtsComplex[i], &idx, (SSFCStrIn_t *)path);
+            }
+            memset(path, 0, sizeof(path));
+            path[0] = "obj2";
+            for (j = 0; j < JTS_NUM_ITEMS(keys1, sizeof(char *)); j++)
+            {
+                path[1] = (char *)keys1[j];
+                SSFJsonUnitTestIndexPath(_jtsComplex[i], &idx, (SSFCStrIn_t *)path);
+            }
+            path[1] = "objdeep";
+            for (j = 0; j < JTS_NUM_ITEMS(keys2, sizeof(char *)); j++)
+            {
+                path[2] = (char *)keys2[j];
+                SSFJsonUnitTestIndexPath(_jtsComplex[i], &idx, (SSFCStrIn_t *)path);
+            }
+
+            /* Array element paths */
+            memset(path, 0, sizeof(path));
+            path[0] = "a2";
+            path[1] = (char *)&aidx1;
+            for (aidx1 = 0; aidx1 < 13; aidx1++)
+            {
+                path[2] = NULL;
+                SSFJsonUnitTestIndexPath(_jtsComplex[i], &idx, (SSFCStrIn_t *)path);
+                jtype = SSFJsonIndexGetType(&idx, (SSFCStrIn_t *)path);
+                if (jtype == SSF_JSON_TYPE_ARRAY)
+                {
+                    path[2] = (char *)&aidx2;
+                    for (aidx2 = 0; SSFJsonIndexGetType(&idx, (SSFCStrIn_t *)path) !=
+                                    SSF_JSON_TYPE_ERROR; aidx2++)
+                    {
+                        SSFJsonUnitTestIndexPath(_jtsComplex[i], &idx, (SSFCStrIn_t *)path);
+                    }
+                    SSF_ASSERT(aidx2 == ((aidx1 == 9) ? 3 : 0));
+                }
+                else if (jtype == SSF_JSON_TYPE_OBJECT)
+                {
+                    for (j = 0; j < JTS_NUM_ITEMS(keys2, sizeof(char *)); j++)
+                    {
+                        path[2] = (char *)keys2[j];
+                        SSFJsonUnitTestIndexPath(_jtsComplex[i], &idx, (SSFCStrIn_t *)path);
+                    }
+                }
+            }
+            memset(path, 0, sizeof(path));
+            path[0] = "a1";
+            path[1] = (char *)&aidx1;
+            aidx1 = 0;
+            SSF_ASSERT(SSFJsonIndexGetType(&idx, (SSFCStrIn_t *)path) == SSF_JSON_TYPE_ERROR);
+
+            /* Spot check decoded values */
+            memset(path, 0, sizeof(path));
+            path[0] = "obj2";
+            path[1] = "objdeep";
+            path[2] = "NUMFAR";
+            SSF_ASSERT(SSFJsonIndexFind(&idx, (SSFCStrIn_t *)path, &tok));
+            SSF_ASSERT(memcmp(&_jtsComplex[i][idx.toks[tok].start], "-42",
+                              idx.toks[tok].end - idx.toks[tok].start + 1) == 0);
+            SSF_ASSERT(idx.toks[tok].keyLen == 6);
+            SSF_ASSERT(memcmp(&_jtsComplex[i][idx.toks[tok].key], "NUMFAR", 6) == 0);
+        }
+    }
+#endif /* SSF_JSON_CONFIG_ENABLE_INDEX */
+
+#if SSF_JSON_CONFIG_ENABLE_ITER == 1
+    /* Iterator tests */
+    {
+        SSFJsonIter_t it;
+        SSFJsonIter_t child;
+        SSFJsonIter_t child2;
+        SSFJsonStr_t span;
+        SSFCStrIn_t ipath[SSF_JSON_CONFIG_MAX_IN_DEPTH + 1];
+        const char *js = " { \"a\" : 1 , \"b\":[ 10, -20 ,\"s\",{\"c\":true},[],null,false, 1.5] ,"
+                         "\"e\":{}, \"h\":\"A1B2\", \"b64\":\"AQI=\",\"bb\" : \"x\"} ";
+        char str[8];
+        uint8_t bin[4];
+        size_t binLen;
+        long si;
+        unsigned long ui;
+        size_t aidx;
+        size_t n;
+
+        memset(ipath, 0, sizeof(ipath));
+        SSF_ASSERT_TEST(SSFJsonIterBegin(NULL, js, ipath));
+        SSF_ASSERT_TEST(SSFJsonIterBegin(&it, NULL, ipath));
+        SSF_ASSERT_TEST(SSFJsonIterBegin(&it, js, NULL));
+
+        /* Root object members in order with keys */
+        SSF_ASSERT(SSFJsonIterBegin(&it, js, ipath));
+        SSF_ASSERT(it.jt == SSF_JSON_TYPE_ERROR);
+        SSF_ASSERT(SSFJsonIterNext(&it));
+        SSF_ASSERT((it.jt == SSF_JSON_TYPE_NUMBER) && SSFJsonIterKeyIs(&it, "a"));
+        SSF_ASSERT(!SSFJsonIterKeyIs(&it, "") && !SSFJsonIterKeyIs(&it, "aa"));
+        SSF_ASSERT(SSFJsonIterGetLong(&it, &si) && (si == 1));
+        SSF_ASSERT(SSFJsonIterGetULong(&it, &ui) && (ui == 1));
+        SSF_ASSERT(!SSFJsonIterGetString(&it, str, sizeof(str), NULL));
+        SSF_ASSERT(SSFJsonIterNext(&it));
+        SSF_ASSERT((it.jt == SSF_JSON_TYPE_ARRAY) && SSFJsonIterKeyIs(&it, "b"));
+        SSF_ASSERT((js[it.start] == '[') && (js[it.end] == ']'));
+        SSF_ASSERT(!SSFJsonIterGetLong(&it, &si));
+
+        /* Elements of the array value */
+        SSF_ASSERT(SSFJsonIterChild(&it, &child));
+        SSF_ASSERT(SSFJsonIterNext(&child) && (child.jt == SSF_JSON_TYPE_NUMBER));
+        SSF_ASSERT((child.key == NULL) && (child.keyLen == 0) && !SSFJsonIterKeyIs(&child, "b"));
+        SSF_ASSERT(SSFJsonIterGetLong(&child, &si) && (si == 10));
+        SSF_ASSERT(!SSFJsonIterChild(&child, &child2));
+        SSF_ASSERT(SSFJsonIterNext(&child) && SSFJsonIterGetLong(&child, &si) && (si == -20));
+        SSF_ASSERT(!SSFJsonIterGetULong(&child, &ui));
+        SSF_ASSERT(SSFJsonIterNext(&child) && (child.jt == SSF_JSON_TYPE_STRING));
+        SSF_ASSERT(SSFJsonIterGetString(&child, str, sizeof(str), &n) && (n == 1));
+        SSF_ASSERT(SSFJsonIterGetStringSpan(&child, &span) && SSFJsonStrIs(&span, "s"));
+        SSF_ASSERT(!SSFJsonIterGetStringSpan(&it, &span));
+        SSF_ASSERT(strcmp(str, "s") == 0);
+        SSF_ASSERT(SSFJsonIterNext(&child) && (child.jt == SSF_JSON_TYPE_OBJECT));
+        SSF_ASSERT(SSFJsonIterChild(&child, &child2));
+        SSF_ASSERT(SSFJsonIterNext(&child2) && (child2.jt == SSF_JSON_TYPE_TRUE));
+        SSF_ASSERT(SSFJsonIterKeyIs(&child2, "c"));
+        SSF_ASSERT(!SSFJsonIterNext(&child2) && (child2.jt == SSF_JSON_TYPE_ERROR));
+        SSF_ASSERT(!SSFJsonIterNext(&child2));
+        SSF_ASSERT(SSFJsonIterNext(&child) && (child.jt == SSF_JSON_TYPE_ARRAY));
+        SSF_ASSERT(SSFJsonIterChild(&child, &child2));
+        SSF_ASSERT(!SSFJsonIterNext(&child2));
+        SSF_ASSERT(SSFJsonIterNext(&child) && (child.jt == SSF_JSON_TYPE_NULL));
+        SSF_ASSERT(SSFJsonIterNext(&child) && (child.jt == SSF_JSON_TYPE_FALSE));
+        SSF_ASSERT(SSFJsonIterNext(&child) && (child.jt == SSF_JSON_TYPE_NUMBER));
+#if SSF_JSON_CONFIG_ENABLE_FLOAT_PARSE == 1
+        {
+            double d;
+            SSF_ASSERT(SSFJsonIterGetDouble(&child, &d) && (d == 1.5));
+        }
+#else
+        SSF_ASSERT(!SSFJsonIterGetLong(&child, &si));
+#endif /* SSF_JSON_CONFIG_ENABLE_FLOAT_PARSE */
+        SSF_ASSERT(!SSFJsonIterNext(&child));
+
+        /* Remaining root members */
+        SSF_ASSERT(SSFJsonIterNext(&it) && (it.jt == SSF_JSON_TYPE_OBJECT));
+        SSF_ASSERT(SSFJsonIterKeyIs(&it, "e"));
+        SSF_ASSERT(SSFJsonIterChild(&it, &child) && !SSFJsonIterNext(&child));
+        SSF_ASSERT(SSFJsonIterNext(&it) && SSFJsonIterKeyIs(&it, "h"));
+        SSF_ASSERT(SSFJsonIterGetHex(&it, bin, sizeof(bin), &binLen, false) && (binLen == 2));
+        SSF_ASSERT((bin[0] == 0xa1) && (bin[1] == 0xb2));
+        SSF_ASSERT(SSFJsonIterNext(&it) && SSFJsonIterKeyIs(&it, "b64"));
+        SSF_ASSERT(SSFJsonIterGetBase64(&it, bin, sizeof(bin), &binLen) && (binLen == 2));
+        SSF_ASSERT((bin[0] == 0x01) && (bin[1] == 0x02));
+        SSF_ASSERT(SSFJsonIterNext(&it) && SSFJsonIterKeyIs(&it, "bb"));
+        SSF_ASSERT(!SSFJsonIterKeyIs(&it, "b"));
+        SSF_ASSERT(!SSFJsonIterNext(&it));
+        SSF_ASSERT(!SSFJsonIterNext(&it));
+
+        /* Begin on a path */
+        ipath[0] = "b";
+        SSF_ASSERT(SSFJsonIterBegin(&it, js, ipath));
+        for (n = 0; SSFJsonIterNext(&it); n++);
+        SSF_ASSERT(n == 8);
+        aidx = 3;
+        ipath[1] = (SSFCStrIn_t)&aidx;
+        SSF_ASSERT(SSFJsonIterBegin(&it, js, ipath));
+        SSF_ASSERT(SSFJsonIterNext(&it) && SSFJsonIterKeyIs(&it, "c"));
+        ipath[1] = NULL;
+        ipath[0] = "a";
+        SSF_ASSERT(SSFJsonIterBegin(&it, js, ipath) == false);
+        ipath[0] = "x";
+        SSF_ASSERT(SSFJsonIterBegin(&it, js, ipath) == false);
+        ipath[0] = NULL;
+        SSF_ASSERT(SSFJsonIterBegin(&it, "{\"a\":1,}", ipath) == false);
+        SSF_ASSERT(SSFJsonIterBegin(&it, "{}", ipath) && !SSFJsonIterNext(&it));
+
+        /* Walking a large array matches indexed lookups */
+        {
+            size_t end;
+            bool comma = false;
+
+            _jsIterIn[0] = '{';
+            SSF_ASSERT(SSFJsonPrintLabel(_jsIterIn, sizeof(_jsIterIn), 1, &end, "v", NULL));
+            _jsIterIn[end++] = '[';
+            for (n = 0; n < 300; n++)
+            {
+                SSF_ASSERT(SSFJsonPrintInt(_jsIterIn, sizeof(_jsIterIn), end, &end,
+                                           (long)(n * 7) - 500, &comma));
+            }
+            _jsIterIn[end++] = ']';
+            _jsIterIn[end++] = '}';
+            _jsIterIn[end] = 0;
+            ipath[0] = "v";
+            SSF_ASSERT(SSFJsonIterBegin(&it, _jsIterIn, ipath));
+            for (n = 0; SSFJsonIterNext(&it); n++)
+            {
+                SSF_ASSERT(SSFJsonIterGetLong(&it, &si) && (si == ((long)(n * 7) - 500)));
+                if ((n % 50) == 0)
+                {
+                    ipath[1] = (SSFCStrIn_t)&n;
+                    SSF_ASSERT(SSFJsonGetLong(_jsIterIn, ipath, &si));
+                    SSF_ASSERT(si == ((long)(n * 7) - 500));
+                    ipath[1] = NULL;
+                }
+            }
+            SSF_ASSERT(n == 300);
+        }
+    }
+#endif /* SSF_JSON_CONFIG_ENABLE_ITER */
+
+#if SSF_JSON_CONFIG_ENABLE_STREAM == 1
+    /* Streaming parser tests */
+    {
+        SSFJsonStream_t jss;
+        SSFBFifo_t fifo;
+        uint8_t fifoBuf[SSF_BFIFO_255 + 1];
+        char trace[sizeof(_jsStreamTrace)];
+        size_t chunk;
+        size_t len;
+        size_t j;
+
+        SSF_ASSERT_TEST(SSFJsonStreamInit(NULL, SSFJsonUnitTestStreamFn, NULL));
+        SSF_ASSERT_TEST(SSFJsonStreamInit(&jss, NULL, NULL));
+        SSFJsonStreamInit(&jss, SSFJsonUnitTestStreamFn, &_jsStreamTraceLen);
+        SSF_ASSERT_TEST(SSFJsonStreamFeed(NULL, "{}", 2));
+        SSF_ASSERT_TEST(SSFJsonStreamFeed(&jss, NULL, 2));
+        SSF_ASSERT_TEST(SSFJsonStreamFeedBFifo(&jss, NULL));
+        SSF_ASSERT_TEST(SSFJsonStreamIsDone(NULL));
+        SSFJsonStreamDeInit(&jss);
+        SSF_ASSERT_TEST(SSFJsonStreamIsDone(&jss));
+        SSF_ASSERT_TEST(SSFJsonStreamDeInit(NULL));
+
+        /* Validate streaming parser on valid JSON strings, whole and one char at a time */
+        _jsStreamAbortAt = 0;
+        for (i = 0; i < JTS_NUM_ITEMS(_jtsIsValid, sizeof(char *)); i++)
+        {
+            _jsStreamTraceLen = 0;
+            SSFJsonStreamInit(&jss, SSFJsonUnitTestStreamFn, &_jsStreamTraceLen);
+            SSF_ASSERT(SSFJsonStreamFeed(&jss, _jtsIsValid[i], strlen(_jtsIsValid[i])));
+            SSF_ASSERT(SSFJsonStreamIsDone(&jss));
+            memcpy(trace, _jsStreamTrace, _jsStreamTraceLen);
+            len = _jsStreamTraceLen;
+
+            _jsStreamTraceLen = 0;
+            SSFJsonStreamInit(&jss, SSFJsonUnitTestStreamFn, &_jsStreamTraceLen);
+            for (j = 0; j < strlen(_jtsIsValid[i]); j++)
+            {
+                SSF_ASSERT(SSFJsonStreamFeed(&jss, &_jtsIsValid[i][j], 1));
+            }
+            SSF_ASSERT(SSFJsonStreamIsDone(&jss));
+            SSF_ASSERT((len == _jsStreamTraceLen) && (memcmp(trace, _jsStreamTrace, len) == 0));
+            SSFJsonStreamDeInit(&jss);
+        }
+
+        /* Validate streaming parser on invalid JSON strings */
+        for (i = 0; i < JTS_NUM_ITEMS(_jtsIsInvalid, sizeof(char *)); i++)
+        {
+            _jsStreamTraceLen = 0;
+            SSFJsonStreamInit(&jss, SSFJsonUnitTestStreamFn, &_jsStreamTraceLen);
+            SSFJsonStreamFeed(&jss, _jtsIsInvalid[i], strlen(_jtsIsInvalid[i]));
+            SSF_ASSERT(SSFJsonStreamIsDone(&jss) == false);
+            SSFJsonStreamDeInit(&jss);
+        }
+
+        /* Validate events */
+        _jsStreamTraceLen = 0;
+        SSFJsonStreamInit(&jss, SSFJsonUnitTestStreamFn, &_jsStreamTraceLen);
+        SSF_ASSERT(SSFJsonStreamFeed(&jss, "{\"a\":[1,\"s\\\"\",{\"b\":null}],", 26));
+        SSF_ASSERT(SSFJsonStreamIsDone(&jss) == false);
+        SSF_ASSERT(SSFJsonStreamFeed(&jss, " \"c\" : -1.5e3 } \r\n", 18));
+        SSF_ASSERT(SSFJsonStreamIsDone(&jss));
+        _jsStreamTrace[_jsStreamTraceLen] = 0;
+        SSF_ASSERT(strcmp(_jsStreamTrace, "O30#0;O41a:0;V22#0=1;V12#1=s\\\";O32#2;V73b:0=null;"
+                                          "C32#2;C41#0;V21c:1=-1.5e3;C30#0;") == 0);
+        SSF_ASSERT(SSFJsonStreamFeed(&jss, " x", 2) == false);
+        SSF_ASSERT(SSFJsonStreamIsDone(&jss) == false);
+        SSF_ASSERT(SSFJsonStreamFeed(&jss, " ", 1) == false);
+        SSFJsonStreamDeInit(&jss);
+
+        /* Validate number delimiting and literal checking across chunks */
+        _jsStreamTraceLen = 0;
+        SSFJsonStreamInit(&jss, SSFJsonUnitTestStreamFn, &_jsStreamTraceLen);
+        SSF_ASSERT(SSFJsonStreamFeed(&jss, "{\"n\":12", 7));
+        SSF_ASSERT(_jsStreamTraceLen == 6);
+        SSF_ASSERT(SSFJsonStreamFeed(&jss, "3}", 2));
+        SSF_ASSERT(SSFJsonStreamIsDone(&jss));
+        SSFJsonStreamInit(&jss, SSFJsonUnitTestStreamFn, &_jsStreamTraceLen);
+        SSF_ASSERT(SSFJsonStreamFeed(&jss, "{\"n\":tr", 7));
+        SSF_ASSERT(SSFJsonStreamFeed(&jss, "ue", 2));
+        SSF_ASSERT(SSFJsonStreamFeed(&jss, "e}", 2) == false);
+        SSFJsonStreamInit(&jss, SSFJsonUnitTestStreamFn, &_jsStreamTraceLen);
+        SSF_ASSERT(SSFJsonStreamFeed(&jss, "{\"n\":1.}", 8) == false);
+        SSFJsonStreamInit(&jss, SSFJsonUnitTestStreamFn, &_jsStreamTraceLen);
+        SSF_ASSERT(SSFJsonStreamFeed(&jss, "{\"n\":\"\\u12G4\"}", 14) == false);
+        SSFJsonStreamInit(&jss, SSFJsonUnitTestStreamFn, &_jsStreamTraceLen);
+        SSF_ASSERT(SSFJsonStreamFeed(&jss, "{\"n\":\"\\u12aF\"}", 14));
+        SSF_ASSERT(SSFJsonStreamIsDone(&jss));
+
+        /* Validate token length limits */
+        memset(_jsOut, 'a', sizeof(_jsOut));
+        SSFJsonStreamInit(&jss, SSFJsonUnitTestStreamFn, &_jsStreamTraceLen);
+        SSF_ASSERT(SSFJsonStreamFeed(&jss, "{\"", 2));
+        SSF_ASSERT(SSFJsonStreamFeed(&jss, _jsOut, SSF_JSON_CONFIG_STREAM_MAX_KEY_LEN));
+        SSF_ASSERT(SSFJsonStreamFeed(&jss, "\":\"", 3));
+        SSF_ASSERT(SSFJsonStreamFeed(&jss, _jsOut, SSF_JSON_CONFIG_STREAM_MAX_VAL_LEN));
+        SSF_ASSERT(SSFJsonStreamFeed(&jss, _jsOut, 1));
+        SSF_ASSERT(SSFJsonStreamFeed(&jss, "\"}", 2));
+        SSF_ASSERT(SSFJsonStreamIsDone(&jss));
+        SSFJsonStreamInit(&jss, SSFJsonUnitTestStreamFn, &_jsStreamTraceLen);
+        SSF_ASSERT(SSFJsonStreamFeed(&jss, "{\"", 2));
+        SSF_ASSERT(SSFJsonStreamFeed(&jss, _jsOut, SSF_JSON_CONFIG_STREAM_MAX_KEY_LEN + 1) == false);
+        memset(_jsOut, '1', SSF_JSON_CONFIG_STREAM_MAX_VAL_LEN + 1);
+        SSFJsonStreamInit(&jss, SSFJsonUnitTestStreamFn, &_jsStreamTraceLen);
+        SSF_ASSERT(SSFJsonStreamFeed(&jss, "{\"n\":", 5));
+        SSF_ASSERT(SSFJsonStreamFeed(&jss, _jsOut, SSF_JSON_CONFIG_STREAM_MAX_VAL_LEN));
+        SSF_ASSERT(SSFJsonStreamFeed(&jss, _jsOut, 1) == false);
+
+        /* Validate long strings are delivered in parts that keep escape sequences whole */
+        memset(_jsOut, 'a', sizeof(_jsOut));
+        _jsStreamTraceLen = 0;
+        SSFJsonStreamInit(&jss, SSFJsonUnitTestStreamFn, &_jsStreamTraceLen);
+        SSF_ASSERT(SSFJsonStreamFeed(&jss, "{\"k\":\"", 6));
+        SSF_ASSERT(SSFJsonStreamFeed(&jss, _jsOut, SSF_JSON_CONFIG_STREAM_MAX_VAL_LEN - 3));
+        SSF_ASSERT(SSFJsonStreamFeed(&jss, "\\u00e9", 6));
+        SSF_ASSERT(SSFJsonStreamFeed(&jss, _jsOut, SSF_JSON_CONFIG_STREAM_MAX_VAL_LEN));
+        SSF_ASSERT(SSFJsonStreamFeed(&jss, "\"}", 2));
+        SSF_ASSERT(SSFJsonStreamIsDone(&jss));
+        _jsStreamTrace[_jsStreamTraceLen] = 0;
+        len = (size_t)snprintf(trace, sizeof(trace), "O30#0;P11k:0=%.*s;P11k:0=\\u00e9%.*s;"
+                               "V11k:0=aaaaaa;C30#0;", (int)SSF_JSON_CONFIG_STREAM_MAX_VAL_LEN - 3,
+                               _jsOut, (int)SSF_JSON_CONFIG_STREAM_MAX_VAL_LEN - 6, _jsOut);
+        SSF_ASSERT((len == _jsStreamTraceLen) && (strcmp(trace, _jsStreamTrace) == 0));
+        _jsStreamAbortAt = 2;
+        SSFJsonStreamInit(&jss, SSFJsonUnitTestStreamFn, &_jsStreamTraceLen);
+        SSF_ASSERT(SSFJsonStreamFeed(&jss, "{\"k\":\"", 6));
+        SSF_ASSERT(SSFJsonStreamFeed(&jss, _jsOut, SSF_JSON_CONFIG_STREAM_MAX_VAL_LEN + 1) == false);
+        SSF_ASSERT(_jsStreamAbortAt == 0);
+
+        /* Validate depth limit */
+        SSFJsonStreamInit(&jss, SSFJsonUnitTestStreamFn, &_jsStreamTraceLen);
+        for (j = 0; j < SSF_JSON_CONFIG_MAX_IN_DEPTH; j++)
+        {
+            SSF_ASSERT(SSFJsonStreamFeed(&jss, "{\"a\":", 5));
+        }
+        SSF_ASSERT(SSFJsonStreamFeed(&jss, "[", 1) == false);
+
+        /* Validate event function can abort parsing */
+        _jsStreamTraceLen = 0;
+        _jsStreamAbortAt = 3;
+        SSFJsonStreamInit(&jss, SSFJsonUnitTestStreamFn, &_jsStreamTraceLen);
+        SSF_ASSERT(SSFJsonStreamFeed(&jss, "{\"a\":1,\"b\":2}", 13) == false);
+        SSF_ASSERT(SSFJsonStreamIsDone(&jss) == false);
+        SSF_ASSERT(_jsStreamAbortAt == 0);
+        SSFJsonStreamDeInit(&jss);
+
+        /* Validate streaming parser fed in chunks through a byte fifo */
+        memset(&fifo, 0, sizeof(fifo));
+        SSFBFifoInit(&fifo, SSF_BFIFO_255, fifoBuf, sizeof(fifoBuf));
+        for (i = 0; i < JTS_NUM_ITEMS(_jtsComplex, sizeof(char *)); i++)
+        {
+            _jsStreamTraceLen = 0;
+            SSFJsonStreamInit(&jss, SSFJsonUnitTestStreamFn, &_jsStreamTraceLen);
+            SSF_ASSERT(SSFJsonStreamFeed(&jss, _jtsComplex[i], strlen(_jtsComplex[i])));
+            SSF_ASSERT(SSFJsonStreamIsDone(&jss));
+            memcpy(trace, _jsStreamTrace, _jsStreamTraceLen);
+            len = _jsStreamTraceLen;
+
+            for (chunk = 1; chunk < 32; chunk++)
+            {
+                _jsStreamTraceLen = 0;
+                SSFJsonStreamInit(&jss, SSFJsonUnitTestStreamFn, &_jsStreamTraceLen);
+                for (j = 0; j < strlen(_jtsComplex[i]); j += chunk)
+                {
+                    SSFBFifoPutBytes(&fifo, (const uint8_t *)&_jtsComplex[i][j],
+                                     (uint32_t)SSF_MIN(chunk, strlen(_jtsComplex[i]) - j));
+                    SSF_ASSERT(SSFJsonStreamFeedBFifo(&jss, &fifo));
+                    SSF_ASSERT(SSFBFifoIsEmpty(&fifo));
+                }
+                SSF_ASSERT(SSFJsonStreamIsDone(&jss));
+                SSF_ASSERT((len == _jsStreamTraceLen) && (memcmp(trace, _jsStreamTrace, len) == 0));
+                SSFJsonStreamDeInit(&jss);
+            }
+        }
+    }
+#endif /* SSF_JSON_CONFIG_ENABLE_STREAM */
+
     /* Generator tests */
     i = 0x12345678;
     SSF_ASSERT(SSFJsonPrintObject(_jsOut, sizeof(_jsOut), 0, &end, p3fn, &i, false) == true);
@@ -1203,6 +2318,257 @@ void SSFJsonUnitTest(void)
     SSF_ASSERT(SSFJsonIsValid(_jsOut));
     SSF_ASSERT(i == 0xabcdef90);
 
+    /* Integers print the same as the C library, and only if there is room for them and a NULL */
+    {
+        long ints[] = { 0, 1, -1, 9, -9, 10, -10, 99, 100, -101, 12345, -98765432, LONG_MAX,
+                        LONG_MIN, LONG_MAX - 1, LONG_MIN + 1 };
+        unsigned long u;
+        char ref[32];
+        size_t j;
+
+        for (i = 0; i < JTS_NUM_ITEMS(ints, sizeof(long)); i++)
+        {
+            snprintf(ref, sizeof(ref), "%ld", ints[i]);
+            SSF_ASSERT(SSFJsonPrintInt(_jsOut, sizeof(_jsOut), 0, &end, ints[i], false));
+            SSF_ASSERT((end == strlen(ref)) && (strcmp(_jsOut, ref) == 0));
+            for (j = 0; j <= strlen(ref); j++)
+            {SSF_ASSERT(!SSFJsonPrintInt(_jsOut, j, 0, &end, ints[i], false)); }
+            SSF_ASSERT(SSFJsonPrintInt(_jsOut, j + 2, 2, &end, ints[i], false));
+            SSF_ASSERT((end == (strlen(ref) + 2)) && (strcmp(&_jsOut[2], ref) == 0));
+
+            snprintf(ref, sizeof(ref), "%lu", (unsigned long)ints[i]);
+            SSF_ASSERT(SSFJsonPrintUInt(_jsOut, sizeof(_jsOut), 0, &end, (unsigned long)ints[i],
+                                        false));
+            SSF_ASSERT((end == strlen(ref)) && (strcmp(_jsOut, ref) == 0));
+            for (j = 0; j <= strlen(ref); j++)
+            {SSF_ASSERT(!SSFJsonPrintUInt(_jsOut, j, 0, &end, (unsigned long)ints[i], false)); }
+        }
+        for (u = 1; u <= (ULONG_MAX / 10); u *= 10)
+        {
+            snprintf(ref, sizeof(ref), "%lu", u - 1);
+            SSF_ASSERT(SSFJsonPrintUInt(_jsOut, sizeof(_jsOut), 0, &end, u - 1, false));
+            SSF_ASSERT(strcmp(_jsOut, ref) == 0);
+            snprintf(ref, sizeof(ref), "%lu", u * 10);
+            SSF_ASSERT(SSFJsonPrintUInt(_jsOut, sizeof(_jsOut), 0, &end, u * 10, false));
+            SSF_ASSERT(strcmp(_jsOut, ref) == 0);
+        }
+    }
+
+    /* Base64 prints and gets back in each alphabet and padding format */
+    {
+        static const char *exp[SSF_BASE64_FMT_MAX] = { "{\"b\":\"+/8=\"}", "{\"b\":\"+/8\"}",
+                                                        "{\"b\":\"-_8=\"}", "{\"b\":\"-_8\"}" };
+        const char *bpath[SSF_JSON_CONFIG_MAX_IN_DEPTH + 1];
+        uint8_t bin[2] = { 0xfb, 0xff };
+        uint8_t bout[4];
+        size_t boutLen;
+        size_t j;
+
+        memset(bpath, 0, sizeof(bpath));
+        bpath[0] = "b";
+        for (i = 0; i < SSF_BASE64_FMT_MAX; i++)
+        {
+            memcpy(_jsOut, "{\"b\":", 5); end = 5;
+            SSF_ASSERT(SSFJsonPrintBase64Fmt(_jsOut, sizeof(_jsOut), end, &end, bin, sizeof(bin),
+                                             (SSFBase64Fmt_t)i, NULL));
+            _jsOut[end++] = '}'; _jsOut[end] = 0;
+            SSF_ASSERT(strcmp(_jsOut, exp[i]) == 0);
+            for (j = 0; j < SSF_BASE64_FMT_MAX; j++)
+            {
+                bool ok = SSFJsonGetBase64Fmt(_jsOut, bpath, bout, sizeof(bout), &boutLen,
+                                              (SSFBase64Fmt_t)j);
+
+                SSF_ASSERT(ok == (i == j));
+                if (ok) SSF_ASSERT((boutLen == sizeof(bin)) && (memcmp(bout, bin, boutLen) == 0));
+            }
+            SSF_ASSERT(SSFJsonGetBase64(_jsOut, bpath, bout, sizeof(bout), &boutLen) ==
+                       (i == SSF_BASE64_FMT_STD));
+        }
+    }
+
+#if SSF_JSON_CONFIG_ENABLE_FLOAT_GEN == 1
+    /* Doubles print with the fewest digits that parse back to the same double */
+    {
+        typedef struct
+        {
+            double in;
+            const char *out;
+        } SSFJsonUTShortest_t;
+        static const SSFJsonUTShortest_t shortest[] =
+        {
+            { 0.0, "0" }, { -0.0, "-0" }, { 1.0, "1" }, { -1.0, "-1" }, { 0.1, "0.1" },
+            { 0.3, "0.3" }, { 0.1 + 0.2, "0.30000000000000004" }, { 100.0, "100" },
+            { 123456.0, "123456" }, { -92.8123456789123e3, "-92812.3456789123" },
+            { 1.5e-7, "1.5e-7" }, { 1e-7, "1e-7" }, { 0.000001, "0.000001" },
+            { 0.00001234, "0.00001234" }, { 1e21, "1e+21" }, { 1e20, "100000000000000000000" },
+            { 123456789012345680000.0, "123456789012345680000" }, { 1.25e100, "1.25e+100" },
+            { 5e-324, "5e-324" }, { 2.2250738585072014e-308, "2.2250738585072014e-308" },
+            { 1.7976931348623157e308, "1.7976931348623157e+308" }, { 9007199254740993.0,
+            "9007199254740992" }, { 3.14159, "3.14159" }, { 1e-10, "1e-10" }, { 4.5e15, 
+            "4500000000000000" },
+        };
+        uint64_t bits = 0x0123456789abcdefull;
+        uint64_t nf;
+        double d;
+        double rt;
+        char *endptr;
+        size_t j;
+
+        for (i = 0; i < JTS_NUM_ITEMS(shortest, sizeof(shortest[0])); i++)
+        {
+            SSF_ASSERT(SSFJsonPrintDouble(_jsOut, sizeof(_jsOut), 0, &end, shortest[i].in,
+                                          SSF_JSON_FLT_FMT_SHORTEST, false));
+            SSF_ASSERT((end == strlen(shortest[i].out)) && (strcmp(_jsOut, shortest[i].out) == 0));
+            for (j = 0; j <= end; j++)
+            {
+                SSF_ASSERT(!SSFJsonPrintDouble(_jsOut, j, 0, &start, shortest[i].in,
+                                               SSF_JSON_FLT_FMT_SHORTEST, false));
+            }
+        }
+
+        /* Non-finite values are not valid JSON numbers */
+        for (nf = 0x7FF0000000000000ull; nf != 0x7FF0000000000100ull; nf += 0x80)
+        {
+            memcpy(&d, &nf, sizeof(d));
+            SSF_ASSERT(!SSFJsonPrintDouble(_jsOut, sizeof(_jsOut), 0, &end, d,
+                                           SSF_JSON_FLT_FMT_SHORTEST, false));
+            d = -d;
+            SSF_ASSERT(!SSFJsonPrintDouble(_jsOut, sizeof(_jsOut), 0, &end, d,
+                                           SSF_JSON_FLT_FMT_SHORTEST, false));
+        }
+
+        /* Pseudo-random bit patterns round trip through strtod() */
+        for (i = 0; i < 100000; i++)
+        {
+            bits = (bits * 6364136223846793005ull) + 1442695040888963407ull;
+            nf = bits ^ (bits >> 29);
+            if ((nf & 0x7FF0000000000000ull) == 0x7FF0000000000000ull) continue;
+            memcpy(&d, &nf, sizeof(d));
+            SSF_ASSERT(SSFJsonPrintDouble(_jsOut, sizeof(_jsOut), 0, &end, d,
+                                          SSF_JSON_FLT_FMT_SHORTEST, false));
+            rt = strtod(_jsOut, &endptr);
+            SSF_ASSERT((endptr == &_jsOut[end]) && (memcmp(&rt, &d, sizeof(d)) == 0));
+        }
+    }
+#endif /* SSF_JSON_CONFIG_ENABLE_FLOAT_GEN */
+
+    /* Integers parse exactly over the full range of long and unsigned long */
+    {
+        char js[64];
+        char *last;
+        long si;
+        unsigned long ui;
+
+        path[0] = "n";
+        path[1] = NULL;
+        snprintf(js, sizeof(js), "{\"n\":%ld}", LONG_MAX);
+        SSF_ASSERT(SSFJsonGetLong(js, (SSFCStrIn_t *)path, &si) && (si == LONG_MAX));
+        SSF_ASSERT(SSFJsonGetULong(js, (SSFCStrIn_t *)path, &ui) && (ui == LONG_MAX));
+        last = strchr(js, '}') - 1;
+        SSF_ASSERT(*last == '7');
+        *last = '8';
+        SSF_ASSERT(SSFJsonGetLong(js, (SSFCStrIn_t *)path, &si) == false);
+        SSF_ASSERT(SSFJsonGetULong(js, (SSFCStrIn_t *)path, &ui) && (ui == (LONG_MAX + 1ul)));
+
+        snprintf(js, sizeof(js), "{\"n\":%ld}", LONG_MIN);
+        SSF_ASSERT(SSFJsonGetLong(js, (SSFCStrIn_t *)path, &si) && (si == LONG_MIN));
+        SSF_ASSERT(SSFJsonGetULong(js, (SSFCStrIn_t *)path, &ui) == false);
+        last = strchr(js, '}') - 1;
+        SSF_ASSERT(*last == '8');
+        *last = '9';
+        SSF_ASSERT(SSFJsonGetLong(js, (SSFCStrIn_t *)path, &si) == false);
+
+        snprintf(js, sizeof(js), "{\"n\":%lu}", ULONG_MAX);
+        SSF_ASSERT(SSFJsonGetULong(js, (SSFCStrIn_t *)path, &ui) && (ui == ULONG_MAX));
+        SSF_ASSERT(SSFJsonGetLong(js, (SSFCStrIn_t *)path, &si) == false);
+        last = strchr(js, '}') - 1;
+        SSF_ASSERT(*last == '5');
+        *last = '6';
+        SSF_ASSERT(SSFJsonGetULong(js, (SSFCStrIn_t *)path, &ui) == false);
+
+        SSF_ASSERT(SSFJsonGetLong("{\"n\":123456789012345678901234567890}", (SSFCStrIn_t *)path,
+                                  &si) == false);
+        SSF_ASSERT(SSFJsonGetULong("{\"n\":123456789012345678901234567890}",
+                                   (SSFCStrIn_t *)path, &ui) == false);
+        SSF_ASSERT(SSFJsonGetLong("{\"n\":-0}", (SSFCStrIn_t *)path, &si) && (si == 0));
+        SSF_ASSERT(SSFJsonGetLong("{\"n\":-1}", (SSFCStrIn_t *)path, &si) && (si == -1));
+        SSF_ASSERT(SSFJsonGetULong("{\"n\":-1}", (SSFCStrIn_t *)path, &ui) == false);
+        SSF_ASSERT(SSFJsonGetLong("{\"n\":0}", (SSFCStrIn_t *)path, &si) && (si == 0));
+        SSF_ASSERT(SSFJsonGetULong("{\"n\":0}", (SSFCStrIn_t *)path, &ui) && (ui == 0));
+#if SSF_JSON_CONFIG_ENABLE_FLOAT_PARSE == 1
+        /* Non-integers round to nearest if in range */
+        SSF_ASSERT(SSFJsonGetLong("{\"n\":1.0}", (SSFCStrIn_t *)path, &si) && (si == 1));
+        SSF_ASSERT(SSFJsonGetLong("{\"n\":1e2}", (SSFCStrIn_t *)path, &si) && (si == 100));
+        SSF_ASSERT(SSFJsonGetLong("{\"n\":2.5}", (SSFCStrIn_t *)path, &si) && (si == 3));
+        SSF_ASSERT(SSFJsonGetLong("{\"n\":-2.5}", (SSFCStrIn_t *)path, &si) && (si == -3));
+        SSF_ASSERT(SSFJsonGetULong("{\"n\":2.4}", (SSFCStrIn_t *)path, &ui) && (ui == 2));
+        SSF_ASSERT(SSFJsonGetULong("{\"n\":-1.5}", (SSFCStrIn_t *)path, &ui) == false);
+        SSF_ASSERT(SSFJsonGetLong("{\"n\":1e30}", (SSFCStrIn_t *)path, &si) == false);
+        SSF_ASSERT(SSFJsonGetLong("{\"n\":-1e30}", (SSFCStrIn_t *)path, &si) == false);
+        SSF_ASSERT(SSFJsonGetULong("{\"n\":1e30}", (SSFCStrIn_t *)path, &ui) == false);
+#else
+        SSF_ASSERT(SSFJsonGetLong("{\"n\":1.0}", (SSFCStrIn_t *)path, &si) == false);
+        SSF_ASSERT(SSFJsonGetLong("{\"n\":1e2}", (SSFCStrIn_t *)path, &si) == false);
+        SSF_ASSERT(SSFJsonGetULong("{\"n\":1.0}", (SSFCStrIn_t *)path, &ui) == false);
+        SSF_ASSERT(SSFJsonGetULong("{\"n\":1e2}", (SSFCStrIn_t *)path, &ui) == false);
+#endif /* SSF_JSON_CONFIG_ENABLE_FLOAT_PARSE */
+    }
+
+#if SSF_JSON_CONFIG_ENABLE_FLOAT_PARSE == 1
+    /* Doubles parse to the same bits as the C library */
+    {
+        static const char *dbls[] =
+        {
+            "0", "-0", "1", "-1", "0.1", "0.3", "0.30000000000000004", "123456", "1.5e-7",
+            "1E22", "1e23", "9007199254740992", "9007199254740993", "9007199254740993.0",
+            "4.9e-324", "5e-324", "2.2250738585072014e-308", "1.7976931348623157e308", "1e309",
+            "1e-400", "0.000000000000000000000000000000001", "12345678901234567890123",
+            "0.12345678901234567890123", "3.14159", "-92.8123456789123e3", "1e0000000000000001",
+            "0e999999999999", "1.0e-22", "123456789e-22", "8.98846567431158e307",
+            /* Boundaries of Clinger's fast path: 2^53 mantissa and 10^22 */
+            "-1e22", "1e-23", "9007199254740991e15", "9007199254740992e15",
+            "9007199254740993e15", "9007199254740992e22", "9007199254740992e23",
+            "9007199254740992e-22", "9007199254740992e-23", "-9007199254740993e-22",
+        };
+        SSFJsonGet_t get;
+        uint64_t bits = 0xfedcba9876543210ull;
+        uint64_t r;
+        char js[80];
+        char *endptr;
+        double d;
+        double ref;
+
+        path[0] = "n";
+        path[1] = NULL;
+        for (i = 0; i < (JTS_NUM_ITEMS(dbls, sizeof(char *)) + 100000); i++)
+        {
+            if (i < JTS_NUM_ITEMS(dbls, sizeof(char *)))
+            {snprintf(js, sizeof(js), "{\"n\":%s}", dbls[i]); }
+            else
+            {
+                /* Random mantissas of up to 19 digits with small and large exponents */
+                bits = (bits * 6364136223846793005ull) + 1442695040888963407ull;
+                r = bits ^ (bits >> 29);
+                snprintf(js, sizeof(js), "{\"n\":%s%llu.%03ue%d}", (r & 1) ? "-" : "",
+                         (unsigned long long)(r >> (r & 0x3f)), (unsigned int)((r >> 8) % 1000),
+                         (int)((r >> 20) % 64) - ((r & 0x10000) ? 340 : 32));
+            }
+            ref = strtod(&js[5], &endptr);
+            SSF_ASSERT(*endptr == '}');
+            SSF_ASSERT(SSFJsonGetDouble(js, (SSFCStrIn_t *)path, &d));
+            SSF_ASSERT(memcmp(&d, &ref, sizeof(d)) == 0);
+            if (i < JTS_NUM_ITEMS(dbls, sizeof(char *)))
+            {
+                /* Value accumulated by the walk converts the same for many getters */
+                memset(&get, 0, sizeof(get));
+                get.path = (SSFCStrIn_t *)path; get.kind = SSF_JSON_GET_DOUBLE; get.out = &d;
+                SSF_ASSERT(SSFJsonGetMany(js, &get, 1));
+                SSF_ASSERT(memcmp(&d, &ref, sizeof(d)) == 0);
+            }
+        }
+    }
+#endif /* SSF_JSON_CONFIG_ENABLE_FLOAT_PARSE */
+
 #if SSF_JSON_CONFIG_ENABLE_UPDATE == 1
     SSFJsonUnitTestUpdate(_jsOut, sizeof(_jsOut), "l1", NULL, NULL,
                           "{}",
@@ -1243,7 +2609,511 @@ void SSFJsonUnitTest(void)
     SSFJsonUnitTestUpdate(_jsOut, sizeof(_jsOut), "l1", "l2", "l3", _jtsComplex[1], NULL);
     SSFJsonUnitTestUpdate(_jsOut, sizeof(_jsOut), "obj2", "objdeep", "NUMFAR", _jtsComplex[1], NULL);
     SSFJsonUnitTestUpdate(_jsOut, sizeof(_jsOut), "obj2", "objdeep", "hex3", _jtsComplex[1], NULL);
+
+    /* Update many fields in one pass */
+    {
+        SSFJsonUpdate_t ups[7];
+        SSFCStrIn_t paths[7][SSF_JSON_CONFIG_MAX_IN_DEPTH + 1];
+        const char *initial = "{\"a\":1, \"b\" : {\"c\":2,\"d\":[3,4]}, \"e\":{ }, \"f\":\"old\"}";
+        const char *expected = "{\"x\":{\"y\":{\"z\":-5},\"w\":\"mynewvalue\"},\"a\":-5, "
+                               "\"b\" : {\"n\":-5,\"c\":2,\"d\":[3,\"mynewvalue\"]}, "
+                               "\"e\":{\"n\":\"mynewvalue\" }, \"f\":\"mynewvalue\"}";
+        long val = -5;
+        size_t idx = 1;
+        size_t idx2 = 2;
+        size_t outLen;
+        size_t j;
+
+        memset(paths, 0, sizeof(paths));
+        paths[0][0] = "f";
+        paths[1][0] = "x"; paths[1][1] = "y"; paths[1][2] = "z";
+        paths[2][0] = "b"; paths[2][1] = "d"; paths[2][2] = (SSFCStrIn_t)&idx;
+        paths[3][0] = "a";
+        paths[4][0] = "e"; paths[4][1] = "n";
+        paths[5][0] = "b"; paths[5][1] = "n";
+        paths[6][0] = "x"; paths[6][1] = "w";
+        for (i = 0; i < JTS_NUM_ITEMS(ups, sizeof(ups[0])); i++)
+        {
+            ups[i].path = paths[i];
+            ups[i].fn = ((i & 1) == 0) ? p4fn : p5fn;
+            ups[i].in = &val;
+        }
+
+        SSF_ASSERT_TEST(SSFJsonUpdateMany(NULL, _jsOut, sizeof(_jsOut), &outLen, ups, 1));
+        SSF_ASSERT_TEST(SSFJsonUpdateMany(initial, NULL, sizeof(_jsOut), &outLen, ups, 1));
+        SSF_ASSERT_TEST(SSFJsonUpdateMany(_jsOut, _jsOut, sizeof(_jsOut), &outLen, ups, 1));
+        SSF_ASSERT_TEST(SSFJsonUpdateMany(initial, _jsOut, sizeof(_jsOut), &outLen, NULL, 1));
+
+        SSF_ASSERT(SSFJsonUpdateMany(initial, _jsOut, sizeof(_jsOut), &outLen, ups, 7));
+        SSF_ASSERT(strcmp(_jsOut, expected) == 0);
+        SSF_ASSERT(outLen == strlen(expected));
+        SSF_ASSERT(SSFJsonIsValid(_jsOut));
+
+        /* Output buffer too small */
+        for (j = 0; j <= strlen(expected); j++)
+        {
+            SSF_ASSERT(!SSFJsonUpdateMany(initial, _jsOut, j, &outLen, ups, 7));
+        }
+        SSF_ASSERT(SSFJsonUpdateMany(initial, _jsOut, j, NULL, ups, 7));
+        SSF_ASSERT(strcmp(_jsOut, expected) == 0);
+
+        /* No updates copies js */
+        SSF_ASSERT(SSFJsonUpdateMany(initial, _jsOut, sizeof(_jsOut), &outLen, ups, 0));
+        SSF_ASSERT(strcmp(_jsOut, initial) == 0);
+
+        /* Invalid js */
+        SSF_ASSERT(!SSFJsonUpdateMany("{\"a\":1", _jsOut, sizeof(_jsOut), &outLen, ups, 7));
+
+        /* Paths that overlap */
+        paths[1][0] = "f"; paths[1][1] = NULL; paths[1][2] = NULL;
+        SSF_ASSERT(!SSFJsonUpdateMany(initial, _jsOut, sizeof(_jsOut), &outLen, ups, 2));
+        paths[1][0] = "b"; paths[1][1] = "d";
+        SSF_ASSERT(!SSFJsonUpdateMany(initial, _jsOut, sizeof(_jsOut), &outLen, &ups[1], 2));
+        paths[1][0] = "b"; paths[1][1] = NULL;
+        SSF_ASSERT(!SSFJsonUpdateMany(initial, _jsOut, sizeof(_jsOut), &outLen, &ups[1], 5));
+        paths[1][0] = "x"; paths[1][1] = "w"; paths[1][2] = "z";
+        SSF_ASSERT(!SSFJsonUpdateMany(initial, _jsOut, sizeof(_jsOut), &outLen, &ups[1], 6));
+        paths[1][1] = "y";
+        SSF_ASSERT(SSFJsonUpdateMany(initial, _jsOut, sizeof(_jsOut), &outLen, &ups[1], 6));
+
+        /* Cannot add to array or through a non-object value */
+        paths[1][0] = "b"; paths[1][1] = "d"; paths[1][2] = (SSFCStrIn_t)&idx2;
+        SSF_ASSERT(!SSFJsonUpdateMany(initial, _jsOut, sizeof(_jsOut), &outLen, &ups[1], 1));
+        paths[1][0] = "a"; paths[1][1] = "z"; paths[1][2] = NULL;
+        SSF_ASSERT(!SSFJsonUpdateMany(initial, _jsOut, sizeof(_jsOut), &outLen, &ups[1], 1));
+    }
 #endif /* SSF_JSON_CONFIG_ENABLE_UPDATE */
+
+#if SSF_JSON_CONFIG_ENABLE_GEN == 1
+    /* Streaming generator */
+    {
+        SSFJsonGen_t gen;
+        uint8_t buf[16];
+        uint8_t bin[200];
+        char expected[1024];
+        char big[512];
+        size_t expectedLen;
+        size_t len;
+        size_t j;
+        bool comma;
+
+        memset(&gen, 0, sizeof(gen));
+        SSF_ASSERT_TEST(SSFJsonGenInit(NULL, buf, sizeof(buf), SSFJsonUnitTestGenFn, NULL));
+        SSF_ASSERT_TEST(SSFJsonGenInit(&gen, NULL, sizeof(buf), SSFJsonUnitTestGenFn, NULL));
+        SSF_ASSERT_TEST(SSFJsonGenInit(&gen, buf, 0, SSFJsonUnitTestGenFn, NULL));
+        SSF_ASSERT_TEST(SSFJsonGenInit(&gen, buf, sizeof(buf), NULL, NULL));
+        SSF_ASSERT_TEST(SSFJsonGenInitBFifo(NULL, &_jsGenFifo, NULL, NULL));
+        SSF_ASSERT_TEST(SSFJsonGenInitBFifo(&gen, NULL, NULL, NULL));
+        SSF_ASSERT_TEST(SSFJsonGenInt(&gen, 0));
+        SSF_ASSERT_TEST(SSFJsonGenDeInit(&gen));
+
+        /* Expected output built with the buffer based generator */
+        comma = false;
+        for (i = 0, expectedLen = 0; i < 100; i++)
+        {
+            SSF_ASSERT(SSFJsonPrintUInt(big, sizeof(big), expectedLen, &expectedLen, i, &comma));
+        }
+        snprintf(expected, sizeof(expected),
+                 "{\"a\":1,\"b\\\"\":[true,false,null,-5,\"s\\\"\\\\\\/\\r\\n\\u0001x\"],"
+                 "\"c\":{},\"d\":[[],{}],\"h\":\"01020304\",\"hr\":\"04030201\","
+                 "\"b64\":\"AQIDBA==\",\"e\":\"\",\"u\":4294967295,%s\"big\":[%s]}",
+#if SSF_JSON_CONFIG_ENABLE_FLOAT_GEN == 1
+                 "\"f\":1.5,",
+#else
+                 "",
+#endif /* SSF_JSON_CONFIG_ENABLE_FLOAT_GEN */
+                 big);
+        expectedLen = strlen(expected);
+        SSF_ASSERT(expectedLen > sizeof(_jsGenFifoBuf));
+
+        /* Any staging buffer size produces the same output */
+        for (j = 1; j <= sizeof(buf); j++)
+        {
+            _jsGenOutLen = 0;
+            SSFJsonGenInit(&gen, buf, j, SSFJsonUnitTestGenFn, &_jsGenOutLen);
+            SSF_ASSERT(SSFJsonUnitTestGenDoc(&gen, &len));
+            SSF_ASSERT((len == expectedLen) && (_jsGenOutLen == expectedLen));
+            SSF_ASSERT(memcmp(_jsGenOut, expected, expectedLen) == 0);
+            SSFJsonGenDeInit(&gen);
+        }
+
+        /* BFifo output is drained by the flush function when full */
+        memset(&_jsGenFifo, 0, sizeof(_jsGenFifo));
+        SSFBFifoInit(&_jsGenFifo, SSF_BFIFO_255, _jsGenFifoBuf, sizeof(_jsGenFifoBuf));
+        _jsGenOutLen = 0;
+        SSFJsonGenInitBFifo(&gen, &_jsGenFifo, SSFJsonUnitTestGenFn, &_jsGenOutLen);
+        SSF_ASSERT(SSFJsonUnitTestGenDoc(&gen, &len));
+        SSF_ASSERT(SSFJsonUnitTestGenFn(NULL, 0, &_jsGenOutLen));
+        SSF_ASSERT((len == expectedLen) && (_jsGenOutLen == expectedLen));
+        SSF_ASSERT(memcmp(_jsGenOut, expected, expectedLen) == 0);
+        SSFJsonGenDeInit(&gen);
+
+        /* Full BFifo without a flush function fails */
+        SSFJsonGenInitBFifo(&gen, &_jsGenFifo, NULL, NULL);
+        SSF_ASSERT(SSFJsonUnitTestGenDoc(&gen, &len) == false);
+        SSF_ASSERT(SSFBFifoIsFull(&_jsGenFifo));
+        SSFJsonGenDeInit(&gen);
+        _jsGenOutLen = 0;
+        SSF_ASSERT(SSFJsonUnitTestGenFn(NULL, 0, &_jsGenOutLen));
+        SSF_ASSERT(_jsGenOutLen == SSF_BFIFO_255);
+        SSF_ASSERT(memcmp(_jsGenOut, expected, SSF_BFIFO_255) == 0);
+
+        /* Flush failures are sticky */
+        for (j = 1; j < 10; j++)
+        {
+            _jsGenOutLen = 0;
+            _jsGenFailAt = j;
+            SSFJsonGenInit(&gen, buf, sizeof(buf), SSFJsonUnitTestGenFn, &_jsGenOutLen);
+            SSF_ASSERT(SSFJsonUnitTestGenDoc(&gen, &len) == false);
+            SSF_ASSERT(SSFJsonGenFlush(&gen) == false);
+            SSF_ASSERT(_jsGenOutLen == ((j - 1) * sizeof(buf)));
+            SSFJsonGenDeInit(&gen);
+        }
+        _jsGenFailAt = 0;
+
+        /* Structure errors */
+        SSFJsonGenInit(&gen, buf, sizeof(buf), SSFJsonUnitTestGenFn, &_jsGenOutLen);
+        SSF_ASSERT(SSFJsonGenEnd(&gen, &len) == false);
+        SSF_ASSERT(len == 0);
+        SSF_ASSERT(SSFJsonGenObjectEnd(&gen) == false);
+        SSF_ASSERT(SSFJsonGenObjectBegin(&gen) == false);
+        SSFJsonGenDeInit(&gen);
+        SSFJsonGenInit(&gen, buf, sizeof(buf), SSFJsonUnitTestGenFn, &_jsGenOutLen);
+        SSF_ASSERT(SSFJsonGenObjectBegin(&gen));
+        SSF_ASSERT(SSFJsonGenArrayEnd(&gen) == false);
+        SSFJsonGenDeInit(&gen);
+        SSFJsonGenInit(&gen, buf, sizeof(buf), SSFJsonUnitTestGenFn, &_jsGenOutLen);
+        SSF_ASSERT(SSFJsonGenArrayBegin(&gen));
+        SSF_ASSERT(SSFJsonGenEnd(&gen, &len) == false);
+        SSF_ASSERT(len == 1);
+        SSFJsonGenDeInit(&gen);
+        _jsGenOutLen = 0;
+        SSFJsonGenInit(&gen, buf, sizeof(buf), SSFJsonUnitTestGenFn, &_jsGenOutLen);
+        for (j = 0; j < SSF_JSON_CONFIG_GEN_MAX_DEPTH; j++)
+        {SSF_ASSERT(SSFJsonGenOpen(&gen, (j & 1) != 0)); }
+        SSF_ASSERT(SSFJsonGenArrayBegin(&gen) == false);
+        SSFJsonGenDeInit(&gen);
+        _jsGenOutLen = 0;
+        SSFJsonGenInit(&gen, buf, sizeof(buf), SSFJsonUnitTestGenFn, &_jsGenOutLen);
+        for (j = 0; j < SSF_JSON_CONFIG_GEN_MAX_DEPTH; j++)
+        {SSF_ASSERT(SSFJsonGenOpen(&gen, (j & 1) != 0)); }
+        for (j = SSF_JSON_CONFIG_GEN_MAX_DEPTH; j > 0; j--)
+        {SSF_ASSERT(SSFJsonGenClose(&gen, ((j - 1) & 1) != 0)); }
+        SSF_ASSERT(SSFJsonGenEnd(&gen, &len) && (len == (SSF_JSON_CONFIG_GEN_MAX_DEPTH * 2)));
+        SSFJsonGenDeInit(&gen);
+#if SSF_JSON_CONFIG_ENABLE_FLOAT_GEN == 1
+        SSFJsonGenInit(&gen, buf, sizeof(buf), SSFJsonUnitTestGenFn, &_jsGenOutLen);
+        SSF_ASSERT(SSFJsonGenDouble(&gen, 1e300, SSF_JSON_FLT_FMT_STD) == false);
+        SSF_ASSERT(SSFJsonGenEnd(&gen, &len) == false);
+        SSFJsonGenDeInit(&gen);
+#endif /* SSF_JSON_CONFIG_ENABLE_FLOAT_GEN */
+
+        /* Long binary data is converted in chunks */
+        for (j = 0; j < sizeof(bin); j++) bin[j] = (uint8_t)(j * 7);
+        for (j = 0; j < sizeof(bin); j += 37)
+        {
+            _jsGenOutLen = 0;
+            SSFJsonGenInit(&gen, buf, sizeof(buf), SSFJsonUnitTestGenFn, &_jsGenOutLen);
+            SSF_ASSERT(SSFJsonGenArrayBegin(&gen));
+            SSF_ASSERT(SSFJsonGenHex(&gen, bin, j, false));
+            SSF_ASSERT(SSFJsonGenHex(&gen, bin, j, true));
+            SSF_ASSERT(SSFJsonGenBase64(&gen, bin, j));
+            SSF_ASSERT(SSFJsonGenArrayEnd(&gen));
+            SSF_ASSERT(SSFJsonGenEnd(&gen, &len) && (len == _jsGenOutLen));
+            SSFJsonGenDeInit(&gen);
+
+            comma = false;
+            expected[0] = '[';
+            SSF_ASSERT(SSFJsonPrintHex(expected, sizeof(expected), 1, &expectedLen, bin, j,
+                                       false, &comma));
+            SSF_ASSERT(SSFJsonPrintHex(expected, sizeof(expected), expectedLen, &expectedLen, bin,
+                                       j, true, &comma));
+            SSF_ASSERT(SSFJsonPrintBase64(expected, sizeof(expected), expectedLen, &expectedLen,
+                                          bin, j, &comma));
+            expected[expectedLen] = ']';
+            expectedLen++;
+            SSF_ASSERT((len == expectedLen) && (memcmp(_jsGenOut, expected, len) == 0));
+        }
+    }
+#endif /* SSF_JSON_CONFIG_ENABLE_GEN */
+
+#if SSF_JSON_CONFIG_ENABLE_MINIFY == 1
+    /* Minify and canonicalize */
+    {
+        const char *pretty = " {\r\n  \"b\" : 1 ,\n\t\"a\" : { \"d\" : [ 3 , { \"z\" : 1, "
+                             "\"y\" : \"x y\\\" z\" } ] , \"c\" : null } ,\n  \"aa\" : [ ] , "
+                             "\"ab\":{ } }\n";
+        const char *min = "{\"b\":1,\"a\":{\"d\":[3,{\"z\":1,\"y\":\"x y\\\" z\"}],\"c\":null},"
+                          "\"aa\":[],\"ab\":{}}";
+        const char *canon = "{\"a\":{\"c\":null,\"d\":[3,{\"y\":\"x y\\\" z\",\"z\":1}]},"
+                            "\"aa\":[],\"ab\":{},\"b\":1}";
+        char out[256];
+        size_t len;
+        size_t j;
+
+        SSF_ASSERT_TEST(SSFJsonMinify(NULL, out, sizeof(out), &len));
+        SSF_ASSERT_TEST(SSFJsonMinify(pretty, NULL, sizeof(out), &len));
+        SSF_ASSERT_TEST(SSFJsonMinify(pretty, out, sizeof(out), NULL));
+
+        SSF_ASSERT(SSFJsonMinify(pretty, out, sizeof(out), &len));
+        SSF_ASSERT((len == strlen(min)) && (strcmp(out, min) == 0));
+        SSF_ASSERT(SSFJsonMinify(min, out, sizeof(out), &len));
+        SSF_ASSERT((len == strlen(min)) && (strcmp(out, min) == 0));
+        SSF_ASSERT(SSFJsonMinify("{}", out, 3, &len) && (len == 2) && (strcmp(out, "{}") == 0));
+        SSF_ASSERT(SSFJsonMinify("{\"a\":}", out, sizeof(out), &len) == false);
+        SSF_ASSERT(SSFJsonMinify("[1]", out, sizeof(out), &len) == false);
+        for (j = 0; j <= strlen(min); j++)
+        {
+            SSF_ASSERT(SSFJsonMinify(pretty, out, j, &len) == false);
+        }
+
+        /* In place, the output never overtakes the input still to be read */
+        strcpy(out, pretty);
+        SSF_ASSERT(SSFJsonMinify(out, out, sizeof(out), &len));
+        SSF_ASSERT((len == strlen(min)) && (strcmp(out, min) == 0));
+
+#if SSF_JSON_CONFIG_ENABLE_ITER == 1
+        SSF_ASSERT_TEST(SSFJsonCanonicalize(NULL, out, sizeof(out), &len));
+        SSF_ASSERT_TEST(SSFJsonCanonicalize(pretty, NULL, sizeof(out), &len));
+        SSF_ASSERT_TEST(SSFJsonCanonicalize(pretty, out, sizeof(out), NULL));
+        SSF_ASSERT_TEST(SSFJsonCanonicalize(out, out, sizeof(out), &len));
+
+        SSF_ASSERT(SSFJsonCanonicalize(pretty, out, sizeof(out), &len));
+        SSF_ASSERT((len == strlen(canon)) && (strcmp(out, canon) == 0));
+        SSF_ASSERT(SSFJsonCanonicalize(min, out, sizeof(out), &len));
+        SSF_ASSERT((len == strlen(canon)) && (strcmp(out, canon) == 0));
+        SSF_ASSERT(SSFJsonCanonicalize(canon, out, sizeof(out), &len));
+        SSF_ASSERT((len == strlen(canon)) && (strcmp(out, canon) == 0));
+        for (j = 0; j <= strlen(canon); j++)
+        {
+            SSF_ASSERT(SSFJsonCanonicalize(pretty, out, j, &len) == false);
+        }
+
+        /* Keys sort by raw bytes, a key sorts before the longer keys it is a prefix of */
+        SSF_ASSERT(SSFJsonCanonicalize("{\"ab\":1,\"B\":2,\"a\":3,\"\\u0041\":4}", out,
+                                       sizeof(out), &len));
+        SSF_ASSERT(strcmp(out, "{\"B\":2,\"\\u0041\":4,\"a\":3,\"ab\":1}") == 0);
+
+        /* Duplicate keys have no canonical order */
+        SSF_ASSERT(SSFJsonCanonicalize("{\"a\":1,\"a\":2}", out, sizeof(out), &len) == false);
+        SSF_ASSERT(SSFJsonCanonicalize("{\"b\":[{\"x\":1,\"y\":1,\"x\":1}],\"a\":1}", out,
+                                       sizeof(out), &len) == false);
+        SSF_ASSERT(SSFJsonCanonicalize("{\"a\":1,\"b\":{\"a\":1}}", out, sizeof(out), &len));
+        SSF_ASSERT(SSFJsonCanonicalize("{\"a\":}", out, sizeof(out), &len) == false);
+#endif /* SSF_JSON_CONFIG_ENABLE_ITER */
+
+#if SSF_JSON_CONFIG_ENABLE_GEN == 1
+        /* Output to a sink as a value of the document being generated */
+        {
+            SSFJsonGen_t gen;
+            uint8_t buf[16];
+
+            memset(_jsGenOut, 0, sizeof(_jsGenOut));
+            _jsGenOutLen = 0;
+            SSFJsonGenInit(&gen, buf, sizeof(buf), SSFJsonUnitTestGenFn, &_jsGenOutLen);
+            SSF_ASSERT_TEST(SSFJsonGenMinify(&gen, NULL));
+            SSF_ASSERT(SSFJsonGenArrayBegin(&gen));
+            SSF_ASSERT(SSFJsonGenMinify(&gen, "{\"a\":}") == false);
+            SSF_ASSERT(SSFJsonGenMinify(&gen, pretty));
+#if SSF_JSON_CONFIG_ENABLE_ITER == 1
+            SSF_ASSERT_TEST(SSFJsonGenCanonicalize(&gen, NULL));
+            SSF_ASSERT(SSFJsonGenCanonicalize(&gen, "{\"a\":}") == false);
+            SSF_ASSERT(SSFJsonGenCanonicalize(&gen, pretty));
+#endif /* SSF_JSON_CONFIG_ENABLE_ITER */
+            SSF_ASSERT(SSFJsonGenArrayEnd(&gen));
+            SSF_ASSERT(SSFJsonGenEnd(&gen, &len));
+            SSFJsonGenDeInit(&gen);
+#if SSF_JSON_CONFIG_ENABLE_ITER == 1
+            snprintf(out, sizeof(out), "[%s,%s]", min, canon);
+#else /* SSF_JSON_CONFIG_ENABLE_ITER */
+            snprintf(out, sizeof(out), "[%s]", min);
+#endif /* SSF_JSON_CONFIG_ENABLE_ITER */
+            SSF_ASSERT((len == strlen(out)) && (len == _jsGenOutLen));
+            SSF_ASSERT(memcmp(_jsGenOut, out, len) == 0);
+
+#if SSF_JSON_CONFIG_ENABLE_ITER == 1
+            /* Duplicate keys found part way through output leave the generator in error */
+            SSFJsonGenInit(&gen, buf, sizeof(buf), SSFJsonUnitTestGenFn, &_jsGenOutLen);
+            SSF_ASSERT(SSFJsonGenCanonicalize(&gen, "{\"b\":1,\"a\":2,\"b\":3}") == false);
+            SSF_ASSERT(SSFJsonGenEnd(&gen, &len) == false);
+            SSFJsonGenDeInit(&gen);
+#endif /* SSF_JSON_CONFIG_ENABLE_ITER */
+        }
+#endif /* SSF_JSON_CONFIG_ENABLE_GEN */
+    }
+#endif /* SSF_JSON_CONFIG_ENABLE_MINIFY */
+
+#if SSF_JSON_CONFIG_ENABLE_SCHEMA == 1
+    /* Schema codec */
+    {
+        SSFJsonUTMsg_t msg;
+        SSFJsonUTMsg_t msg2;
+        char js[256];
+        const char *expected;
+        size_t len;
+        size_t j;
+
+        SSF_ASSERT_TEST(SSFJsonSchemaInit(NULL));
+        SSF_ASSERT_TEST(SSFJsonSchemaDecode("{}", &_jsMsgSchema, &msg));
+        SSF_ASSERT_TEST(SSFJsonSchemaInit(&_jsDupSchema));
+        SSFJsonSchemaInit(&_jsPosSchema);
+        SSFJsonSchemaInit(&_jsMsgSchema);
+        SSF_ASSERT_TEST(SSFJsonSchemaDecode(NULL, &_jsMsgSchema, &msg));
+        SSF_ASSERT_TEST(SSFJsonSchemaDecode("{}", NULL, &msg));
+        SSF_ASSERT_TEST(SSFJsonSchemaDecode("{}", &_jsMsgSchema, NULL));
+        SSF_ASSERT(_jsMsgSchema.fields[4].offset == offsetof(SSFJsonUTMsg_t, pos));
+        SSF_ASSERT(_jsMsgSchema.fields[2].size == sizeof(msg.name));
+
+        /* Decode in a single pass, ignoring unknown keys and leaving missing fields unchanged */
+        memset(&msg, 0, sizeof(msg));
+        msg.seq = 99;
+        SSF_ASSERT(SSFJsonSchemaDecode("{\"x\":[1,{\"id\":5}],\"id\":-12, \"name\" : \"abc\","
+                                       "\"pos\":{\"y\":-2,\"z\":{\"x\":9},\"x\":7},\"on\":true,"
+                                       "\"key\":\"A1b2C3d4\",\"iv\":\"AQIDBAU=\",\"temp\":-1.25}",
+                                       &_jsMsgSchema, &msg));
+        SSF_ASSERT((msg.id == -12) && (msg.seq == 99) && (strcmp(msg.name, "abc") == 0));
+        SSF_ASSERT(msg.on && (msg.pos.x == 7) && (msg.pos.y == -2));
+        SSF_ASSERT((msg.key[0] == 0xa1) && (msg.key[1] == 0xb2) && (msg.key[2] == 0xc3) &&
+                   (msg.key[3] == 0xd4));
+        SSF_ASSERT((msg.iv[0] == 1) && (msg.iv[1] == 2) && (msg.iv[2] == 3) && (msg.iv[3] == 4) &&
+                   (msg.iv[4] == 5));
+#if (SSF_JSON_CONFIG_ENABLE_FLOAT_PARSE == 1) && (SSF_JSON_CONFIG_ENABLE_FLOAT_GEN == 1)
+        SSF_ASSERT(msg.temp == -1.25);
+#endif /* SSF_JSON_CONFIG_ENABLE_FLOAT_PARSE && SSF_JSON_CONFIG_ENABLE_FLOAT_GEN */
+        SSF_ASSERT(SSFJsonSchemaDecode("{\"on\":false}", &_jsMsgSchema, &msg));
+        SSF_ASSERT(msg.on == false);
+
+        /* Unknown values may nest deeper than the schema */
+        SSF_ASSERT(SSFJsonSchemaDecode("{\"x\":{\"a\":{\"b\":{\"c\":{\"d\":[1]}}}},\"id\":3}",
+                                       &_jsMsgSchema, &msg));
+        SSF_ASSERT(msg.id == 3);
+
+        /* Invalid JSON and values that do not match their field fail */
+        SSF_ASSERT(SSFJsonSchemaDecode("{\"id\":1", &_jsMsgSchema, &msg) == false);
+        SSF_ASSERT(SSFJsonSchemaDecode("[]", &_jsMsgSchema, &msg) == false);
+        SSF_ASSERT(SSFJsonSchemaDecode("{\"id\":\"1\"}", &_jsMsgSchema, &msg) == false);
+        SSF_ASSERT(SSFJsonSchemaDecode("{\"id\":1.5}", &_jsMsgSchema, &msg) == false);
+        SSF_ASSERT(SSFJsonSchemaDecode("{\"id\":1e2}", &_jsMsgSchema, &msg) == false);
+        SSF_ASSERT(SSFJsonSchemaDecode("{\"seq\":2.0}", &_jsMsgSchema, &msg) == false);
+        SSF_ASSERT(SSFJsonSchemaDecode("{\"seq\":-1}", &_jsMsgSchema, &msg) == false);
+        SSF_ASSERT(SSFJsonSchemaDecode("{\"name\":1}", &_jsMsgSchema, &msg) == false);
+        SSF_ASSERT(SSFJsonSchemaDecode("{\"name\":\"12345678\"}", &_jsMsgSchema, &msg) == false);
+        SSF_ASSERT(SSFJsonSchemaDecode("{\"name\":\"1234567\"}", &_jsMsgSchema, &msg));
+        SSF_ASSERT(SSFJsonSchemaDecode("{\"name\":[]}", &_jsMsgSchema, &msg) == false);
+        SSF_ASSERT(SSFJsonSchemaDecode("{\"on\":null}", &_jsMsgSchema, &msg) == false);
+        SSF_ASSERT(SSFJsonSchemaDecode("{\"pos\":1}", &_jsMsgSchema, &msg) == false);
+        SSF_ASSERT(SSFJsonSchemaDecode("{\"pos\":[]}", &_jsMsgSchema, &msg) == false);
+        SSF_ASSERT(SSFJsonSchemaDecode("{\"pos\":{\"x\":{}}}", &_jsMsgSchema, &msg) == false);
+        SSF_ASSERT(SSFJsonSchemaDecode("{\"key\":\"A1B2C3\"}", &_jsMsgSchema, &msg) == false);
+        SSF_ASSERT(SSFJsonSchemaDecode("{\"key\":\"A1B2C3D4E5\"}", &_jsMsgSchema, &msg) == false);
+        SSF_ASSERT(SSFJsonSchemaDecode("{\"iv\":\"AQIDBA==\"}", &_jsMsgSchema, &msg) == false);
+        SSF_ASSERT(SSFJsonSchemaDecode("{\"iv\":\"AQIDBAUG\"}", &_jsMsgSchema, &msg) == false);
+
+        /* Print and generate produce the same JSON, which decodes to the same struct */
+        memset(&msg, 0, sizeof(msg));
+        msg.id = -12;
+        msg.seq = 4000000000ul;
+        strcpy(msg.name, "a\"b");
+        msg.on = true;
+        msg.pos.x = 7;
+        msg.pos.y = -2;
+        msg.key[0] = 0xa1;
+        msg.key[3] = 0xd4;
+        msg.iv[4] = 0xff;
+#if (SSF_JSON_CONFIG_ENABLE_FLOAT_PARSE == 1) && (SSF_JSON_CONFIG_ENABLE_FLOAT_GEN == 1)
+        msg.temp = 0.1;
+        expected = "{\"id\":-12,\"seq\":4000000000,\"name\":\"a\\\"b\",\"on\":true,"
+                   "\"pos\":{\"x\":7,\"y\":-2},\"key\":\"A10000D4\",\"iv\":\"AAAAAP8=\","
+                   "\"temp\":0.1}";
+#else
+        expected = "{\"id\":-12,\"seq\":4000000000,\"name\":\"a\\\"b\",\"on\":true,"
+                   "\"pos\":{\"x\":7,\"y\":-2},\"key\":\"A10000D4\",\"iv\":\"AAAAAP8=\"}";
+#endif /* SSF_JSON_CONFIG_ENABLE_FLOAT_PARSE && SSF_JSON_CONFIG_ENABLE_FLOAT_GEN */
+        SSF_ASSERT(SSFJsonSchemaPrint(js, sizeof(js), 0, &len, &_jsMsgSchema, &msg, NULL));
+        SSF_ASSERT((len == strlen(expected)) && (strcmp(js, expected) == 0));
+        for (j = 0; j <= len; j++)
+        {SSF_ASSERT(!SSFJsonSchemaPrint(js, j, 0, &len, &_jsMsgSchema, &msg, NULL)); }
+        strcpy(msg.name, "ab");
+        SSF_ASSERT(SSFJsonSchemaPrint(js, sizeof(js), 0, &len, &_jsMsgSchema, &msg, NULL));
+        memset(&msg2, 0xff, sizeof(msg2));
+        SSF_ASSERT(SSFJsonSchemaDecode(js, &_jsMsgSchema, &msg2));
+        SSFJsonUnitTestSchemaMsgEq(&msg, &msg2);
+        memset(msg.name, 'x', sizeof(msg.name));
+        SSF_ASSERT(!SSFJsonSchemaPrint(js, sizeof(js), 0, &len, &_jsMsgSchema, &msg, NULL));
+        strcpy(msg.name, "a\"b");
+#if SSF_JSON_CONFIG_ENABLE_GEN == 1
+        {
+            SSFJsonGen_t gen;
+            uint8_t buf[8];
+
+            _jsGenOutLen = 0;
+            SSFJsonGenInit(&gen, buf, sizeof(buf), SSFJsonUnitTestGenFn, &_jsGenOutLen);
+            SSF_ASSERT(SSFJsonGenArrayBegin(&gen));
+            SSF_ASSERT(SSFJsonSchemaGen(&gen, &_jsMsgSchema, &msg));
+            SSF_ASSERT(SSFJsonSchemaGen(&gen, &_jsMsgSchema, &msg));
+            SSF_ASSERT(SSFJsonGenArrayEnd(&gen));
+            SSF_ASSERT(SSFJsonGenEnd(&gen, &len));
+            SSFJsonGenDeInit(&gen);
+            SSF_ASSERT(len == ((strlen(expected) * 2) + 3));
+            SSF_ASSERT((_jsGenOut[0] == '[') && (_jsGenOut[strlen(expected) + 1] == ','));
+            SSF_ASSERT(memcmp(&_jsGenOut[1], expected, strlen(expected)) == 0);
+            SSF_ASSERT(memcmp(&_jsGenOut[strlen(expected) + 2], expected, strlen(expected)) == 0);
+        }
+#endif /* SSF_JSON_CONFIG_ENABLE_GEN */
+
+#if SSF_JSON_CONFIG_SCHEMA_MAX_FIELDS >= SSF_JSON_UT_MANY_LEN
+        /* A perfect hash is found for many fields */
+        {
+            SSFJsonUTMany_t many;
+
+            SSFJsonSchemaInit(&_jsManySchema);
+            for (j = 0; j < SSF_JSON_UT_MANY_LEN; j++) many.v[j] = j * 3;
+            SSF_ASSERT(SSFJsonSchemaPrint(_jsOut, sizeof(_jsOut), 0, &len, &_jsManySchema, &many,
+                                          NULL));
+            memset(&many, 0, sizeof(many));
+            SSF_ASSERT(SSFJsonSchemaDecode(_jsOut, &_jsManySchema, &many));
+            for (j = 0; j < SSF_JSON_UT_MANY_LEN; j++) { SSF_ASSERT(many.v[j] == j * 3); }
+            memset(&many, 0, sizeof(many));
+            SSF_ASSERT(SSFJsonSchemaDecode("{\"k0\":1,\"k000\":1,\"k32\":1,\"K00\":1}",
+                                           &_jsManySchema, &many));
+            for (j = 0; j < SSF_JSON_UT_MANY_LEN; j++) { SSF_ASSERT(many.v[j] == 0); }
+        }
+#endif /* SSF_JSON_CONFIG_SCHEMA_MAX_FIELDS */
+
+        /* Every key of a schema with the maximum number of fields is found */
+        {
+            static SSFJsonField_t fields[SSF_JSON_CONFIG_SCHEMA_MAX_FIELDS];
+            static char keys[SSF_JSON_CONFIG_SCHEMA_MAX_FIELDS][8];
+            static char fjs[(SSF_JSON_CONFIG_SCHEMA_MAX_FIELDS * 16) + 4];
+            unsigned long v[SSF_JSON_CONFIG_SCHEMA_MAX_FIELDS];
+            SSFJsonSchema_t full;
+
+            for (j = 0; j < SSF_JSON_CONFIG_SCHEMA_MAX_FIELDS; j++)
+            {
+                snprintf(keys[j], sizeof(keys[j]), "f%u", (unsigned int)j);
+                fields[j].key = keys[j];
+                fields[j].keyLen = strlen(keys[j]);
+                fields[j].offset = j * sizeof(v[0]);
+                fields[j].size = sizeof(v[0]);
+                fields[j].kind = SSF_JSON_FIELD_ULONG;
+                fields[j].sub = NULL;
+                v[j] = j * 7;
+            }
+            memset(&full, 0, sizeof(full));
+            full.fields = fields;
+            full.fieldsLen = SSF_JSON_CONFIG_SCHEMA_MAX_FIELDS;
+            SSFJsonSchemaInit(&full);
+            SSF_ASSERT(SSFJsonSchemaPrint(fjs, sizeof(fjs), 0, &len, &full, v, NULL));
+            memset(v, 0, sizeof(v));
+            SSF_ASSERT(SSFJsonSchemaDecode(fjs, &full, v));
+            for (j = 0; j < SSF_JSON_CONFIG_SCHEMA_MAX_FIELDS; j++) { SSF_ASSERT(v[j] == j * 7); }
+            memset(v, 0, sizeof(v));
+            SSF_ASSERT(SSFJsonSchemaDecode("{\"f\":1,\"F0\":1,\"f0 \":1,\"g1\":1,\"f999\":1}",
+                                           &full, v));
+            for (j = 0; j < SSF_JSON_CONFIG_SCHEMA_MAX_FIELDS; j++) { SSF_ASSERT(v[j] == 0); }
+        }
+    }
+#endif /* SSF_JSON_CONFIG_ENABLE_SCHEMA */
 }
 #endif /* SSF_CONFIG_JSON_UNIT_TEST */
 
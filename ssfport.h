@@ -114,6 +114,7 @@ typedef uint64_t SSFPortTick_t;
 #define SSF_CONFIG_AESGCM_UNIT_TEST (1u)
 #define SSF_CONFIG_CFG_UNIT_TEST (1u)
 #define SSF_CONFIG_PRNG_UNIT_TEST (1u)
+#define SSF_CONFIG_CBOR_UNIT_TEST (1u)
 
 /* If any unit test is enabled then enable unit test mode */
 #if SSF_CONFIG_BFIFO_UNIT_TEST == 1 || \
@@ -132,7 +133,8 @@ typedef uint64_t SSFPortTick_t;
     SSF_CONFIG_AES_UNIT_TEST == 1 || \
     SSF_CONFIG_AESGCM_UNIT_TEST == 1 || \
     SSF_CONFIG_CFG_UNIT_TEST == 1 || \
-    SSF_CONFIG_PRNG_UNIT_TEST == 1
+    SSF_CONFIG_PRNG_UNIT_TEST == 1 || \
+    SSF_CONFIG_CBOR_UNIT_TEST == 1
 #define SSF_CONFIG_UNIT_TEST (1u)
 #else
 #define SSF_CONFIG_UNIT_TEST (0u)
@@ -165,12 +167,67 @@ typedef uint64_t SSFPortTick_t;
 /* --------------------------------------------------------------------------------------------- */
 #define SSF_MPOOL_DEBUG (0u)
 
+/* --------------------------------------------------------------------------------------------- */
+/* Configure ssfbase64 interface                                                                 */
+/* --------------------------------------------------------------------------------------------- */
+/* Select how SSFBase64Decode() decodes runs of plain chars: 0 a quad at a time using a lookup */
+/* table (MCUs), 1 SSSE3 16 chars at a time, 2 AArch64 NEON 64 chars at a time. */
+#define SSF_BASE64_CONFIG_DECODE (0u)
+
+/* Select how SSFBase64Encode() encodes runs of bytes: 0 3 bytes at a time using the alphabet */
+/* (MCUs), 1 SSSE3 12 bytes at a time, 2 AArch64 NEON 48 bytes at a time. */
+#define SSF_BASE64_CONFIG_ENCODE (0u)
+
+/* Enable interface that encodes and decodes Base64 in chunks, carrying partial blocks. */
+#define SSF_BASE64_CONFIG_ENABLE_STREAM (1u)
+#if SSF_BASE64_CONFIG_DECODE > 2
+#error SSFBASE64 invalid SSF_BASE64_CONFIG_DECODE.
+#endif
+#if (SSF_BASE64_CONFIG_DECODE == 1) && !defined(__SSSE3__)
+#error SSFBASE64 SSF_BASE64_CONFIG_DECODE SSSE3 not supported by target.
+#endif
+#if (SSF_BASE64_CONFIG_DECODE == 2) && !(defined(__ARM_NEON) && defined(__aarch64__))
+#error SSFBASE64 SSF_BASE64_CONFIG_DECODE NEON not supported by target.
+#endif
+#if SSF_BASE64_CONFIG_ENCODE > 2
+#error SSFBASE64 invalid SSF_BASE64_CONFIG_ENCODE.
+#endif
+#if (SSF_BASE64_CONFIG_ENCODE == 1) && !defined(__SSSE3__)
+#error SSFBASE64 SSF_BASE64_CONFIG_ENCODE SSSE3 not supported by target.
+#endif
+#if (SSF_BASE64_CONFIG_ENCODE == 2) && !(defined(__ARM_NEON) && defined(__aarch64__))
+#error SSFBASE64 SSF_BASE64_CONFIG_ENCODE NEON not supported by target.
+#endif
+
+/* --------------------------------------------------------------------------------------------- */
+/* Configure ssfhex interface                                                                    */
+/* --------------------------------------------------------------------------------------------- */
+/* Select how SSFHexBytesToBin() and SSFHexBinToBytes() convert runs of bytes: 0 a byte at a */
+/* time using lookup tables (MCUs), 1 SWAR 8 bytes per pair of 64-bit words, 2 SSSE3 16 bytes */
+/* at a time, 3 AArch64 NEON 16 bytes at a time. */
+#define SSF_HEX_CONFIG_CODEC (1u)
+
+/* Enable interface that encodes and decodes hex in chunks, with optional group separators. */
+#define SSF_HEX_CONFIG_ENABLE_STREAM (1u)
+#if SSF_HEX_CONFIG_CODEC > 3
+#error SSFHEX invalid SSF_HEX_CONFIG_CODEC.
+#endif
+#if (SSF_HEX_CONFIG_CODEC == 2) && !defined(__SSSE3__)
+#error SSFHEX SSF_HEX_CONFIG_CODEC SSSE3 not supported by target.
+#endif
+#if (SSF_HEX_CONFIG_CODEC == 3) && !(defined(__ARM_NEON) && defined(__aarch64__))
+#error SSFHEX SSF_HEX_CONFIG_CODEC NEON not supported by target.
+#endif
+
 /* --------------------------------------------------------------------------------------------- */
 /* Configure ssfjson's parser limits                                                             */
 /* --------------------------------------------------------------------------------------------- */
 /* Define the maximum parse depth, each opening { or [ starts a new depth level. */
 #define SSF_JSON_CONFIG_MAX_IN_DEPTH (4u)
 
+/* Define the maximum nesting of any value the parser walks over, 1 bit of stack per level. */
+#define SSF_JSON_CONFIG_MAX_WALK_DEPTH (32u)
+
 /* Define the maximum JSON string length to be parsed. */
 #define SSF_JSON_CONFIG_MAX_IN_LEN  (2047u)
 
@@ -183,6 +240,54 @@ typedef uint64_t SSFPortTick_t;
 /* Enable interface that can update specific fields in a JSON string. */
 #define SSF_JSON_CONFIG_ENABLE_UPDATE (1u)
 
+/* Enable interface that indexes a JSON string once into a token tape for repeated lookups. */
+#define SSF_JSON_CONFIG_ENABLE_INDEX (1u)
+
+/* Enable interface that iterates over the members of an object or elements of an array. */
+#define SSF_JSON_CONFIG_ENABLE_ITER (1u)
+
+/* Enable interface that parses a JSON string incrementally as chunks of it arrive. */
+#define SSF_JSON_CONFIG_ENABLE_STREAM (1u)
+
+/* Define the maximum lengths of key and value tokens delivered by the streaming parser, */
+/* string values that are longer are delivered in parts. */
+#define SSF_JSON_CONFIG_STREAM_MAX_KEY_LEN (63u)
+#define SSF_JSON_CONFIG_STREAM_MAX_VAL_LEN (255u)
+
+/* Enable interface that generates a JSON string through a BFifo or a flush callback. */
+#define SSF_JSON_CONFIG_ENABLE_GEN (1u)
+
+/* Define the maximum nesting depth of objects and arrays emitted by the streaming generator. */
+#define SSF_JSON_CONFIG_GEN_MAX_DEPTH (16u)
+
+/* Enable interface that strips whitespace from a JSON string, and with ITER sorts object keys. */
+#define SSF_JSON_CONFIG_ENABLE_MINIFY (1u)
+
+/* Enable interface that decodes and prints C structs described by an X-macro schema. */
+#define SSF_JSON_CONFIG_ENABLE_SCHEMA (1u)
+
+/* Define the maximum number of fields in one schema, up to 127. */
+#define SSF_JSON_CONFIG_SCHEMA_MAX_FIELDS (32u)
+
+/* Select how the parser skips whitespace and scans string bodies: 0 a byte at a time (MCUs), */
+/* 1 SWAR 8 bytes per 64-bit word, 2 SSE2 16 bytes at a time, 3 AArch64 NEON 16 bytes at a time. */
+#define SSF_JSON_CONFIG_SCAN (1u)
+#if SSF_JSON_CONFIG_MAX_WALK_DEPTH < SSF_JSON_CONFIG_MAX_IN_DEPTH
+#error SSFJSON SSF_JSON_CONFIG_MAX_WALK_DEPTH must be >= SSF_JSON_CONFIG_MAX_IN_DEPTH.
+#endif
+#if SSF_JSON_CONFIG_STREAM_MAX_VAL_LEN < 6
+#error SSFJSON SSF_JSON_CONFIG_STREAM_MAX_VAL_LEN must be at least 6 to hold an escape.
+#endif
+#if SSF_JSON_CONFIG_SCAN > 3
+#error SSFJSON invalid SSF_JSON_CONFIG_SCAN.
+#endif
+#if (SSF_JSON_CONFIG_SCAN == 2) && !defined(__SSE2__)
+#error SSFJSON SSF_JSON_CONFIG_SCAN SSE2 not supported by target.
+#endif
+#if (SSF_JSON_CONFIG_SCAN == 3) && !(defined(__ARM_NEON) && defined(__aarch64__))
+#error SSFJSON SSF_JSON_CONFIG_SCAN NEON not supported by target.
+#endif
+
 /* --------------------------------------------------------------------------------------------- */
 /* Configure ssfsm's state machine interface                                                     */
 /* --------------------------------------------------------------------------------------------- */
@@ -372,6 +477,36 @@ enum SSFSMEventList
 /* 0 allows 2^30 unique TAGs and VALUE fields < 2^30 bytes in length */
 #define SSF_TLV_ENABLE_FIXED_MODE (0u)
 
+/* --------------------------------------------------------------------------------------------- */
+/* Configure ssfcbor interface                                                                   */
+/* --------------------------------------------------------------------------------------------- */
+/* Maximum nesting depth of arrays and maps */
+#define SSF_CBOR_CONFIG_MAX_IN_DEPTH (8u)
+
+/* 1 to enable float and double support, else 0 */
+#define SSF_CBOR_CONFIG_ENABLE_FLOAT (1u)
+
+/* 1 to enable SSFCborFromJson() and SSFCborToJson(), needs SSF_JSON_CONFIG_ENABLE_ITER, else 0 */
+#define SSF_CBOR_CONFIG_ENABLE_JSON (1u)
+
+/* --------------------------------------------------------------------------------------------- */
+/* Configure ssfaes interface                                                                    */
+/* --------------------------------------------------------------------------------------------- */
+/* Select the AES block cipher: 0 compact byte-wise rounds (MCUs with little flash), 1 T-table */
+/* rounds on 32-bit columns using 2 KiB more of lookup tables. Neither is constant time. */
+#define SSF_AES_CONFIG_CIPHER (0u)
+
+/* Enable AES-NI block cipher, key expansion and CTR on x86 targets when CPUID reports support, */
+/* else SSF_AES_CONFIG_CIPHER is used. Needs no compiler flags. Ignored on other targets. */
+#define SSF_AES_CONFIG_ENABLE_AESNI (1u)
+
+/* Enable constant time bitsliced AES, 4 blocks per pass, for all context encryption and so */
+/* AES-GCM when AES-NI is not used. Contexts then hold about 1 KiB more for round keys. */
+#define SSF_AES_CONFIG_ENABLE_BITSLICE (0u)
+#if SSF_AES_CONFIG_CIPHER > 1
+#error SSFAES invalid SSF_AES_CONFIG_CIPHER.
+#endif
+
 /* --------------------------------------------------------------------------------------------- */
 /* Configure ssfcfg interface                                                                    */
 /* --------------------------------------------------------------------------------------------- */
@@ -50,7 +50,7 @@ void SSFPRNGInitContext(SSFPRNGContext_t *context, const uint8_t *entropy, size_
 	SSF_REQUIRE(entropy != NULL);
 	SSF_REQUIRE(entropyLen == SSF_PRNG_ENTROPY_SIZE);
 
-	memcpy(context->entropy, entropy, SSF_PRNG_ENTROPY_SIZE);
+	SSFAESInitContext(&context->aes, entropy, SSF_PRNG_ENTROPY_SIZE);
 	memcpy(&context->count, entropy, sizeof(uint64_t));
 	context->count = (~context->count) + 1;
 	context->magic = SSF_PRNG_MAGIC;
@@ -74,8 +74,8 @@ void SSFPRNGGetRandom(SSFPRNGContext_t *context, uint8_t *random, size_t randomS
 	memcpy(&pt[SSF_AES_BLOCK_SIZE >> 1], &context->count, sizeof(uint64_t));
 	context->count++;
 
-	/* Generate next 16 bytes of random numbers from entropy */
-	SSFAES128BlockEncrypt(pt, sizeof(pt), ct, sizeof(ct), context->entropy, SSF_PRNG_ENTROPY_SIZE);
+	/* Generate next 16 bytes of random numbers from the entropy's key schedule */
+	SSFAESContextBlockEncrypt(&context->aes, pt, sizeof(pt), ct, sizeof(ct));
 
 	/* Copy requested number of random numbers to user buffer */
 	memcpy(random, ct, randomSize);
@@ -46,7 +46,7 @@ extern "C" {
 
 typedef struct
 {
-	uint8_t entropy[SSF_PRNG_ENTROPY_SIZE];
+	SSFAESContext_t aes;
 	uint64_t count;
 	uint32_t magic;
 } SSFPRNGContext_t;
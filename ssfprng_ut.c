@@ -67,4 +67,18 @@ void SSFPRNGUnitTest(void)
         SSFPRNGGetRandom(&context, random, i);
         SSF_ASSERT((lastCount + 1) == context.count);
     }
+
+    /* Random numbers are AES-128 of the count under the entropy key */
+    SSFPRNGInitContext(&context, entropy, sizeof(entropy));
+    for (i = 0; i < 100; i++)
+    {
+        uint8_t pt[SSF_AES_BLOCK_SIZE];
+        uint8_t ct[SSF_AES_BLOCK_SIZE];
+
+        memcpy(pt, &context.count, sizeof(uint64_t));
+        memcpy(&pt[SSF_AES_BLOCK_SIZE >> 1], &context.count, sizeof(uint64_t));
+        SSFAES128BlockEncrypt(pt, sizeof(pt), ct, sizeof(ct), entropy, sizeof(entropy));
+        SSFPRNGGetRandom(&context, random, sizeof(random));
+        SSF_ASSERT(memcmp(random, ct, sizeof(ct)) == 0);
+    }
 }